@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+namespace {
+
+using clock_type = std::chrono::high_resolution_clock;
+
+/**
+ * UV sphere with a seam at the first meridian and a vertex per segment at the poles, as created by
+ * the sphere builder.
+ */
+void CreateSphere(size_t segments, BABYLON::Float32Array& positions,
+                  BABYLON::IndicesArray& indices)
+{
+  const auto pi        = std::acos(-1.f);
+  const auto rings     = static_cast<uint32_t>(segments);
+  const auto meridians = static_cast<uint32_t>(2 * segments);
+  const auto rowSize   = meridians + 1;
+  for (uint32_t ring = 0; ring <= rings; ++ring) {
+    const auto theta = pi * static_cast<float>(ring) / static_cast<float>(rings);
+    for (uint32_t meridian = 0; meridian <= meridians; ++meridian) {
+      const auto phi = 2.f * pi * static_cast<float>(meridian % meridians)
+                       / static_cast<float>(meridians);
+      positions.insert(positions.end(), {std::sin(theta) * std::cos(phi), std::cos(theta),
+                                         std::sin(theta) * std::sin(phi)});
+    }
+  }
+  for (uint32_t ring = 0; ring < rings; ++ring) {
+    for (uint32_t meridian = 0; meridian < meridians; ++meridian) {
+      const auto i = ring * rowSize + meridian;
+      indices.insert(indices.end(), {i, i + 1, i + rowSize + 1, i, i + rowSize + 1, i + rowSize});
+    }
+  }
+}
+
+double Milliseconds(const clock_type::time_point& start)
+{
+  return std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkQuadraticErrorSimplification, Sphere)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateSphere(256, positions, indices);
+
+  const std::vector<float> qualities{1.f, 0.5f, 0.25f, 0.1f, 0.01f};
+  std::cout << "Sphere of " << indices.size() / 3 << " triangles" << std::endl;
+  std::cout << std::setw(10) << "quality" << std::setw(12) << "triangles" << std::setw(12)
+            << "time (ms)" << std::setw(12) << "error" << std::endl;
+
+  // One level after the other
+  const auto start = clock_type::now();
+  for (auto quality : qualities) {
+    const auto levelStart = clock_type::now();
+    const auto result
+      = QuadraticErrorSimplification::SimplifyIndices(positions, indices, quality);
+    std::cout << std::setw(10) << quality << std::setw(12) << result.triangleCount
+              << std::setw(12) << Milliseconds(levelStart) << std::setw(12) << result.error
+              << std::endl;
+    EXPECT_LE(result.triangleCount,
+              static_cast<size_t>(std::ceil(quality * result.sourceTriangleCount)));
+  }
+  std::cout << "Sequential levels: " << Milliseconds(start) << " ms" << std::endl;
+
+  // All the levels on the thread pool, as with parallelProcessing
+  const auto parallelStart = clock_type::now();
+  ThreadPool::Default().parallelFor(0, qualities.size(), 1, [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      QuadraticErrorSimplification::SimplifyIndices(positions, indices, qualities[i]);
+    }
+  });
+  std::cout << "Parallel levels: " << Milliseconds(parallelStart) << " ms on "
+            << ThreadPool::Default().concurrency() << " threads" << std::endl;
+}
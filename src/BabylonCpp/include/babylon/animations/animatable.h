@@ -128,6 +128,34 @@ public:
    */
   bool _animate(const millisecond_t& delay);
 
+  /**
+   * @brief Hidden Internal use only. First step of _animate(): updates the delays of the
+   * animatable on the main thread.
+   * @returns true if the runtime animations have to be evaluated, false if the animatable is
+   * paused
+   */
+  bool _beginAnimate(const millisecond_t& delay);
+
+  /**
+   * @brief Hidden Internal use only. Second step of _animate(): evaluates the runtime animations
+   * without touching the targets. Can be called from a worker thread if _canEvaluateInParallel()
+   * returns true.
+   */
+  void _evaluateRuntimeAnimations(const millisecond_t& delay);
+
+  /**
+   * @brief Hidden Internal use only. Last step of _animate(): applies the evaluated values to the
+   * targets on the main thread.
+   * @returns true if the animatable is still running
+   */
+  bool _endAnimate();
+
+  /**
+   * @brief Hidden Internal use only. Returns true if all the runtime animations can be evaluated
+   * on a worker thread. It also brings the compiled keys of the animations up to date.
+   */
+  bool _canEvaluateInParallel();
+
 protected:
   /**
    * @brief Creates a new Animatable.     * @param scene defines the hosting
@@ -205,6 +233,11 @@ public:
    */
   bool animationStarted;
 
+  /**
+   * Hidden Number of frames skipped by the animation LOD policy since the last update
+   */
+  size_t _animationLODSkippedFrames;
+
   /**
    * Defines the starting frame number (default is 0)
    */
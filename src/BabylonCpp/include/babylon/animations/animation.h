@@ -17,6 +17,7 @@ namespace BABYLON {
 struct _IAnimationState;
 class Animatable;
 class Animation;
+class CompiledAnimationTrack;
 class IAnimatable;
 struct IAnimationKey;
 struct IEasingFunction;
@@ -24,10 +25,11 @@ class Node;
 class RuntimeAnimation;
 class Scene;
 using AnimatablePtr       = std::shared_ptr<Animatable>;
-using AnimationPtr        = std::shared_ptr<Animation>;
-using IEasingFunctionPtr  = std::shared_ptr<IEasingFunction>;
-using NodePtr             = std::shared_ptr<Node>;
-using RuntimeAnimationPtr = std::shared_ptr<RuntimeAnimation>;
+using AnimationPtr              = std::shared_ptr<Animation>;
+using CompiledAnimationTrackPtr = std::unique_ptr<CompiledAnimationTrack>;
+using IEasingFunctionPtr        = std::shared_ptr<IEasingFunction>;
+using NodePtr                   = std::shared_ptr<Node>;
+using RuntimeAnimationPtr       = std::shared_ptr<RuntimeAnimation>;
 
 /**
  * @brief Class used to store any kind of animation.
@@ -310,10 +312,47 @@ public:
 
   /**
    * @brief Gets the key frames from the animation.
+   * Note: as the keys may be modified by the caller, they are compiled again on the next
+   * evaluation, the quantized key frames (see quantizeKeys) being decoded. Use getKeyCount(),
+   * getKeyFrame() and getKeyValue() to read them.
    * @returns The key frames of the animation
    */
   std::vector<IAnimationKey>& getKeys();
 
+  /**
+   * @brief Gets the number of key frames of the animation.
+   */
+  [[nodiscard]] size_t getKeyCount() const;
+
+  /**
+   * @brief Gets the frame of a key frame, without decoding the quantized key frames.
+   */
+  [[nodiscard]] float getKeyFrame(size_t index) const;
+
+  /**
+   * @brief Gets the value of a key frame, without decoding the quantized key frames.
+   */
+  [[nodiscard]] AnimationValue getKeyValue(size_t index) const;
+
+  /**
+   * @brief Hidden Internal use only. Returns true if the key frames are only stored quantized, in
+   * the compiled key frames.
+   */
+  [[nodiscard]] bool _hasQuantizedKeys() const;
+
+  /**
+   * @brief Hidden Internal use only. Flags the key frames as modified, so that they are compiled
+   * again on the next evaluation.
+   */
+  void _markKeysAsDirty();
+
+  /**
+   * @brief Hidden Internal use only. Returns the compiled key frames of the animation, compiling
+   * them if needed, or nullptr if they cannot be compiled or compileKeys is disabled. This
+   * function is not thread-safe.
+   */
+  CompiledAnimationTrack* _getCompiledTrack();
+
   /**
    * @brief Gets the highest frame rate of the animation.
    * @returns Highest frame rate of the animation
@@ -544,6 +583,37 @@ private:
    */
   [[nodiscard]] bool get_hasRunningRuntimeAnimations() const;
 
+  /**
+   * @brief Gets whether the key frames are compiled to typed arrays.
+   */
+  [[nodiscard]] bool get_compileKeys() const;
+
+  /**
+   * @brief Sets whether the key frames are compiled to typed arrays.
+   */
+  void set_compileKeys(bool value);
+
+  /**
+   * @brief Gets whether the compiled key frames store their values quantized.
+   */
+  [[nodiscard]] bool get_quantizeKeys() const;
+
+  /**
+   * @brief Sets whether the compiled key frames store their values quantized.
+   */
+  void set_quantizeKeys(bool value);
+
+  /**
+   * @brief Interpolates the value at the given frame using the compiled key frames.
+   */
+  AnimationValue _interpolateCompiled(const CompiledAnimationTrack& track, float currentFrame,
+                                      _IAnimationState& state);
+
+  /**
+   * @brief Decodes the quantized key frames.
+   */
+  [[nodiscard]] std::vector<IAnimationKey> _decodeKeys() const;
+
 private:
   /**
    * Use matrix interpolation instead of using direct key value when animating
@@ -609,12 +679,36 @@ public:
    */
   ReadOnlyProperty<Animation, bool> hasRunningRuntimeAnimations;
 
+  /**
+   * Specifies if the key frames are compiled to typed arrays (see CompiledAnimationTrack) and
+   * evaluated from them, which is the default. When disabled, the key frames are evaluated as they
+   * are stored, the quantized key frames being decoded and quantizeKeys being ignored
+   */
+  Property<Animation, bool> compileKeys;
+
+  /**
+   * Specifies if the compiled key frames store their values as 16 bits integers (see
+   * CompiledAnimationTrack::quantize). The key frames are then only stored quantized, and
+   * evaluated from the quantized values
+   */
+  Property<Animation, bool> quantizeKeys;
+
 private:
   /**
    * Stores the key frames of the animation
    */
   std::vector<IAnimationKey> _keys;
 
+  /**
+   * Stores the key frames compiled to typed arrays, lazily created
+   */
+  CompiledAnimationTrackPtr _compiledTrack;
+  bool _compiledTrackIsDirty;
+  bool _compileKeys;
+  bool _quantizeKeys;
+  // The key frames are released once quantized, the compiled key frames holding them
+  bool _keysAreQuantized;
+
   /**
    * Stores the easing function of the animation
    */
@@ -0,0 +1,94 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_KEY_COMPRESSION_H
+#define BABYLON_ANIMATIONS_ANIMATION_KEY_COMPRESSION_H
+
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class Animation;
+class AnimationGroup;
+
+/**
+ * @brief Options of the key frames compression.
+ */
+struct BABYLON_SHARED_EXPORT AnimationKeyCompressionOptions {
+  /**
+   * Maximum difference allowed on a component of a float, vector or color value when removing a
+   * key
+   */
+  float tolerance = 1e-3f;
+  /**
+   * Maximum difference allowed on a component of a quaternion value when removing a key
+   */
+  float quaternionTolerance = 1e-4f;
+  /**
+   * Specifies if the remaining keys are quantized (see Animation::quantizeKeys)
+   */
+  bool quantize = true;
+}; // end of struct AnimationKeyCompressionOptions
+
+/**
+ * @brief Result of the key frames compression of an animation or of an animation group.
+ */
+struct BABYLON_SHARED_EXPORT AnimationKeyCompressionReport {
+  /** Number of compressed animations */
+  size_t animationCount = 0;
+  /** Number of key frames before the compression */
+  size_t originalKeyCount = 0;
+  /** Number of key frames after the compression */
+  size_t keyCount = 0;
+  /** Number of bytes used by the key frames before the compression */
+  size_t originalMemorySize = 0;
+  /** Number of bytes used by the key frames (or the quantized key frames) after the compression */
+  size_t memorySize = 0;
+  /** Largest difference on a component between the original and the compressed key frames */
+  float maxError = 0.f;
+
+  /**
+   * @brief Returns the number of bytes saved by the compression.
+   */
+  [[nodiscard]] size_t savedMemorySize() const;
+
+  /**
+   * @brief Adds the results of another compression.
+   */
+  void merge(const AnimationKeyCompressionReport& other);
+}; // end of struct AnimationKeyCompressionReport
+
+/**
+ * @brief Removes the redundant key frames of animations and quantizes the remaining ones.
+ *
+ * A key is removed when interpolating its neighbours gives its value within the tolerance of the
+ * options, for all the keys removed in between; the keys using tangents or a STEP interpolation
+ * are kept. The error reported is measured by evaluating the compressed animation at the frames of
+ * the original keys. Meant to be used after importing dense (baked) animations, e.g. from glTF.
+ */
+struct BABYLON_SHARED_EXPORT AnimationKeyCompression {
+
+  /**
+   * @brief Compresses the key frames of an animation. Matrix animations and animations which
+   * cannot be compiled (see CompiledAnimationTrack) are left unchanged.
+   * @param animation the animation to compress
+   * @param options the compression options
+   * @returns the compression report
+   */
+  static AnimationKeyCompressionReport
+  CompressAnimation(Animation& animation, const AnimationKeyCompressionOptions& options = {});
+
+  /**
+   * @brief Compresses the key frames of the animations of an animation group.
+   * @param animationGroup the animation group to compress
+   * @param options the compression options
+   * @returns the compression report of the group
+   */
+  static AnimationKeyCompressionReport
+  CompressAnimationGroup(AnimationGroup& animationGroup,
+                         const AnimationKeyCompressionOptions& options = {});
+
+}; // end of struct AnimationKeyCompression
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_KEY_COMPRESSION_H
@@ -0,0 +1,91 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_LOD_POLICY_H
+#define BABYLON_ANIMATIONS_ANIMATION_LOD_POLICY_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Animatable;
+class Camera;
+class Scene;
+class Skeleton;
+
+/**
+ * @brief Defines how often the animatables are updated depending on the visibility and the screen
+ * size of the meshes they animate (see Scene::animationLODPolicy).
+ *
+ * The animations are evaluated from the time elapsed since they started, so an animatable updated
+ * after skipped frames directly gets the value of the current time and raises the events whose
+ * frame was passed in the meantime. Animatables whose target is not a mesh, a transform node, a
+ * bone or a skeleton are always updated.
+ */
+class BABYLON_SHARED_EXPORT AnimationLODPolicy {
+
+public:
+  AnimationLODPolicy();
+  ~AnimationLODPolicy(); // = default
+
+  /**
+   * @brief Hidden Called once per animation step, before the animatables are updated.
+   */
+  void _beginFrame(Scene* scene);
+
+  /**
+   * @brief Hidden Returns true if the animatable must not be updated during the current frame.
+   */
+  bool _skip(Animatable& animatable);
+
+private:
+  /**
+   * @brief Returns the number of frames between two updates of the animatable.
+   */
+  size_t _getUpdateInterval(const Animatable& animatable);
+
+  /**
+   * @brief Collects the meshes animated by an animatable.
+   */
+  void _collectTargetMeshes(const Animatable& animatable, std::vector<AbstractMesh*>& meshes);
+
+public:
+  /**
+   * Specifies if the policy is applied (default is false)
+   */
+  bool enabled;
+
+  /**
+   * Number of frames between two updates of an animatable whose meshes were not active during the
+   * last frame, 0 to pause it until one of its meshes becomes active (default is 30)
+   */
+  size_t offscreenUpdateInterval;
+
+  /**
+   * Ratio between the projected diameter of the meshes and the height of the screen below which an
+   * animatable is considered distant, the field of view of the camera being converted to a vertical
+   * one when it is horizontally fixed (default is 0.1)
+   */
+  float distantScreenCoverage;
+
+  /**
+   * Number of frames between two updates of a distant animatable (default is 4)
+   */
+  size_t distantUpdateInterval;
+
+private:
+  Scene* _scene;
+  Camera* _camera;
+  float _tanHalfVerticalFov;
+  int _frameRenderId;
+  int _lastFrameRenderId;
+  std::unordered_map<const Skeleton*, std::vector<AbstractMesh*>> _skeletonMeshes;
+  std::vector<AbstractMesh*> _targetMeshes;
+
+}; // end of class AnimationLODPolicy
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_LOD_POLICY_H
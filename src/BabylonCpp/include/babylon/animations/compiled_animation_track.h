@@ -0,0 +1,187 @@
+#ifndef BABYLON_ANIMATIONS_COMPILED_ANIMATION_TRACK_H
+#define BABYLON_ANIMATIONS_COMPILED_ANIMATION_TRACK_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/matrix.h>
+
+namespace BABYLON {
+
+class AnimationValue;
+class CompiledAnimationTrack;
+struct IAnimationKey;
+using CompiledAnimationTrackPtr = std::unique_ptr<CompiledAnimationTrack>;
+
+/**
+ * @brief Key frames of an animation compiled to contiguous, typed arrays.
+ *
+ * The frames are stored in their own array and the values (and tangents) as packed floats, so
+ * that finding the keys surrounding a frame is a binary search (or, using a cursor kept between
+ * two evaluations, a constant time probe) and interpolating is a small loop on floats, without
+ * going through AnimationValue. Float, Vector2, Vector3, Quaternion, Color3, Color4 and Matrix
+ * animations can be compiled.
+ *
+ * The values can also be stored quantized (see quantize()), in which case they are decoded when
+ * evaluated.
+ */
+class BABYLON_SHARED_EXPORT CompiledAnimationTrack {
+
+public:
+  /**
+   * Maximum number of floats of a compiled value
+   */
+  static constexpr size_t MaxStride = 4;
+
+  using Value = std::array<float, MaxStride>;
+
+  /**
+   * @brief Compiles the key frames of an animation.
+   * @param dataType the data type of the animation
+   * @param keys the key frames of the animation
+   * @returns the compiled track or nullptr if the data type is not supported, if a key does not
+   * hold a value of the data type or if the keys are not sorted by frame
+   */
+  static CompiledAnimationTrackPtr Compile(unsigned int dataType,
+                                           const std::vector<IAnimationKey>& keys);
+
+  /**
+   * @brief Returns true if the given key is a STEP key (the value of the key is kept up to the
+   * next key).
+   */
+  static bool IsStepKey(const IAnimationKey& key);
+
+public:
+  ~CompiledAnimationTrack(); // = default
+
+  /**
+   * @brief Stores the values as 16 bits integers. Quaternions are encoded with the smallest three
+   * method (the largest component is dropped and recomputed), the other types relative to the
+   * range of each component. Quaternion tracks using tangents are encoded like the other types to
+   * keep the sign of the values. The tangents and the matrices are not quantized.
+   * @returns true if the values are quantized
+   */
+  bool quantize();
+
+  /**
+   * @brief Returns true if the values are stored quantized.
+   */
+  [[nodiscard]] bool isQuantized() const;
+
+  /**
+   * @brief Returns the number of bytes used by the compiled key frames.
+   */
+  [[nodiscard]] size_t memorySize() const;
+
+  /**
+   * @brief Returns the data type of the compiled animation.
+   */
+  [[nodiscard]] unsigned int dataType() const;
+
+  /**
+   * @brief Returns the number of key frames.
+   */
+  [[nodiscard]] size_t keyCount() const;
+
+  /**
+   * @brief Finds the keys surrounding a frame.
+   * @param frame the frame to evaluate
+   * @param cursor the index of the segment found by the previous call, updated with the index of
+   * the segment found
+   * @returns the index of the segment (the start key) containing the frame, 0 if the frame is
+   * before the first key, or -1 if it is after the last key
+   */
+  int findSegment(float frame, int& cursor) const;
+
+  /**
+   * @brief Returns true if the start key of the given segment is a STEP key.
+   */
+  [[nodiscard]] bool isStep(size_t segment) const;
+
+  /**
+   * @brief Evaluates the track at the given frame (not available for matrices).
+   * @param frame the frame to evaluate
+   * @param cursor the index of the segment found by the previous call (see findSegment)
+   * @returns the value at the frame, the value of the last key after the last key
+   */
+  [[nodiscard]] Value evaluate(float frame, int& cursor) const;
+
+  /**
+   * @brief Returns the position of a frame in a segment (0 at the start key, 1 at the end key).
+   */
+  [[nodiscard]] float gradient(size_t segment, float frame) const;
+
+  /**
+   * @brief Interpolates the value of a segment (not available for matrices).
+   * @param segment the index of the segment
+   * @param gradient the position in the segment
+   * @param result receives the interpolated value
+   */
+  void interpolate(size_t segment, float gradient, Value& result) const;
+
+  /**
+   * @brief Returns the frame of a key.
+   */
+  [[nodiscard]] float keyFrame(size_t key) const;
+
+  /**
+   * @brief Returns the value of a key (not available for matrices).
+   */
+  [[nodiscard]] Value keyValue(size_t key) const;
+
+  /**
+   * @brief Returns the value of a key of a matrix animation.
+   */
+  [[nodiscard]] const Matrix& keyMatrix(size_t key) const;
+
+  /**
+   * @brief Creates an AnimationValue of the data type of the track from a compiled value.
+   */
+  [[nodiscard]] AnimationValue toAnimationValue(const Value& value) const;
+
+  /**
+   * @brief Converts an AnimationValue of the data type of the track to a compiled value.
+   */
+  [[nodiscard]] Value fromAnimationValue(const AnimationValue& value) const;
+
+  /**
+   * @brief Decodes a key: its frame, its value, its tangents and its STEP interpolation.
+   */
+  [[nodiscard]] IAnimationKey toAnimationKey(size_t key) const;
+
+private:
+  CompiledAnimationTrack(unsigned int dataType, size_t stride);
+
+  /**
+   * @brief Returns the values of a key, decoded in the given buffer if they are quantized.
+   */
+  const float* _getKeyValues(size_t key, Value& buffer) const;
+
+  static constexpr uint8_t InTangentFlag  = 1;
+  static constexpr uint8_t OutTangentFlag = 2;
+  static constexpr uint8_t StepFlag       = 4;
+
+private:
+  unsigned int _dataType;
+  size_t _stride;
+  std::vector<float> _frames;
+  std::vector<float> _values;
+  std::vector<float> _inTangents;
+  std::vector<float> _outTangents;
+  std::vector<uint8_t> _flags;
+  std::vector<Matrix> _matrices;
+  // Quantized values (stride, or 3 for the smallest three encoding, integers per key)
+  bool _quantized;
+  bool _smallestThree;
+  Value _quantizationOffset;
+  Value _quantizationScale;
+  std::vector<uint16_t> _quantizedValues;
+
+}; // end of class CompiledAnimationTrack
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_COMPILED_ANIMATION_TRACK_H
@@ -14,7 +14,6 @@ class Animatable;
 class Animation;
 class AnimationEvent;
 class IAnimatable;
-struct IAnimationKey;
 class RuntimeAnimation;
 class Scene;
 using AnimationPtr        = std::shared_ptr<Animation>;
@@ -102,6 +101,29 @@ public:
   bool animate(millisecond_t delay, float from, float to, bool loop, float speedRatio,
                float weight = -1.f);
 
+  /**
+   * @brief Hidden Internal use only. Computes the value of the animation at the given time
+   * without touching the target, first step of animate(). Only the state of the runtime animation
+   * is modified, so runtime animations can be evaluated in parallel provided that
+   * _canEvaluateInParallel() returns true and that the compiled keys of the animation are up to
+   * date (see Animation::_getCompiledTrack).
+   */
+  void _evaluate(millisecond_t delay, float from, float to, bool loop, float speedRatio);
+
+  /**
+   * @brief Hidden Internal use only. Sets the value computed by _evaluate() to the target and
+   * raises the loop and animation events, second step of animate(). Main thread only.
+   * @param weight defines the weight of the animation (default is -1 so no weight)
+   * @returns a boolean indicating if the animation is running
+   */
+  bool _apply(float weight = -1.f);
+
+  /**
+   * @brief Hidden Internal use only. Returns false if the evaluation depends on other runtime
+   * animations (synchronized animatable) or uses shared temporaries (matrix decomposition).
+   */
+  [[nodiscard]] bool _canEvaluateInParallel() const;
+
 protected:
   /**
    * @brief Create a new RuntimeAnimation object.
@@ -181,8 +203,25 @@ public:
   std::function<void()> _onLoop;
 
 private:
+  /**
+   * Result of _evaluate(), consumed by _apply()
+   */
+  struct _EvaluatedFrame {
+    AnimationValue value;
+    float from     = 0.f;
+    float range    = 0.f;
+    bool hasValue  = false;
+    bool hasLooped = false;
+    bool isRunning = false;
+  }; // end of struct _EvaluatedFrame
+
   std::vector<AnimationEvent> _events;
 
+  /**
+   * The frame computed by the last evaluation
+   */
+  _EvaluatedFrame _evaluatedFrame;
+
   /**
    * The current frame of the runtime animation
    */
@@ -277,7 +316,6 @@ private:
 
   bool _enableBlending;
 
-  std::vector<IAnimationKey> _keys;
   float _minFrame;
   float _maxFrame;
   float _minValue;
@@ -63,6 +63,12 @@ BABYLON_SHARED_EXPORT void Service_Stop();
 BABYLON_SHARED_EXPORT void push_HACK_DISABLE_ASYNC();
 BABYLON_SHARED_EXPORT void pop_HACK_DISABLE_ASYNC();
 
+/**
+ * @brief IsAsyncDisabled: returns true while push_HACK_DISABLE_ASYNC is in effect, i.e. when the
+ * callbacks are expected to be raised synchronously
+ */
+BABYLON_SHARED_EXPORT bool IsAsyncDisabled();
+
 } // namespace asio
 } // namespace BABYLON
 
@@ -0,0 +1,172 @@
+#ifndef BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
+#define BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector4.h>
+
+namespace BABYLON {
+
+class BakedVertexAnimationManager;
+class BaseTexture;
+class Effect;
+class Scene;
+using BakedVertexAnimationManagerPtr = std::shared_ptr<BakedVertexAnimationManager>;
+using BaseTexturePtr                 = std::shared_ptr<BaseTexture>;
+using EffectPtr                      = std::shared_ptr<Effect>;
+
+/**
+ * @brief This class is used to animate meshes using a baked vertex animation texture (VAT).
+ *
+ * The texture stores the skinning matrices of every baked frame, one row per frame (see
+ * VertexAnimationBaker). The bones are then read from the texture in the vertex shader instead of
+ * being computed on the CPU, so crowds of instances can be animated for the cost of a texture
+ * fetch. Each instance can play its own range with its own offset and speed by registering the
+ * "bakedVertexAnimationSettingsInstanced" instanced buffer on the source mesh (stride 4).
+ * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+ */
+class BABYLON_SHARED_EXPORT BakedVertexAnimationManager {
+
+public:
+  /** Name of the per-instance settings attribute (start, end, offset, speed) */
+  static constexpr const char* SettingsInstancedKind = "bakedVertexAnimationSettingsInstanced";
+
+public:
+  template <typename... Ts>
+  static BakedVertexAnimationManagerPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<BakedVertexAnimationManager>(
+      new BakedVertexAnimationManager(std::forward<Ts>(args)...));
+  }
+  ~BakedVertexAnimationManager(); // = default
+
+  /**
+   * @brief Returns the string "BakedVertexAnimationManager".
+   * @returns "BakedVertexAnimationManager"
+   */
+  std::string getClassName() const;
+
+  /**
+   * @brief Gets the vertex animation texture.
+   */
+  BaseTexturePtr& texture();
+
+  /**
+   * @brief Sets the vertex animation texture.
+   */
+  void setTexture(const BaseTexturePtr& value);
+
+  /**
+   * @brief Gets whether the manager is enabled.
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Enables or disables the manager.
+   */
+  void setEnabled(bool value);
+
+  /**
+   * @brief Sets animation parameters.
+   * @param startFrame The first frame of the animation.
+   * @param endFrame The last frame of the animation.
+   * @param offset The offset when starting the animation.
+   * @param speedFramesPerSecond The frame rate.
+   */
+  void setAnimationParameters(float startFrame, float endFrame, float offset = 0.f,
+                              float speedFramesPerSecond = 30.f);
+
+  /**
+   * @brief Binds to the effect.
+   * @param effect The effect to bind to.
+   * @param useInstances True when it's an instance.
+   */
+  void bind(const EffectPtr& effect, bool useInstances = false);
+
+  /**
+   * @brief Clone the current manager.
+   * @returns a new BakedVertexAnimationManager
+   */
+  BakedVertexAnimationManagerPtr clone() const;
+
+  /**
+   * @brief Update the time for the animation.
+   * @param deltaTimeInSeconds Time since the last update, in seconds.
+   */
+  void _update(float deltaTimeInSeconds);
+
+  /**
+   * @brief Disposes the resources of the manager.
+   * @param forceDisposeTextures Forces the disposal of all textures.
+   */
+  void dispose(bool forceDisposeTextures = false);
+
+  /**
+   * @brief Adds the uniforms used by the manager to a list of uniforms.
+   * @param uniforms defines the list of uniforms
+   */
+  static void AddUniforms(std::vector<std::string>& uniforms);
+
+  /**
+   * @brief Adds the samplers used by the manager to a list of samplers.
+   * @param samplers defines the list of samplers
+   */
+  static void AddSamplers(std::vector<std::string>& samplers);
+
+  /**
+   * @brief Computes the baked frame read by the vertex shader for some animation settings (CPU
+   * reference of the shader code, used to validate baked data without a GPU).
+   * @param settings the animation settings (start frame, end frame, offset, speed)
+   * @param time the animation time, in seconds
+   * @returns the index of the row of the texture
+   */
+  static float ComputeFrame(const Vector4& settings, float time);
+
+  /**
+   * @brief Reads a bone matrix from baked vertex data (CPU reference of the shader code).
+   * @param vertexData the baked vertex data
+   * @param boneCount the number of bones of the skeleton
+   * @param frame the index of the baked frame
+   * @param boneIndex the index of the bone matrix
+   * @returns the matrix, identity when out of range
+   */
+  static Matrix ReadBoneMatrix(const Float32Array& vertexData, size_t boneCount, size_t frame,
+                               size_t boneIndex);
+
+protected:
+  /**
+   * @brief Creates a new BakedVertexAnimationManager.
+   * @param scene defines the current scene
+   */
+  BakedVertexAnimationManager(Scene* scene = nullptr);
+
+private:
+  void _markSubMeshesAsAttributesDirty();
+
+public:
+  /**
+   * The animation parameters for the mesh (start frame, end frame, offset, speed). See
+   * setAnimationParameters()
+   */
+  Vector4 animationParameters;
+
+  /**
+   * The time counter, to pick the correct animation frame.
+   */
+  float time;
+
+private:
+  Scene* _scene;
+  BaseTexturePtr _texture;
+  bool _isEnabled;
+
+}; // end of class BakedVertexAnimationManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
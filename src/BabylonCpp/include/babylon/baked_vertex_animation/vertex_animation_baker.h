@@ -0,0 +1,67 @@
+#ifndef BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
+#define BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class AnimationRange;
+class RawTexture;
+class Scene;
+using AbstractMeshPtr = std::shared_ptr<AbstractMesh>;
+using RawTexturePtr   = std::shared_ptr<RawTexture>;
+
+/**
+ * @brief Class to bake the vertex animation of a skinned mesh into a texture (VAT).
+ *
+ * Every frame of the requested animation ranges is sampled on the skeleton of the mesh and the
+ * resulting skinning matrices (bone count + 1 matrices, as returned by
+ * Skeleton::getTransformMatrices) are stored as one row of the texture. The texture is consumed by
+ * BakedVertexAnimationManager.
+ * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+ */
+class BABYLON_SHARED_EXPORT VertexAnimationBaker {
+
+public:
+  /**
+   * @brief Create a new VertexAnimationBaker object which can help baking animations into a
+   * texture.
+   * @param scene Defines the scene the VAT belongs to
+   * @param mesh Defines the mesh the VAT belongs to
+   */
+  VertexAnimationBaker(Scene* scene, const AbstractMeshPtr& mesh);
+  ~VertexAnimationBaker(); // = default
+
+  /**
+   * @brief Bakes the animation into the texture. This should be called once, when the scene
+   * starts, so the VAT is generated and associated to the mesh.
+   * @param ranges Defines the ranges in the animation that will be baked, in order
+   * @returns the raw vertex data (one row of (bone count + 1) matrices per frame), empty if the
+   * mesh has no skeleton
+   */
+  Float32Array bakeVertexData(const std::vector<AnimationRange>& ranges);
+
+  /**
+   * @brief Builds a vertex animation texture given the vertex data.
+   * @param vertexData The vertex animation data. You can generate it with bakeVertexData().
+   * @returns The vertex animation texture to be used with BakedVertexAnimationManager.
+   */
+  RawTexturePtr textureFromBakedVertexData(const Float32Array& vertexData);
+
+private:
+  size_t _boneCount() const;
+
+private:
+  Scene* _scene;
+  AbstractMeshPtr _mesh;
+
+}; // end of class VertexAnimationBaker
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
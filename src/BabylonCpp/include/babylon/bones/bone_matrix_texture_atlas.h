@@ -0,0 +1,110 @@
+#ifndef BABYLON_BONES_BONE_MATRIX_TEXTURE_ATLAS_H
+#define BABYLON_BONES_BONE_MATRIX_TEXTURE_ATLAS_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class RawTexture;
+class Scene;
+using RawTexturePtr = std::shared_ptr<RawTexture>;
+
+/**
+ * @brief Float texture shared by the skeletons of a scene to store their bone matrices.
+ *
+ * Each skeleton (or each mesh with a pose matrix) owns a row of the texture, a matrix using 4
+ * RGBA texels. Updating a row only uploads the texels which changed since the last update, and a
+ * single texture is bound for all the skinned meshes. The texture grows (and is uploaded again)
+ * when a row is allocated for more matrices than its width or when all its rows are used, up to the
+ * maximum texture size of the engine.
+ */
+class BABYLON_SHARED_EXPORT BoneMatrixTextureAtlas {
+
+public:
+  /** Minimum width of the texture, in texels */
+  static constexpr size_t MinWidth = 64;
+  /** Initial number of rows of the texture */
+  static constexpr size_t InitialRowCount = 4;
+
+  /**
+   * @brief Returns the atlas of a scene, creating it if needed.
+   */
+  static BoneMatrixTextureAtlas& ForScene(Scene* scene);
+
+public:
+  BoneMatrixTextureAtlas(Scene* scene);
+  ~BoneMatrixTextureAtlas(); // = default
+
+  /**
+   * @brief Allocates a row.
+   * @param matrixCount the number of matrices stored in the row
+   * @returns the index of the row, or nullopt if the texture would be larger than the maximum
+   * texture size of the engine
+   */
+  std::optional<size_t> allocate(size_t matrixCount);
+
+  /**
+   * @brief Releases a row allocated with allocate().
+   */
+  void release(size_t row);
+
+  /**
+   * @brief Updates the matrices of a row and uploads the texels which changed.
+   * @param row the index of the row
+   * @param matrices the matrices (16 floats per matrix), at most the number of matrices of the
+   * texture width
+   */
+  void update(size_t row, const Float32Array& matrices);
+
+  /**
+   * @brief Gets the texture (nullptr until a row is allocated).
+   */
+  RawTexturePtr& getTexture();
+
+  /**
+   * @brief Gets the width of the texture, in texels.
+   */
+  [[nodiscard]] size_t getWidth() const;
+
+  /**
+   * @brief Gets the number of rows of the texture.
+   */
+  [[nodiscard]] size_t getHeight() const;
+
+  /**
+   * @brief Gets the vertical texture coordinate of the center of a row.
+   */
+  [[nodiscard]] float getRowCoordinate(size_t row) const;
+
+  /**
+   * @brief Gets the number of texels uploaded by the updates since the creation of the atlas.
+   */
+  [[nodiscard]] size_t getUploadedTexelCount() const;
+
+  /**
+   * @brief Releases the texture and all the rows.
+   */
+  void dispose();
+
+private:
+  void _resize(size_t width, size_t height);
+
+private:
+  Scene* _scene;
+  size_t _width;
+  size_t _height;
+  Float32Array _data;
+  std::vector<bool> _usedRows;
+  RawTexturePtr _texture;
+  size_t _uploadedTexelCount;
+
+}; // end of class BoneMatrixTextureAtlas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_BONE_MATRIX_TEXTURE_ATLAS_H
@@ -0,0 +1,67 @@
+#ifndef BABYLON_BONES_BONE_MATRIX_TOOLS_H
+#define BABYLON_BONES_BONE_MATRIX_TOOLS_H
+
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Batch operations on the matrices of a skeleton stored as contiguous arrays of 16 floats
+ * (row-major, same layout as Matrix).
+ *
+ * The 4x4 products use SSE when the library is built with OPTION_ENABLE_SIMD. The operations are
+ * done in the same order as Matrix::multiplyToRef, so both paths give the same results. The SSE
+ * product is compiled on every SSE2 target, so that it can be checked against the scalar one.
+ */
+struct BABYLON_SHARED_EXPORT BoneMatrixTools {
+
+  /**
+   * @brief Multiplies two matrices (result = a * b). The result can alias the operands.
+   */
+  static void Multiply(const float* a, const float* b, float* result);
+
+  /**
+   * @brief Multiplies two matrices without SIMD instructions (result = a * b).
+   */
+  static void MultiplyScalar(const float* a, const float* b, float* result);
+
+  /**
+   * @brief Multiplies two matrices with SSE instructions (result = a * b).
+   * @returns false if the target does not support SSE2, the result being then left untouched
+   */
+  static bool MultiplySSE2(const float* a, const float* b, float* result);
+
+  /**
+   * @brief Computes the world matrices of bones in one pass, the parents being stored before
+   * their children.
+   * @param parentIndices the index of the parent of each bone, -1 for the root bones
+   * @param localMatrices the local matrices of the bones
+   * @param rootMatrix the matrix the root bones are multiplied with (initial skin matrix), or
+   * nullptr
+   * @param worldMatrices receives the world matrices of the bones
+   * @param boneCount the number of bones
+   */
+  static void ComputeWorldMatrices(const int* parentIndices, const float* localMatrices,
+                                   const float* rootMatrix, float* worldMatrices,
+                                   size_t boneCount);
+
+  /**
+   * @brief Computes the skinning matrices (inverse bind matrix * world matrix) of bones.
+   * @param matrixIndices the index of the matrix of each bone in the target array, -1 to skip
+   * the bone
+   * @param inverseBindMatrices the inverted absolute transforms of the bones
+   * @param worldMatrices the world matrices of the bones
+   * @param target receives the skinning matrices
+   * @param boneCount the number of bones
+   */
+  static void ComputeSkinningMatrices(const int* matrixIndices, const float* inverseBindMatrices,
+                                      const float* worldMatrices, float* target,
+                                      size_t boneCount);
+
+}; // end of struct BoneMatrixTools
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_BONE_MATRIX_TOOLS_H
@@ -7,6 +7,7 @@
 #include <babylon/animations/animation_range.h>
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
+#include <babylon/bones/skeleton_animation_clip.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/maths/matrix.h>
 #include <babylon/misc/iinspectable.h>
@@ -81,6 +82,19 @@ public:
    */
   RawTexturePtr& getTransformMatrixTexture(AbstractMesh* mesh);
 
+  /**
+   * @brief Gets the width, in texels, of the texture containing the transform matrices.
+   * @returns the width of the texture
+   */
+  [[nodiscard]] float getTransformMatrixTextureWidth() const;
+
+  /**
+   * @brief Gets the vertical texture coordinate of the row containing the transform matrices.
+   * @param mesh defines the mesh to use to get the row (if needInitialSkinMatrix === true)
+   * @returns the texture coordinate of the row
+   */
+  float getTransformMatrixTextureRow(AbstractMesh* mesh);
+
   /**
    * @brief Gets the current hosting scene.
    * @returns a scene object
@@ -143,6 +157,29 @@ public:
   bool copyAnimationRange(Skeleton* source, const std::string& name,
                           bool rescaleAsRequired = false);
 
+  /**
+   * @brief Plays a clip shared with other skeletons using the same rig, without copying its key
+   * frames. The bones are matched by name and updated from the clip when the skeleton is prepared,
+   * the skeletons playing the same clip at the same frame sharing the evaluated pose (see
+   * Scene::skeletonPoseCache).
+   * @param clip defines the clip to play
+   * @param loop defines if the clip loops (true by default)
+   * @param speedRatio defines the speed ratio to apply (1 by default)
+   * @param weight defines the weight of the clip, blended with the rest pose (1 by default)
+   */
+  void playClip(const SkeletonAnimationClipPtr& clip, bool loop = true, float speedRatio = 1.f,
+                float weight = 1.f);
+
+  /**
+   * @brief Stops the clip played by the skeleton, the bones keep their current pose.
+   */
+  void stopClip();
+
+  /**
+   * @brief Gets the state of the clip played by the skeleton, if any.
+   */
+  std::optional<SkeletonAnimationClipPlayback>& getClipPlayback();
+
   /**
    * @brief Forces the skeleton to go to rest pose.
    */
@@ -282,7 +319,22 @@ private:
   float _getHighestAnimationFrame();
   void _computeTransformMatrices(Float32Array& targetMatrix,
                                  const std::optional<Matrix>& initialSkinMatrix = std::nullopt);
+  /**
+   * @brief Updates the flat layout of the bones (parent indices and matrix arrays) if the
+   * hierarchy changed.
+   */
+  void _updateBoneLayout();
   void _sortBones(unsigned int index, std::vector<BonePtr>& bones, std::vector<bool>& visited);
+  /**
+   * @brief Uploads matrices to a row of the bone matrix texture atlas, allocating the row if
+   * needed.
+   */
+  void _updateTextureRow(std::optional<size_t>& row, const Float32Array& matrices);
+  void _releaseTextureRow(std::optional<size_t>& row);
+  /**
+   * @brief Updates the local matrices of the bones from the clip played, if the frame changed.
+   */
+  void _updateFromClip();
 
 public:
   /**
@@ -359,7 +411,8 @@ private:
   Scene* _scene;
   bool _isDirty;
   Float32Array _transformMatrices;
-  RawTexturePtr _transformMatrixTexture;
+  std::optional<size_t> _transformMatrixTextureRow;
+  std::optional<SkeletonAnimationClipPlayback> _clipPlayback;
   std::vector<AbstractMesh*> _meshesWithPoseMatrix;
   std::vector<IAnimatablePtr> _animatables;
   Matrix _identity;
@@ -370,6 +423,18 @@ private:
   size_t _uniqueId;
   bool _useTextureToStoreBoneMatrices;
   AnimationPropertiesOverridePtr _animationPropertiesOverride;
+  // Flat layout of the bones used to compute the transform matrices: index of the parent of each
+  // bone (-1 for the roots), and contiguous local, world and inverse bind matrices. The bones and
+  // parents the layout was built from tell when the hierarchy changes, the layout being unused
+  // when a parent is not part of the skeleton
+  std::vector<const Bone*> _boneLayoutBones;
+  std::vector<const Bone*> _boneLayoutParents;
+  bool _hasFlatBoneLayout;
+  std::vector<int> _boneParentIndices;
+  std::vector<int> _boneMatrixIndices;
+  Float32Array _boneLocalMatrices;
+  Float32Array _boneWorldMatrices;
+  Float32Array _boneInverseBindMatrices;
 
 }; // end of class Bone
 
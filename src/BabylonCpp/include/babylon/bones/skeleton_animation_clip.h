@@ -0,0 +1,186 @@
+#ifndef BABYLON_BONES_SKELETON_ANIMATION_CLIP_H
+#define BABYLON_BONES_SKELETON_ANIMATION_CLIP_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Animation;
+class AnimationGroup;
+class Bone;
+class Skeleton;
+class SkeletonAnimationClip;
+using SkeletonAnimationClipPtr = std::shared_ptr<const SkeletonAnimationClip>;
+
+/**
+ * @brief Immutable skeletal animation shared by the skeletons playing it (see Skeleton::playClip).
+ *
+ * The key frames of each bone are stored decomposed (scaling, rotation and translation), the way
+ * matrix animations are interpolated by default, and the bones are matched by name with the
+ * skeletons playing the clip, so that a clip extracted from a skeleton can be played by any
+ * skeleton using the same rig without copying its keys. The matrix animations of the bones and the
+ * position, rotationQuaternion and scaling animations of the bones or of their linked transform
+ * nodes (as loaded from glTF files) are sampled at their key frames, the components which are not
+ * animated keeping their rest value.
+ */
+class BABYLON_SHARED_EXPORT SkeletonAnimationClip {
+
+public:
+  /**
+   * @brief Creates a clip from an animation range of a skeleton.
+   * @param skeleton defines the skeleton whose bone animations are read
+   * @param rangeName defines the name of the animation range
+   * @returns the clip, whose frames start at 0, or nullptr if the skeleton has no such range
+   */
+  static SkeletonAnimationClipPtr FromAnimationRange(Skeleton* skeleton,
+                                                     const std::string& rangeName);
+
+  /**
+   * @brief Creates a clip from the animations of an animation group targeting the bones of a
+   * skeleton or their linked transform nodes.
+   * @param skeleton defines the skeleton whose bones are animated
+   * @param animationGroup defines the animation group
+   * @returns the clip, whose frames start at 0, or nullptr if the group does not animate the
+   * skeleton
+   */
+  static SkeletonAnimationClipPtr FromAnimationGroup(Skeleton* skeleton,
+                                                     AnimationGroup& animationGroup);
+
+public:
+  ~SkeletonAnimationClip(); // = default
+
+  /**
+   * @brief Returns the number of bones animated by the clip.
+   */
+  [[nodiscard]] size_t boneCount() const;
+
+  /**
+   * @brief Returns the name of a bone animated by the clip.
+   */
+  [[nodiscard]] const std::string& boneName(size_t index) const;
+
+  /**
+   * @brief Returns the index of the bone with the given name, or -1 if the clip does not animate
+   * it.
+   */
+  [[nodiscard]] int findBone(const std::string& boneName) const;
+
+  /**
+   * @brief Evaluates the local matrices of the bones at a frame.
+   * @param frame defines the frame (clamped to the frames of the clip)
+   * @param localMatrices receives the local matrix of each bone of the clip
+   */
+  void evaluate(float frame, std::vector<Matrix>& localMatrices) const;
+
+  /**
+   * @brief Returns the number of bytes used by the key frames.
+   */
+  [[nodiscard]] size_t memorySize() const;
+
+protected:
+  SkeletonAnimationClip(const std::string& name, float framePerSecond, float duration);
+
+public:
+  /**
+   * Name of the clip
+   */
+  const std::string name;
+
+  /**
+   * Number of frames per second
+   */
+  const float framePerSecond;
+
+  /**
+   * Number of frames of the clip
+   */
+  const float duration;
+
+private:
+  struct BoneTrack {
+    std::string boneName;
+    std::vector<float> frames;
+    std::vector<Vector3> scalings;
+    std::vector<Quaternion> rotations;
+    std::vector<Vector3> translations;
+  }; // end of struct BoneTrack
+
+  struct BoneChannels {
+    Animation* matrix   = nullptr;
+    Animation* position = nullptr;
+    Animation* rotation = nullptr;
+    Animation* scaling  = nullptr;
+    /**
+     * @brief Keeps the animation if it animates a component of a bone.
+     * @returns the animation kept, nullptr otherwise
+     */
+    Animation* add(Animation* animation);
+  }; // end of struct BoneChannels
+
+  /**
+   * @brief Adds the track of a bone sampled from its channels between two frames.
+   */
+  void _addTrack(Bone& bone, const BoneChannels& channels, float from, float to);
+
+private:
+  std::vector<BoneTrack> _tracks;
+
+}; // end of class SkeletonAnimationClip
+
+/**
+ * @brief State of a skeleton playing a clip (see Skeleton::playClip).
+ */
+struct BABYLON_SHARED_EXPORT SkeletonAnimationClipPlayback {
+  /**
+   * @brief Returns the frame of the clip at a time of the clip clock (see
+   * SkeletonPoseCache::getTime).
+   */
+  [[nodiscard]] float getFrame(float time) const;
+
+  /**
+   * The clip played
+   */
+  SkeletonAnimationClipPtr clip = nullptr;
+
+  /**
+   * Time of the clip clock when the clip started, in milliseconds
+   */
+  float startTime = 0.f;
+
+  /**
+   * Speed ratio of the playback
+   */
+  float speedRatio = 1.f;
+
+  /**
+   * Weight of the clip, blended with the rest pose of the bones
+   */
+  float weight = 1.f;
+
+  /**
+   * Specifies if the clip loops, else the last frame is kept
+   */
+  bool loop = true;
+
+  /**
+   * Hidden Index of the clip bone animating each bone of the skeleton, -1 if none
+   */
+  std::vector<int> _boneIndices;
+
+  /**
+   * Hidden Frame and weight applied to the bones during the last update
+   */
+  float _appliedFrame  = -1.f;
+  float _appliedWeight = -1.f;
+}; // end of struct SkeletonAnimationClipPlayback
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_SKELETON_ANIMATION_CLIP_H
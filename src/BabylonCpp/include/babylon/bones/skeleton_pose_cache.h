@@ -0,0 +1,91 @@
+#ifndef BABYLON_BONES_SKELETON_POSE_CACHE_H
+#define BABYLON_BONES_SKELETON_POSE_CACHE_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/matrix.h>
+
+namespace BABYLON {
+
+class SkeletonAnimationClip;
+
+/**
+ * @brief Clock of the skeleton animation clips of a scene and cache of the poses they evaluated
+ * during the current animation step (see Scene::skeletonPoseCache).
+ *
+ * The skeletons playing the same clip at the same frame share the local matrices evaluated by the
+ * first of them. The cache is cleared each time the clock advances.
+ */
+class BABYLON_SHARED_EXPORT SkeletonPoseCache {
+
+public:
+  SkeletonPoseCache();
+  ~SkeletonPoseCache(); // = default
+
+  /**
+   * @brief Gets the current time of the clock, in milliseconds.
+   */
+  [[nodiscard]] float getTime() const;
+
+  /**
+   * @brief Gets the local matrices of the bones of a clip at a frame, evaluating them if they are
+   * not cached yet.
+   * @param clip defines the clip to evaluate
+   * @param frame defines the frame to evaluate
+   * @returns the local matrix of each bone of the clip
+   */
+  const std::vector<Matrix>& getPose(const SkeletonAnimationClip& clip, float frame);
+
+  /**
+   * @brief Gets the number of poses evaluated since the creation of the cache.
+   */
+  [[nodiscard]] size_t getEvaluationCount() const;
+
+  /**
+   * @brief Gets the number of poses found in the cache since the creation of the cache.
+   */
+  [[nodiscard]] size_t getHitCount() const;
+
+  /**
+   * @brief Hidden Advances the clock and clears the cached poses.
+   * @param deltaTime defines the elapsed time, in milliseconds
+   */
+  void _advance(float deltaTime);
+
+public:
+  /**
+   * Specifies if the poses are cached (default is true)
+   */
+  bool enabled;
+
+  /**
+   * Interval, in frames, the evaluated frames are rounded to so that skeletons playing the same
+   * clip at close frames share the same pose, 0 to only share identical frames (default is 0)
+   */
+  float framePrecision;
+
+private:
+  struct PoseKey {
+    const SkeletonAnimationClip* clip;
+    float frame;
+    bool operator==(const PoseKey& other) const;
+  }; // end of struct PoseKey
+
+  struct PoseKeyHash {
+    size_t operator()(const PoseKey& key) const;
+  }; // end of struct PoseKeyHash
+
+  float _time;
+  std::unordered_map<PoseKey, std::vector<Matrix>, PoseKeyHash> _poses;
+  std::vector<Matrix> _uncachedPose;
+  size_t _evaluationCount;
+  size_t _hitCount;
+
+}; // end of class SkeletonPoseCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_SKELETON_POSE_CACHE_H
@@ -0,0 +1,85 @@
+#ifndef BABYLON_BONES_SOFTWARE_SKINNING_H
+#define BABYLON_BONES_SOFTWARE_SKINNING_H
+
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Vertex streams processed by SoftwareSkinning. The source and destination arrays of a
+ * stream must not overlap. A null stream is skipped.
+ */
+struct BABYLON_SHARED_EXPORT SoftwareSkinningData {
+  /** The skinning matrices (Skeleton::getTransformMatrices), 16 floats per matrix */
+  const float* matrices = nullptr;
+  /** Number of matrices in the matrices array */
+  size_t matrixCount = 0;
+  /** Matrix indices and weights, 4 per vertex */
+  const float* matricesIndices = nullptr;
+  const float* matricesWeights = nullptr;
+  /** Extra matrix indices and weights (influences 5 to 8), 4 per vertex, or nullptr */
+  const float* matricesIndicesExtra = nullptr;
+  const float* matricesWeightsExtra = nullptr;
+  /** Positions (3 floats per vertex) */
+  const float* sourcePositions = nullptr;
+  float* positions             = nullptr;
+  /** Normals (3 floats per vertex) */
+  const float* sourceNormals = nullptr;
+  float* normals             = nullptr;
+  /** Tangents (4 floats per vertex, w is copied) */
+  const float* sourceTangents = nullptr;
+  float* tangents             = nullptr;
+  /** Number of vertices */
+  size_t vertexCount = 0;
+}; // end of struct SoftwareSkinningData
+
+/**
+ * @brief CPU skinning of vertex streams, used by Mesh::applySkeleton when the bones are not
+ * computed in the shaders.
+ *
+ * The weighted bone matrix of a vertex is accumulated row by row (SSE when the library is built
+ * with OPTION_ENABLE_SIMD) and the vertices are processed in blocks on the default thread pool.
+ * Both paths perform the operations of Matrix::addToSelf / Vector3::TransformCoordinates in the
+ * same order, so the results do not depend on the build options. The SSE skinning is compiled on
+ * every SSE2 target, so that it can be checked against the scalar one.
+ */
+struct BABYLON_SHARED_EXPORT SoftwareSkinning {
+
+  /** Number of vertices processed by a task */
+  static constexpr size_t DefaultBlockSize = 1024;
+
+  /**
+   * @brief Skins the vertices [begin, end) of the streams on the calling thread.
+   * @param data the vertex streams
+   * @param begin the first vertex
+   * @param end the vertex after the last one
+   */
+  static void SkinVertices(const SoftwareSkinningData& data, size_t begin, size_t end);
+
+  /**
+   * @brief Skins the vertices [begin, end) of the streams without SIMD instructions.
+   * @see SkinVertices
+   */
+  static void SkinVerticesScalar(const SoftwareSkinningData& data, size_t begin, size_t end);
+
+  /**
+   * @brief Skins the vertices [begin, end) of the streams with SSE instructions.
+   * @see SkinVertices
+   * @returns false if the target does not support SSE2, the streams being then left untouched
+   */
+  static bool SkinVerticesSSE2(const SoftwareSkinningData& data, size_t begin, size_t end);
+
+  /**
+   * @brief Skins all the vertices of the streams, split in blocks on the default thread pool.
+   * @param data the vertex streams
+   * @param blockSize the number of vertices processed by a task
+   */
+  static void Apply(const SoftwareSkinningData& data, size_t blockSize = DefaultBlockSize);
+
+}; // end of struct SoftwareSkinning
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BONES_SOFTWARE_SKINNING_H
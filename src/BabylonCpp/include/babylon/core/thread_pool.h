@@ -0,0 +1,106 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed size pool of worker threads used to run CPU bound jobs (parsing, decoding,
+ * animation evaluation, ...) off the main thread.
+ *
+ * When no worker thread is available (e.g. emscripten builds without pthreads), jobs are executed
+ * synchronously on the calling thread.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  using Job        = std::function<void()>;
+  using RangeJob   = std::function<void(size_t begin, size_t end)>;
+  using WorkerJobs = std::deque<Job>;
+
+public:
+  /**
+   * @brief Returns the process wide thread pool, lazily created with one worker per hardware
+   * thread minus the calling (main) thread.
+   */
+  static ThreadPool& Default();
+
+  /**
+   * @brief Creates a new thread pool.
+   * @param numThreads number of worker threads, 0 means one per hardware thread minus one
+   */
+  explicit ThreadPool(size_t numThreads = 0);
+  ~ThreadPool(); // = default
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of threads taking part in a parallelFor call (workers + caller).
+   */
+  size_t concurrency() const;
+
+  /**
+   * @brief Returns true if the current thread is one of the workers of this pool.
+   */
+  bool isWorkerThread() const;
+
+  /**
+   * @brief Schedules a job on the pool.
+   * @param f the job to execute
+   * @returns a future holding the result of the job
+   */
+  template <typename F>
+  auto enqueue(F&& f) -> std::future<decltype(f())>
+  {
+    using R   = decltype(f());
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+    auto res  = task->get_future();
+    _push([task]() { (*task)(); });
+    return res;
+  }
+
+  /**
+   * @brief Splits the range [begin, end) into chunks of at most grainSize elements and processes
+   * them on the workers and the calling thread. Returns when every chunk has been processed.
+   *
+   * The calling thread takes part in the work, so nested calls from inside a job cannot
+   * deadlock.
+   * @param begin first index of the range
+   * @param end end index of the range (excluded)
+   * @param grainSize maximum number of elements per chunk (at least 1)
+   * @param job function called with the bounds of each chunk
+   */
+  void parallelFor(size_t begin, size_t end, size_t grainSize, const RangeJob& job);
+
+private:
+  void _push(Job&& job);
+  void _workerLoop();
+
+private:
+  std::vector<std::thread> _workers;
+  WorkerJobs _jobs;
+  mutable std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _stopping;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
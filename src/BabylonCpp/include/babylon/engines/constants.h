@@ -167,6 +167,20 @@ struct BABYLON_SHARED_EXPORT Constants {
   static constexpr unsigned int TEXTUREFORMAT_RGB_INTEGER = 10;
   /** RGBA_INTEGER */
   static constexpr unsigned int TEXTUREFORMAT_RGBA_INTEGER = 11;
+  /** Compressed BC7 */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM = 36492;
+  /** Compressed BC3 */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT5 = 33779;
+  /** Compressed BC1 */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGB_S3TC_DXT1 = 33776;
+  /** Compressed ETC2 RGBA */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGBA8_ETC2_EAC = 37496;
+  /** Compressed ETC2 RGB */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGB8_ETC2 = 37492;
+  /** Compressed ETC1 */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGB_ETC1_WEBGL = 36196;
+  /** Compressed ASTC 4x4 */
+  static constexpr unsigned int TEXTUREFORMAT_COMPRESSED_RGBA_ASTC_4x4 = 37808;
 
   /** UNSIGNED_BYTE */
   static constexpr unsigned int TEXTURETYPE_UNSIGNED_BYTE = 0;
@@ -1058,10 +1058,10 @@ public:
    * @param compression defines the compression used (null by default)
    * @param type defines the type fo the data (Engine.TEXTURETYPE_UNSIGNED_INT by default)
    */
-  void updateRawTexture(const InternalTexturePtr& texture, const Uint8Array& data,
-                        unsigned int format, bool invertY = true,
-                        const std::string& compression = "",
-                        unsigned int type              = Constants::TEXTURETYPE_UNSIGNED_INT);
+  virtual void updateRawTexture(const InternalTexturePtr& texture, const Uint8Array& data,
+                                unsigned int format, bool invertY = true,
+                                const std::string& compression = "",
+                                unsigned int type = Constants::TEXTURETYPE_UNSIGNED_INT);
 
   /**
    * @brief Creates a new raw cube texture.
@@ -1241,6 +1241,15 @@ public:
    */
   void bindTransformFeedbackBuffer(const WebGLDataBufferPtr& value);
 
+  /**
+   * @brief Bind a range of a webGL buffer for a transform feedback operation.
+   * @param value defines the webGL buffer to bind
+   * @param byteOffset defines the offset of the range in bytes
+   * @param byteLength defines the length of the range in bytes
+   */
+  void bindTransformFeedbackBufferRange(const WebGLDataBufferPtr& value, size_t byteOffset,
+                                        size_t byteLength);
+
 protected:
   /**
    * @brief Creates a new engine.
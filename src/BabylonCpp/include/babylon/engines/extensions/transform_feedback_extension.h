@@ -74,6 +74,15 @@ public:
    */
   void bindTransformFeedbackBuffer(const WebGLDataBufferPtr& value);
 
+  /**
+   * @brief Bind a range of a webGL buffer for a transform feedback operation.
+   * @param value defines the webGL buffer to bind
+   * @param byteOffset defines the offset of the range in bytes
+   * @param byteLength defines the length of the range in bytes
+   */
+  void bindTransformFeedbackBufferRange(const WebGLDataBufferPtr& value, size_t byteOffset,
+                                        size_t byteLength);
+
 private:
   Engine* _this;
 
@@ -31,8 +31,10 @@ using json = nlohmann::json;
 namespace BABYLON {
 
 class Animatable;
+class AnimationLODPolicy;
 struct AnimationPropertiesOverride;
 class Bone;
+class BoneMatrixTextureAtlas;
 class BoundingBoxRenderer;
 class ClickInfo;
 class Collider;
@@ -43,6 +45,7 @@ class Engine;
 class EnvironmentHelper;
 class GamepadManager;
 class GeometryBufferRenderer;
+class GPUParticleBufferPool;
 struct IActiveMeshCandidateProvider;
 class IAnimatable;
 struct ICollisionCoordinator;
@@ -59,6 +62,8 @@ class KeyboardInfoPre;
 class Mesh;
 class Node;
 class OutlineRenderer;
+class ParticleArena;
+class ParticleBudgetManager;
 class PostProcess;
 class PostProcessManager;
 class PostProcessRenderPipelineManager;
@@ -67,6 +72,7 @@ struct RenderingGroupInfo;
 class RenderingManager;
 class RuntimeAnimation;
 class SimplificationQueue;
+class SkeletonPoseCache;
 class SoundTrack;
 class UniformBuffer;
 using AnimatablePtr                   = std::shared_ptr<Animatable>;
@@ -418,6 +424,11 @@ public:
    */
   void unregisterAfterRender(const std::function<void(Scene* scene, EventState& es)>& func);
 
+  /**
+   * @brief Hidden
+   */
+  void _addPendingData(const void* data);
+
   /**
    * @brief Hidden
    */
@@ -428,6 +439,11 @@ public:
    */
   void _addPendingData(const InternalTexturePtr& texure);
 
+  /**
+   * @brief Hidden
+   */
+  void _removePendingData(const void* data);
+
   /**
    * @brief Hidden
    */
@@ -442,7 +458,7 @@ public:
    * @brief Returns the number of items waiting to be loaded.
    * @returns the number of items waiting to be loaded
    */
-  void getWaitingItemsCount();
+  size_t getWaitingItemsCount() const;
 
   /**
    * Registers a function to be executed when the scene is ready
@@ -1782,19 +1798,32 @@ private:
   Scene& _processPointerUp(std::optional<PickingInfo>& pickResult, const PointerEvent& evt,
                            const ClickInfo& clickInfo);
   void _animate();
+  /**
+   * Hidden Value and weight of a weighted animation
+   */
+  struct LateAnimationValue {
+    AnimationValue value;
+    float weight;
+  }; // end of struct LateAnimationValue
+  /**
+   * Hidden Weighted animations of a property, blended once all the animations are applied
+   */
+  struct LateAnimationHolder {
+    IAnimatablePtr target;
+    std::vector<std::string> targetPropertyPath;
+    float totalWeight;
+    std::vector<LateAnimationValue> animations;
+    AnimationValue originalValue;
+  }; // end of struct LateAnimationHolder
   /**
    * @brief Hidden
    */
-  AnimationValue
-  _processLateAnimationBindingsForMatrices(float holderTotalWeight,
-                                           std::vector<RuntimeAnimation*>& holderAnimations,
-                                           Matrix& holderOriginalValue);
+  AnimationValue _processLateAnimationBindingsForMatrices(const LateAnimationHolder& holder);
   /**
    * @brief Hidden
    */
-  Quaternion _processLateAnimationBindingsForQuaternions(
-    float holderTotalWeight, std::vector<RuntimeAnimation*>& holderAnimations,
-    Quaternion& holderOriginalValue, Quaternion& refQuaternion);
+  Quaternion _processLateAnimationBindingsForQuaternions(const LateAnimationHolder& holder,
+                                                         Quaternion& refQuaternion);
   /**
    * @brief Hidden
    */
@@ -2660,6 +2689,45 @@ public:
    */
   bool useConstantAnimationDeltaTime;
 
+  /**
+   * Gets or sets a boolean indicating if the runtime animations can be evaluated on the worker
+   * threads of the default thread pool. The values are always applied to the targets on the main
+   * thread, in the order of the active animatables
+   */
+  bool useParallelAnimationEvaluation;
+
+  /**
+   * Defines how often the animatables are updated depending on the visibility and the screen size
+   * of the meshes they animate (disabled by default)
+   */
+  std::unique_ptr<AnimationLODPolicy> animationLODPolicy;
+
+  /**
+   * Clock of the skeleton animation clips and cache of the poses shared by the skeletons playing
+   * the same clip at the same frame (see Skeleton::playClip)
+   */
+  std::unique_ptr<SkeletonPoseCache> skeletonPoseCache;
+
+  /**
+   * Hidden Texture storing the bone matrices of the skeletons (see BoneMatrixTextureAtlas)
+   */
+  std::unique_ptr<BoneMatrixTextureAtlas> _boneMatrixTextureAtlas;
+
+  /**
+   * Hidden Buffers shared by the GPU particle systems (see GPUParticleBufferPool)
+   */
+  std::unique_ptr<GPUParticleBufferPool> _gpuParticleBufferPool;
+
+  /**
+   * Hidden Budget of the CPU particle systems (see ParticleBudgetManager)
+   */
+  std::unique_ptr<ParticleBudgetManager> _particleBudgetManager;
+
+  /**
+   * Hidden Particles and sub-emitter systems shared by the particle systems (see ParticleArena)
+   */
+  std::unique_ptr<ParticleArena> _particleArena;
+
   /**
    * Gets the current delta time used by animation engine
    */
@@ -3450,7 +3518,7 @@ private:
   Observer<Camera>::Ptr _onBeforeCameraRenderObserver;
   Observer<Camera>::Ptr _onAfterCameraRenderObserver;
   // Animations
-  std::vector<std::string> _registeredForLateAnimationBindings;
+  std::vector<LateAnimationHolder> _registeredForLateAnimationBindings;
   // Pointers
   std::function<void(PointerEvent&& evt)> _onPointerMove;
   std::function<void(PointerEvent&& evt)> _onPointerDown;
@@ -3552,7 +3620,7 @@ private:
   int _alternateViewUpdateFlag;
   int _alternateProjectionUpdateFlag;
   std::vector<IFileRequest> _activeRequests;
-  std::vector<std::string> _pendingData;
+  std::vector<const void*> _pendingData;
   bool _isDisposed;
   std::vector<AbstractMesh*> _activeMeshes;
   IActiveMeshCandidateProvider* _activeMeshCandidateProvider;
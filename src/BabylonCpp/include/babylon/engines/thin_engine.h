@@ -1612,7 +1612,7 @@ protected:
   void _normalizeIndexData(const IndicesArray& indices, Uint16Array& uint16ArrayResult,
                            Uint32Array& uint32ArrayResult);
   void bindIndexBuffer(const WebGLDataBufferPtr& buffer);
-  void _deleteBuffer(const WebGLDataBufferPtr& buffer);
+  virtual void _deleteBuffer(const WebGLDataBufferPtr& buffer);
   /** @hidden */
   virtual void _reportDrawCall();
   static std::string _ConcatenateShader(const std::string& source, const std::string& defines,
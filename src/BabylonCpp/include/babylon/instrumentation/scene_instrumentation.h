@@ -190,6 +190,21 @@ protected:
    */
   PerfCounter& get_drawCallsCounter();
 
+  /**
+   * @brief Gets the perf counter used for the heap allocations made by the particle arena.
+   */
+  PerfCounter& get_particleAllocationsCounter();
+
+  /**
+   * @brief Gets the perf counter used for the particles allowed by the particle budget.
+   */
+  PerfCounter& get_budgetedParticlesCounter();
+
+  /**
+   * @brief Gets the perf counter used for the particle systems throttled by the particle budget.
+   */
+  PerfCounter& get_throttledParticleSystemsCounter();
+
 public:
   // Properties
 
@@ -303,6 +318,25 @@ public:
    */
   ReadOnlyProperty<SceneInstrumentation, PerfCounter> drawCallsCounter;
 
+  /**
+   * Perf counter used for the heap allocations made by the particle arena for its pools of
+   * particles and sub-systems (see ParticleArena), the other allocations of the particle systems
+   * are not counted.
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> particleAllocationsCounter;
+
+  /**
+   * Perf counter used for the particles allowed by the particle budget (see
+   * ParticleBudgetManager).
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> budgetedParticlesCounter;
+
+  /**
+   * Perf counter used for the particle systems running below their capacity or update rate
+   * because of the particle budget.
+   */
+  ReadOnlyProperty<SceneInstrumentation, PerfCounter> throttledParticleSystemsCounter;
+
 private:
   bool _captureActiveMeshesEvaluationTime;
   PerfCounter _activeMeshesEvaluationTime;
@@ -334,6 +368,9 @@ private:
   bool _captureCameraRenderTime;
   PerfCounter _cameraRenderTime;
 
+  PerfCounter _budgetedParticles;
+  PerfCounter _throttledParticleSystems;
+
   // Observers
   Observer<Scene>::Ptr _onBeforeActiveMeshesEvaluationObserver;
   Observer<Scene>::Ptr _onAfterActiveMeshesEvaluationObserver;
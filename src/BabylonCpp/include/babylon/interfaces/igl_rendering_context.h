@@ -835,6 +835,17 @@ public:
    */
   virtual void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer) = 0;
 
+  /**
+   * @brief bindBufferRange
+   * @param target
+   * @param index
+   * @param buffer
+   * @param offset
+   * @param size
+   */
+  virtual void bindBufferRange(GLenum target, GLuint index, IGLBuffer* buffer, GLintptr offset,
+                               GLsizeiptr size) = 0;
+
   /**
    * @brief Binds a IGLRenderbuffer object to a given target.
    * @param target A GLenum specifying the binding point (target).
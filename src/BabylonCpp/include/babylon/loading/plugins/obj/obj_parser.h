@@ -0,0 +1,87 @@
+#ifndef BABYLON_LOADING_PLUGINS_OBJ_OBJ_PARSER_H
+#define BABYLON_LOADING_PLUGINS_OBJ_OBJ_PARSER_H
+
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector2.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+
+struct MeshObject {
+  std::string name;
+  IndicesArray indices;
+  Float32Array positions;
+  Float32Array normals;
+  Float32Array colors;
+  Float32Array uvs;
+  std::string materialName;
+}; // end of struct MeshObject
+
+/**
+ * @brief Options of the OBJ parser.
+ */
+struct BABYLON_SHARED_EXPORT OBJParserOptions {
+  /**
+   * Defines if the UV index is part of the key used to deduplicate vertices.
+   */
+  bool optimizeWithUV = true;
+  /**
+   * Include in meshes the vertex colors available in some OBJ files.
+   */
+  bool importVertexColors = false;
+  /**
+   * Defines custom scaling of UV coordinates of loaded meshes.
+   */
+  Vector2 uvScaling = Vector2(1.f, 1.f);
+  /**
+   * Minimum size in bytes of a chunk parsed by a single job. Files smaller than two chunks are
+   * parsed on the calling thread.
+   */
+  size_t minChunkSize = 1 << 20;
+}; // end of struct OBJParserOptions
+
+/**
+ * @brief Result of the parsing of an OBJ file.
+ */
+struct BABYLON_SHARED_EXPORT OBJParseResult {
+  /**
+   * The meshes found in the file, with unwrapped (flat) vertex data
+   */
+  std::vector<MeshObject> meshes;
+  /**
+   * The name of the material library referenced by the file (mtllib keyword)
+   */
+  std::string mtlFileName;
+}; // end of struct OBJParseResult
+
+/**
+ * @brief Single-pass tokenizer for the Wavefront OBJ format.
+ *
+ * Large files are split at line boundaries into chunks that are tokenized in parallel. Each chunk
+ * deduplicates its (position, uv, normal) tuples with a hash map, then the per chunk index spaces
+ * are merged in file order into the final meshes. Vertices shared across a chunk boundary are
+ * duplicated, the resulting geometry is identical.
+ */
+class BABYLON_SHARED_EXPORT OBJParser {
+
+public:
+  /**
+   * @brief Parses the content of an OBJ file.
+   * @param data the content of the obj file
+   * @param options the parser options
+   * @param pool the thread pool used to parse the chunks, the default pool is used if null
+   * @returns the meshes defined in the file
+   */
+  static OBJParseResult Parse(const std::string& data, const OBJParserOptions& options = {},
+                              ThreadPool* pool = nullptr);
+
+}; // end of class OBJParser
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_OBJ_OBJ_PARSER_H
@@ -0,0 +1,92 @@
+#ifndef BABYLON_LOADING_STREAMING_STREAMING_ASSET_OPTIONS_H
+#define BABYLON_LOADING_STREAMING_STREAMING_ASSET_OPTIONS_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Mesh;
+using MeshPtr = std::shared_ptr<Mesh>;
+
+/**
+ * @brief Level of detail of a streamed asset.
+ */
+struct BABYLON_SHARED_EXPORT StreamingLODLevel {
+  /**
+   * Url of the level data
+   */
+  std::string url;
+  /**
+   * Fraction of the screen height the asset has to cover for this level to be wanted
+   */
+  float minScreenCoverage = 0.f;
+  /**
+   * Called on the main thread with the loaded data, makes the level resident and returns the
+   * number of bytes it uses
+   */
+  std::function<size_t(const ArrayBuffer& data)> onLoaded = nullptr;
+  /**
+   * Called on the main thread when the level is evicted to stay within the memory budget
+   */
+  std::function<void()> onEvicted = nullptr;
+}; // end of struct StreamingLODLevel
+
+/**
+ * @brief Options of an asset registered in a StreamingManager.
+ */
+struct BABYLON_SHARED_EXPORT StreamingAssetOptions {
+  /**
+   * Name of the asset, used for logging
+   */
+  std::string name;
+  /**
+   * Center of the bounding sphere of the asset, in world space
+   */
+  Vector3 center = Vector3::Zero();
+  /**
+   * Radius of the bounding sphere of the asset, in world space
+   */
+  float radius = 1.f;
+  /**
+   * Multiplier applied to the computed loading priority
+   */
+  float priorityBias = 1.f;
+  /**
+   * The levels of the asset, ordered from the coarsest to the finest. The coarsest level is
+   * always wanted and never evicted.
+   */
+  std::vector<StreamingLODLevel> levels;
+}; // end of struct StreamingAssetOptions
+
+/**
+ * @brief Level of detail of a streamed mesh.
+ */
+struct BABYLON_SHARED_EXPORT StreamingMeshLODLevel {
+  /**
+   * Url of the level data
+   */
+  std::string url;
+  /**
+   * Distance from which the level is used (see Mesh::addLODLevel)
+   */
+  float distance = 0.f;
+  /**
+   * Fraction of the screen height the mesh has to cover for this level to be wanted
+   */
+  float minScreenCoverage = 0.f;
+  /**
+   * Creates the mesh of the level from the loaded data
+   */
+  std::function<MeshPtr(const ArrayBuffer& data)> createMesh = nullptr;
+}; // end of struct StreamingMeshLODLevel
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_STREAMING_STREAMING_ASSET_OPTIONS_H
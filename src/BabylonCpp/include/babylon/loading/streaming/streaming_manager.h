@@ -0,0 +1,167 @@
+#ifndef BABYLON_LOADING_STREAMING_STREAMING_MANAGER_H
+#define BABYLON_LOADING_STREAMING_STREAMING_MANAGER_H
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/asio/callback_types.h>
+#include <babylon/loading/streaming/streaming_asset_options.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class Scene;
+
+/**
+ * @brief Options of the StreamingManager.
+ */
+struct BABYLON_SHARED_EXPORT StreamingManagerOptions {
+  using FetchFunction
+    = std::function<void(const std::string& url, const asio::OnSuccessFunction<ArrayBuffer>&,
+                         const asio::OnErrorFunction&)>;
+
+  /**
+   * Maximum number of bytes resident before cold levels are evicted
+   */
+  size_t memoryBudget = 256 * 1024 * 1024;
+  /**
+   * Maximum number of requests in flight
+   */
+  size_t maxConcurrentRequests = 4;
+  /**
+   * Number of updates a level has not been wanted before it can be evicted
+   */
+  size_t coldFrames = 120;
+  /**
+   * If true, the scene is not ready (and does not start animating) until the coarsest level of
+   * every asset is resident
+   */
+  bool waitForCoarsestLevels = true;
+  /**
+   * If true, the manager updates itself before each render of the scene
+   */
+  bool autoUpdate = true;
+  /**
+   * Function used to fetch the data of a level, defaults to asio::LoadAssetAsync_Binary
+   */
+  FetchFunction fetch = nullptr;
+}; // end of struct StreamingManagerOptions
+
+/**
+ * @brief Streams the levels of detail of assets in priority order.
+ *
+ * Each update, the priority of an asset is computed from the screen-space size of its bounding
+ * sphere, seen from the active camera. The coarsest levels are fetched first, then finer levels
+ * are fetched, one after the other, as long as the asset covers enough of the screen. When the
+ * resident memory exceeds the budget, the finest levels which have not been wanted for a while
+ * (cold levels) are evicted, lowest priority first.
+ */
+class BABYLON_SHARED_EXPORT StreamingManager {
+
+public:
+  using AssetId = size_t;
+
+public:
+  StreamingManager(Scene* scene, const StreamingManagerOptions& options = {});
+  ~StreamingManager(); // = default
+
+  StreamingManager(const StreamingManager& other) = delete;
+  StreamingManager& operator=(const StreamingManager& other) = delete;
+
+  /**
+   * @brief Registers an asset to stream.
+   * @param options the asset options
+   * @returns the id of the asset
+   */
+  AssetId addAsset(const StreamingAssetOptions& options);
+
+  /**
+   * @brief Registers the levels of detail of a mesh to stream. Each resident level is added as
+   * LOD level of the mesh, the finest resident level being used for every distance lower than its
+   * own. The bounding info of the mesh is used as streaming bounding sphere.
+   * @param mesh the master mesh
+   * @param levels the levels, ordered from the coarsest to the finest
+   * @returns the id of the asset
+   */
+  AssetId addMesh(const MeshPtr& mesh, const std::vector<StreamingMeshLODLevel>& levels);
+
+  /**
+   * @brief Unregisters an asset, evicting its resident levels.
+   * @param id the id of the asset
+   */
+  void removeAsset(AssetId id);
+
+  /**
+   * @brief Updates the priorities using the active camera of the scene, issues the requests and
+   * evicts the cold levels.
+   */
+  void update();
+
+  /**
+   * @brief Updates the priorities using the given point of view, issues the requests and evicts
+   * the cold levels.
+   * @param eyePosition the position of the viewer
+   * @param tanHalfFov tangent of the half vertical field of view of the viewer
+   */
+  void update(const Vector3& eyePosition, float tanHalfFov);
+
+  /**
+   * @brief Returns the index of the finest resident level of an asset, -1 if none.
+   */
+  int residentLevel(AssetId id) const;
+
+  /**
+   * @brief Returns the number of bytes used by the resident levels.
+   */
+  size_t residentBytes() const;
+
+  /**
+   * @brief Returns the number of requests in flight.
+   */
+  size_t pendingRequests() const;
+
+private:
+  enum class LevelState { NotLoaded, Loading, Resident, Failed };
+
+  struct Level {
+    StreamingLODLevel options;
+    LevelState state       = LevelState::NotLoaded;
+    size_t byteSize        = 0;
+    size_t lastWantedFrame = 0;
+  };
+
+  struct Asset {
+    StreamingAssetOptions options;
+    std::vector<Level> levels;
+    float priority        = 0.f;
+    size_t wantedLevel    = 0;
+    int residentLevel     = -1;
+    bool loading          = false;
+  };
+
+  void _request(AssetId id, Asset& asset, size_t levelIndex);
+  void _onLevelLoaded(AssetId id, size_t levelIndex, const ArrayBuffer& data);
+  void _onLevelError(AssetId id, size_t levelIndex, const std::string& message);
+  void _evict(Asset& asset);
+  void _evictColdLevels();
+  void _issueRequests();
+
+private:
+  Scene* _scene;
+  StreamingManagerOptions _options;
+  std::unordered_map<AssetId, Asset> _assets;
+  AssetId _nextAssetId;
+  size_t _frameId;
+  size_t _residentBytes;
+  size_t _pendingRequests;
+  Observer<Scene>::Ptr _onBeforeRenderObserver;
+  // Expires when the manager is destroyed, guards the fetch callbacks
+  std::shared_ptr<bool> _alive;
+
+}; // end of class StreamingManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_STREAMING_STREAMING_MANAGER_H
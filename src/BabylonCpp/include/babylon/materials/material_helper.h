@@ -115,6 +115,14 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    */
   static void PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines& defines);
 
+  /**
+   * @brief Prepares the defines for baked vertex animation (only for the materials declaring the
+   * BAKED_VERTEX_ANIMATION_TEXTURE define).
+   * @param mesh The mesh containing the geometry data we will draw
+   * @param defines The defines to update
+   */
+  static void PrepareDefinesForBakedVertexAnimation(AbstractMesh* mesh, MaterialDefines& defines);
+
   /**
    * @brief Prepares the defines for morph targets.
    * @param mesh The mesh containing the geometry data we will draw
@@ -269,6 +277,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
   static void PrepareAttributesForBones(std::vector<std::string>& attribs, AbstractMesh* mesh,
                                         MaterialDefines& defines, EffectFallbacks& fallbacks);
 
+  /**
+   * @brief Adds the per-instance baked vertex animation settings attribute when both baked vertex
+   * animation and instances are used.
+   * @param attribs The current list of supported attribs
+   * @param defines The current Defines of the effect
+   */
+  static void PrepareAttributesForBakedVertexAnimation(std::vector<std::string>& attribs,
+                                                       MaterialDefines& defines);
+
   /**
    * @brief Check and prepare the list of attributes required for instances according to the effect
    * defines.
@@ -346,6 +363,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    */
   static void BindBonesParameters(AbstractMesh* mesh, const EffectPtr& effect);
 
+  /**
+   * @brief Binds the baked vertex animation information from the mesh to the effect.
+   * @param mesh The mesh we are binding the information to render
+   * @param effect The effect we are binding the data to
+   * @param useInstances Defines if the settings are read from the instanced buffer
+   */
+  static void BindBakedVertexAnimationParameters(AbstractMesh* mesh, const EffectPtr& effect,
+                                                 bool useInstances);
+
   /**
    * @brief Binds the morph targets information from the mesh to the effect.
    * @param abstractMesh The mesh we are binding the information to render
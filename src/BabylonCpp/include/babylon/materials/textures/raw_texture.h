@@ -48,6 +48,16 @@ public:
    */
   void update(const ArrayBufferView& data);
 
+  /**
+   * @brief Updates a region of the texture underlying data.
+   * @param data Define the new data of the region
+   * @param xOffset Define the horizontal offset of the region
+   * @param yOffset Define the vertical offset of the region
+   * @param width Define the width of the region
+   * @param height Define the height of the region
+   */
+  void updateRegion(const ArrayBufferView& data, int xOffset, int yOffset, int width, int height);
+
   /**
    * @brief Creates a luminance texture from some data.
    * @param data Define the texture data
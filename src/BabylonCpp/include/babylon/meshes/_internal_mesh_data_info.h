@@ -13,6 +13,7 @@ namespace BABYLON {
 class Mesh;
 class MeshLODLevel;
 class MorphTargetManager;
+struct _MorphTargetsCPUBase;
 using MeshLODLevelPtr       = std::shared_ptr<MeshLODLevel>;
 using MorphTargetManagerPtr = std::shared_ptr<MorphTargetManager>;
 
@@ -32,6 +33,19 @@ struct BABYLON_SHARED_EXPORT _InternalMeshDataInfo {
   Float32Array _sourcePositions;
   // Will be used to save original normals when using software skinning
   Float32Array _sourceNormals;
+  // Will be used to save original tangents when using software skinning
+  Float32Array _sourceTangents;
+  // Will be used to save the results of the software skinning
+  Float32Array _skinnedPositions;
+  Float32Array _skinnedNormals;
+  Float32Array _skinnedTangents;
+  // Will be used to save the vertices moved by the morph targets blended on the CPU, with their
+  // data without morphing, and the manager of these targets
+  std::shared_ptr<_MorphTargetsCPUBase> _morphBase;
+  MorphTargetManager* _morphBaseManager = nullptr;
+  // Influences update id of the morph target manager used by the last CPU blending
+  size_t _morphInfluencesUpdateId = 0;
+  bool _morphBlendingDirty        = false;
 
   // Will be used to save a source mesh reference, If any
   Mesh* _source = nullptr;
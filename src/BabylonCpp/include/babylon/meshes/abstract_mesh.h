@@ -52,6 +52,7 @@ using LightPtr                 = std::shared_ptr<Light>;
 using MaterialPtr              = std::shared_ptr<Material>;
 using PhysicsImpostorPtr       = std::shared_ptr<PhysicsImpostor>;
 using RawTexturePtr            = std::shared_ptr<RawTexture>;
+using VertexBufferPtr          = std::shared_ptr<VertexBuffer>;
 using SkeletonPtr              = std::shared_ptr<Skeleton>;
 
 namespace GL {
@@ -67,7 +68,7 @@ using WebGLQueryPtr = std::shared_ptr<WebGLQuery>;
 struct UserInstancedBuffersStorage {
   std::unordered_map<std::string, Float32Array> data;
   std::unordered_map<std::string, size_t> sizes;
-  std::unordered_map<std::string, std::unique_ptr<VertexBuffer>> vertexBuffers;
+  std::unordered_map<std::string, VertexBufferPtr> vertexBuffers;
   std::unordered_map<std::string, size_t> strides;
 }; // end of struct UserInstancedBuffersStorage
 
@@ -1297,6 +1298,16 @@ protected:
    */
   virtual SkeletonPtr& get_skeleton();
 
+  /**
+   * @brief Sets the baked vertex animation manager used to animate the mesh.
+   */
+  void set_bakedVertexAnimationManager(const BakedVertexAnimationManagerPtr& value);
+
+  /**
+   * @brief Gets the baked vertex animation manager used to animate the mesh.
+   */
+  BakedVertexAnimationManagerPtr& get_bakedVertexAnimationManager();
+
   /**
    * @brief Hidden
    */
@@ -1863,14 +1874,21 @@ public:
   /** Hidden */
   Float32Array _bonesTransformMatrices;
 
-  /** Hidden */
-  RawTexturePtr _transformMatrixTexture;
+  /** Hidden Row of the bone matrix texture atlas (skeletons with needInitialSkinMatrix) */
+  std::optional<size_t> _transformMatrixTextureRow;
 
   /**
    * A skeleton to apply skining transformations
    */
   Property<AbstractMesh, SkeletonPtr> skeleton;
 
+  /**
+   * Baked vertex animation manager used to animate the skinned mesh from a vertex animation
+   * texture
+   * @see https://doc.babylonjs.com/divingDeeper/animation/baked_texture_animations
+   */
+  Property<AbstractMesh, BakedVertexAnimationManagerPtr> bakedVertexAnimationManager;
+
   /**
    * An event triggered when the mesh is rebuilt.
    */
@@ -1919,10 +1937,11 @@ public:
   ReadOnlyProperty<AbstractMesh, ColliderPtr> collider;
 
   /**
-   * Object used to store instanced buffers defined by user
+   * Object used to store instanced buffers defined by user (the value of each registered kind,
+   * stride floats)
    * @see https://doc.babylonjs.com/how_to/how_to_use_instances#custom-buffers
    */
-  std::unordered_map<std::string, UserInstancedBuffersStoragePtr> instancedBuffers;
+  std::unordered_map<std::string, Float32Array> instancedBuffers;
 
 private:
   // Collisions
@@ -146,8 +146,11 @@ public:
 
   /**
    * @brief Hidden
+   * @param overrideVertexBuffers vertex buffers bound in addition to (or instead of) the buffers
+   * of the geometry, the vertex array objects are not used when not empty
    */
-  void _bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind = nullptr);
+  void _bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind = nullptr,
+             const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers = {});
 
   /**
    * @brief Gets total number of vertices.
@@ -2,6 +2,7 @@
 #define BABYLON_MESHES_MESH_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_enums.h>
 #include <babylon/maths/isize.h>
 #include <babylon/maths/path3d.h>
 #include <babylon/meshes/abstract_mesh.h>
@@ -15,6 +16,7 @@ struct _InstancesBatch;
 struct _InstanceDataStorage;
 struct _InternalMeshDataInfo;
 struct _VisibleInstances;
+struct ISimplificationSettings;
 class Buffer;
 class Effect;
 class Geometry;
@@ -997,6 +999,23 @@ public:
    */
   Mesh& synchronizeInstances();
 
+  /**
+   * @brief Simplify the mesh according to the given array of settings.
+   * Function will return immediately and will simplify async, the simplified meshes being added
+   * as LOD levels of the mesh.
+   * @see https://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the simplification
+   * finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing = true,
+                 SimplificationType simplificationType = SimplificationType::QUADRATIC,
+                 const std::function<void(Mesh* mesh)>& successCallback = nullptr);
+
   /**
    * @brief Optimization of the mesh's indices, in case a mesh has duplicated
    * vertices. The function will only reorder the indices and will not remove
@@ -1035,6 +1054,12 @@ public:
    */
   void _syncGeometryWithMorphTargetManager();
 
+  /**
+   * @brief Hidden Blends the morph targets on the CPU and uploads the result when the influences
+   * changed since the last call (MorphTargetManager::useCPUBlending).
+   */
+  void _syncCPUMorphTargets();
+
   /**
    * @brief Creates points inside a mesh. This utility enables you to create and
    * store Vector3 points each of which is randomly positioned inside a given
@@ -1639,6 +1664,12 @@ public:
    */
   Float32Array& setNormalsForCPUSkinning();
 
+  /**
+   * @brief Prepare internal tangent array for software CPU skinning.
+   * @returns original tangents used for CPU skinning.
+   */
+  Float32Array& setTangentsForCPUSkinning();
+
   /**
    * @brief Updates the vertex buffer by applying transformation from the bones.
    * @param skeleton defines the skeleton to apply to current mesh
@@ -1646,6 +1677,16 @@ public:
    */
   Mesh* applySkeleton(const SkeletonPtr& skeleton);
 
+  /**
+   * @brief Gets the result of the last software skinning of the mesh (see applySkeleton), for
+   * physics or picking in compute-only pipelines. The data is not double buffered: the next
+   * skinning rewrites it in place from the worker threads of applySkeleton. It must only be read
+   * from the thread calling applySkeleton, between two calls.
+   * @param kind defines the data kind (Position, Normal or Tangent)
+   * @returns the skinned data, empty if the mesh was not skinned on the CPU
+   */
+  const Float32Array& getSoftwareSkinnedVerticesData(const std::string& kind) const;
+
   /** Tools **/
 
   /**
@@ -1843,6 +1884,12 @@ private:
   // influences)
   void normalizeSkinWeightsAndExtra();
   Mesh& _queueLoad(Scene* scene);
+  // Writes back the data without morphing of the vertices moved by the CPU blended morph targets,
+  // restoring the dense data of the targets of the manager if any
+  void _restoreCPUMorphTargets(const MorphTargetManagerPtr& manager);
+  // Uploads the vertices [first, end) of a vertex buffer whose data was written in place
+  void _uploadVerticesRange(const std::string& kind, size_t stride,
+                            const std::pair<size_t, size_t>& range);
 
 public:
   /** Events **/
@@ -1,24 +1,102 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <memory>
+#include <vector>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
 #include <babylon/meshes/simplification/isimplifier.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Result of the simplification of an indexed triangle list.
+ */
+struct BABYLON_SHARED_EXPORT QuadraticErrorSimplificationResult {
+  /**
+   * Indices of the remaining triangles, referencing the vertices of the source
+   */
+  IndicesArray indices;
+  /**
+   * Number of indices of each range of the source, in the same order
+   */
+  std::vector<size_t> indexCounts;
+  /**
+   * Number of triangles of the source
+   */
+  size_t sourceTriangleCount = 0;
+  /**
+   * Number of remaining triangles
+   */
+  size_t triangleCount = 0;
+  /**
+   * Largest distance of the collapsed surface to the source surface, relative to the extent of
+   * the source
+   */
+  float error = 0.f;
+}; // end of struct QuadraticErrorSimplificationResult
+
 /**
  * @brief An implementation of the Quadratic Error simplification algorithm.
  * Original paper : http://www1.cs.columbia.edu/~cs4162/html05s/garland97.pdf
- * Ported mostly from QSlim and
- * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html to babylon JS
- * @author RaananW
+ *
+ * The edges are collapsed by increasing quadric error, popped from a heap whose entries are
+ * invalidated when the neighborhood of their vertex changes. A vertex is collapsed into one of its
+ * neighbors, so the attributes of the remaining vertices are never interpolated. The vertices
+ * sharing a position are welded to find the attribute seams (UV or normal discontinuities): a
+ * seam vertex only moves along the seam with its twin, the borders only along the border, and the
+ * vertices where seams or borders meet are kept.
+ *
+ * The simplification runs on the worker threads of the ThreadPool, the mesh being read when
+ * simplify() is called and the simplified mesh created on the main thread.
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  /**
+   * @brief Creates a new simplifier of a mesh.
+   * @param mesh defines the mesh to simplify
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+  ~QuadraticErrorSimplification() override; // = default
+
+  /**
+   * @brief Simplification of the mesh according to the given settings, the simplified mesh being
+   * created hidden, with the material and the parent of the mesh.
+   * @param settings The settings of the simplification, the quality being the ratio of triangles
+   * to keep
+   * @param successCallback A callback that will be called on the main thread after the mesh was
+   * simplified, with nullptr if the mesh has no triangles or was disposed in the meantime.
+   */
+  void simplify(const ISimplificationSettings& settings,
+                const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback) override;
+
+  /**
+   * @brief Simplifies an indexed triangle list. Thread safe.
+   * @param positions defines the positions of the vertices
+   * @param indices defines the indices of the triangles
+   * @param quality defines the ratio of triangles to keep, between 0 and 1
+   * @param indexCounts defines the number of indices of each range of the indices simplified
+   * together (e.g. the submeshes), one range if empty
+   * @returns the remaining triangles
+   */
+  static QuadraticErrorSimplificationResult
+  SimplifyIndices(const Float32Array& positions, const IndicesArray& indices, float quality,
+                  const std::vector<size_t>& indexCounts = {});
+
+private:
+  struct SourceData;
+  struct SimplifiedData;
+
+  std::shared_ptr<const SourceData> _getSourceData();
+  static std::shared_ptr<SimplifiedData> _simplify(const SourceData& source, float quality);
+  static MeshPtr _reconstructMesh(Mesh& mesh, const SimplifiedData& simplified);
+
+private:
+  std::weak_ptr<Mesh> _mesh;
+  std::shared_ptr<const SourceData> _sourceData;
 
 }; // end of class QuadraticErrorSimplification
 
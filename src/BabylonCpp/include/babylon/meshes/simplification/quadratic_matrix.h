@@ -14,27 +14,32 @@ class BABYLON_SHARED_EXPORT QuadraticMatrix {
 
 public:
   QuadraticMatrix();
-  QuadraticMatrix(const std::array<float, 10>& data);
+  QuadraticMatrix(const std::array<double, 10>& data);
   QuadraticMatrix(const QuadraticMatrix& other);
   QuadraticMatrix(QuadraticMatrix&& other);
   QuadraticMatrix& operator=(const QuadraticMatrix& other);
   QuadraticMatrix& operator=(QuadraticMatrix&& other);
   ~QuadraticMatrix(); // = default
 
-  float det(unsigned int a11, unsigned int a12, unsigned int a13, //
-            unsigned int a21, unsigned int a22, int unsigned a23, //
-            int unsigned a31, int unsigned a32, int unsigned a33  //
+  double det(unsigned int a11, unsigned int a12, unsigned int a13, //
+             unsigned int a21, unsigned int a22, int unsigned a23, //
+             int unsigned a31, int unsigned a32, int unsigned a33  //
   );
   void addInPlace(const QuadraticMatrix& matrix);
-  void addArrayInPlace(const std::array<float, 10>& data);
+  void addArrayInPlace(const std::array<double, 10>& data);
   QuadraticMatrix add(const QuadraticMatrix& matrix);
 
-  static QuadraticMatrix FromData(float a, float b, float c, float d);
-  static std::array<float, 10> DataFromNumbers(float a, float b, float c,
-                                               float d);
+  /**
+   * @brief Evaluates the quadric at a point, i.e. the sum of the squared distances of the point to
+   * the planes of the quadric, weighted by the factors the planes were added with.
+   */
+  [[nodiscard]] double evaluate(double x, double y, double z) const;
+
+  static QuadraticMatrix FromData(double a, double b, double c, double d);
+  static std::array<double, 10> DataFromNumbers(double a, double b, double c, double d);
 
 private:
-  std::array<float, 10> data;
+  std::array<double, 10> data;
 
 }; // end of class QuadraticMatrix
 
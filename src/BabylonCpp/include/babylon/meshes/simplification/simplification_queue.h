@@ -1,6 +1,7 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <memory>
 #include <queue>
 
 #include <babylon/babylon_api.h>
@@ -9,12 +10,16 @@
 namespace BABYLON {
 
 class ISimplifier;
+class Mesh;
+using MeshPtr = std::shared_ptr<Mesh>;
 
 /**
- * @brief Queue used to order the simplification tasks.
+ * @brief Queue used to order the simplification tasks. The queue is shared, as the one of the
+ * scene, the levels simplified on worker threads being dropped if it is destroyed in the meantime.
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
  */
-class BABYLON_SHARED_EXPORT SimplificationQueue {
+class BABYLON_SHARED_EXPORT SimplificationQueue
+    : public std::enable_shared_from_this<SimplificationQueue> {
 
 public:
   /**
@@ -35,13 +40,20 @@ public:
   void executeNext();
 
   /**
-   * @brief Execute a simplification task.
+   * @brief Execute a simplification task, the levels being simplified on worker threads and added
+   * as LOD levels of the mesh of the task on the main thread. The next task is executed when all
+   * the levels are added.
    * @param task defines the task to run
    */
   void runSimplification(const ISimplificationTask& task);
 
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  std::shared_ptr<ISimplifier> getSimplifier(const ISimplificationTask& task);
+  void _simplifyLevel(const std::shared_ptr<ISimplifier>& simplifier,
+                      const std::shared_ptr<const ISimplificationTask>& task, size_t index);
+  void _addLODLevel(const ISimplificationTask& task, const ISimplificationSettings& setting,
+                    const MeshPtr& simplifiedMesh);
+  void _endSimplification(const ISimplificationTask& task);
 
 public:
   /**
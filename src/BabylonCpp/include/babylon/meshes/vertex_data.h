@@ -595,6 +595,17 @@ public:
                              Float32Array& normals,
                              std::optional<FacetParameters> options = std::nullopt);
 
+  /**
+   * @brief Compute normals for given positions and indices, and the facet data of the given
+   * parameters.
+   * @param positions an array of vertex positions, [...., x, y, z, ......]
+   * @param indices an array of indices in groups of three for each triangular facet
+   * @param normals an array of vertex normals, [...., x, y, z, ......]
+   * @param options the facet parameters (see above), whose arrays are updated
+   */
+  static void ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
+                             Float32Array& normals, FacetParameters& options);
+
   /**
    * @brief Applies VertexData created from the imported parameters to the
    * geometry.
@@ -629,6 +640,8 @@ private:
   static std::unique_ptr<VertexData> _ExtractFrom(IGetSetVerticesData* meshOrGeometry,
                                                   bool copyWhenShared = false,
                                                   bool forceCopy      = false);
+  static void _ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
+                              Float32Array& normals, FacetParameters* options);
 
 public:
   /**
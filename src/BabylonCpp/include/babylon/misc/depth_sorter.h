@@ -0,0 +1,114 @@
+#ifndef BABYLON_MISC_DEPTH_SORTER_H
+#define BABYLON_MISC_DEPTH_SORTER_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Sorts items by depth, used for the transparent submeshes and the solid particles.
+ *
+ * The depths are mapped to unsigned integer keys preserving their order and sorted with a least
+ * significant digit radix sort (3 passes of 11 bits, a pass being skipped when all the keys share
+ * its digit). When the items are the same as during the previous sort, their previous order is
+ * first fixed with an insertion sort, which is cheaper than the radix sort for the small changes
+ * of depth happening from one frame to the next. The insertion sort gives up (falling back to the
+ * radix sort) after a number of moves proportional to the number of items. Both sorts are stable:
+ * items with equal depths keep their relative order.
+ */
+class BABYLON_SHARED_EXPORT DepthSorter {
+
+public:
+  /**
+   * @brief Maps a float to an unsigned integer with the same order (-0 sorts before +0).
+   */
+  static uint32_t FloatToKey(float value)
+  {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Negative floats: flip all the bits, positive floats: flip the sign bit
+    return bits ^ ((bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+  }
+
+public:
+  DepthSorter();
+  ~DepthSorter(); // = default
+
+  /**
+   * @brief Sorts the items by depth.
+   * @param depths defines the depth of each item
+   * @param count defines the number of items
+   * @param descending defines if the deepest items come first
+   * @returns the indices of the items in sorted order
+   */
+  const std::vector<uint32_t>& sort(const float* depths, size_t count, bool descending = false);
+
+  /**
+   * @brief Sorts the items by depth.
+   * @param count defines the number of items
+   * @param depthOf defines the function returning the depth of an item from its index
+   * @param descending defines if the deepest items come first
+   * @returns the indices of the items in sorted order
+   */
+  template <typename DepthFunction>
+  const std::vector<uint32_t>& sort(size_t count, DepthFunction&& depthOf, bool descending = false)
+  {
+    _keys.resize(count);
+    const auto mask = descending ? 0xFFFFFFFFu : 0u;
+    for (size_t i = 0; i < count; ++i) {
+      _keys[i] = FloatToKey(static_cast<float>(depthOf(i))) ^ mask;
+    }
+    return _sortKeys();
+  }
+
+  /**
+   * @brief Returns the indices of the items in the order of the last sort.
+   */
+  [[nodiscard]] const std::vector<uint32_t>& order() const;
+
+  /**
+   * @brief Returns true if the last sort only needed the insertion sort.
+   */
+  [[nodiscard]] bool lastSortWasIncremental() const;
+
+  /**
+   * @brief Forgets the previous order, the next sort starts from the order of the items.
+   */
+  void reset();
+
+public:
+  /**
+   * Specifies if the previous order is used as the starting point of the next sort (default
+   * true)
+   */
+  bool incremental;
+
+  /**
+   * Number of moves, relative to the number of items, after which the insertion sort falls back
+   * to the radix sort (default 0.5)
+   */
+  float maxIncrementalMoveRatio;
+
+private:
+  const std::vector<uint32_t>& _sortKeys();
+  bool _insertionSort(size_t maxMoves);
+  void _radixSort();
+
+private:
+  std::vector<uint32_t> _keys;
+  // Key in the high 32 bits, item index in the low 32 bits
+  std::vector<uint64_t> _items;
+  std::vector<uint64_t> _buffer;
+  std::vector<uint32_t> _histograms;
+  std::vector<uint32_t> _order;
+  bool _lastSortWasIncremental;
+
+}; // end of class DepthSorter
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_DEPTH_SORTER_H
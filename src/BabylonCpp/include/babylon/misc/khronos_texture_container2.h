@@ -0,0 +1,159 @@
+#ifndef BABYLON_MISC_KHRONOS_TEXTURE_CONTAINER2_H
+#define BABYLON_MISC_KHRONOS_TEXTURE_CONTAINER2_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/misc/ktx2_transcoder.h>
+
+namespace BABYLON {
+
+class InternalTexture;
+class ThinEngine;
+class ThreadPool;
+using InternalTexturePtr = std::shared_ptr<InternalTexture>;
+
+/**
+ * @brief Options used to pick the format a KTX2 file is transcoded to.
+ */
+struct BABYLON_SHARED_EXPORT KTX2DecoderOptions {
+  /** ASTC textures can be uploaded */
+  bool astc = false;
+  /** BC7 (BPTC) textures can be uploaded */
+  bool bptc = false;
+  /** BC1 / BC3 (S3TC) textures can be uploaded */
+  bool s3tc = false;
+  /** ETC2 textures can be uploaded */
+  bool etc2 = false;
+  /** ETC1 textures can be uploaded */
+  bool etc1 = false;
+  /** Always transcode to RGBA */
+  bool forceRGBA = false;
+  /** UASTC files are transcoded to RGBA rather than to a lower quality format if neither ASTC nor
+   * BC7 is available */
+  bool useRGBAIfASTCBC7NotAvailableWhenUASTC = false;
+}; // end of struct KTX2DecoderOptions
+
+/**
+ * @brief Level of a decoded KTX2 file, ready to be uploaded.
+ */
+struct BABYLON_SHARED_EXPORT KTX2DecodedLevel {
+  Uint8Array data;
+  int width  = 0;
+  int height = 0;
+}; // end of struct KTX2DecodedLevel
+
+/**
+ * @brief Result of the decoding of a KTX2 file.
+ */
+struct BABYLON_SHARED_EXPORT KTX2DecodedTexture {
+  /** GL internal format of the levels (TEXTUREFORMAT_RGBA if not compressed) */
+  unsigned int internalFormat = 0;
+  bool isCompressed           = false;
+  bool isInGammaSpace         = false;
+  bool hasAlpha               = false;
+  /** Name of the transcoder used, empty if the levels were used as stored in the file */
+  std::string transcoderName;
+  /** The levels, the first one being the largest */
+  std::vector<KTX2DecodedLevel> levels;
+  /** The reason of the failure, empty on success */
+  std::string errorMessage;
+}; // end of struct KTX2DecodedTexture
+
+/**
+ * @brief Reader and decoder of KTX2 files.
+ *
+ * Basis Universal files (ETC1S / UASTC) are transcoded on worker threads to the best compressed
+ * format supported by the engine (ASTC, BC7, BC3 / BC1, ETC2 / ETC1), falling back to RGBA8,
+ * using the transcoders registered with RegisterTranscoder. Files storing a GPU format without
+ * supercompression are uploaded as is, the formats the engine cannot upload being decoded to RGBA8
+ * on worker threads when possible (8 bits per channel R, RG, RGB and BGR(A) formats, BC1 and BC3).
+ *
+ * for file layout see https://github.khronos.org/KTX-Specification/
+ */
+class BABYLON_SHARED_EXPORT KhronosTextureContainer2 {
+
+public:
+  using OnDecodedFunction = std::function<void(const KTX2DecodedTexture& decoded)>;
+
+  /** Supercompression schemes */
+  static constexpr uint32_t SupercompressionScheme_None      = 0;
+  static constexpr uint32_t SupercompressionScheme_BasisLZ   = 1;
+  static constexpr uint32_t SupercompressionScheme_ZStandard = 2;
+  static constexpr uint32_t SupercompressionScheme_ZLib      = 3;
+
+  /**
+   * Options used by the decoder, in addition to the capabilities of the engine
+   */
+  static KTX2DecoderOptions DefaultDecoderOptions;
+
+  /**
+   * @brief Registers a transcoder. The transcoders registered last are tried first.
+   */
+  static void RegisterTranscoder(const KTX2TranscoderPtr& transcoder);
+
+  /**
+   * @brief Unregisters all the transcoders.
+   */
+  static void ClearTranscoders();
+
+  /**
+   * @brief Checks if the given data starts with a KTX2 file identifier.
+   * @param data the data to check
+   * @returns true if the data is a KTX2 file or false otherwise
+   */
+  static bool IsValid(const ArrayBufferView& data);
+
+  /**
+   * @brief Decodes a KTX2 file on the calling thread, the levels being transcoded in parallel.
+   * This function is thread-safe.
+   * @param data contents of the KTX2 file
+   * @param options the formats which can be uploaded
+   * @param pool the thread pool used to transcode the levels, the default pool is used if null
+   * @returns the decoded texture
+   */
+  static KTX2DecodedTexture Decode(const ArrayBufferView& data, const KTX2DecoderOptions& options,
+                                   ThreadPool* pool = nullptr);
+
+public:
+  /**
+   * @brief Creates a new KhronosTextureContainer2.
+   * @param engine the engine the decoded textures are uploaded to
+   */
+  KhronosTextureContainer2(ThinEngine* engine);
+  ~KhronosTextureContainer2(); // = default
+
+  /**
+   * @brief Decodes a KTX2 file on a worker thread. The callback is raised on the main thread, or
+   * synchronously if there is no worker thread or if asynchronous loading is disabled.
+   * @param data contents of the KTX2 file
+   * @param onDecoded the callback receiving the decoded texture
+   */
+  void decodeAsync(const ArrayBufferView& data, const OnDecodedFunction& onDecoded) const;
+
+  /**
+   * @brief Uploads the decoded levels to a texture. It is assumed that the texture has already been
+   * created & is currently bound.
+   * Hidden
+   */
+  void uploadLevels(const InternalTexturePtr& texture, const KTX2DecodedTexture& decoded,
+                    bool loadMipmaps) const;
+
+  /**
+   * @brief Returns the decoder options matching the capabilities of the engine.
+   */
+  KTX2DecoderOptions decoderOptions() const;
+
+private:
+  ThinEngine* _engine;
+
+}; // end of class KhronosTextureContainer2
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_KHRONOS_TEXTURE_CONTAINER2_H
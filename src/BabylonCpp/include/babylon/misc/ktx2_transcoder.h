@@ -0,0 +1,99 @@
+#ifndef BABYLON_MISC_KTX2_TRANSCODER_H
+#define BABYLON_MISC_KTX2_TRANSCODER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Supercompressed formats a KTX2 file can hold.
+ */
+enum class KTX2SourceTextureFormat {
+  /** Basis Universal ETC1S, supercompressed with BasisLZ */
+  ETC1S,
+  /** Basis Universal UASTC, optionally supercompressed with Zstandard */
+  UASTC4x4,
+}; // end of enum class KTX2SourceTextureFormat
+
+/**
+ * @brief GPU formats a KTX2 file can be transcoded to, by decreasing quality.
+ */
+enum class KTX2TranscodeTarget {
+  ASTC_4x4_RGBA,
+  BC7_RGBA,
+  BC3_RGBA,
+  BC1_RGB,
+  ETC2_RGBA,
+  ETC1_RGB,
+  RGBA32,
+}; // end of enum class KTX2TranscodeTarget
+
+/**
+ * @brief Description of the transcoding of one level of a KTX2 file.
+ */
+struct BABYLON_SHARED_EXPORT KTX2TranscodeRequest {
+  KTX2SourceTextureFormat sourceFormat = KTX2SourceTextureFormat::ETC1S;
+  KTX2TranscodeTarget targetFormat     = KTX2TranscodeTarget::RGBA32;
+  /** Index of the level, 0 being the largest */
+  uint32_t level = 0;
+  /** Size of the level in pixels */
+  uint32_t width  = 0;
+  uint32_t height = 0;
+  /** Supercompression scheme of the file (0: none, 1: BasisLZ, 2: Zstandard, 3: Zlib) */
+  uint32_t supercompressionScheme = 0;
+  /** Size of the level once the supercompression is removed */
+  uint64_t uncompressedByteLength = 0;
+  bool hasAlpha                   = false;
+  bool isInGammaSpace             = false;
+  /** Data of the level, as stored in the file */
+  const uint8_t* encodedData = nullptr;
+  size_t encodedByteLength   = 0;
+  /** Supercompression global data of the file (BasisLZ codebooks and image descriptions) */
+  const uint8_t* supercompressionGlobalData = nullptr;
+  size_t supercompressionGlobalDataLength   = 0;
+}; // end of struct KTX2TranscodeRequest
+
+/**
+ * @brief Transcodes the Basis Universal levels of KTX2 files.
+ *
+ * The Basis Universal transcoder is not part of the library: applications shipping KTX2 textures
+ * register an implementation (typically a thin wrapper around basisu_transcoder) with
+ * KhronosTextureContainer2::RegisterTranscoder. Implementations are called from worker threads
+ * and must be thread-safe.
+ */
+class BABYLON_SHARED_EXPORT KTX2Transcoder {
+
+public:
+  virtual ~KTX2Transcoder() = default;
+
+  /**
+   * @brief Returns the name of the transcoder, used for logging.
+   */
+  virtual std::string name() const = 0;
+
+  /**
+   * @brief Returns true if the transcoder can convert the given source format to the given target.
+   */
+  virtual bool canTranscode(KTX2SourceTextureFormat sourceFormat, KTX2TranscodeTarget targetFormat,
+                            bool isInGammaSpace) const = 0;
+
+  /**
+   * @brief Transcodes a level.
+   * @param request the description of the level
+   * @param output receives the data of the level in the target format
+   * @returns true on success
+   */
+  virtual bool transcode(const KTX2TranscodeRequest& request, Uint8Array& output) = 0;
+
+}; // end of class KTX2Transcoder
+
+using KTX2TranscoderPtr = std::shared_ptr<KTX2Transcoder>;
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_KTX2_TRANSCODER_H
@@ -1,19 +1,41 @@
 #ifndef BABYLON_MISC_OPTIMIZATION_PARTICLES_OPTIMIZATION_H
 #define BABYLON_MISC_OPTIMIZATION_PARTICLES_OPTIMIZATION_H
 
+#include <cstddef>
+
 #include <babylon/babylon_api.h>
 #include <babylon/misc/optimization/scene_optimization.h>
 
 namespace BABYLON {
 
+/**
+ * @brief Disables the particles of the scene or, when a budget is given, enables the
+ * ParticleBudgetManager of the scene and halves its budget each time the optimization is applied,
+ * from maxParticles down to minParticles.
+ */
 class BABYLON_SHARED_EXPORT ParticlesOptimization : public SceneOptimization {
 
 public:
-  ParticlesOptimization(int priority = 0);
+  ParticlesOptimization(int priority = 0, size_t maxParticles = 0, size_t minParticles = 0);
   ~ParticlesOptimization() override; // = default
 
   bool apply(Scene* scene) override;
 
+public:
+  /**
+   * Budget of particles set the first time the optimization is applied, the particles are
+   * disabled when 0
+   */
+  size_t maxParticles;
+
+  /**
+   * Budget of particles below which the optimization is done
+   */
+  size_t minParticles;
+
+private:
+  size_t _currentBudget;
+
 }; // end of class ParticlesOptimization
 
 } // end of namespace BABYLON
@@ -1,6 +1,7 @@
 #ifndef BABYLON_MISC_OPTIMIZATION_SCENE_OPTIMIZER_OPTIONS_H
 #define BABYLON_MISC_OPTIMIZATION_SCENE_OPTIMIZER_OPTIONS_H
 
+#include <memory>
 #include <vector>
 
 #include <babylon/babylon_api.h>
@@ -28,7 +29,7 @@ public:
                                                       = 60);
 
 public:
-  std::vector<SceneOptimization> optimizations;
+  std::vector<std::shared_ptr<SceneOptimization>> optimizations;
   float targetFrameRate;
   int trackerDuration;
 
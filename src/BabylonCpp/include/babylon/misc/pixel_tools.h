@@ -0,0 +1,57 @@
+#ifndef BABYLON_MISC_PIXEL_TOOLS_H
+#define BABYLON_MISC_PIXEL_TOOLS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+struct Image;
+
+/**
+ * @brief Class used to host CPU side pixel transformations applied to decoded images.
+ *
+ * When the library is built with OPTION_ENABLE_SIMD, the hot loops use SSE2 (SSSE3 for the channel
+ * expansion) and produce the same results as the scalar code.
+ */
+struct BABYLON_SHARED_EXPORT PixelTools {
+
+  /**
+   * @brief Flips an image vertically, in place.
+   * @param pixels the pixel data
+   * @param rowBytes the number of bytes of a row
+   * @param height the number of rows
+   */
+  static void FlipVertically(uint8_t* pixels, size_t rowBytes, size_t height);
+
+  /**
+   * @brief Expands 1 (grey), 2 (grey, alpha), 3 (RGB) or 4 (RGBA) channels pixels to RGBA.
+   * @param src the source pixels
+   * @param components the number of channels of the source pixels
+   * @param dst the destination RGBA pixels, must hold pixelCount * 4 bytes
+   * @param pixelCount the number of pixels to convert
+   */
+  static void ExpandToRGBA(const uint8_t* src, int components, uint8_t* dst, size_t pixelCount);
+
+  /**
+   * @brief Multiplies the color channels of RGBA pixels by their alpha, in place.
+   * @param rgba the RGBA pixels
+   * @param pixelCount the number of pixels
+   */
+  static void PremultiplyAlpha(uint8_t* rgba, size_t pixelCount);
+
+  /**
+   * @brief Computes the next level of a mip chain with a 2x2 box filter. Odd dimensions are
+   * handled by clamping the sampled coordinates.
+   * @param image the RGBA8 source level
+   * @return the RGBA8 level of half the size (at least 1x1)
+   */
+  static Image DownsampleRGBA(const Image& image);
+
+}; // end of struct PixelTools
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_PIXEL_TOOLS_H
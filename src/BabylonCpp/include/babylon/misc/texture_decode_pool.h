@@ -0,0 +1,135 @@
+#ifndef BABYLON_MISC_TEXTURE_DECODE_POOL_H
+#define BABYLON_MISC_TEXTURE_DECODE_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/structs.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+
+/**
+ * @brief Options of the decoding of an image.
+ */
+struct BABYLON_SHARED_EXPORT TextureDecodeOptions {
+  /**
+   * Defines if the rows of the image are flipped (first row at the bottom)
+   */
+  bool flipVertically = false;
+  /**
+   * Defines if the color channels are multiplied by the alpha channel
+   */
+  bool premultiplyAlpha = false;
+  /**
+   * Defines if the mip chain of the image is computed on the CPU
+   */
+  bool generateMipMaps = false;
+}; // end of struct TextureDecodeOptions
+
+/**
+ * @brief Result of the decoding of an image.
+ */
+struct BABYLON_SHARED_EXPORT DecodedImage {
+  /**
+   * The decoded RGBA8 image (first level), invalid if the decoding failed
+   */
+  Image image;
+  /**
+   * The following levels of the mip chain, down to 1x1, if requested
+   */
+  std::vector<Image> mipMaps;
+  /**
+   * The reason of the failure, if any
+   */
+  std::string errorMessage;
+}; // end of struct DecodedImage
+
+/**
+ * @brief Decodes PNG / JPEG / TGA / BMP / HDR images on worker threads.
+ *
+ * The decoding never touches the global state of stb_image: the vertical flip, the channel
+ * expansion to RGBA, the alpha premultiplication and the mip chain are computed afterwards with
+ * PixelTools. The decoded images are delivered on the main thread (see asio::HeartBeat_Sync), so
+ * only the upload of the pixels remains to be done on the GL thread.
+ */
+class BABYLON_SHARED_EXPORT TextureDecodePool {
+
+public:
+  using OnDecodedFunction = std::function<void(const DecodedImage& decoded)>;
+
+public:
+  /**
+   * @brief Returns the pool used by the file tools, running on the default thread pool.
+   */
+  static TextureDecodePool& Default();
+
+  /**
+   * @brief Decodes an image on the calling thread. This function is thread-safe.
+   * @param buffer the encoded image
+   * @param options the decoding options
+   * @return the decoded image
+   */
+  static DecodedImage Decode(const ArrayBuffer& buffer, const TextureDecodeOptions& options = {});
+
+public:
+  /**
+   * @brief Creates a decode pool.
+   * @param pool the thread pool running the decoding jobs, the default pool is used if null
+   */
+  explicit TextureDecodePool(ThreadPool* pool = nullptr);
+  ~TextureDecodePool(); // = default
+
+  TextureDecodePool(const TextureDecodePool& other) = delete;
+  TextureDecodePool& operator=(const TextureDecodePool& other) = delete;
+
+  /**
+   * @brief Decodes an image on a worker thread. The callback is raised on the main thread, or
+   * synchronously if there is no worker thread or if asynchronous loading is disabled.
+   * @param buffer the encoded image
+   * @param options the decoding options
+   * @param onDecoded the callback receiving the decoded image (invalid if the decoding failed)
+   */
+  void decodeAsync(ArrayBuffer buffer, const TextureDecodeOptions& options,
+                   const OnDecodedFunction& onDecoded);
+
+  /**
+   * @brief Decodes a batch of images in parallel, blocking until all of them are decoded.
+   * @param buffers the encoded images
+   * @param options the decoding options
+   * @return the decoded images, in the order of the buffers
+   */
+  std::vector<DecodedImage> decodeAll(const std::vector<ArrayBuffer>& buffers,
+                                      const TextureDecodeOptions& options = {});
+
+  /**
+   * @brief Returns the number of asynchronous decodings not finished yet.
+   */
+  size_t pendingDecodes() const;
+
+  /**
+   * @brief Waits for the asynchronous decodings in flight and raises their callbacks. Must be
+   * called from the main thread.
+   */
+  void waitAll();
+
+private:
+  void _waitWorkers();
+
+private:
+  ThreadPool* _pool;
+  mutable std::mutex _mutex;
+  std::condition_variable _idle;
+  size_t _pendingDecodes;
+
+}; // end of class TextureDecodePool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_TEXTURE_DECODE_POOL_H
@@ -7,6 +7,7 @@
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
 #include <babylon/misc/observable.h>
+#include <babylon/morph/sparse_morph_deltas.h>
 
 using json = nlohmann::json;
 
@@ -59,7 +60,7 @@ public:
 
   /**
    * @brief Gets the position data stored in this target.
-   * @returns a FloatArray containing the position data (or null if not present)
+   * @returns a FloatArray containing the position data (or null if not present or compressed)
    */
   Float32Array& getPositions();
 
@@ -155,6 +156,56 @@ public:
   static MorphTargetPtr FromMesh(const AbstractMeshPtr& mesh, std::string name,
                                  float influence = 0.f);
 
+  /**
+   * @brief Gets the number of bytes used by the data of the target, dense or compressed.
+   */
+  [[nodiscard]] size_t getMemorySize() const;
+
+  /**
+   * @brief Hidden Replaces the position, normal and tangent data of the target by sparse deltas
+   * against the data of a mesh (see MorphTargetManager::useCPUBlending), the dense data being
+   * released. The data whose size does not match the mesh data stays dense.
+   * @param basePositions the positions of the mesh without morphing
+   * @param baseNormals the normals of the mesh without morphing (can be empty)
+   * @param baseTangents the tangents of the mesh without morphing, 4 floats per vertex (can be
+   * empty)
+   * @param tolerance the deltas within this tolerance are ignored
+   */
+  void _compress(const Float32Array& basePositions, const Float32Array& baseNormals,
+                 const Float32Array& baseTangents, float tolerance);
+
+  /**
+   * @brief Hidden Restores the dense data of a compressed target from the data of a mesh without
+   * morphing.
+   */
+  void _decompress(const Float32Array& basePositions, const Float32Array& baseNormals,
+                   const Float32Array& baseTangents);
+
+  /**
+   * @brief Hidden Returns whether the data of the target was compressed and not set since.
+   */
+  [[nodiscard]] bool _isCompressed() const;
+
+  /**
+   * @brief Hidden Returns the number of vertices of the position data, dense or compressed.
+   */
+  [[nodiscard]] size_t _getVertexCount() const;
+
+  /**
+   * @brief Hidden Sparse deltas of the positions (empty if not compressed).
+   */
+  [[nodiscard]] const SparseMorphDeltas& _getSparsePositions() const;
+
+  /**
+   * @brief Hidden Sparse deltas of the normals (empty if not compressed).
+   */
+  [[nodiscard]] const SparseMorphDeltas& _getSparseNormals() const;
+
+  /**
+   * @brief Hidden Sparse deltas of the xyz components of the tangents (empty if not compressed).
+   */
+  [[nodiscard]] const SparseMorphDeltas& _getSparseTangents() const;
+
 protected:
   /**
    * @brief Gets the influence of this target (ie. its weight in the overall
@@ -273,6 +324,10 @@ private:
   Float32Array _normals;
   Float32Array _tangents;
   Float32Array _uvs;
+  bool _compressed;
+  SparseMorphDeltas _sparsePositions;
+  SparseMorphDeltas _sparseNormals;
+  SparseMorphDeltas _sparseTangents;
   float _influence;
   size_t _uniqueId;
   AnimationPropertiesOverridePtr _animationPropertiesOverride;
@@ -1,6 +1,8 @@
 #ifndef BABYLON_MORPH_MORPH_TARGET_MANAGER_H
 #define BABYLON_MORPH_MORPH_TARGET_MANAGER_H
 
+#include <utility>
+
 #include <babylon/babylon_api.h>
 #include <babylon/misc/observer.h>
 #include <babylon/morph/morph_target.h>
@@ -10,6 +12,30 @@ namespace BABYLON {
 class MorphTargetManager;
 using MorphTargetManagerPtr = std::shared_ptr<MorphTargetManager>;
 
+/**
+ * @brief Hidden Vertices of a mesh moved by the morph targets blended on the CPU, with their data
+ * without morphing.
+ */
+struct BABYLON_SHARED_EXPORT _MorphTargetsCPUBase {
+  /**
+   * @brief Writes the data without morphing of the moved vertices in the data of the mesh.
+   * @returns the range [first, end) of the vertices written
+   */
+  std::pair<size_t, size_t> restore(Float32Array& meshPositions, Float32Array& meshNormals,
+                                    Float32Array& meshTangents) const;
+
+  /** Sorted indices of the vertices moved by the targets */
+  std::vector<uint32_t> vertices;
+  /** Positions of these vertices without morphing */
+  Float32Array positions;
+  /** Normals of these vertices without morphing */
+  Float32Array normals;
+  /** Tangents of these vertices without morphing, 4 floats per vertex */
+  Float32Array tangents;
+  /** Layout of the targets the vertices were gathered for */
+  size_t layoutId = 0;
+}; // end of struct _MorphTargetsCPUBase
+
 /**
  * @brief This class is used to deform meshes using morphing between different targets.
  * @see http://doc.babylonjs.com/how_to/how_to_use_morphtargets
@@ -74,6 +100,39 @@ public:
    */
   void synchronize();
 
+  /**
+   * @brief Blends the active targets on the CPU (see useCPUBlending) in the data of a mesh, only
+   * the vertices moved by the targets being written. The targets are compressed to sparse deltas
+   * against the data of the mesh the first time they are blended, and their dense data released.
+   * @param base the vertices moved by the targets and their data without morphing, gathered when
+   * the targets change
+   * @param positions the positions of the mesh
+   * @param normals the normals of the mesh (can be empty)
+   * @param tangents the tangents of the mesh, 4 floats per vertex (can be empty)
+   * @returns the range [first, end) of the vertices written
+   */
+  std::pair<size_t, size_t> blendOnCPU(_MorphTargetsCPUBase& base, Float32Array& positions,
+                                       Float32Array& normals, Float32Array& tangents);
+
+  /**
+   * @brief Hidden Restores the dense data of the targets compressed by the CPU blending.
+   * @param positions the positions of the mesh without morphing
+   * @param normals the normals of the mesh without morphing (can be empty)
+   * @param tangents the tangents of the mesh without morphing, 4 floats per vertex (can be empty)
+   */
+  void _decompressTargets(const Float32Array& positions, const Float32Array& normals,
+                          const Float32Array& tangents);
+
+  /**
+   * @brief Gets the number of bytes used by the data of the targets, dense or compressed.
+   */
+  [[nodiscard]] size_t getTargetsMemorySize() const;
+
+  /**
+   * @brief Hidden (incremented each time the active targets or their influences change)
+   */
+  [[nodiscard]] size_t _getInfluencesUpdateId() const;
+
   // Statics
   static MorphTargetManagerPtr Parse(const json& serializationObject, Scene* scene);
 
@@ -119,6 +178,16 @@ protected:
    */
   [[nodiscard]] size_t get_numInfluencers() const;
 
+  /**
+   * @brief Gets a boolean indicating if the targets are blended on the CPU.
+   */
+  [[nodiscard]] bool get_useCPUBlending() const;
+
+  /**
+   * @brief Sets a boolean indicating if the targets are blended on the CPU.
+   */
+  void set_useCPUBlending(bool value);
+
   /**
    * @brief Gets the list of influences (one per target).
    */
@@ -183,6 +252,22 @@ public:
    */
   ReadOnlyProperty<MorphTargetManager, Float32Array> influences;
 
+  /**
+   * Gets or sets a boolean indicating if the targets are blended on the CPU instead of the vertex
+   * shader. The targets are then stored as sparse quantized deltas against the data of the first
+   * mesh blending them (the meshes sharing the manager are expected to share this data), no target
+   * vertex buffer is created and the number of active targets is not limited by the materials.
+   * The moved vertices are uploaded once per frame, when the influences changed. The dense data of
+   * the targets is restored when the CPU blending is disabled.
+   */
+  Property<MorphTargetManager, bool> useCPUBlending;
+
+  /**
+   * Deltas smaller than this tolerance are ignored when compressing the targets blended on the
+   * CPU
+   */
+  float cpuBlendingTolerance;
+
 private:
   std::vector<MorphTargetPtr> _targets;
   std::vector<Observer<bool>::Ptr> _targetInfluenceChangedObservers;
@@ -196,6 +281,9 @@ private:
   size_t _vertexCount;
   size_t _uniqueId;
   Float32Array _tempInfluences;
+  bool _useCPUBlending;
+  size_t _influencesUpdateId;
+  size_t _targetsLayoutId;
 
 }; // end of class MorphTargetManager
 
@@ -0,0 +1,87 @@
+#ifndef BABYLON_MORPH_SPARSE_MORPH_DELTAS_H
+#define BABYLON_MORPH_SPARSE_MORPH_DELTAS_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Compressed difference between a morph target stream (positions, normals, ...) and the
+ * base data of the mesh.
+ *
+ * Only the vertices moved by the target are stored: their index and their quantized delta (one
+ * int16 per component, padded to 4 components, dequantized with a single scale). A facial blend
+ * shape typically moves a small part of the mesh, which makes the deltas an order of magnitude
+ * smaller than the dense target data. Accumulating the deltas in a stream uses SSE when the
+ * library is built with OPTION_ENABLE_SIMD; both paths give the same results. The SSE
+ * accumulation is compiled on every SSE2 target, so that it can be checked against the scalar one.
+ */
+struct BABYLON_SHARED_EXPORT SparseMorphDeltas {
+
+  /** Maximum number of components of a stream */
+  static constexpr size_t MaxComponents = 4;
+
+  /**
+   * @brief Compresses the difference between a target stream and the base stream.
+   * @param base the base data of the mesh
+   * @param target the data of the morph target (same size as the base data)
+   * @param components the number of components per vertex (at most 4)
+   * @param tolerance the vertices whose delta components are all within the tolerance are skipped
+   * @returns the sparse deltas, empty if the streams are incompatible or identical
+   */
+  static SparseMorphDeltas Compress(const Float32Array& base, const Float32Array& target,
+                                    size_t components, float tolerance = 0.f);
+
+  /**
+   * @brief Adds influence * delta to a stream.
+   * @param influence the influence of the target
+   * @param output the stream to update (vertexCount * stride floats)
+   * @param stride the number of floats per vertex in the stream, 0 for the number of components
+   * (used to update the xyz components of 4 floats tangents)
+   */
+  void accumulate(float influence, float* output, size_t stride = 0) const;
+
+  /**
+   * @brief Adds influence * delta to a stream without SIMD instructions.
+   * @see accumulate
+   */
+  void accumulateScalar(float influence, float* output, size_t stride = 0) const;
+
+  /**
+   * @brief Adds influence * delta to a stream with SSE instructions. The components of the
+   * stream which are not part of the deltas are left untouched.
+   * @see accumulate
+   * @returns false if the target does not support SSE2, the stream being then left untouched
+   */
+  bool accumulateSSE2(float influence, float* output, size_t stride = 0) const;
+
+  /**
+   * @brief Returns the number of bytes used by the deltas.
+   */
+  [[nodiscard]] size_t memorySize() const;
+
+  /**
+   * @brief Returns whether the target does not move any vertex.
+   */
+  [[nodiscard]] bool empty() const;
+
+  /** Number of components per vertex */
+  size_t components = 3;
+  /** Number of vertices of the stream */
+  size_t vertexCount = 0;
+  /** Dequantization scale (delta = value * scale) */
+  float scale = 0.f;
+  /** Indices of the moved vertices */
+  std::vector<uint32_t> indices;
+  /** Quantized deltas, 4 per moved vertex */
+  std::vector<int16_t> values;
+
+}; // end of struct SparseMorphDeltas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MORPH_SPARSE_MORPH_DELTAS_H
@@ -0,0 +1,162 @@
+#ifndef BABYLON_PARTICLES_GPU_PARTICLE_BUFFER_POOL_H
+#define BABYLON_PARTICLES_GPU_PARTICLE_BUFFER_POOL_H
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Buffer;
+class Scene;
+
+/**
+ * @brief Range of particles in a page of a GPUParticleBufferPool.
+ */
+struct BABYLON_SHARED_EXPORT GPUParticleBufferRange {
+  /** Index of the page */
+  size_t page = 0;
+  /** Index of the first particle of the range in the page */
+  size_t offset = 0;
+  /** Number of particles of the range */
+  size_t count = 0;
+}; // end of struct GPUParticleBufferRange
+
+/**
+ * @brief Allocates ranges of particles in pages of a fixed capacity.
+ *
+ * The first free range large enough is used (first fit), the released ranges are merged with their
+ * free neighbours and a new page is added when no page has enough room. A range larger than the
+ * capacity of the pages gets its own page.
+ */
+class BABYLON_SHARED_EXPORT GPUParticleRangeAllocator {
+
+public:
+  GPUParticleRangeAllocator(size_t pageCapacity);
+  ~GPUParticleRangeAllocator(); // = default
+
+  /**
+   * @brief Allocates a range.
+   * @param count the number of particles of the range
+   * @returns the range, in a new page if its index is not lower than the previous page count
+   */
+  GPUParticleBufferRange allocate(size_t count);
+
+  /**
+   * @brief Releases a range allocated with allocate().
+   */
+  void release(const GPUParticleBufferRange& range);
+
+  /**
+   * @brief Gets the number of pages.
+   */
+  [[nodiscard]] size_t getPageCount() const;
+
+  /**
+   * @brief Gets the number of particles a page can store.
+   */
+  [[nodiscard]] size_t getPageCapacity(size_t page) const;
+
+  /**
+   * @brief Gets the number of particles allocated in a page.
+   */
+  [[nodiscard]] size_t getUsedCount(size_t page) const;
+
+  /**
+   * @brief Releases all the ranges and pages.
+   */
+  void clear();
+
+private:
+  size_t _pageCapacity;
+  std::vector<size_t> _pageCapacities;
+  std::vector<size_t> _usedCounts;
+  // Free ranges of each page: offset -> count
+  std::vector<std::map<size_t, size_t>> _freeRanges;
+
+}; // end of class GPUParticleRangeAllocator
+
+/**
+ * @brief Particles allocated in a GPUParticleBufferPool.
+ */
+struct BABYLON_SHARED_EXPORT GPUParticleBufferAllocation {
+  /** Number of floats per particle */
+  size_t stride = 0;
+  /** Range of the particles in the buffers */
+  GPUParticleBufferRange range;
+  /** The two buffers alternatively read and written by the transform feedback */
+  std::array<Buffer*, 2> buffers{{nullptr, nullptr}};
+}; // end of struct GPUParticleBufferAllocation
+
+/**
+ * @brief Vertex buffers shared by the GPU particle systems of a scene.
+ *
+ * The particles of the systems with the same layout (number of floats per particle) are stored in
+ * pages of two updatable buffers, each system using a range of a page. The transform feedback of a
+ * system only writes its range, so that small systems (sparks, impacts...) do not each create and
+ * upload their own pair of buffers when they start. The ranges are only tracked on the CPU, the
+ * buffers are never read back.
+ *
+ * The pool only shares the storage: each system still runs its own update pass (bound to its
+ * range) and its own render pass. The systems of a page are not updated in a single draw, as the
+ * parameters of each system (emitter type, gradients, noise...) are set as separate uniforms and
+ * textures of its own update effect.
+ */
+class BABYLON_SHARED_EXPORT GPUParticleBufferPool {
+
+public:
+  /** Default number of particles of a page */
+  static constexpr size_t DefaultPageCapacity = 16384;
+
+  /**
+   * @brief Returns the pool of a scene, creating it if needed.
+   */
+  static GPUParticleBufferPool& ForScene(Scene* scene);
+
+public:
+  GPUParticleBufferPool(Scene* scene, size_t pageCapacity = DefaultPageCapacity);
+  ~GPUParticleBufferPool(); // = default
+
+  /**
+   * @brief Allocates a range of particles and uploads their initial data in both buffers.
+   * @param stride the number of floats per particle
+   * @param data the initial data of the particles
+   * @returns the allocation
+   */
+  GPUParticleBufferAllocation allocate(size_t stride, const Float32Array& data);
+
+  /**
+   * @brief Releases particles allocated with allocate().
+   */
+  void release(const GPUParticleBufferAllocation& allocation);
+
+  /**
+   * @brief Gets the number of pages of buffers created for all the layouts.
+   */
+  [[nodiscard]] size_t getPageCount() const;
+
+  /**
+   * @brief Releases all the buffers.
+   */
+  void dispose();
+
+private:
+  struct StridePages {
+    GPUParticleRangeAllocator allocator;
+    std::vector<std::array<std::unique_ptr<Buffer>, 2>> buffers;
+  };
+
+private:
+  Scene* _scene;
+  size_t _pageCapacity;
+  std::map<size_t, StridePages> _pages;
+
+}; // end of class GPUParticleBufferPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_GPU_PARTICLE_BUFFER_POOL_H
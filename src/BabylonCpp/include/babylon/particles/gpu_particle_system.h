@@ -15,6 +15,7 @@ class IGLVertexArrayObject;
 class Buffer;
 class Effect;
 class Engine;
+struct GPUParticleBufferAllocation;
 class GPUParticleSystem;
 struct IEffectCreationOptions;
 class Mesh;
@@ -438,8 +439,9 @@ protected:
 private:
   void _addFactorGradient(std::vector<FactorGradient>& factorGradients, float gradient,
                           float factor);
-  WebGLVertexArrayObjectPtr _createUpdateVAO(Buffer* source);
-  WebGLVertexArrayObjectPtr _createRenderVAO(Buffer* source, Buffer* spriteSource);
+  WebGLVertexArrayObjectPtr _createUpdateVAO(Buffer* source, size_t baseOffset);
+  WebGLVertexArrayObjectPtr _createRenderVAO(Buffer* source, Buffer* spriteSource,
+                                             size_t baseOffset);
   void _initialize(bool force = false);
   RawTexture* _getRawTextureByName(const std::string& textureName);
   void _setRawTextureByName(const std::string& textureName,
@@ -467,6 +469,15 @@ public:
    */
   Property<GPUParticleSystem, size_t> activeParticleCount;
 
+  /**
+   * Gets or sets a boolean indicating that the particles are stored in the buffers shared by the
+   * GPU particle systems of the scene (see GPUParticleBufferPool) instead of buffers created for
+   * this system (default false). Changing it is taken into account when the buffers are created.
+   * This only saves the creation and upload of the buffers, the system still issues its own update
+   * and render draws.
+   */
+  bool usePooledBuffers;
+
 private:
   size_t _capacity;
   size_t _activeCount;
@@ -478,6 +489,7 @@ private:
   std::unique_ptr<Buffer> _buffer0;
   std::unique_ptr<Buffer> _buffer1;
   std::unique_ptr<Buffer> _spriteBuffer;
+  std::unique_ptr<GPUParticleBufferAllocation> _bufferAllocation;
   std::vector<WebGLVertexArrayObjectPtr> _updateVAO;
   std::vector<WebGLVertexArrayObjectPtr> _renderVAO;
 
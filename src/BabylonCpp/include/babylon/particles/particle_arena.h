@@ -0,0 +1,166 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_ARENA_H
+#define BABYLON_PARTICLES_PARTICLE_ARENA_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/misc/observer.h>
+#include <babylon/misc/perf_counter.h>
+
+namespace BABYLON {
+
+class Particle;
+class ParticleSystem;
+class Scene;
+
+/**
+ * @brief Storage of the particles and of the sub-emitter systems shared by the particle systems of
+ * a scene, so that steady-state particle effects do not allocate.
+ *
+ * The particles are allocated by blocks of blockSize particles and recycled through free lists, one
+ * per thread using the arena. The particle systems keep their dead particles in their own stock and
+ * give all their particles back to the arena when they are reset or disposed, the next systems
+ * reusing them.
+ *
+ * The systems started by the sub-emitters of a particle system are recycled by template: a system
+ * whose animation ended goes back to the pool of its template instead of being disposed, and is
+ * restarted by the next sub-emitter of the same template. The heap allocations made by the arena
+ * are counted per frame (see getAllocationsCounter() and
+ * SceneInstrumentation::particleAllocationsCounter).
+ */
+class BABYLON_SHARED_EXPORT ParticleArena {
+
+public:
+  /**
+   * Maximum number of free lists, the threads beyond it sharing the free lists
+   */
+  static constexpr size_t MaxThreadFreeLists = 16;
+
+public:
+  /**
+   * @brief Returns the arena of a scene, creating it if needed.
+   */
+  static ParticleArena& ForScene(Scene* scene);
+
+  ParticleArena(Scene* scene);
+  ~ParticleArena(); // = default
+
+  /**
+   * @brief Gets a particle for a particle system, allocating a block of particles when the free
+   * lists are empty. Thread safe.
+   * @param particleSystem the particle system the particle belongs to
+   * @returns the particle, in the state of a new particle of the system
+   */
+  Particle* acquireParticle(ParticleSystem* particleSystem);
+
+  /**
+   * @brief Gives a particle back to the arena. Thread safe.
+   */
+  void releaseParticle(Particle* particle);
+
+  /**
+   * @brief Gives particles back to the arena and clears the list. Thread safe.
+   */
+  void releaseParticles(std::vector<Particle*>& particles);
+
+  /**
+   * @brief Gets a stopped particle system created from a sub-emitter template, creating it when
+   * all the systems of the template are running. Main thread only.
+   * @param templateSystem the particle system used as template
+   * @returns the particle system, owned by the scene
+   */
+  ParticleSystem* acquireSubSystem(ParticleSystem* templateSystem);
+
+  /**
+   * @brief Gives back a particle system returned by acquireSubSystem() whose animation ended, the
+   * system being disposed after the frame if its template was disposed. Main thread only.
+   */
+  void releaseSubSystem(ParticleSystem* subSystem);
+
+  /**
+   * @brief Gets the number of heap allocations made by the arena since its creation.
+   */
+  [[nodiscard]] size_t getAllocationCount() const;
+
+  /**
+   * @brief Gets the number of particles allocated by the arena.
+   */
+  [[nodiscard]] size_t getParticleCount() const;
+
+  /**
+   * @brief Gets the number of particles in the free lists.
+   */
+  [[nodiscard]] size_t getFreeParticleCount() const;
+
+  /**
+   * @brief Gets the number of sub-emitter systems created by the arena.
+   */
+  [[nodiscard]] size_t getSubSystemCount() const;
+
+  /**
+   * @brief Gets the number of stopped sub-emitter systems waiting in the pools.
+   */
+  [[nodiscard]] size_t getFreeSubSystemCount() const;
+
+  /**
+   * @brief Gets the perf counter of the heap allocations made by the arena during each frame.
+   */
+  PerfCounter& getAllocationsCounter();
+
+  /**
+   * @brief Hidden Starts a new frame of the allocations counter, its current value being the
+   * number of allocations made since the previous frame.
+   */
+  void _fetchNewFrame();
+
+  /**
+   * @brief Releases the pools of sub-emitter systems, the systems being disposed by the scene.
+   */
+  void dispose();
+
+private:
+  struct FreeList {
+    mutable std::mutex mutex;
+    std::vector<Particle*> particles;
+  };
+
+  struct SubSystemPool {
+    std::vector<ParticleSystem*> freeSystems;
+    Observer<ParticleSystem>::Ptr onTemplateDisposeObserver = nullptr;
+  };
+
+  FreeList& _getThreadFreeList();
+  bool _stealParticles(FreeList& freeList);
+  void _allocateBlock(ParticleSystem* particleSystem, FreeList& freeList);
+  void _reserveFreeList(FreeList& freeList, size_t count);
+  void _countAllocation();
+  void _removeSubSystemPool(ParticleSystem* templateSystem);
+
+public:
+  /**
+   * Number of particles allocated at once when the free lists are empty (256 by default)
+   */
+  size_t blockSize;
+
+private:
+  Scene* _scene;
+  std::mutex _blocksMutex;
+  std::vector<std::vector<Particle>> _blocks;
+  std::array<FreeList, MaxThreadFreeLists> _freeLists;
+  std::atomic<size_t> _particleCount;
+  std::atomic<size_t> _allocationCount;
+  std::atomic<size_t> _frameAllocationCount;
+  std::unordered_map<ParticleSystem*, SubSystemPool> _subSystemPools;
+  size_t _subSystemCount;
+  PerfCounter _allocationsCounter;
+
+}; // end of class ParticleArena
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_ARENA_H
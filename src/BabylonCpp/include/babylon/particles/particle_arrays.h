@@ -0,0 +1,152 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_ARRAYS_H
+#define BABYLON_PARTICLES_PARTICLE_ARRAYS_H
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class ColorGradient;
+struct FactorGradient;
+
+/**
+ * @brief Parameters of ParticleArrays::update. A null or empty gradient list is not applied.
+ */
+struct BABYLON_SHARED_EXPORT ParticleArraysUpdate {
+  /** Time step of the update (ParticleSystem::updateSpeed scaled by the animation ratio) */
+  float step = 0.f;
+  /** Gravity applied to the directions */
+  Vector3 gravity;
+  /** Color gradients, else the colors are updated with their color steps */
+  const std::vector<ColorGradient>* colorGradients = nullptr;
+  /** Size gradients */
+  const std::vector<FactorGradient>* sizeGradients = nullptr;
+  /** Angular speed gradients */
+  const std::vector<FactorGradient>* angularSpeedGradients = nullptr;
+  /** Velocity gradients, scaling the directions when the particles move */
+  const std::vector<FactorGradient>* velocityGradients = nullptr;
+  /** Limit velocity gradients, the directions faster than the limit are scaled by the damping */
+  const std::vector<FactorGradient>* limitVelocityGradients = nullptr;
+  float limitVelocityDamping = 0.4f;
+  /** Drag gradients */
+  const std::vector<FactorGradient>* dragGradients = nullptr;
+  /** Number of particles updated by a task of the default thread pool */
+  size_t blockSize = 4096;
+}; // end of struct ParticleArraysUpdate
+
+/**
+ * @brief Particles stored as a structure of arrays (see ParticleSystem::useParticleArrays).
+ *
+ * Each property of the particles is stored in its own contiguous array, so that the update kernels
+ * process 4 particles per instruction (SSE when the library is built with OPTION_ENABLE_SIMD) on
+ * blocks of particles spread on the default thread pool. Both paths perform the same operations in
+ * the same order, and the SSE kernels are compiled on every SSE2 target so that they can be
+ * checked against the scalar ones. The gradients are sampled with the seed of each particle to
+ * pick a value between the two factors (or colors) of a gradient, and dead particles are removed
+ * by moving the last particle in their slot.
+ */
+class BABYLON_SHARED_EXPORT ParticleArrays {
+
+public:
+  ParticleArrays();
+  ~ParticleArrays(); // = default
+
+  /**
+   * @brief Returns the number of particles.
+   */
+  [[nodiscard]] size_t count() const;
+
+  /**
+   * @brief Returns the number of particles the arrays can hold.
+   */
+  [[nodiscard]] size_t capacity() const;
+
+  /**
+   * @brief Resizes the arrays to hold the given number of particles, the particles beyond the new
+   * capacity are removed.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Adds a particle whose properties are set to 0.
+   * @returns the index of the particle, or the capacity if the arrays are full
+   */
+  size_t add();
+
+  /**
+   * @brief Removes all the particles.
+   */
+  void clear();
+
+  /**
+   * @brief Ages, moves and updates the gradients of the particles. The particles reaching their
+   * life time are not removed (see removeDeadParticles).
+   */
+  void update(const ParticleArraysUpdate& parameters);
+
+  /**
+   * @brief Updates the particles without SIMD instructions.
+   * @see update
+   */
+  void updateScalar(const ParticleArraysUpdate& parameters);
+
+  /**
+   * @brief Updates the particles with SSE instructions.
+   * @see update
+   * @returns false if the target does not support SSE2, the particles being then left untouched
+   */
+  bool updateSSE2(const ParticleArraysUpdate& parameters);
+
+  /**
+   * @brief Removes the particles whose age reached their life time, moving the last particle in
+   * the slot of each removed one.
+   * @returns the number of removed particles
+   */
+  size_t removeDeadParticles();
+
+  /**
+   * @brief Removes the dead particles without SIMD instructions.
+   * @see removeDeadParticles
+   */
+  size_t removeDeadParticlesScalar();
+
+  /**
+   * @brief Removes the dead particles, skipping the groups of living particles with SSE
+   * instructions.
+   * @see removeDeadParticles
+   * @returns the number of removed particles, nothing if the target does not support SSE2 (the
+   * particles being then left untouched)
+   */
+  std::optional<size_t> removeDeadParticlesSSE2();
+
+private:
+  static constexpr size_t StreamCount = 22;
+
+  std::array<Float32Array*, StreamCount> _streams();
+  void _move(size_t from, size_t to);
+
+public:
+  Float32Array positionX, positionY, positionZ;
+  Float32Array directionX, directionY, directionZ;
+  Float32Array colorR, colorG, colorB, colorA;
+  Float32Array colorStepR, colorStepG, colorStepB, colorStepA;
+  Float32Array age, lifeTime;
+  Float32Array size, scaleX, scaleY;
+  Float32Array angle, angularSpeed;
+  /** Random value in [0, 1) picking the values between the two factors (or colors) of gradients */
+  Float32Array gradientSeed;
+
+private:
+  size_t _count;
+
+}; // end of class ParticleArrays
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_ARRAYS_H
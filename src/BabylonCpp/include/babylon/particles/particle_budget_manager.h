@@ -0,0 +1,167 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_BUDGET_MANAGER_H
+#define BABYLON_PARTICLES_PARTICLE_BUDGET_MANAGER_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/misc/observable.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class ParticleSystem;
+class Scene;
+
+/**
+ * @brief Share of the particle budget given to a particle system during a frame.
+ */
+struct BABYLON_SHARED_EXPORT ParticleBudgetDecision {
+  /** The particle system */
+  ParticleSystem* particleSystem = nullptr;
+  /** Whether the emitter is in the camera frustum */
+  bool visible = true;
+  /** Diameter of the emitter divided by the height of the screen */
+  float screenSize = 1.f;
+  /** Distance between the emitter and the camera */
+  float distance = 0.f;
+  /** Area of the largest particle divided by the area of the screen */
+  float particleScreenArea = 0.f;
+  /** Number of particles alive when the decision was taken */
+  size_t liveParticles = 0;
+  /** Capacity of the particle system */
+  size_t requestedCapacity = 0;
+  /** Number of particles the system can keep alive */
+  size_t capacity = 0;
+  /** Scale applied to the emit rate of the system */
+  float emitRateScale = 1.f;
+  /** Number of frames between two updates of the system */
+  unsigned int updateInterval = 1;
+}; // end of struct ParticleBudgetDecision
+
+/**
+ * @brief Keeps the CPU particle systems of a scene within a global budget of particles and of
+ * overdraw.
+ *
+ * Once per frame, before the particles are animated, the share of each started ParticleSystem is
+ * computed from the size of its emitter on screen and its distance to the active camera:
+ * - the systems smaller on screen than fullRateScreenSize are updated every few frames, up to
+ * maxUpdateInterval, the skipped time being added to the next update,
+ * - when the capacities of the systems exceed maxParticles, the budget is shared proportionally to
+ * the screen sizes, the small and hidden systems losing their particles first,
+ * - when the estimated overdraw (particles times their screen area) exceeds maxOverdraw, all the
+ * shares are scaled down.
+ * The emit rates are scaled by the same ratio as the capacities so that the particles are spread
+ * over their life time instead of being emitted until the capacity is reached. The decisions of
+ * the last frame are kept for instrumentation (see getDecisions() and SceneInstrumentation). GPU
+ * particle systems are not budgeted as their number of live particles is not known on the CPU.
+ */
+class BABYLON_SHARED_EXPORT ParticleBudgetManager {
+
+public:
+  /**
+   * @brief Returns the budget manager of a scene, creating it if needed.
+   */
+  static ParticleBudgetManager& ForScene(Scene* scene);
+
+public:
+  ParticleBudgetManager(Scene* scene);
+  ~ParticleBudgetManager(); // = default
+
+  /**
+   * @brief Computes the decisions of the started particle systems of the scene and applies them.
+   * Called before the particles are animated.
+   */
+  void update();
+
+  /**
+   * @brief Computes the capacities, emit rate scales and update intervals of decisions whose
+   * visibility, screen sizes, particle screen areas and requested capacities are set.
+   */
+  void allocate(std::vector<ParticleBudgetDecision>& decisions) const;
+
+  /**
+   * @brief Gets the decisions taken during the last update.
+   */
+  [[nodiscard]] const std::vector<ParticleBudgetDecision>& getDecisions() const;
+
+  /**
+   * @brief Gets the number of particles alive during the last update.
+   */
+  [[nodiscard]] size_t getLiveParticleCount() const;
+
+  /**
+   * @brief Gets the number of particles allowed by the decisions of the last update.
+   */
+  [[nodiscard]] size_t getAllowedParticleCount() const;
+
+  /**
+   * @brief Gets the overdraw (in screens) estimated for the allowed particles of the last update.
+   */
+  [[nodiscard]] float getEstimatedOverdraw() const;
+
+  /**
+   * @brief Restores the full rate of the particle systems and stops updating them.
+   */
+  void dispose();
+
+public:
+  /**
+   * Whether the budget is enforced, the particle systems run at full rate otherwise
+   */
+  bool enabled;
+
+  /**
+   * Number of particles shared by all the particle systems (default 10000)
+   */
+  size_t maxParticles;
+
+  /**
+   * Overdraw, in screens, allowed for all the particles, 0 to disable the limit (default 0)
+   */
+  float maxOverdraw;
+
+  /**
+   * Screen size (diameter of the emitter divided by the height of the screen) above which a
+   * system is updated every frame (default 0.1)
+   */
+  float fullRateScreenSize;
+
+  /**
+   * Maximum number of frames between two updates of a system (default 4)
+   */
+  unsigned int maxUpdateInterval;
+
+  /**
+   * Smallest weight of a system when the budget is shared, given to the hidden systems (default
+   * 0.05)
+   */
+  float minWeight;
+
+  /**
+   * Radius used for the emitters which are not meshes (default 1)
+   */
+  float emitterRadius;
+
+  /**
+   * An event triggered after the decisions of a frame are applied
+   */
+  Observable<ParticleBudgetManager> onDecisionsAppliedObservable;
+
+private:
+  void _reset();
+
+private:
+  Scene* _scene;
+  Observer<Scene>::Ptr _onBeforeParticlesRenderingObserver;
+  int _updateFrameId;
+  std::vector<ParticleBudgetDecision> _decisions;
+  size_t _liveParticleCount;
+  size_t _allowedParticleCount;
+  float _estimatedOverdraw;
+
+}; // end of class ParticleBudgetManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_BUDGET_MANAGER_H
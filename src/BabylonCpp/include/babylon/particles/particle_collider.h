@@ -0,0 +1,85 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_COLLIDER_H
+#define BABYLON_PARTICLES_PARTICLE_COLLIDER_H
+
+#include <memory>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class ParticleArrays;
+class ParticleCollider;
+class SignedDistanceField;
+class Vector3;
+using ParticleColliderPtr    = std::shared_ptr<ParticleCollider>;
+using SignedDistanceFieldPtr = std::shared_ptr<SignedDistanceField>;
+
+/**
+ * @brief Collides particles with the geometry baked in a signed distance field (see
+ * ParticleSystem::collider and PointsCloudSystem::collider).
+ *
+ * A particle closer to the geometry than its radius is pushed back along the gradient of the
+ * field, and its velocity moving into the geometry is reflected: the normal part of the velocity
+ * is scaled by the restitution and the tangential part by one minus the friction. The particles
+ * are tested without any ray cast, so a particle moving farther than the band width of the field
+ * during a frame can go through thin geometry.
+ */
+class BABYLON_SHARED_EXPORT ParticleCollider {
+
+public:
+  ParticleCollider(const SignedDistanceFieldPtr& field = nullptr);
+  ~ParticleCollider(); // = default
+
+  /**
+   * @brief Collides a particle.
+   * @param position the position of the particle
+   * @param velocity the velocity (or direction) of the particle
+   * @returns true if the particle collided
+   */
+  bool collide(Vector3& position, Vector3& velocity) const;
+
+  /**
+   * @brief Collides the particles stored in arrays, using their directions as velocities, in
+   * blocks spread on the default thread pool.
+   * @returns the number of particles which collided
+   */
+  size_t collide(ParticleArrays& particles) const;
+
+  /**
+   * @brief Collides the particles [begin, end) stored in arrays on the calling thread.
+   * @returns the number of particles which collided
+   */
+  size_t collideRange(ParticleArrays& particles, size_t begin, size_t end) const;
+
+public:
+  /**
+   * The field storing the distances to the geometry, nothing collides without it
+   */
+  SignedDistanceFieldPtr field;
+
+  /**
+   * Distance to the geometry below which a particle collides (default 0)
+   */
+  float radius;
+
+  /**
+   * Ratio of the normal velocity kept after a collision, 0 stops the particle and 1 is a perfect
+   * bounce (default 0.5)
+   */
+  float restitution;
+
+  /**
+   * Ratio of the tangential velocity lost during a collision (default 0.1)
+   */
+  float friction;
+
+  /**
+   * Number of particles collided by a task of the default thread pool (default 4096)
+   */
+  size_t blockSize;
+
+}; // end of class ParticleCollider
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_COLLIDER_H
@@ -0,0 +1,180 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_PRE_WARM_CACHE_H
+#define BABYLON_PARTICLES_PARTICLE_PRE_WARM_CACHE_H
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/misc/factor_gradient.h>
+#include <babylon/particles/particle_arrays.h>
+
+namespace BABYLON {
+
+class IParticleEmitterType;
+class Particle;
+class ParticleCollider;
+struct ParticlePreWarmState;
+using ParticlePreWarmStatePtr = std::shared_ptr<const ParticlePreWarmState>;
+
+/**
+ * @brief State of the emission of particles stored in particle arrays.
+ */
+struct BABYLON_SHARED_EXPORT ParticleArraysEmission {
+  /** Scratch particle given to the emitter functions */
+  Particle* particle = nullptr;
+  /** World matrix of the emitter */
+  Matrix emitterWorldMatrix;
+  /** Maximum number of particles */
+  size_t capacity = 0;
+  /** Time elapsed since the start of the system */
+  float actualFrame = 0.f;
+  /** Start size gradient and factors picked when the gradient was reached */
+  std::optional<FactorGradient> currentStartSizeGradient;
+  float currentStartSize1 = 0.f;
+  float currentStartSize2 = 0.f;
+}; // end of struct ParticleArraysEmission
+
+/**
+ * @brief Properties of a particle system read by the emission and the updates of the particles
+ * stored in particle arrays. The gradients, the emitter and the collider are referenced, the ones
+ * of the system or, for a pre-warm simulated on a worker thread, copies owned by the job.
+ */
+struct BABYLON_SHARED_EXPORT ParticleArraysSettings {
+  using StartFunction = std::function<void(const Matrix& worldMatrix, Vector3& vectorToUpdate,
+                                           Particle* particle, bool isLocal)>;
+
+  /** Emit rate, scaled by the particle budget */
+  float emitRate = 0.f;
+  const std::vector<FactorGradient>* emitRateGradients = nullptr;
+  /** Duration of the emission, 0 if the system is not stopped */
+  int targetStopDuration = 0;
+  /** Ranges of the values given to the new particles */
+  float minLifeTime        = 0.f;
+  float maxLifeTime        = 0.f;
+  float minEmitPower       = 0.f;
+  float maxEmitPower       = 0.f;
+  float minSize            = 0.f;
+  float maxSize            = 0.f;
+  float minScaleX          = 0.f;
+  float maxScaleX          = 0.f;
+  float minScaleY          = 0.f;
+  float maxScaleY          = 0.f;
+  float minAngularSpeed    = 0.f;
+  float maxAngularSpeed    = 0.f;
+  float minInitialRotation = 0.f;
+  float maxInitialRotation = 0.f;
+  Color4 color1;
+  Color4 color2;
+  Color4 colorDead;
+  Vector3 inheritedVelocityOffset;
+  /** Gradients only sampled when the particles are emitted */
+  const std::vector<FactorGradient>* lifeTimeGradients  = nullptr;
+  const std::vector<FactorGradient>* startSizeGradients = nullptr;
+  /** Emitter of the particles, the start functions being used instead when set */
+  IParticleEmitterType* particleEmitterType   = nullptr;
+  const StartFunction* startPositionFunction  = nullptr;
+  const StartFunction* startDirectionFunction = nullptr;
+  /** Parameters of the updates, the other gradients being sampled at emission too */
+  ParticleArraysUpdate update;
+  /** Collider applied after the updates */
+  const ParticleCollider* collider = nullptr;
+}; // end of struct ParticleArraysSettings
+
+/**
+ * @brief Particles of a system using particle arrays and the state of its emission after its
+ * pre-warm cycles (see ParticleSystem::preWarmAsync and ParticleSystem::preWarmSnapshotKey).
+ */
+struct BABYLON_SHARED_EXPORT ParticlePreWarmState {
+  /** Pre-warm parameters of the simulation */
+  size_t preWarmCycles    = 0;
+  float preWarmStepOffset = 1.f;
+  float updateSpeed       = 0.f;
+  /** Emission parameters of the simulation */
+  float emitRate    = 0.f;
+  float minLifeTime = 0.f;
+  float maxLifeTime = 0.f;
+  /** Emitter type of the simulation, shared by the systems created from the same template */
+  std::weak_ptr<IParticleEmitterType> emitter;
+  /** Particles, in world space */
+  ParticleArrays particles;
+  /** Emission state, the world matrix being the one of the emitter during the simulation */
+  ParticleArraysEmission emission;
+  float newPartsExcess = 0.f;
+  bool stopped         = false;
+  /** Emit rate gradient and factors picked when the gradient was reached */
+  std::optional<FactorGradient> currentEmitRateGradient;
+  float currentEmitRate1 = 0.f;
+  float currentEmitRate2 = 0.f;
+
+  /**
+   * @brief Returns whether the state was simulated with the parameters of another state: the
+   * pre-warm parameters, the capacity, the emit rate, the life times and the same emitter type.
+   */
+  [[nodiscard]] bool matches(const ParticlePreWarmState& other) const;
+
+  /**
+   * @brief Moves the particles along with their emitter, from the world matrix of the emitter
+   * during the simulation to its current one.
+   * @param emitterWorldMatrix the current world matrix of the emitter
+   */
+  void moveToEmitter(const Matrix& emitterWorldMatrix);
+
+}; // end of struct ParticlePreWarmState
+
+/**
+ * @brief Pre-warmed particles of particle systems shared by key, so that the systems spawned from
+ * the same template start from a copy of the particles of the first one instead of simulating
+ * their pre-warm cycles. Only used from the main thread.
+ */
+class BABYLON_SHARED_EXPORT ParticlePreWarmCache {
+
+public:
+  /**
+   * @brief Returns the process wide cache.
+   */
+  static ParticlePreWarmCache& Default();
+
+  ParticlePreWarmCache();
+  ~ParticlePreWarmCache(); // = default
+
+  /**
+   * @brief Gets the state stored with a key.
+   * @returns the state, nullptr if none
+   */
+  [[nodiscard]] ParticlePreWarmStatePtr get(const std::string& key) const;
+
+  /**
+   * @brief Stores a state, replacing the state previously stored with the key.
+   */
+  void set(const std::string& key, const ParticlePreWarmStatePtr& state);
+
+  /**
+   * @brief Removes the state stored with a key.
+   */
+  void remove(const std::string& key);
+
+  /**
+   * @brief Removes all the states.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the number of stored states.
+   */
+  [[nodiscard]] size_t size() const;
+
+private:
+  std::unordered_map<std::string, ParticlePreWarmStatePtr> _states;
+
+}; // end of class ParticlePreWarmCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_PRE_WARM_CACHE_H
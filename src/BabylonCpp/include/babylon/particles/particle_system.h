@@ -1,6 +1,9 @@
 #ifndef BABYLON_PARTICLES_PARTICLE_SYSTEM_H
 #define BABYLON_PARTICLES_PARTICLE_SYSTEM_H
 
+#include <atomic>
+#include <unordered_map>
+
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
 #include <babylon/engines/constants.h>
@@ -8,7 +11,6 @@
 #include <babylon/misc/observer.h>
 #include <babylon/particles/base_particle_system.h>
 #include <babylon/particles/iparticle_system.h>
-#include <unordered_map>
 
 namespace BABYLON {
 
@@ -16,12 +18,18 @@ class Buffer;
 class Effect;
 class Mesh;
 class Particle;
+class ParticleArrays;
+class ParticleCollider;
+struct ParticleArraysEmission;
+struct ParticleArraysSettings;
+struct ParticlePreWarmState;
 class Scene;
 class VertexBuffer;
 class WebGLDataBuffer;
-using EffectPtr          = std::shared_ptr<Effect>;
-using VertexBufferPtr    = std::shared_ptr<VertexBuffer>;
-using WebGLDataBufferPtr = std::shared_ptr<WebGLDataBuffer>;
+using EffectPtr           = std::shared_ptr<Effect>;
+using ParticleColliderPtr = std::shared_ptr<ParticleCollider>;
+using VertexBufferPtr     = std::shared_ptr<VertexBuffer>;
+using WebGLDataBufferPtr  = std::shared_ptr<WebGLDataBuffer>;
 
 /**
  * @brief This represents a particle system in Babylon.
@@ -306,6 +314,12 @@ public:
    */
   std::vector<Particle*>& particles();
 
+  /**
+   * @brief Gets the number of active particles, whether they are stored as Particle objects or in
+   * particle arrays (see useParticleArrays).
+   */
+  [[nodiscard]] size_t getActiveParticleCount() const;
+
   /**
    * @brief Returns the string "ParticleSystem".
    * @returns a string containing the class name
@@ -331,6 +345,13 @@ public:
    */
   [[nodiscard]] bool isStarted() const override;
 
+  /**
+   * @brief Gets whether the pre-warm cycles of the system are being simulated on the default
+   * thread pool (see preWarmAsync). The system is not animated meanwhile.
+   * @returns True if the pre-warm is running, otherwise false.
+   */
+  [[nodiscard]] bool isPreWarming() const;
+
   /**
    * @brief Starts the particle system and begins to emit.
    * @param delay defines the delay in milliseconds before starting the system
@@ -362,6 +383,13 @@ public:
    */
   void _appendParticleVertex(unsigned int index, Particle* particle, int offsetX, int offsetY);
 
+  /**
+   * @brief Hidden Creates a stopped particle system with the properties of this one, used as
+   * sub-emitter template (see ParticleArena::acquireSubSystem()).
+   * @returns the particle system, owned by the scene
+   */
+  ParticleSystem* _instantiateSubSystem();
+
   /**
    * @brief "Recycles" one of the particle by copying it back to the "stock" of
    * particles and removing it from the active list. Its lifetime will start
@@ -494,6 +522,21 @@ private:
   void _emitFromParticle(Particle* particle);
   // End of sub system methods
   void _update(int newParticles);
+  bool _canUseParticleArrays();
+  void _updateParticleArrays(int newParticles);
+  [[nodiscard]] ParticleArraysSettings _getParticleArraysSettings(float step) const;
+  static void _emitParticleArrays(ParticleArrays& particles, int newParticles,
+                                  ParticleArraysEmission& emission,
+                                  const ParticleArraysSettings& settings);
+  Matrix _computeEmitterWorldMatrix();
+  bool _canPreWarmAsync();
+  void _preWarm();
+  static void _simulatePreWarm(ParticlePreWarmState& state, const ParticleArraysSettings& settings,
+                               const std::atomic<bool>& cancelled);
+  bool _finishPreWarm();
+  void _applyPreWarmState(ParticlePreWarmState state, bool store);
+  void _cancelPreWarm();
+  void _appendParticleArrayVertices();
   EffectPtr _getEffect(unsigned int blendMode);
   void _appendParticleVertices(unsigned int offset, Particle* particle);
   size_t _render(unsigned int blendMode);
@@ -513,6 +556,56 @@ public:
    */
   std::function<void(std::vector<Particle*>& particles)> updateFunction;
 
+  /**
+   * Specifies if the particles are stored as a structure of arrays updated by vectorized kernels
+   * on the default thread pool instead of Particle objects (default is false). The arrays are not
+   * used with local particles, noise textures, ramp gradients, animation sheets or sub-emitters, in
+   * which case the Particle objects are used. In this mode updateFunction is not called and
+   * particles() is empty.
+   */
+  bool useParticleArrays;
+
+  /**
+   * Collider applied to the particles after their update, also when updateFunction is replaced
+   * (default nullptr). Local particles do not collide.
+   */
+  ParticleColliderPtr collider;
+
+  /**
+   * Specifies if the pre-warm cycles are simulated on the default thread pool when the system is
+   * started (default is false). The particles are swapped in once simulated, the system not being
+   * animated meanwhile, and the properties read by the simulation are copied when the system is
+   * started. Only used with the particle arrays, without start functions and with the box, cone,
+   * cylinder, hemispheric, point or sphere emitters, the cycles being simulated on the calling
+   * thread otherwise.
+   */
+  bool preWarmAsync;
+
+  /**
+   * Key of the pre-warmed particles of the system in the ParticlePreWarmCache (default is empty,
+   * not cached). The systems created from the same template can share a key so that only the first
+   * one simulates its pre-warm cycles, the next ones starting from a copy of its particles moved
+   * along with their emitter. The copy is only used by the systems sharing the emitter type (as the
+   * sub-emitter systems of a template do) with the same emit rate, life times and pre-warm
+   * parameters. Only used with the particle arrays.
+   */
+  std::string preWarmSnapshotKey;
+
+  /**
+   * Hidden Scale of the emit rate set by the ParticleBudgetManager of the scene
+   */
+  float _budgetEmitRateScale;
+
+  /**
+   * Hidden Number of particles allowed by the ParticleBudgetManager of the scene
+   */
+  size_t _budgetCapacity;
+
+  /**
+   * Hidden Number of frames between two updates set by the ParticleBudgetManager of the scene
+   */
+  unsigned int _budgetUpdateInterval;
+
   /**
    * This function can be defined to specify initial direction for every new
    * particle. It by default use the emitterType defined function
@@ -581,13 +674,25 @@ public:
    */
   std::vector<ParticleSystem*> activeSubSystems;
 
+  /**
+   * Hidden Template of the system when it was created by the ParticleArena for a sub-emitter, the
+   * system going back to the pool of its template when its animation ends
+   */
+  ParticleSystem* _subEmitterTemplate;
+
 private:
   Observer<ParticleSystem>::Ptr _onDisposeObserver;
   std::vector<Particle*> _particles;
   float _epsilon;
   size_t _capacity;
   std::vector<Particle*> _stockParticles;
-  int _newPartsExcess;
+  std::unique_ptr<ParticleArrays> _particleArrays;
+  // Particle given to the emitter functions when the particle arrays are used
+  std::unique_ptr<Particle> _emissionParticle;
+  float _newPartsExcess;
+  // Pre-warm running on the default thread pool
+  struct PreWarmJob;
+  std::shared_ptr<PreWarmJob> _preWarmJob;
   Float32Array _vertexData;
   std::unique_ptr<Buffer> _vertexBuffer;
   std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
@@ -607,8 +712,11 @@ private:
 
   bool _started;
   bool _stopped;
-  int _actualFrame;
-  int _scaledUpdateSpeed;
+  float _actualFrame;
+  float _scaledUpdateSpeed;
+  // Frames skipped and their animation ratio when the budget reduces the update frequency
+  unsigned int _budgetSkippedFrames;
+  float _budgetSkippedRatio;
   unsigned int _vertexBufferSize;
   int _rawTextureWidth;
   RawTexturePtr _rampGradientsTexture;
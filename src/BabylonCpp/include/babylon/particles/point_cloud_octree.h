@@ -0,0 +1,153 @@
+#ifndef BABYLON_PARTICLES_POINT_CLOUD_OCTREE_H
+#define BABYLON_PARTICLES_POINT_CLOUD_OCTREE_H
+
+#include <array>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Plane;
+
+/**
+ * @brief Node of a PointCloudOctree, holding a bucket of points.
+ */
+struct BABYLON_SHARED_EXPORT PointCloudOctreeNode {
+  PointCloudOctreeNode(const Vector3& minimum, const Vector3& maximum, size_t depth);
+  ~PointCloudOctreeNode(); // = default
+
+  /** Bounds of the node (a cube) */
+  Vector3 minimum;
+  Vector3 maximum;
+  /** Depth of the node, 0 for the root */
+  size_t depth;
+  /** Positions of the points of the bucket (3 floats per point) */
+  Float32Array positions;
+  /** Colors of the points of the bucket (4 floats per point), empty if the cloud has no colors */
+  Float32Array colors;
+  /** Children of the node, indexed by octant (x + 2y + 4z), nullptr if not created */
+  std::array<std::unique_ptr<PointCloudOctreeNode>, 8> children;
+  /** Incremented each time points are added to the bucket */
+  size_t version;
+  /** Hidden, cells of the occupancy grid of the node which already hold a point */
+  std::unordered_set<uint32_t> _occupiedCells;
+
+  /**
+   * @brief Gets the number of points of the bucket.
+   */
+  [[nodiscard]] size_t count() const;
+
+  /**
+   * @brief Gets the center of the node.
+   */
+  [[nodiscard]] Vector3 getCenter() const;
+
+  /**
+   * @brief Gets the radius of the sphere enclosing the node.
+   */
+  [[nodiscard]] float getRadius() const;
+
+}; // end of struct PointCloudOctreeNode
+
+/**
+ * @brief Octree of buckets of points, used to render point clouds which are too large to be drawn
+ * at once (see StreamingPointsCloud).
+ *
+ * The points are distributed with the scheme used by Potree: every node subsamples the points
+ * falling in it with an occupancy grid of gridSize^3 cells. A point is kept by the first node,
+ * from the root, whose cell containing the point is still free, the others go down to the child
+ * of their octant. The spacing of the points of a node is therefore halved at each level and any
+ * set of nodes forming a subtree rooted at the root is a uniform sample of the cloud, coarse in
+ * the root and refined by the children. The nodes at the maximum depth keep all their points.
+ */
+class BABYLON_SHARED_EXPORT PointCloudOctree {
+
+public:
+  /**
+   * @brief Creates an empty octree.
+   * @param minimum the minimum of the bounds of the cloud, points outside of the bounds are clamped
+   * @param maximum the maximum of the bounds of the cloud
+   * @param hasColors whether the points have colors
+   * @param gridSize the number of cells of the occupancy grids along each axis
+   * @param maxDepth the depth of the deepest nodes
+   */
+  PointCloudOctree(const Vector3& minimum, const Vector3& maximum, bool hasColors,
+                   size_t gridSize = 128, size_t maxDepth = 10);
+  ~PointCloudOctree(); // = default
+
+  /**
+   * @brief Adds points to the octree.
+   * @param positions the positions of the points (3 floats per point)
+   * @param colors the colors of the points (4 floats per point), ignored if the cloud has no colors
+   * @param count the number of points
+   * @returns the nodes which received points
+   */
+  std::vector<PointCloudOctreeNode*> addPoints(const float* positions, const float* colors,
+                                               size_t count);
+
+  /**
+   * @brief Selects the nodes to render, by decreasing projected size.
+   *
+   * A node is selected when its bounds intersect the frustum and the projected size of its
+   * bounding sphere is at least minProjectedSize, as long as the selected nodes hold no more than
+   * pointBudget points. The children of a node are only considered when the node is selected, so
+   * the selection is a subtree and the density of the rendered points follows their screen size.
+   * @param frustumPlanes the planes of the frustum, in the space of the points
+   * @param cameraPosition the position of the camera, in the space of the points
+   * @param projectionFactor the projected size of a sphere of radius 1 at a distance 1, i.e. the
+   * render height / (2 tan(fov / 2)) for a size in pixels
+   * @param minProjectedSize the minimum projected size of the selected nodes
+   * @param pointBudget the maximum number of points of the selected nodes
+   * @param nodes the selected nodes
+   * @returns the number of points of the selected nodes
+   */
+  size_t selectNodes(const std::array<Plane, 6>& frustumPlanes, const Vector3& cameraPosition,
+                     float projectionFactor, float minProjectedSize, size_t pointBudget,
+                     std::vector<PointCloudOctreeNode*>& nodes) const;
+
+  /**
+   * @brief Gets the root node.
+   */
+  [[nodiscard]] PointCloudOctreeNode* getRoot() const;
+
+  /**
+   * @brief Gets whether the points have colors.
+   */
+  [[nodiscard]] bool hasColors() const;
+
+  /**
+   * @brief Gets the number of points of the octree.
+   */
+  [[nodiscard]] size_t getPointCount() const;
+
+  /**
+   * @brief Gets the number of nodes of the octree.
+   */
+  [[nodiscard]] size_t getNodeCount() const;
+
+  /**
+   * @brief Gets the spacing of the points of the nodes of a depth.
+   */
+  [[nodiscard]] float getSpacing(size_t depth) const;
+
+private:
+  PointCloudOctreeNode* _addPoint(const float* position, const float* color);
+
+private:
+  std::unique_ptr<PointCloudOctreeNode> _root;
+  bool _hasColors;
+  size_t _gridSize;
+  size_t _maxDepth;
+  size_t _pointCount;
+  size_t _nodeCount;
+
+}; // end of class PointCloudOctree
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_POINT_CLOUD_OCTREE_H
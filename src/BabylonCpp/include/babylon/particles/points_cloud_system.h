@@ -14,11 +14,13 @@ namespace BABYLON {
 
 class CloudPoint;
 class Mesh;
+class ParticleCollider;
 class PointsGroup;
 class Scene;
-using CloudPointPtr  = std::shared_ptr<CloudPoint>;
-using MeshPtr        = std::shared_ptr<Mesh>;
-using PointsGroupPtr = std::shared_ptr<PointsGroup>;
+using CloudPointPtr       = std::shared_ptr<CloudPoint>;
+using MeshPtr             = std::shared_ptr<Mesh>;
+using ParticleColliderPtr = std::shared_ptr<ParticleCollider>;
+using PointsGroupPtr      = std::shared_ptr<PointsGroup>;
 
 struct PointsCloudSystemOptions {
   std::optional<bool> updatable = std::nullopt;
@@ -378,6 +380,13 @@ public:
    */
   Property<PointsCloudSystem, bool> computeBoundingBox;
 
+  /**
+   * Collider applied by `setParticles()` to the particle positions and velocities after
+   * `updateParticle()` (default nullptr). The positions are local to the PCS mesh, so the field of
+   * the collider is expected in the same space.
+   */
+  ParticleColliderPtr collider;
+
 private:
   Scene* _scene;
   Float32Array _positions;
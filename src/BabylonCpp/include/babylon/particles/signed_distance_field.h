@@ -0,0 +1,186 @@
+#ifndef BABYLON_PARTICLES_SIGNED_DISTANCE_FIELD_H
+#define BABYLON_PARTICLES_SIGNED_DISTANCE_FIELD_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class SignedDistanceField;
+using SignedDistanceFieldPtr = std::shared_ptr<SignedDistanceField>;
+
+/**
+ * @brief Signed distances to a set of triangles stored in a regular grid, used to collide the
+ * particles with the geometry of a scene (see ParticleCollider).
+ *
+ * The distances are negative behind the triangles (the side opposite to their normal), which is
+ * the inside of closed meshes and below the surface of a terrain, the side being given by the
+ * normal of the closest triangle. They are only computed in a narrow band around the triangles,
+ * the cells farther than the band width are set to the band width. The field is sampled with
+ * trilinear interpolation; outside of the grid, the distance to the grid is added to the value of
+ * its closest point.
+ */
+class BABYLON_SHARED_EXPORT SignedDistanceField {
+
+public:
+  using OnBakedFunction = std::function<void(const SignedDistanceFieldPtr& field)>;
+
+  /**
+   * @brief Bakes the field of triangles on the default thread pool.
+   * @param positions the positions of the vertices (3 floats per vertex)
+   * @param indices the indices of the triangles, wound as the front faces of the meshes
+   * @param cellSize the size of the cells of the grid
+   * @param bandWidth the distance around the triangles where the distances are computed, 3 cells
+   * if not positive
+   * @returns the field, covering the bounding box of the triangles enlarged by the band width
+   */
+  static SignedDistanceFieldPtr FromTriangles(const Float32Array& positions,
+                                              const Uint32Array& indices, float cellSize,
+                                              float bandWidth = 0.f);
+
+  /**
+   * @brief Bakes the field of meshes, in world space, on the default thread pool.
+   * @param meshes the meshes
+   * @param cellSize the size of the cells of the grid
+   * @param bandWidth the distance around the triangles where the distances are computed, 3 cells
+   * if not positive
+   * @returns the field
+   */
+  static SignedDistanceFieldPtr FromMeshes(const std::vector<AbstractMesh*>& meshes,
+                                           float cellSize, float bandWidth = 0.f);
+
+  /**
+   * @brief Bakes the field of meshes on a worker thread. The triangles are read on the calling
+   * thread and the callback is run on the main thread once the field is baked.
+   * @param meshes the meshes
+   * @param cellSize the size of the cells of the grid
+   * @param bandWidth the distance around the triangles where the distances are computed, 3 cells
+   * if not positive
+   * @param onBaked the callback receiving the field
+   */
+  static void FromMeshesAsync(const std::vector<AbstractMesh*>& meshes, float cellSize,
+                              float bandWidth, const OnBakedFunction& onBaked);
+
+public:
+  /**
+   * @brief Creates a field whose values are all set to the given distance.
+   * @param origin the position of the first value of the grid
+   * @param width the number of values along x
+   * @param height the number of values along y
+   * @param depth the number of values along z
+   * @param cellSize the distance between two values
+   * @param distance the initial value
+   */
+  SignedDistanceField(const Vector3& origin, size_t width, size_t height, size_t depth,
+                      float cellSize, float distance = 0.f);
+  ~SignedDistanceField(); // = default
+
+  /**
+   * @brief Gets the number of values along x.
+   */
+  [[nodiscard]] size_t getWidth() const;
+
+  /**
+   * @brief Gets the number of values along y.
+   */
+  [[nodiscard]] size_t getHeight() const;
+
+  /**
+   * @brief Gets the number of values along z.
+   */
+  [[nodiscard]] size_t getDepth() const;
+
+  /**
+   * @brief Gets the distance between two values.
+   */
+  [[nodiscard]] float getCellSize() const;
+
+  /**
+   * @brief Gets the position of the first value of the grid.
+   */
+  [[nodiscard]] const Vector3& getOrigin() const;
+
+  /**
+   * @brief Gets the values, x varying first then y then z.
+   */
+  Float32Array& getValues();
+
+  /**
+   * @brief Gets the value at a grid position.
+   */
+  [[nodiscard]] float getValue(size_t x, size_t y, size_t z) const;
+
+  /**
+   * @brief Sets the value at a grid position.
+   */
+  void setValue(size_t x, size_t y, size_t z, float distance);
+
+  /**
+   * @brief Samples the distance at a position.
+   */
+  [[nodiscard]] float sample(const Vector3& position) const;
+
+  /**
+   * @brief Samples the distance and its gradient at a position.
+   * @param position the position
+   * @param gradient the gradient of the distance (not normalized)
+   * @returns the distance
+   */
+  float sample(const Vector3& position, Vector3& gradient) const;
+
+  /**
+   * @brief Samples the distances and their gradients at positions stored as a structure of arrays
+   * (4 positions per instruction when the library is built with OPTION_ENABLE_SIMD). The SSE
+   * sampling is compiled on every SSE2 target, so that it can be checked against the scalar one.
+   * @param count the number of positions
+   * @param x the x coordinates of the positions
+   * @param y the y coordinates of the positions
+   * @param z the z coordinates of the positions
+   * @param distances the distances
+   * @param gradientX the x components of the gradients (not normalized)
+   * @param gradientY the y components of the gradients
+   * @param gradientZ the z components of the gradients
+   */
+  void sample(size_t count, const float* x, const float* y, const float* z, float* distances,
+              float* gradientX, float* gradientY, float* gradientZ) const;
+
+  /**
+   * @brief Samples the distances and their gradients without SIMD instructions.
+   * @see sample
+   */
+  void sampleScalar(size_t count, const float* x, const float* y, const float* z, float* distances,
+                    float* gradientX, float* gradientY, float* gradientZ) const;
+
+  /**
+   * @brief Samples the distances and their gradients with SSE instructions.
+   * @see sample
+   * @returns false if the target does not support SSE2, nothing being then sampled
+   */
+  bool sampleSSE2(size_t count, const float* x, const float* y, const float* z, float* distances,
+                  float* gradientX, float* gradientY, float* gradientZ) const;
+
+private:
+  /**
+   * @brief Samples the positions [begin, count) one by one.
+   */
+  void _sampleScalar(size_t begin, size_t count, const float* x, const float* y, const float* z,
+                     float* distances, float* gradientX, float* gradientY, float* gradientZ) const;
+
+  Vector3 _origin;
+  size_t _width;
+  size_t _height;
+  size_t _depth;
+  float _cellSize;
+  Float32Array _values;
+
+}; // end of class SignedDistanceField
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_SIGNED_DISTANCE_FIELD_H
@@ -7,6 +7,7 @@
 #include <babylon/core/structs.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/maths/matrix.h>
+#include <babylon/misc/depth_sorter.h>
 #include <babylon/particles/solid_particle.h>
 
 namespace BABYLON {
@@ -172,6 +173,16 @@ public:
    */
   SolidParticleSystem& setParticles(size_t start = 0, size_t end = 0, bool update = true);
 
+  /**
+   * @brief Updates the particles [start, end] as setParticles() does, expanding the given bounding
+   * box with their vertices. Only local scratch values are used so that disjoint ranges can be
+   * updated concurrently.
+   * @hidden
+   */
+  void _setParticlesRange(size_t start, size_t end, const Vector3& camAxisX,
+                          const Vector3& camAxisY, const Vector3& camAxisZ,
+                          const Vector3& camInvertedPosition, Vector3& minimum, Vector3& maximum);
+
   /**
    * @brief Disposes the SPS.
    */
@@ -661,6 +672,21 @@ public:
    */
   bool recomputeNormals;
 
+  /**
+   * If `setParticles()` splits the particles in chunks updated on the default thread pool (default
+   * false). `updateParticle()` and `updateParticleVertex()` are then called concurrently from
+   * several threads : they must only modify the particle they are given and must not use the
+   * shared TmpVectors scratch arrays. The ranges containing particles with a parent are updated on
+   * the calling thread.
+   */
+  bool parallelUpdate;
+
+  /**
+   * Minimum number of particles of a chunk updated by a thread when `parallelUpdate` is set
+   * (default 1024)
+   */
+  size_t parallelUpdateChunkSize;
+
   /**
    * This a counter ofr your own usage. It's not set by any SPS functions.
    */
@@ -826,8 +852,7 @@ private:
   bool _useModelMaterial;
   std::vector<size_t> _indicesByMaterial;
   std::vector<size_t> _materialIndexes;
-  std::function<bool(const DepthSortedParticle& p1, const DepthSortedParticle& p2)>
-    _depthSortFunction;
+  DepthSorter _depthSorter;
   std::function<bool(const DepthSortedParticle& p1, const DepthSortedParticle& p2)>
     _materialSortFunction;
   std::vector<MaterialPtr> _materials;
@@ -0,0 +1,188 @@
+#ifndef BABYLON_PARTICLES_STREAMING_POINTS_CLOUD_H
+#define BABYLON_PARTICLES_STREAMING_POINTS_CLOUD_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+class Mesh;
+struct PointCloudOctreeNode;
+class Scene;
+class StandardMaterial;
+class StreamingPointsCloud;
+class TransformNode;
+class Vector3;
+using MeshPtr                 = std::shared_ptr<Mesh>;
+using StandardMaterialPtr     = std::shared_ptr<StandardMaterial>;
+using StreamingPointsCloudPtr = std::shared_ptr<StreamingPointsCloud>;
+using TransformNodePtr        = std::shared_ptr<TransformNode>;
+
+/**
+ * @brief Point cloud streamed into a PointCloudOctree and rendered with a level of detail selected
+ * each frame from the screen size of the nodes of the octree, for clouds of tens of millions of
+ * points (LiDAR scans...).
+ *
+ * Before each render, the nodes in the camera frustum are selected by decreasing projected size
+ * within the point budget (see PointCloudOctree::selectNodes) and each selected node is drawn as a
+ * mesh of points parented to the root node of the cloud. The mesh of a node is rebuilt when points
+ * were added to the node, the meshes of the nodes which are no longer selected are disabled and
+ * kept in a cache of maxCachedNodes meshes.
+ *
+ * The points files are read in chunks on the default thread pool, the selection of a frame being
+ * skipped while a chunk is inserted. Format (little endian):
+ * - header: "BPC1", uint32 flags (1 when the points have colors), uint64 number of points, float
+ *   minimum (x, y, z) and float maximum (x, y, z) of the points
+ * - points: float x, y, z followed by uint8 r, g, b, a when the points have colors
+ */
+class BABYLON_SHARED_EXPORT StreamingPointsCloud {
+
+public:
+  using OnLoadedFunction = std::function<void(StreamingPointsCloud* cloud, bool success)>;
+
+public:
+  /**
+   * @brief Creates an empty streaming point cloud.
+   * @param name the name of the cloud, also given to its root node
+   * @param scene the hosting scene
+   * @param pointSize the size of the points in pixels
+   */
+  StreamingPointsCloud(const std::string& name, Scene* scene, float pointSize = 1.f);
+  ~StreamingPointsCloud();
+
+  /**
+   * @brief Loads a points file. The header is read on the calling thread and the points are read
+   * in chunks of chunkSize points on the default thread pool.
+   * @param filename the path of the file
+   * @param onLoaded called on the main thread once all the points were read, or when the file
+   * cannot be read
+   */
+  void load(const std::string& filename, const OnLoadedFunction& onLoaded = nullptr);
+
+  /**
+   * @brief Creates the octree receiving the points, discarding the previous points.
+   * @param minimum the minimum of the bounds of the points
+   * @param maximum the maximum of the bounds of the points
+   * @param hasColors whether the points have colors
+   */
+  void initialize(const Vector3& minimum, const Vector3& maximum, bool hasColors);
+
+  /**
+   * @brief Adds points to the octree, e.g. points generated or received from a network.
+   * @param positions the positions of the points (3 floats per point)
+   * @param colors the colors of the points (4 floats per point), ignored if the cloud has no colors
+   * @param count the number of points
+   */
+  void addPoints(const float* positions, const float* colors, size_t count);
+
+  /**
+   * @brief Selects the nodes to render for the active camera and updates their meshes. Called
+   * before each render of the scene.
+   */
+  void update();
+
+  /**
+   * @brief Gets the node parent of the meshes of the cloud, used to place the cloud.
+   */
+  [[nodiscard]] TransformNodePtr getRoot() const;
+
+  /**
+   * @brief Gets whether a points file is being read.
+   */
+  [[nodiscard]] bool isLoading() const;
+
+  /**
+   * @brief Gets the number of points of the octree.
+   */
+  [[nodiscard]] size_t getLoadedPointCount() const;
+
+  /**
+   * @brief Gets the number of points rendered during the last frame.
+   */
+  [[nodiscard]] size_t getRenderedPointCount() const;
+
+  /**
+   * @brief Gets the nodes rendered during the last frame.
+   */
+  [[nodiscard]] const std::vector<PointCloudOctreeNode*>& getSelectedNodes() const;
+
+  /**
+   * @brief Stops the loading and releases the meshes of the cloud.
+   */
+  void dispose();
+
+private:
+  struct StreamingState;
+  struct NodeMesh {
+    MeshPtr mesh       = nullptr;
+    size_t version     = 0;
+    size_t renderFrame = 0;
+  };
+
+  void _updateNodeMesh(const PointCloudOctreeNode& node, NodeMesh& nodeMesh);
+  void _evictNodeMeshes();
+  void _disposeNodeMeshes();
+
+public:
+  /**
+   * The name of the cloud
+   */
+  std::string name;
+
+  /**
+   * Maximum number of points rendered per frame (1,000,000 by default)
+   */
+  size_t pointBudget;
+
+  /**
+   * Minimum projected size, in pixels, of the bounding sphere of the rendered nodes (100 by
+   * default). Lower values render more nodes at the same distance.
+   */
+  float minNodeSize;
+
+  /**
+   * Number of points read from the file between two insertions in the octree (65536 by default)
+   */
+  size_t chunkSize;
+
+  /**
+   * Maximum number of meshes of nodes which are no longer rendered kept for later frames (64 by
+   * default)
+   */
+  size_t maxCachedNodes;
+
+  /**
+   * Number of cells of the occupancy grids of the nodes along each axis, used by the next call to
+   * initialize() or load() (128 by default)
+   */
+  size_t gridSize;
+
+  /**
+   * Depth of the deepest nodes, used by the next call to initialize() or load() (10 by default)
+   */
+  size_t maxDepth;
+
+private:
+  Scene* _scene;
+  float _pointSize;
+  TransformNodePtr _root;
+  StandardMaterialPtr _material;
+  std::shared_ptr<StreamingState> _state;
+  std::unordered_map<const PointCloudOctreeNode*, NodeMesh> _nodeMeshes;
+  std::vector<PointCloudOctreeNode*> _selectedNodes;
+  size_t _renderedPointCount;
+  size_t _frameId;
+  Observer<Scene>::Ptr _onBeforeRenderObserver;
+
+}; // end of class StreamingPointsCloud
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_STREAMING_POINTS_CLOUD_H
@@ -7,6 +7,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/maths/vector3.h>
+#include <babylon/misc/depth_sorter.h>
 
 namespace BABYLON {
 
@@ -165,6 +166,25 @@ private:
                  sortCompareFn,
                const CameraPtr& camera, bool transparent);
 
+  /**
+   * @brief Renders the transparent submeshes back to front, sorted by the
+   * depth sorter (default transparent order when all the submeshes share the
+   * same alpha index).
+   * @param subMeshes The submeshes to sort before render
+   */
+  void _renderTransparentBackToFront(const std::vector<SubMesh*>& subMeshes);
+
+  /**
+   * @brief Computes the values used to sort the submeshes.
+   */
+  static void _prepareSubMeshesForSort(const std::vector<SubMesh*>& subMeshes,
+                                       const CameraPtr& camera);
+
+  /**
+   * @brief Renders a submesh, with its depth pre-pass if transparent.
+   */
+  static void _renderSubMesh(SubMesh* subMesh, bool transparent);
+
   /**
    * @brief Renders the submeshes in the order they were dispatched (no sort
    * applied).
@@ -240,6 +260,8 @@ private:
     _alphaTestSortCompareFn;
   std::function<bool(const SubMesh* a, const SubMesh* b)>
     _transparentSortCompareFn;
+  bool _defaultTransparentSort;
+  DepthSorter _transparentDepthSorter;
 
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderOpaque;
   std::function<void(const std::vector<SubMesh*>& subMeshes)> _renderAlphaTest;
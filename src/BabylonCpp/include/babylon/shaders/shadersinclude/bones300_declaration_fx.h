@@ -11,6 +11,7 @@ const char* bones300Declaration
 #if NUM_BONE_INFLUENCERS > 0
     #ifdef BONETEXTURE
         uniform sampler2D boneSampler;
+        uniform float boneTextureRow;
     #else
         uniform mat4 mBones[BonesPerMesh];
     #endif
@@ -29,10 +30,10 @@ const char* bones300Declaration
             float offset = index  * 4.0;
             float dx = 1.0 / boneTextureWidth;
 
-            result[0] = texture(smp, vec2(dx * (offset + 0.5), 0.));
-            result[1] = texture(smp, vec2(dx * (offset + 1.5), 0.));
-            result[2] = texture(smp, vec2(dx * (offset + 2.5), 0.));
-            result[3] = texture(smp, vec2(dx * (offset + 3.5), 0.));
+            result[0] = texture(smp, vec2(dx * (offset + 0.5), boneTextureRow));
+            result[1] = texture(smp, vec2(dx * (offset + 1.5), boneTextureRow));
+            result[2] = texture(smp, vec2(dx * (offset + 2.5), boneTextureRow));
+            result[3] = texture(smp, vec2(dx * (offset + 3.5), boneTextureRow));
 
             return result;
         }
@@ -12,6 +12,7 @@ const char* bonesDeclaration
     #ifdef BONETEXTURE
         uniform sampler2D boneSampler;
         uniform float boneTextureWidth;
+        uniform float boneTextureRow;
     #else
         uniform mat4 mBones[BonesPerMesh];
     #endif
@@ -29,10 +30,10 @@ const char* bonesDeclaration
             float offset = index  * 4.0;
             float dx = 1.0 / boneTextureWidth;
 
-            vec4 m0 = texture2D(smp, vec2(dx * (offset + 0.5), 0.));
-            vec4 m1 = texture2D(smp, vec2(dx * (offset + 1.5), 0.));
-            vec4 m2 = texture2D(smp, vec2(dx * (offset + 2.5), 0.));
-            vec4 m3 = texture2D(smp, vec2(dx * (offset + 3.5), 0.));
+            vec4 m0 = texture2D(smp, vec2(dx * (offset + 0.5), boneTextureRow));
+            vec4 m1 = texture2D(smp, vec2(dx * (offset + 1.5), boneTextureRow));
+            vec4 m2 = texture2D(smp, vec2(dx * (offset + 2.5), boneTextureRow));
+            vec4 m3 = texture2D(smp, vec2(dx * (offset + 3.5), boneTextureRow));
 
             return mat4(m0, m1, m2, m3);
         }
@@ -8,7 +8,7 @@ extern const char* bonesVertex;
 const char* bonesVertex
   = R"ShaderCode(
 
-#if NUM_BONE_INFLUENCERS > 0
+#if !defined(BAKED_VERTEX_ANIMATION_TEXTURE) && NUM_BONE_INFLUENCERS > 0
     mat4 influence;
 
 #ifdef BONETEXTURE
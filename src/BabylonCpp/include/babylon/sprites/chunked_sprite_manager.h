@@ -0,0 +1,171 @@
+#ifndef BABYLON_SPRITES_CHUNKED_SPRITE_MANAGER_H
+#define BABYLON_SPRITES_CHUNKED_SPRITE_MANAGER_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/materials/textures/texture_constants.h>
+#include <babylon/misc/observable.h>
+#include <babylon/sprites/isprite_manager.h>
+#include <babylon/sprites/sprite.h>
+#include <babylon/sprites/sprite_chunk_grid.h>
+
+namespace BABYLON {
+
+class Buffer;
+class ChunkedSpriteManager;
+class Effect;
+class Matrix;
+class Texture;
+using ChunkedSpriteManagerPtr = std::shared_ptr<ChunkedSpriteManager>;
+using EffectPtr               = std::shared_ptr<Effect>;
+using TexturePtr              = std::shared_ptr<Texture>;
+
+/**
+ * @brief Sprite manager for large numbers of sprites (maps, vegetation, crowds...).
+ *
+ * The sprites are stored in the chunks of a uniform grid (see SpriteChunkGrid). Each sprite is
+ * drawn as an instance of a single quad from one record of the instance buffer of its chunk, and
+ * only the records of the sprites marked as dirty since the last frame are uploaded: the sprites
+ * changed outside of their animations and size property must be marked with
+ * Sprite::markAsDirty(). The chunks outside of the camera frustum are neither uploaded nor drawn,
+ * and picking skips the chunks missed by the ray. There is no capacity, the buffers of the chunks
+ * grow with their sprites.
+ *
+ * The grid is updated when the sprites are rendered, hidden sprites are not picked and sprites
+ * moved since the last frame are picked from the bounds of their previous chunk. Requires
+ * instanced arrays, nothing is drawn without them.
+ */
+class BABYLON_SHARED_EXPORT ChunkedSpriteManager : public ISpriteManager {
+
+public:
+  template <typename... Ts>
+  static ChunkedSpriteManagerPtr New(Ts&&... args)
+  {
+    auto spriteManager = std::shared_ptr<ChunkedSpriteManager>(
+      new ChunkedSpriteManager(std::forward<Ts>(args)...));
+    spriteManager->addToScene(spriteManager);
+
+    return spriteManager;
+  }
+  ~ChunkedSpriteManager() override; // = default
+
+  void addToScene(const ChunkedSpriteManagerPtr& newSpriteManager);
+
+  /**
+   * @brief Intersects the sprites with a ray.
+   * @param ray defines the ray to intersect with, in camera space
+   * @param camera defines the current active camera
+   * @param predicate defines a predicate used to select candidate sprites
+   * @param fastCheck defines if a fast check only must be done (the first potential sprite is will
+   * be used and not the closer)
+   * @returns null if no hit or a PickingInfo
+   */
+  std::optional<PickingInfo> intersects(const Ray& ray, const CameraPtr& camera,
+                                        const std::function<bool(Sprite* sprite)>& predicate,
+                                        bool fastCheck) override;
+
+  /**
+   * @brief Intersects the sprites with a ray.
+   * @param ray defines the ray to intersect with, in camera space
+   * @param camera defines the current active camera
+   * @param predicate defines a predicate used to select candidate sprites
+   * @returns null if no hit or a PickingInfo array
+   */
+  std::vector<PickingInfo>
+  multiIntersects(const Ray& ray, const CameraPtr& camera,
+                  const std::function<bool(Sprite* sprite)>& predicate) override;
+
+  /**
+   * @brief Updates the chunks and renders the visible ones.
+   */
+  void render() override;
+
+  /**
+   * @brief Release associated resources.
+   */
+  void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
+
+  /**
+   * @brief Gets the grid storing the sprites.
+   */
+  [[nodiscard]] const SpriteChunkGrid& getGrid() const;
+
+  /**
+   * @brief Gets the number of chunks drawn during the last render.
+   */
+  [[nodiscard]] size_t getRenderedChunkCount() const;
+
+protected:
+  /**
+   * @brief Creates a new chunked sprite manager.
+   * @param name defines the manager's name
+   * @param imgUrl defines the sprite sheet url
+   * @param cellSize defines the size of a sprite cell
+   * @param scene defines the hosting scene
+   * @param chunkSize defines the size of the cells of the grid in world units
+   * @param epsilon defines the epsilon value to align texture (0.01 by default)
+   * @param samplingMode defines the smapling mode to use with spritesheet
+   */
+  ChunkedSpriteManager(const std::string& name, const std::string& imgUrl, const ISize& cellSize,
+                       Scene* scene, float chunkSize = 64.f, float epsilon = 0.01f,
+                       unsigned int samplingMode = TextureConstants::TRILINEAR_SAMPLINGMODE);
+
+private:
+  EffectPtr _createEffect(bool fog) const;
+  void _updateChunkBuffer(SpriteChunk& chunk);
+  void _intersects(const Ray& ray, const Matrix& cameraView,
+                   const std::function<bool(Sprite* sprite)>& predicate,
+                   const std::function<bool(const SpritePtr& sprite, float distance)>& onHit);
+
+public:
+  /**
+   * Defines the manager's name
+   */
+  std::string name;
+
+  /**
+   * Gets or sets a boolean indicating if the manager must consider scene fog when rendering
+   */
+  bool fogEnabled;
+
+  /**
+   * Defines the default width of a cell in the spritesheet
+   */
+  int cellWidth;
+
+  /**
+   * Defines the default height of a cell in the spritesheet
+   */
+  int cellHeight;
+
+  /**
+   * Blend mode use to render the sprites (Constants::ALPHA_COMBINE by default)
+   */
+  unsigned int blendMode;
+
+  /**
+   * Disables writing to the depth buffer when rendering the sprites
+   */
+  bool disableDepthWrite;
+
+  /**
+   * An event triggered when the manager is disposed.
+   */
+  Observable<ChunkedSpriteManager> onDisposeObservable;
+
+private:
+  Scene* _scene;
+  TexturePtr _spriteTexture;
+  float _epsilon;
+  bool _useInstancing;
+  SpriteChunkGrid _grid;
+  std::vector<SpriteChunk*> _visibleChunks;
+  std::unique_ptr<Buffer> _spriteBuffer;
+  VertexBufferPtr _offsets;
+  EffectPtr _effectBase;
+  EffectPtr _effectFog;
+
+}; // end of class ChunkedSpriteManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SPRITES_CHUNKED_SPRITE_MANAGER_H
@@ -58,6 +58,13 @@ public:
    */
   void _animate(float deltaTime);
 
+  /**
+   * @brief Marks the sprite as changed, for the managers only updating the changed sprites (the
+   * ChunkedSpriteManager). To call after changing the position, color, width, height, angle, cell,
+   * inverts or visibility of the sprite.
+   */
+  void markAsDirty();
+
   /**
    * @brief Release associated resources.
    */
@@ -165,6 +172,11 @@ public:
    */
   Property<Sprite, float> size;
 
+  /**
+   * Hidden, whether the sprite changed since its last update by a ChunkedSpriteManager
+   */
+  bool _isDirty;
+
 private:
   bool _animationStarted;
   bool _loopAnimation;
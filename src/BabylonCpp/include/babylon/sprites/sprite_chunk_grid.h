@@ -0,0 +1,173 @@
+#ifndef BABYLON_SPRITES_SPRITE_CHUNK_GRID_H
+#define BABYLON_SPRITES_SPRITE_CHUNK_GRID_H
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Buffer;
+class Plane;
+class Sprite;
+class VertexBuffer;
+using SpritePtr       = std::shared_ptr<Sprite>;
+using VertexBufferPtr = std::shared_ptr<VertexBuffer>;
+
+/**
+ * @brief Sprites of a cell of a SpriteChunkGrid, stored as one instance record per sprite.
+ */
+struct BABYLON_SHARED_EXPORT SpriteChunk {
+  SpriteChunk();
+  ~SpriteChunk(); // = default
+
+  /** Coordinates of the cell */
+  int x = 0;
+  int y = 0;
+  int z = 0;
+  /** Indices of the sprites of the chunk in the list of sprites, in the order of the records */
+  std::vector<size_t> spriteIndices;
+  /** Instance records of the sprites (SpriteChunkGrid::InstanceSize floats per sprite) */
+  Float32Array instanceData;
+  /** Bounds of the sprites of the chunk */
+  Vector3 minimum;
+  Vector3 maximum;
+  /** Range of records [dirtyStart, dirtyEnd) changed since the last call to clearDirty() */
+  size_t dirtyStart;
+  size_t dirtyEnd;
+  /** Hidden, instance buffer of the chunk created by the sprite manager */
+  std::unique_ptr<Buffer> _buffer;
+  /** Hidden, number of records the instance buffer can hold */
+  size_t _bufferCapacity = 0;
+  /** Hidden, vertex buffers of the chunk */
+  std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
+  /** Hidden, sprites leaving the chunk during the update */
+  std::vector<size_t> _movedSprites;
+
+  /**
+   * @brief Gets the number of sprites of the chunk.
+   */
+  [[nodiscard]] size_t count() const;
+
+  /**
+   * @brief Returns whether records were changed since the last call to clearDirty().
+   */
+  [[nodiscard]] bool isDirty() const;
+
+  /**
+   * @brief Marks the records [start, end) as changed.
+   */
+  void markDirty(size_t start, size_t end);
+
+  /**
+   * @brief Marks all the records as uploaded.
+   */
+  void clearDirty();
+
+}; // end of struct SpriteChunk
+
+/**
+ * @brief Uniform grid of chunks of sprites, used by the ChunkedSpriteManager to cull and pick the
+ * sprites by cell and to only upload the records of the sprites which changed.
+ *
+ * Each sprite is stored in the chunk of the cell containing its position. During update() only the
+ * records of the sprites marked as dirty (see Sprite::markAsDirty()) are rebuilt and marked as
+ * dirty in their chunk, along with the bounds of these chunks. All the records are rebuilt when the
+ * sprite sheet changes. A sprite moving to another cell is moved to the chunk of this cell, the
+ * last records of its previous chunk filling the hole. Sprites added at the end of the list are
+ * simply inserted, a sprite removed from the list is removed from its chunk while the other
+ * sprites keep their records.
+ *
+ * Record layout (InstanceSize floats): position (x, y, z), angle, size (width, height), inverts
+ * (u, v), cell (left, top, width, height), color (r, g, b, a). Hidden sprites have a null size.
+ */
+class BABYLON_SHARED_EXPORT SpriteChunkGrid {
+
+public:
+  /** Number of floats of an instance record */
+  static constexpr size_t InstanceSize = 16;
+
+public:
+  /**
+   * @brief Creates a grid.
+   * @param cellSize the size of the cells in world units
+   */
+  SpriteChunkGrid(float cellSize = 64.f);
+  ~SpriteChunkGrid(); // = default
+
+  /**
+   * @brief Updates the chunks from the sprites added, removed or marked as dirty.
+   * @param sprites the sprites of the manager
+   * @param textureWidth the width of the sprite sheet
+   * @param textureHeight the height of the sprite sheet
+   * @param cellWidth the width of a cell of the sprite sheet
+   * @param cellHeight the height of a cell of the sprite sheet
+   */
+  void update(const std::vector<SpritePtr>& sprites, float textureWidth, float textureHeight,
+              int cellWidth, int cellHeight);
+
+  /**
+   * @brief Gets the size of the cells in world units.
+   */
+  [[nodiscard]] float getCellSize() const;
+
+  /**
+   * @brief Gets the chunks, including the empty ones.
+   */
+  [[nodiscard]] const std::vector<std::unique_ptr<SpriteChunk>>& getChunks() const;
+
+  /**
+   * @brief Gets the non-empty chunks whose bounds intersect a frustum.
+   * @param frustumPlanes the planes of the frustum
+   * @param chunks the chunks
+   */
+  void getVisibleChunks(const std::array<Plane, 6>& frustumPlanes,
+                        std::vector<SpriteChunk*>& chunks) const;
+
+  /**
+   * @brief Gets the chunk and the record of the sprite at an index of the list of sprites.
+   * @returns the chunk, nullptr if the sprite is not in the grid
+   */
+  SpriteChunk* getChunk(size_t spriteIndex, size_t& record) const;
+
+  /**
+   * @brief Removes all the sprites from the chunks.
+   */
+  void clear();
+
+private:
+  struct SpriteState {
+    const Sprite* sprite = nullptr;
+    size_t chunk         = 0;
+    size_t record        = 0;
+  };
+
+  std::array<int, 3> _getCell(const Vector3& position) const;
+  size_t _getChunk(const std::array<int, 3>& cell);
+  void _insert(const SpritePtr& sprite, size_t spriteIndex);
+  void _removeHoles(SpriteChunk& chunk);
+  static void _updateBounds(SpriteChunk& chunk);
+  void _writeRecord(const Sprite* sprite, float* record) const;
+  static void _extendBounds(SpriteChunk& chunk, const float* record);
+
+private:
+  float _cellSize;
+  std::vector<std::unique_ptr<SpriteChunk>> _chunks;
+  std::unordered_map<uint64_t, size_t> _chunkIndices;
+  std::vector<SpriteState> _states;
+  float _textureWidth;
+  float _textureHeight;
+  int _cellWidth;
+  int _cellHeight;
+
+}; // end of class SpriteChunkGrid
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SPRITES_SPRITE_CHUNK_GRID_H
@@ -16,6 +16,7 @@ Animatable::Animatable(Scene* scene, const IAnimatablePtr& iTarget, float iFromF
     : target{iTarget}
     , disposeOnEnd{true}
     , animationStarted{false}
+    , _animationLODSkippedFrames{0}
     , fromFrame{iFromFrame}
     , toFrame{iToFrame}
     , loopAnimation{iLoopAnimation}
@@ -255,13 +256,34 @@ void Animatable::stop(const std::string& animationName,
 }
 
 bool Animatable::_animate(const millisecond_t& delay)
+{
+  if (!_beginAnimate(delay)) {
+    return true;
+  }
+
+  _evaluateRuntimeAnimations(delay);
+  return _endAnimate();
+}
+
+bool Animatable::_canEvaluateInParallel()
+{
+  auto canEvaluateInParallel = true;
+  for (const auto& runtimeAnimation : _runtimeAnimations) {
+    // Compiled on the main thread as the animation can be shared
+    runtimeAnimation->animation()->_getCompiledTrack();
+    canEvaluateInParallel = canEvaluateInParallel && runtimeAnimation->_canEvaluateInParallel();
+  }
+  return canEvaluateInParallel;
+}
+
+bool Animatable::_beginAnimate(const millisecond_t& delay)
 {
   if (_paused) {
     animationStarted = false;
     if (_pausedDelay == std::nullopt) {
       _pausedDelay = delay;
     }
-    return true;
+    return false;
   }
 
   if (_localDelayOffset == std::nullopt) {
@@ -273,19 +295,28 @@ bool Animatable::_animate(const millisecond_t& delay)
     _pausedDelay      = std::nullopt;
   }
 
-  if (_weight == 0.f) { // We consider that an animation with a weight === 0 is
-                        // "actively" paused
-    return true;
+  // We consider that an animation with a weight === 0 is "actively" paused
+  return _weight != 0.f;
+}
+
+void Animatable::_evaluateRuntimeAnimations(const millisecond_t& delay)
+{
+  for (const auto& animation : _runtimeAnimations) {
+    animation->_evaluate(delay - (*_localDelayOffset), static_cast<float>(fromFrame),
+                         static_cast<float>(toFrame), loopAnimation, speedRatio());
   }
+}
 
+bool Animatable::_endAnimate()
+{
   // Animating
   auto running = false;
 
-  for (const auto& animation : _runtimeAnimations) {
-    auto isRunning
-      = animation->animate(delay - (*_localDelayOffset), static_cast<float>(fromFrame),
-                           static_cast<float>(toFrame), loopAnimation, speedRatio(), _weight);
-    running = running || isRunning;
+  // Copy because the events raised can stop the runtime animations
+  const auto runtimeAnimations = _runtimeAnimations;
+  for (const auto& animation : runtimeAnimations) {
+    auto isRunning = animation->_apply(_weight);
+    running        = running || isRunning;
   }
 
   animationStarted = running;
@@ -2,6 +2,7 @@
 
 #include <babylon/animations/_ianimation_state.h>
 #include <babylon/animations/animatable.h>
+#include <babylon/animations/compiled_animation_track.h>
 #include <babylon/animations/easing/ieasing_function.h>
 #include <babylon/animations/ianimation_key.h>
 #include <babylon/animations/runtime_animation.h>
@@ -157,6 +158,36 @@ bool Animation::get_hasRunningRuntimeAnimations() const
   return false;
 }
 
+bool Animation::get_compileKeys() const
+{
+  return _compileKeys;
+}
+
+void Animation::set_compileKeys(bool value)
+{
+  if (_compileKeys == value) {
+    return;
+  }
+
+  _compileKeys = value;
+  _markKeysAsDirty();
+}
+
+bool Animation::get_quantizeKeys() const
+{
+  return _quantizeKeys;
+}
+
+void Animation::set_quantizeKeys(bool value)
+{
+  if (_quantizeKeys == value) {
+    return;
+  }
+
+  _quantizeKeys = value;
+  _markKeysAsDirty();
+}
+
 Animation::Animation(const std::string& iName, const std::string& iTargetProperty,
                      size_t iFramePerSecond, int iDataType, unsigned int iLoopMode,
                      bool iEnableBlending)
@@ -166,6 +197,12 @@ Animation::Animation(const std::string& iName, const std::string& iTargetPropert
     , targetPropertyPath{StringTools::split(targetProperty, '.')}
     , blendingSpeed{0.01f}
     , hasRunningRuntimeAnimations{this, &Animation::get_hasRunningRuntimeAnimations}
+    , compileKeys{this, &Animation::get_compileKeys, &Animation::set_compileKeys}
+    , quantizeKeys{this, &Animation::get_quantizeKeys, &Animation::set_quantizeKeys}
+    , _compiledTrackIsDirty{true}
+    , _compileKeys{true}
+    , _quantizeKeys{false}
+    , _keysAreQuantized{false}
     , _easingFunction{nullptr}
 {
   framePerSecond = iFramePerSecond;
@@ -186,7 +223,8 @@ std::string Animation::toString(bool fullDetails) const
         << std::vector<std::string>{"Float",  "Vector3", "Quaternion", "Matrix",
                                     "Color3", "Vector2", "Size",       "Boolean"}[_dataType];
   }
-  oss << ", nKeys: " << (!_keys.empty() ? std::to_string(_keys.size()) : "none");
+  const auto keyCount = getKeyCount();
+  oss << ", nKeys: " << (keyCount > 0 ? std::to_string(keyCount) : "none");
   oss << ", nRanges: " << (!_ranges.empty() ? std::to_string(_ranges.size()) : "none");
   if (fullDetails) {
     oss << ", Ranges: {";
@@ -235,9 +273,10 @@ void Animation::deleteRange(const std::string& iName, bool deleteFrames)
       const auto& from = _ranges[iName].from;
       const auto& to   = _ranges[iName].to;
 
-      stl_util::erase_remove_if(_keys, [from, to](const IAnimationKey& key) {
+      stl_util::erase_remove_if(getKeys(), [from, to](const IAnimationKey& key) {
         return key.frame >= from && key.frame <= to;
       });
+      _markKeysAsDirty();
     }
     _ranges.erase(iName);
   }
@@ -250,15 +289,82 @@ AnimationRange& Animation::getRange(const std::string& iName)
 
 std::vector<IAnimationKey>& Animation::getKeys()
 {
+  // The keys may be modified by the caller
+  _markKeysAsDirty();
   return _keys;
 }
 
+size_t Animation::getKeyCount() const
+{
+  return _keysAreQuantized ? _compiledTrack->keyCount() : _keys.size();
+}
+
+float Animation::getKeyFrame(size_t index) const
+{
+  return _keysAreQuantized ? _compiledTrack->keyFrame(index) : _keys[index].frame;
+}
+
+AnimationValue Animation::getKeyValue(size_t index) const
+{
+  if (_keysAreQuantized) {
+    return _compiledTrack->toAnimationValue(_compiledTrack->keyValue(index));
+  }
+
+  return _keys[index].value;
+}
+
+bool Animation::_hasQuantizedKeys() const
+{
+  return _keysAreQuantized;
+}
+
+std::vector<IAnimationKey> Animation::_decodeKeys() const
+{
+  std::vector<IAnimationKey> keys;
+  keys.reserve(_compiledTrack->keyCount());
+  for (size_t i = 0; i < _compiledTrack->keyCount(); ++i) {
+    keys.emplace_back(_compiledTrack->toAnimationKey(i));
+  }
+  return keys;
+}
+
+void Animation::_markKeysAsDirty()
+{
+  if (_keysAreQuantized) {
+    _keys             = _decodeKeys();
+    _keysAreQuantized = false;
+  }
+
+  _compiledTrack        = nullptr;
+  _compiledTrackIsDirty = true;
+}
+
+CompiledAnimationTrack* Animation::_getCompiledTrack()
+{
+  if (_keysAreQuantized) {
+    return _compiledTrack.get();
+  }
+
+  if (_compiledTrackIsDirty && _compileKeys) {
+    _compiledTrack = CompiledAnimationTrack::Compile(static_cast<unsigned int>(dataType), _keys);
+    _compiledTrackIsDirty = false;
+    if (_compiledTrack && _quantizeKeys && _compiledTrack->quantize()) {
+      // The quantized values replace the key frames
+      std::vector<IAnimationKey>().swap(_keys);
+      _keysAreQuantized = true;
+    }
+  }
+
+  return _compiledTrack.get();
+}
+
 float Animation::getHighestFrame() const
 {
   float ret = 0;
-  for (const auto& key : _keys) {
-    if (ret < key.frame) {
-      ret = key.frame;
+  for (size_t i = 0, keyCount = getKeyCount(); i < keyCount; ++i) {
+    const auto frame = getKeyFrame(i);
+    if (ret < frame) {
+      ret = frame;
     }
   }
   return ret;
@@ -366,6 +472,10 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
     return _getKeyValue(keys[0].value);
   }
 
+  if (const auto compiledTrack = _getCompiledTrack()) {
+    return _interpolateCompiled(*compiledTrack, currentFrame, state);
+  }
+
 #if 1
   // Try to get a hash to find the right key
   int _keysLength = static_cast<int>(keys.size());
@@ -393,9 +503,7 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
       state.key            = static_cast<int>(key);
       const auto& startKey = keys[key];
       auto startValue      = _getKeyValue(startKey.value);
-      if ((*startKey.interpolation).animationType().has_value()
-          && (*startKey.interpolation).animationType().value()
-               == static_cast<unsigned>(AnimationKeyInterpolation::STEP)) {
+      if (CompiledAnimationTrack::IsStepKey(startKey)) {
         return startValue;
       }
       auto endValue = _getKeyValue(endKey.value);
@@ -418,10 +526,9 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
         // Float
         case Animation::ANIMATIONTYPE_FLOAT: {
           const auto floatValue
-            = useTangent ?
-                floatInterpolateFunctionWithTangents(
-                  startValue.get<float>(), *startKey.outTangent * frameDelta, endValue.get<float>(),
-                  *endKey.inTangent * frameDelta, gradient) :
+            = useTangent ? floatInterpolateFunctionWithTangents(
+                startValue.get<float>(), (*startKey.outTangent).get<float>() * frameDelta,
+                endValue.get<float>(), (*endKey.inTangent).get<float>() * frameDelta, gradient) :
                 floatInterpolateFunction(startValue.get<float>(), endValue.get<float>(), gradient);
           switch (state.loopMode.value()) {
             case Animation::ANIMATIONLOOPMODE_CYCLE:
@@ -589,6 +696,63 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
   return _getKeyValue(keys.back().value);
 }
 
+AnimationValue Animation::_interpolateCompiled(const CompiledAnimationTrack& track,
+                                               float currentFrame, _IAnimationState& state)
+{
+  const auto segment = track.findSegment(currentFrame, state.key);
+  if (segment < 0) {
+    return _getKeyValue(getKeyValue(track.keyCount() - 1));
+  }
+
+  const auto startKey = static_cast<size_t>(segment);
+  if (track.isStep(startKey)) {
+    return _getKeyValue(getKeyValue(startKey));
+  }
+
+  // gradient : percent of currentFrame between the frame inf and the frame sup
+  auto gradient = track.gradient(startKey, currentFrame);
+
+  // check for easingFunction and correction of gradient
+  auto easingFunction = getEasingFunction();
+  if (easingFunction != nullptr) {
+    gradient = easingFunction->ease(gradient);
+  }
+
+  const auto loopMode = state.loopMode.value();
+  if (loopMode != Animation::ANIMATIONLOOPMODE_CYCLE
+      && loopMode != Animation::ANIMATIONLOOPMODE_CONSTANT
+      && loopMode != Animation::ANIMATIONLOOPMODE_RELATIVE) {
+    return _getKeyValue(getKeyValue(track.keyCount() - 1));
+  }
+
+  // Matrix
+  if (track.dataType() == Animation::ANIMATIONTYPE_MATRIX) {
+    if (loopMode != Animation::ANIMATIONLOOPMODE_RELATIVE
+        && Animation::AllowMatricesInterpolation() && state.workValue) {
+      auto startValue  = track.keyMatrix(startKey);
+      auto endValue    = track.keyMatrix(startKey + 1);
+      auto& _workValue = *state.workValue;
+      AnimationValue newValue
+        = matrixInterpolateFunction(startValue, endValue, gradient, _workValue.get<Matrix>());
+      state.workValue = _workValue;
+      return newValue;
+    }
+    return AnimationValue(track.keyMatrix(startKey));
+  }
+
+  CompiledAnimationTrack::Value value;
+  track.interpolate(startKey, gradient, value);
+  if (loopMode == Animation::ANIMATIONLOOPMODE_RELATIVE) {
+    const auto offset      = track.fromAnimationValue(state.offsetValue);
+    const auto repeatCount = static_cast<float>(state.repeatCount);
+    for (size_t i = 0; i < value.size(); ++i) {
+      value[i] += offset[i] * repeatCount;
+    }
+  }
+
+  return track.toAnimationValue(value);
+}
+
 Matrix Animation::matrixInterpolateFunction(Matrix& startValue, Matrix& endValue,
                                             float gradient) const
 {
@@ -617,8 +781,13 @@ AnimationPtr Animation::clone() const
 
   clonedAnimation->enableBlending = enableBlending;
   clonedAnimation->blendingSpeed  = blendingSpeed;
+  clonedAnimation->compileKeys    = _compileKeys;
+  clonedAnimation->quantizeKeys   = _quantizeKeys;
 
-  if (!_keys.empty()) {
+  if (_keysAreQuantized) {
+    clonedAnimation->setKeys(_decodeKeys());
+  }
+  else if (!_keys.empty()) {
     clonedAnimation->setKeys(_keys);
   }
 
@@ -633,7 +802,9 @@ AnimationPtr Animation::clone() const
 
 void Animation::setKeys(const std::vector<IAnimationKey>& values)
 {
-  _keys = values;
+  _keysAreQuantized = false;
+  _keys             = values;
+  _markKeysAsDirty();
 }
 
 json Animation::serialize() const
@@ -113,13 +113,14 @@ TargetedAnimation AnimationGroup::addTargetedAnimation(const AnimationPtr& anima
     target     // target
   };
 
-  const auto& keys = animation->getKeys();
-  if (_from > keys.front().frame) {
-    _from = keys.front().frame;
+  const auto firstFrame = animation->getKeyFrame(0);
+  if (_from > firstFrame) {
+    _from = firstFrame;
   }
 
-  if (_to < keys.back().frame) {
-    _to = keys.back().frame;
+  const auto lastFrame = animation->getKeyFrame(animation->getKeyCount() - 1);
+  if (_to < lastFrame) {
+    _to = lastFrame;
   }
 
   _targetedAnimations.emplace_back(std::make_unique<TargetedAnimation>(targetedAnimation));
@@ -153,6 +154,8 @@ AnimationGroup& AnimationGroup::normalize(const std::optional<int>& iBeginFrame,
       newKey.interpolation = endKey.interpolation;
       keys.emplace_back(newKey);
     }
+
+    targetedAnimation->animation->_markKeysAsDirty();
   }
 
   _from = beginFrame;
@@ -0,0 +1,201 @@
+#include <babylon/animations/animation_key_compression.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/compiled_animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/maths/quaternion.h>
+
+namespace BABYLON {
+
+namespace {
+
+using Value = CompiledAnimationTrack::Value;
+
+/**
+ * Largest difference on a component between two values, q and -q being the same rotation.
+ */
+float Difference(const Value& a, const Value& b, bool isQuaternion)
+{
+  float difference = 0.f, oppositeDifference = 0.f;
+  for (size_t c = 0; c < CompiledAnimationTrack::MaxStride; ++c) {
+    difference         = std::max(difference, std::abs(a[c] - b[c]));
+    oppositeDifference = std::max(oppositeDifference, std::abs(a[c] + b[c]));
+  }
+  return isQuaternion ? std::min(difference, oppositeDifference) : difference;
+}
+
+Value Interpolate(const Value& start, const Value& end, float gradient, bool isQuaternion)
+{
+  Value result{};
+  if (isQuaternion) {
+    Quaternion quaternion;
+    Quaternion::SlerpToRef(Quaternion(start[0], start[1], start[2], start[3]),
+                           Quaternion(end[0], end[1], end[2], end[3]), gradient, quaternion);
+    result = {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+    return result;
+  }
+  for (size_t c = 0; c < CompiledAnimationTrack::MaxStride; ++c) {
+    result[c] = start[c] + ((end[c] - start[c]) * gradient);
+  }
+  return result;
+}
+
+/**
+ * Returns the indices of the keys to keep, interpolating linearly between the kept keys giving the
+ * values of the removed ones within the tolerance.
+ */
+std::vector<size_t> ReduceKeys(const std::vector<IAnimationKey>& keys,
+                               const CompiledAnimationTrack& track, float tolerance,
+                               bool isQuaternion)
+{
+  const auto keyCount = keys.size();
+
+  std::vector<Value> values(keyCount);
+  std::vector<bool> removable(keyCount, false);
+  for (size_t i = 0; i < keyCount; ++i) {
+    values[i] = track.keyValue(i);
+    // The value of a STEP key is kept up to the next key
+    removable[i] = i > 0 && i + 1 < keyCount && !track.isStep(i) && !track.isStep(i - 1);
+  }
+
+  const auto fits = [&](size_t start, size_t end) {
+    const auto startFrame = keys[start].frame;
+    const auto frameDelta = keys[end].frame - startFrame;
+    if (frameDelta <= 0.f) {
+      return false;
+    }
+    for (size_t i = start + 1; i < end; ++i) {
+      const auto gradient = (keys[i].frame - startFrame) / frameDelta;
+      if (Difference(Interpolate(values[start], values[end], gradient, isQuaternion), values[i],
+                     isQuaternion)
+          > tolerance) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<size_t> kept{0};
+  for (size_t end = 2; end < keyCount; ++end) {
+    if (!removable[end - 1] || !fits(kept.back(), end)) {
+      kept.emplace_back(end - 1);
+    }
+  }
+  if (keyCount > 1) {
+    kept.emplace_back(keyCount - 1);
+  }
+
+  return kept;
+}
+
+} // end of anonymous namespace
+
+size_t AnimationKeyCompressionReport::savedMemorySize() const
+{
+  return originalMemorySize > memorySize ? originalMemorySize - memorySize : 0;
+}
+
+void AnimationKeyCompressionReport::merge(const AnimationKeyCompressionReport& other)
+{
+  animationCount += other.animationCount;
+  originalKeyCount += other.originalKeyCount;
+  keyCount += other.keyCount;
+  originalMemorySize += other.originalMemorySize;
+  memorySize += other.memorySize;
+  maxError = std::max(maxError, other.maxError);
+}
+
+AnimationKeyCompressionReport
+AnimationKeyCompression::CompressAnimation(Animation& animation,
+                                           const AnimationKeyCompressionOptions& options)
+{
+  AnimationKeyCompressionReport report;
+
+  const auto dataType = static_cast<unsigned int>(animation.dataType);
+  auto& keys          = animation.getKeys();
+  if (dataType == Animation::ANIMATIONTYPE_MATRIX || keys.size() < 2) {
+    return report;
+  }
+
+  const auto original = CompiledAnimationTrack::Compile(dataType, keys);
+  if (!original) {
+    return report;
+  }
+
+  const auto isQuaternion = (dataType == Animation::ANIMATIONTYPE_QUATERNION);
+  const auto hasTangents  = std::any_of(keys.begin(), keys.end(), [](const IAnimationKey& key) {
+    return key.inTangent.has_value() || key.outTangent.has_value();
+  });
+
+  // Measured against the key frames, the compiled key frames being a cache
+  report.animationCount     = 1;
+  report.originalKeyCount   = keys.size();
+  report.originalMemorySize = keys.size() * sizeof(IAnimationKey);
+
+  std::vector<float> originalFrames(keys.size());
+  std::transform(keys.begin(), keys.end(), originalFrames.begin(),
+                 [](const IAnimationKey& key) { return key.frame; });
+
+  // Removing keys changes the segments the easing function is applied to
+  if (!hasTangents && !animation.getEasingFunction()) {
+    const auto tolerance = isQuaternion ? options.quaternionTolerance : options.tolerance;
+    const auto kept      = ReduceKeys(keys, *original, tolerance, isQuaternion);
+    if (kept.size() < keys.size()) {
+      std::vector<IAnimationKey> reducedKeys;
+      reducedKeys.reserve(kept.size());
+      for (const auto index : kept) {
+        reducedKeys.emplace_back(keys[index]);
+      }
+      animation.setKeys(reducedKeys);
+    }
+  }
+
+  // The quantized key frames replace the key frames
+  animation.quantizeKeys = options.quantize;
+  const auto track       = animation._getCompiledTrack();
+  if (!track) {
+    return report;
+  }
+
+  int cursor = 0;
+  for (size_t i = 0; i < originalFrames.size(); ++i) {
+    const auto value = track->evaluate(originalFrames[i], cursor);
+    report.maxError
+      = std::max(report.maxError, Difference(value, original->keyValue(i), isQuaternion));
+  }
+
+  report.keyCount = animation.getKeyCount();
+  if (animation._hasQuantizedKeys()) {
+    report.memorySize = track->memorySize();
+  }
+  else {
+    report.memorySize = report.keyCount * sizeof(IAnimationKey);
+  }
+
+  return report;
+}
+
+AnimationKeyCompressionReport
+AnimationKeyCompression::CompressAnimationGroup(AnimationGroup& animationGroup,
+                                                const AnimationKeyCompressionOptions& options)
+{
+  AnimationKeyCompressionReport report;
+
+  std::unordered_set<Animation*> compressedAnimations;
+  for (const auto& targetedAnimation : animationGroup.targetedAnimations()) {
+    const auto& animation = targetedAnimation->animation;
+    if (animation && compressedAnimations.insert(animation.get()).second) {
+      report.merge(CompressAnimation(*animation, options));
+    }
+  }
+
+  return report;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,158 @@
+#include <babylon/animations/animation_lod_policy.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/ianimatable.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace BABYLON {
+
+AnimationLODPolicy::AnimationLODPolicy()
+    : enabled{false}
+    , offscreenUpdateInterval{30}
+    , distantScreenCoverage{0.1f}
+    , distantUpdateInterval{4}
+    , _scene{nullptr}
+    , _camera{nullptr}
+    , _tanHalfVerticalFov{1.f}
+    , _frameRenderId{-1}
+    , _lastFrameRenderId{-1}
+{
+}
+
+AnimationLODPolicy::~AnimationLODPolicy() = default;
+
+void AnimationLODPolicy::_beginFrame(Scene* scene)
+{
+  _scene  = scene;
+  _camera = scene->activeCamera().get();
+
+  // The screen coverage is measured against the height of the screen
+  if (_camera) {
+    _tanHalfVerticalFov = std::tan(_camera->fov * 0.5f);
+    if (_camera->fovMode == Camera::FOVMODE_HORIZONTAL_FIXED) {
+      const auto aspectRatio = scene->getEngine()->getAspectRatio(*_camera);
+      if (aspectRatio > 0.f) {
+        _tanHalfVerticalFov /= aspectRatio;
+      }
+    }
+  }
+
+  // The meshes activated during the last frame have a render id greater than the render id of the
+  // previous animation step (the fixed steps can animate several times per frame)
+  const auto renderId = scene->getRenderId();
+  if (renderId != _frameRenderId) {
+    _lastFrameRenderId = _frameRenderId;
+    _frameRenderId     = renderId;
+  }
+
+  _skeletonMeshes.clear();
+  for (const auto& mesh : scene->meshes) {
+    if (const auto& skeleton = mesh->skeleton()) {
+      _skeletonMeshes[skeleton.get()].emplace_back(mesh.get());
+    }
+  }
+}
+
+bool AnimationLODPolicy::_skip(Animatable& animatable)
+{
+  auto& skippedFrames = animatable._animationLODSkippedFrames;
+  // Not started animatables are updated to get their start time
+  if (!enabled || !_scene || !animatable.animationStarted) {
+    skippedFrames = 0;
+    return false;
+  }
+
+  const auto interval = _getUpdateInterval(animatable);
+  if (interval == 0) {
+    return true;
+  }
+  if (++skippedFrames < interval) {
+    return true;
+  }
+
+  skippedFrames = 0;
+  return false;
+}
+
+void AnimationLODPolicy::_collectTargetMeshes(const Animatable& animatable,
+                                              std::vector<AbstractMesh*>& meshes)
+{
+  meshes.clear();
+  const auto target = animatable.target.get();
+  if (!target) {
+    return;
+  }
+
+  if (const auto mesh = dynamic_cast<AbstractMesh*>(target)) {
+    meshes.emplace_back(mesh);
+    return;
+  }
+
+  const Skeleton* skeleton = dynamic_cast<Skeleton*>(target);
+  if (!skeleton) {
+    if (const auto bone = dynamic_cast<Bone*>(target)) {
+      skeleton = bone->getSkeleton();
+    }
+  }
+  if (skeleton) {
+    const auto it = _skeletonMeshes.find(skeleton);
+    if (it != _skeletonMeshes.end()) {
+      meshes = it->second;
+    }
+    return;
+  }
+
+  if (const auto node = dynamic_cast<TransformNode*>(target)) {
+    for (const auto& mesh : node->getChildMeshes(false)) {
+      meshes.emplace_back(mesh.get());
+    }
+  }
+}
+
+size_t AnimationLODPolicy::_getUpdateInterval(const Animatable& animatable)
+{
+  _collectTargetMeshes(animatable, _targetMeshes);
+  if (_targetMeshes.empty()) {
+    return 1;
+  }
+
+  auto active   = false;
+  auto coverage = 0.f;
+  for (const auto& mesh : _targetMeshes) {
+    if (mesh->_renderId <= _lastFrameRenderId) {
+      continue;
+    }
+    active = true;
+    if (!_camera || _camera->mode != Camera::PERSPECTIVE_CAMERA) {
+      coverage = 1.f;
+      break;
+    }
+    const auto& boundingSphere = mesh->getBoundingInfo()->boundingSphere;
+    const auto distance
+      = Vector3::Distance(boundingSphere.centerWorld, _camera->globalPosition());
+    if (distance <= boundingSphere.radiusWorld) {
+      coverage = 1.f;
+      break;
+    }
+    coverage
+      = std::max(coverage, boundingSphere.radiusWorld / (distance * _tanHalfVerticalFov));
+  }
+
+  if (!active) {
+    return offscreenUpdateInterval;
+  }
+
+  return coverage < distantScreenCoverage ? std::max<size_t>(distantUpdateInterval, 1) : 1;
+}
+
+} // end of namespace BABYLON
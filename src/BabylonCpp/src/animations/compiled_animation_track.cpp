@@ -0,0 +1,561 @@
+#include <babylon/animations/compiled_animation_track.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+#include <babylon/maths/color3.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+namespace {
+
+size_t StrideOf(unsigned int dataType)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return 1;
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      return 2;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return 3;
+    case Animation::ANIMATIONTYPE_QUATERNION:
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return 4;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      return 0;
+    default:
+      return std::string::npos;
+  }
+}
+
+bool HasTangents(unsigned int dataType)
+{
+  return dataType == Animation::ANIMATIONTYPE_FLOAT || dataType == Animation::ANIMATIONTYPE_VECTOR2
+         || dataType == Animation::ANIMATIONTYPE_VECTOR3
+         || dataType == Animation::ANIMATIONTYPE_QUATERNION;
+}
+
+bool IsOfType(const AnimationValue& value, unsigned int dataType)
+{
+  const auto animationType = value.animationType();
+  return animationType.has_value() && *animationType == dataType;
+}
+
+void ToFloats(const AnimationValue& value, unsigned int dataType, float* out)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      out[0] = value.get<float>();
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR2: {
+      const auto& v = value.get<Vector2>();
+      out[0]        = v.x;
+      out[1]        = v.y;
+    } break;
+    case Animation::ANIMATIONTYPE_VECTOR3: {
+      const auto& v = value.get<Vector3>();
+      out[0]        = v.x;
+      out[1]        = v.y;
+      out[2]        = v.z;
+    } break;
+    case Animation::ANIMATIONTYPE_QUATERNION: {
+      const auto& q = value.get<Quaternion>();
+      out[0]        = q.x;
+      out[1]        = q.y;
+      out[2]        = q.z;
+      out[3]        = q.w;
+    } break;
+    case Animation::ANIMATIONTYPE_COLOR3: {
+      const auto& c = value.get<Color3>();
+      out[0]        = c.r;
+      out[1]        = c.g;
+      out[2]        = c.b;
+    } break;
+    case Animation::ANIMATIONTYPE_COLOR4: {
+      const auto& c = value.get<Color4>();
+      out[0]        = c.r;
+      out[1]        = c.g;
+      out[2]        = c.b;
+      out[3]        = c.a;
+    } break;
+    default:
+      break;
+  }
+}
+
+/**
+ * Same operations, in the same order, as the Lerp functions of the maths classes.
+ */
+template <size_t N>
+void LerpKernel(const float* start, const float* end, float amount, float* result)
+{
+  for (size_t i = 0; i < N; ++i) {
+    result[i] = start[i] + ((end[i] - start[i]) * amount);
+  }
+}
+
+/**
+ * Same operations, in the same order, as the Hermite functions of the maths classes, the tangents
+ * being scaled by the length of the segment.
+ */
+template <size_t N>
+void HermiteKernel(const float* value1, const float* tangent1, const float* value2,
+                   const float* tangent2, float frameDelta, float amount, float* result)
+{
+  const float squared = amount * amount;
+  const float cubed   = amount * squared;
+  const float part1   = ((2.f * cubed) - (3.f * squared)) + 1.f;
+  const float part2   = (-2.f * cubed) + (3.f * squared);
+  const float part3   = (cubed - (2.f * squared)) + amount;
+  const float part4   = cubed - squared;
+
+  for (size_t i = 0; i < N; ++i) {
+    result[i] = (((value1[i] * part1) + (value2[i] * part2)) + ((tangent1[i] * frameDelta) * part3))
+                + ((tangent2[i] * frameDelta) * part4);
+  }
+}
+
+/**
+ * Range of the 3 smallest components of a normalized quaternion
+ */
+constexpr float SmallestThreeRange = 0.707106781f;
+
+/**
+ * Encodes a quaternion in 3 integers of 15 bits, the index of the largest component being stored
+ * in the high bits of the first two integers.
+ */
+void EncodeSmallestThree(const float* value, uint16_t* result)
+{
+  Quaternion quaternion(value[0], value[1], value[2], value[3]);
+  quaternion.normalize();
+  const float q[4] = {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+
+  size_t largest = 0;
+  for (size_t i = 1; i < 4; ++i) {
+    if (std::abs(q[i]) > std::abs(q[largest])) {
+      largest = i;
+    }
+  }
+
+  // q and -q are the same rotation, the largest component is kept positive
+  const auto sign = q[largest] < 0.f ? -1.f : 1.f;
+  for (size_t i = 0, word = 0; i < 4; ++i) {
+    if (i == largest) {
+      continue;
+    }
+    const auto component = std::clamp(q[i] * sign, -SmallestThreeRange, SmallestThreeRange);
+    result[word++]       = static_cast<uint16_t>(
+      std::lround((component + SmallestThreeRange) / (2.f * SmallestThreeRange) * 32767.f));
+  }
+  result[0] = static_cast<uint16_t>(result[0] | ((largest >> 1) << 15));
+  result[1] = static_cast<uint16_t>(result[1] | ((largest & 1) << 15));
+}
+
+void DecodeSmallestThree(const uint16_t* value, float* result)
+{
+  const auto largest = static_cast<size_t>(((value[0] >> 15) << 1) | (value[1] >> 15));
+
+  float sum = 0.f;
+  for (size_t i = 0, word = 0; i < 4; ++i) {
+    if (i == largest) {
+      continue;
+    }
+    const auto component = static_cast<float>(value[word++] & 0x7FFF) / 32767.f
+                             * (2.f * SmallestThreeRange)
+                           - SmallestThreeRange;
+    result[i] = component;
+    sum += component * component;
+  }
+  result[largest] = std::sqrt(std::max(0.f, 1.f - sum));
+}
+
+} // end of anonymous namespace
+
+CompiledAnimationTrack::CompiledAnimationTrack(unsigned int dataType, size_t stride)
+    : _dataType{dataType}
+    , _stride{stride}
+    , _quantized{false}
+    , _smallestThree{false}
+    , _quantizationOffset{}
+    , _quantizationScale{}
+{
+}
+
+CompiledAnimationTrack::~CompiledAnimationTrack() = default;
+
+bool CompiledAnimationTrack::IsStepKey(const IAnimationKey& key)
+{
+  if (!key.interpolation.has_value()) {
+    return false;
+  }
+  const auto& interpolation = *key.interpolation;
+  const auto animationType  = interpolation.animationType();
+  if (!animationType.has_value()) {
+    return false;
+  }
+  const auto step = static_cast<int>(AnimationKeyInterpolation::STEP);
+  switch (*animationType) {
+    case Animation::ANIMATIONTYPE_INT:
+      return interpolation.get<int>() == step;
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return static_cast<int>(interpolation.get<float>()) == step;
+    default:
+      return false;
+  }
+}
+
+CompiledAnimationTrackPtr CompiledAnimationTrack::Compile(unsigned int dataType,
+                                                          const std::vector<IAnimationKey>& keys)
+{
+  const auto stride = StrideOf(dataType);
+  if (stride == std::string::npos || keys.empty()) {
+    return nullptr;
+  }
+
+  const auto keyCount   = keys.size();
+  const auto isMatrix   = (dataType == Animation::ANIMATIONTYPE_MATRIX);
+  const auto useTangent = HasTangents(dataType);
+
+  CompiledAnimationTrackPtr track(new CompiledAnimationTrack(dataType, stride));
+  track->_frames.resize(keyCount);
+  track->_flags.resize(keyCount, 0);
+  if (isMatrix) {
+    track->_matrices.reserve(keyCount);
+  }
+  else {
+    track->_values.resize(keyCount * stride, 0.f);
+    if (useTangent) {
+      track->_inTangents.resize(keyCount * stride, 0.f);
+      track->_outTangents.resize(keyCount * stride, 0.f);
+    }
+  }
+
+  for (size_t i = 0; i < keyCount; ++i) {
+    const auto& key = keys[i];
+    if (!IsOfType(key.value, dataType) || (i > 0 && key.frame < keys[i - 1].frame)) {
+      return nullptr;
+    }
+    track->_frames[i] = key.frame;
+    if (IsStepKey(key)) {
+      track->_flags[i] |= StepFlag;
+    }
+    if (isMatrix) {
+      track->_matrices.emplace_back(key.value.get<Matrix>());
+      continue;
+    }
+    ToFloats(key.value, dataType, &track->_values[i * stride]);
+    if (!useTangent) {
+      continue;
+    }
+    if (key.inTangent) {
+      if (!IsOfType(*key.inTangent, dataType)) {
+        return nullptr;
+      }
+      ToFloats(*key.inTangent, dataType, &track->_inTangents[i * stride]);
+      track->_flags[i] |= InTangentFlag;
+    }
+    if (key.outTangent) {
+      if (!IsOfType(*key.outTangent, dataType)) {
+        return nullptr;
+      }
+      ToFloats(*key.outTangent, dataType, &track->_outTangents[i * stride]);
+      track->_flags[i] |= OutTangentFlag;
+    }
+  }
+
+  return track;
+}
+
+bool CompiledAnimationTrack::quantize()
+{
+  if (_quantized || _values.empty()) {
+    return _quantized;
+  }
+
+  const auto stride   = _stride;
+  const auto keyCount = _frames.size();
+
+  _smallestThree = (_dataType == Animation::ANIMATIONTYPE_QUATERNION)
+                   && std::none_of(_flags.begin(), _flags.end(), [](uint8_t flags) {
+                        return (flags & (InTangentFlag | OutTangentFlag)) != 0;
+                      });
+
+  if (_smallestThree) {
+    _quantizedValues.resize(keyCount * 3);
+    for (size_t i = 0; i < keyCount; ++i) {
+      EncodeSmallestThree(&_values[i * stride], &_quantizedValues[i * 3]);
+    }
+  }
+  else {
+    for (size_t c = 0; c < stride; ++c) {
+      auto min = _values[c];
+      auto max = _values[c];
+      for (size_t i = 1; i < keyCount; ++i) {
+        min = std::min(min, _values[i * stride + c]);
+        max = std::max(max, _values[i * stride + c]);
+      }
+      _quantizationOffset[c] = min;
+      _quantizationScale[c]  = (max - min) / 65535.f;
+    }
+
+    _quantizedValues.resize(keyCount * stride);
+    for (size_t i = 0; i < keyCount * stride; ++i) {
+      const auto c     = i % stride;
+      const auto scale = _quantizationScale[c];
+      _quantizedValues[i]
+        = scale > 0.f ? static_cast<uint16_t>(std::min(
+            65535l, std::lround((_values[i] - _quantizationOffset[c]) / scale))) :
+                        0;
+    }
+  }
+
+  _values.clear();
+  _values.shrink_to_fit();
+  _quantized = true;
+
+  return true;
+}
+
+bool CompiledAnimationTrack::isQuantized() const
+{
+  return _quantized;
+}
+
+size_t CompiledAnimationTrack::memorySize() const
+{
+  return sizeof(CompiledAnimationTrack) + _frames.size() * sizeof(float)
+         + (_values.size() + _inTangents.size() + _outTangents.size()) * sizeof(float)
+         + _flags.size() * sizeof(uint8_t) + _matrices.size() * sizeof(Matrix)
+         + _quantizedValues.size() * sizeof(uint16_t);
+}
+
+const float* CompiledAnimationTrack::_getKeyValues(size_t key, Value& buffer) const
+{
+  if (!_quantized) {
+    return &_values[key * _stride];
+  }
+
+  if (_smallestThree) {
+    DecodeSmallestThree(&_quantizedValues[key * 3], buffer.data());
+  }
+  else {
+    const auto values = &_quantizedValues[key * _stride];
+    for (size_t c = 0; c < _stride; ++c) {
+      buffer[c] = _quantizationOffset[c] + static_cast<float>(values[c]) * _quantizationScale[c];
+    }
+  }
+
+  return buffer.data();
+}
+
+unsigned int CompiledAnimationTrack::dataType() const
+{
+  return _dataType;
+}
+
+size_t CompiledAnimationTrack::keyCount() const
+{
+  return _frames.size();
+}
+
+int CompiledAnimationTrack::findSegment(float frame, int& cursor) const
+{
+  // The segment i contains the frame if frames[i] < frame <= frames[i + 1], the first segment
+  // also containing the frames before the first key
+  const auto lastSegment = static_cast<int>(_frames.size()) - 2;
+  if (lastSegment < 0 || frame > _frames.back()) {
+    return -1;
+  }
+
+  const auto contains = [this, frame](int segment) {
+    const auto index = static_cast<size_t>(segment);
+    return _frames[index + 1] >= frame && (segment == 0 || _frames[index] < frame);
+  };
+
+  // Playing forward, the frame is usually in the same segment or in the next one
+  if (cursor >= 0 && cursor <= lastSegment) {
+    if (contains(cursor)) {
+      return cursor;
+    }
+    if (cursor < lastSegment && contains(cursor + 1)) {
+      return ++cursor;
+    }
+  }
+
+  const auto it = std::lower_bound(_frames.begin() + 1, _frames.end(), frame);
+  cursor        = static_cast<int>(it - _frames.begin()) - 1;
+  return cursor;
+}
+
+bool CompiledAnimationTrack::isStep(size_t segment) const
+{
+  return (_flags[segment] & StepFlag) != 0;
+}
+
+CompiledAnimationTrack::Value CompiledAnimationTrack::evaluate(float frame, int& cursor) const
+{
+  const auto segment = findSegment(frame, cursor);
+  if (segment < 0) {
+    return keyValue(_frames.size() - 1);
+  }
+
+  const auto index = static_cast<size_t>(segment);
+  if (isStep(index)) {
+    return keyValue(index);
+  }
+
+  Value result{};
+  interpolate(index, std::max(0.f, gradient(index, frame)), result);
+  return result;
+}
+
+float CompiledAnimationTrack::gradient(size_t segment, float frame) const
+{
+  const auto startFrame = _frames[segment];
+  return (frame - startFrame) / (_frames[segment + 1] - startFrame);
+}
+
+void CompiledAnimationTrack::interpolate(size_t segment, float gradient, Value& result) const
+{
+  const auto stride = _stride;
+  Value startBuffer, endBuffer;
+  const auto start = _getKeyValues(segment, startBuffer);
+  const auto end   = _getKeyValues(segment + 1, endBuffer);
+
+  const auto useTangent
+    = (_flags[segment] & OutTangentFlag) && (_flags[segment + 1] & InTangentFlag);
+  if (useTangent) {
+    const auto frameDelta = _frames[segment + 1] - _frames[segment];
+    const auto outTangent = &_outTangents[segment * stride];
+    const auto inTangent  = &_inTangents[(segment + 1) * stride];
+    switch (stride) {
+      case 1:
+        HermiteKernel<1>(start, outTangent, end, inTangent, frameDelta, gradient, result.data());
+        break;
+      case 2:
+        HermiteKernel<2>(start, outTangent, end, inTangent, frameDelta, gradient, result.data());
+        break;
+      case 3:
+        HermiteKernel<3>(start, outTangent, end, inTangent, frameDelta, gradient, result.data());
+        break;
+      default:
+        HermiteKernel<4>(start, outTangent, end, inTangent, frameDelta, gradient, result.data());
+        break;
+    }
+    if (_dataType == Animation::ANIMATIONTYPE_QUATERNION) {
+      Quaternion quaternion(result[0], result[1], result[2], result[3]);
+      quaternion.normalize();
+      result = {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+    }
+    return;
+  }
+
+  if (_dataType == Animation::ANIMATIONTYPE_QUATERNION) {
+    Quaternion quaternion;
+    Quaternion::SlerpToRef(Quaternion(start[0], start[1], start[2], start[3]),
+                           Quaternion(end[0], end[1], end[2], end[3]), gradient, quaternion);
+    result = {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+    return;
+  }
+
+  switch (stride) {
+    case 1:
+      LerpKernel<1>(start, end, gradient, result.data());
+      break;
+    case 2:
+      LerpKernel<2>(start, end, gradient, result.data());
+      break;
+    case 3:
+      LerpKernel<3>(start, end, gradient, result.data());
+      break;
+    default:
+      LerpKernel<4>(start, end, gradient, result.data());
+      break;
+  }
+}
+
+float CompiledAnimationTrack::keyFrame(size_t key) const
+{
+  return _frames[key];
+}
+
+CompiledAnimationTrack::Value CompiledAnimationTrack::keyValue(size_t key) const
+{
+  Value value{};
+  if (_quantized) {
+    _getKeyValues(key, value);
+  }
+  else {
+    std::copy_n(&_values[key * _stride], _stride, value.begin());
+  }
+  return value;
+}
+
+const Matrix& CompiledAnimationTrack::keyMatrix(size_t key) const
+{
+  return _matrices[key];
+}
+
+AnimationValue CompiledAnimationTrack::toAnimationValue(const Value& value) const
+{
+  switch (_dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return AnimationValue(value[0]);
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      return AnimationValue(Vector2(value[0], value[1]));
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      return AnimationValue(Vector3(value[0], value[1], value[2]));
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      return AnimationValue(Quaternion(value[0], value[1], value[2], value[3]));
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return AnimationValue(Color3(value[0], value[1], value[2]));
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return AnimationValue(Color4(value[0], value[1], value[2], value[3]));
+    default:
+      return AnimationValue();
+  }
+}
+
+CompiledAnimationTrack::Value
+CompiledAnimationTrack::fromAnimationValue(const AnimationValue& value) const
+{
+  Value result{};
+  if (IsOfType(value, _dataType)) {
+    ToFloats(value, _dataType, result.data());
+  }
+  return result;
+}
+
+IAnimationKey CompiledAnimationTrack::toAnimationKey(size_t key) const
+{
+  IAnimationKey animationKey(_frames[key], _dataType == Animation::ANIMATIONTYPE_MATRIX ?
+                                             AnimationValue(_matrices[key]) :
+                                             toAnimationValue(keyValue(key)));
+
+  // Only the float, vector and quaternion keys have tangents
+  Value tangent{};
+  if (_flags[key] & InTangentFlag) {
+    std::copy_n(&_inTangents[key * _stride], _stride, tangent.begin());
+    animationKey.inTangent = toAnimationValue(tangent);
+  }
+  if (_flags[key] & OutTangentFlag) {
+    std::copy_n(&_outTangents[key * _stride], _stride, tangent.begin());
+    animationKey.outTangent = toAnimationValue(tangent);
+  }
+  if (isStep(key)) {
+    const auto step            = static_cast<int>(AnimationKeyInterpolation::STEP);
+    animationKey.interpolation = AnimationValue(step);
+  }
+
+  return animationKey;
+}
+
+} // end of namespace BABYLON
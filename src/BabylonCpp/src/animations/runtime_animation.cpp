@@ -8,8 +8,8 @@
 #include <babylon/animations/animation_properties_override.h>
 #include <babylon/animations/easing/ieasing_function.h>
 #include <babylon/animations/ianimatable.h>
-#include <babylon/animations/ianimation_key.h>
 #include <babylon/babylon_stl_util.h>
+#include <babylon/engines/scene.h>
 
 namespace BABYLON {
 
@@ -50,21 +50,15 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& iTarget, const Animatio
     _animationState.workValue = Matrix::Zero();
   }
 
-  // Limits
-  _keys     = _animation->getKeys();
-  _minFrame = _keys[0].frame;
-  _maxFrame = _keys.back().frame;
-  _minValue = _keys[0].value;
-  _maxValue = _keys.back().value;
+  // Compile the key frames now rather than on the first evaluation
+  _animation->_getCompiledTrack();
 
-  // Add a start key at frame 0 if missing
-  if (_minFrame != 0.f) {
-    const auto newKey = IAnimationKey{
-      0.f,       // frame
-      _minValue, // value
-    };
-    _keys.insert(_keys.begin(), newKey);
-  }
+  // Limits, read without decoding the quantized key frames
+  const auto lastKey = _animation->getKeyCount() - 1;
+  _minFrame          = _animation->getKeyFrame(0);
+  _maxFrame          = _animation->getKeyFrame(lastKey);
+  _minValue          = _animation->getKeyValue(0);
+  _maxValue          = _animation->getKeyValue(lastKey);
 
   // Check data
   {
@@ -227,15 +221,26 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& iTarget, const IAnimatabl
     _currentValue = iCurrentValue;
   }
 
-  if (!stl_util::almost_equal(iWeight, -1.f)) {
-  }
-  else {
-    if (_currentValue.has_value()) {
-      const auto& targetPropertyPath = _animation->targetPropertyPath;
-      destination->setProperty(targetPropertyPath, _currentValue.value());
+  const auto& targetPropertyPath = _animation->targetPropertyPath;
+  if (!stl_util::almost_equal(iWeight, -1.f) && !_originalValue[targetIndex]) {
+    auto& restPose = destination->getRestPose();
+    if (restPose && _animation->targetProperty == "_matrix") { // For bones
+      _originalValue[targetIndex] = *restPose;
+    }
+    else if (auto originalValue = destination->getProperty(targetPropertyPath)) {
+      _originalValue[targetIndex] = originalValue.copy();
     }
   }
 
+  // The weighted values are blended by the scene once all the animations are applied, the
+  // properties whose original value is unknown are set directly
+  if (!stl_util::almost_equal(iWeight, -1.f) && _originalValue[targetIndex]) {
+    _scene->_registerTargetForLateAnimationBinding(this, *_originalValue[targetIndex]);
+  }
+  else if (_currentValue.has_value()) {
+    destination->setProperty(targetPropertyPath, _currentValue.value());
+  }
+
   /* if (iTarget->markAsDirty) */ {
     iTarget->markAsDirty(_animation->targetProperty);
   }
@@ -252,13 +257,15 @@ std::optional<unsigned int> RuntimeAnimation::_getCorrectLoopMode() const
 
 void RuntimeAnimation::goToFrame(float frame)
 {
-  auto& keys = _animation->getKeys();
+  const auto& animation = *_animation;
+  const auto firstFrame = animation.getKeyFrame(0);
+  const auto lastFrame  = animation.getKeyFrame(animation.getKeyCount() - 1);
 
-  if (frame < keys[0].frame) {
-    frame = keys[0].frame;
+  if (frame < firstFrame) {
+    frame = firstFrame;
   }
-  else if (frame > keys.back().frame) {
-    frame = keys.back().frame;
+  else if (frame > lastFrame) {
+    frame = lastFrame;
   }
 
   // Need to reset animation events
@@ -286,12 +293,32 @@ void RuntimeAnimation::_prepareForSpeedRatioChange(float newSpeedRatio)
 
 bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool loop,
                                float speedRatio, float iWeight)
+{
+  _evaluate(delay, from, to, loop, speedRatio);
+  return _apply(iWeight);
+}
+
+bool RuntimeAnimation::_canEvaluateInParallel() const
+{
+  if (_host && _host->syncRoot()) {
+    return false;
+  }
+
+  return !(_animation->dataType == static_cast<int>(Animation::ANIMATIONTYPE_MATRIX)
+           && Animation::AllowMatricesInterpolation()
+           && Animation::AllowMatrixDecomposeForInterpolation());
+}
+
+void RuntimeAnimation::_evaluate(millisecond_t delay, float from, float to, bool loop,
+                                 float speedRatio)
 {
   auto& animation                = *_animation;
   const auto& targetPropertyPath = animation.targetPropertyPath;
+  _evaluatedFrame.hasValue       = false;
+  _evaluatedFrame.hasLooped      = false;
+  _evaluatedFrame.isRunning      = false;
   if (targetPropertyPath.empty()) {
-    _stopped = true;
-    return false;
+    return;
   }
 
   auto returnValue = true;
@@ -417,11 +444,62 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
     iCurrentFrame = (returnValue && range != 0.f) ? from + std::fmod(ratio, range) : to;
   }
 
+  // The loop is handled when the value is applied
+  _evaluatedFrame.hasLooped = (range > 0.f && currentFrame > iCurrentFrame)
+                              || (range < 0.f && currentFrame < iCurrentFrame);
+
+  _currentFrame                  = iCurrentFrame;
+  _animationState.repeatCount    = range == 0.f ? 0 : static_cast<int>(ratio / range) >> 0;
+  _animationState.highLimitValue = highLimitValue;
+  _animationState.offsetValue    = offsetValue;
+
+  _evaluatedFrame.value     = animation._interpolate(iCurrentFrame, _animationState);
+  _evaluatedFrame.from      = from;
+  _evaluatedFrame.range     = range;
+  _evaluatedFrame.hasValue  = true;
+  _evaluatedFrame.isRunning = returnValue;
+}
+
+bool RuntimeAnimation::_apply(float iWeight)
+{
+  if (!_evaluatedFrame.hasValue) {
+    _stopped = true;
+    return false;
+  }
+
+  const auto from          = _evaluatedFrame.from;
+  const auto range         = _evaluatedFrame.range;
+  const auto iCurrentFrame = _currentFrame;
+  const auto returnValue   = _evaluatedFrame.isRunning;
+
   // Reset events if looping
   auto& events = _events;
-  if ((range > 0.f && currentFrame > iCurrentFrame)
-      || (range < 0.f && currentFrame < iCurrentFrame)) {
-    _onLoop();
+  if (_evaluatedFrame.hasLooped) {
+    if (_onLoop) {
+      _onLoop();
+    }
+
+    // Raise the events between the last evaluated frame and the end of the loop, which are missed
+    // when several frames are skipped (see AnimationLODPolicy) or when the delay is long
+    const auto to = from + range;
+    for (unsigned int index = 0; index < events.size(); ++index) {
+      auto& event = events[index];
+      if (event.isDone
+          || !((range > 0.f && event.frame >= from && event.frame <= to)
+               || (range < 0.f && event.frame <= from && event.frame >= to))) {
+        continue;
+      }
+      const auto action = event.action;
+      const auto frame  = event.frame;
+      if (event.onlyOnce) {
+        events.erase(events.begin() + index);
+        --index;
+      }
+      else {
+        event.isDone = true;
+      }
+      action(frame);
+    }
 
     // Need to reset animation events
     if (!events.empty()) {
@@ -433,15 +511,10 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
       }
     }
   }
-  _currentFrame                  = iCurrentFrame;
-  _animationState.repeatCount    = range == 0.f ? 0 : static_cast<int>(ratio / range) >> 0;
-  _animationState.highLimitValue = highLimitValue;
-  _animationState.offsetValue    = offsetValue;
-
-  auto iCurrentValue = animation._interpolate(iCurrentFrame, _animationState);
 
   // Set value
-  setValue(iCurrentValue, iWeight);
+  setValue(_evaluatedFrame.value, iWeight);
+  _evaluatedFrame.hasValue = false;
 
   // Check events
   if (!events.empty()) {
@@ -195,6 +195,11 @@ void pop_HACK_DISABLE_ASYNC()
   --HACK_DISABLE_ASYNC;
 }
 
+bool IsAsyncDisabled()
+{
+  return HACK_DISABLE_ASYNC > 0;
+}
+
 
 void LoadFileAsync_Text(const std::string& filename,
                        const OnSuccessFunction<std::string>& onSuccessFunction,
@@ -111,6 +111,10 @@ void pop_HACK_DISABLE_ASYNC()
 {
   BABYLON_LOG_WARN("asio", "pop_HACK_DISABLE_ASYNC does not work under emscripten", "");
 }
+bool IsAsyncDisabled()
+{
+  return false;
+}
 
 void LoadAssetAsync_Text(
   const std::string& assetPath,
@@ -0,0 +1,163 @@
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
+
+#include <cmath>
+
+#include <babylon/engines/engine_store.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/textures/base_texture.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace BABYLON {
+
+BakedVertexAnimationManager::BakedVertexAnimationManager(Scene* scene)
+    : animationParameters{0.f, 0.f, 0.f, 30.f}
+    , time{0.f}
+    , _scene{scene ? scene : EngineStore::LastCreatedScene()}
+    , _texture{nullptr}
+    , _isEnabled{true}
+{
+}
+
+BakedVertexAnimationManager::~BakedVertexAnimationManager() = default;
+
+std::string BakedVertexAnimationManager::getClassName() const
+{
+  return "BakedVertexAnimationManager";
+}
+
+BaseTexturePtr& BakedVertexAnimationManager::texture()
+{
+  return _texture;
+}
+
+void BakedVertexAnimationManager::setTexture(const BaseTexturePtr& value)
+{
+  if (_texture == value) {
+    return;
+  }
+
+  _texture = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+bool BakedVertexAnimationManager::isEnabled() const
+{
+  return _isEnabled;
+}
+
+void BakedVertexAnimationManager::setEnabled(bool value)
+{
+  if (_isEnabled == value) {
+    return;
+  }
+
+  _isEnabled = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+void BakedVertexAnimationManager::_markSubMeshesAsAttributesDirty()
+{
+  if (!_scene) {
+    return;
+  }
+
+  for (const auto& mesh : _scene->meshes) {
+    if (mesh->bakedVertexAnimationManager().get() == this) {
+      mesh->_markSubMeshesAsAttributesDirty();
+    }
+  }
+}
+
+void BakedVertexAnimationManager::setAnimationParameters(float startFrame, float endFrame,
+                                                         float offset, float speedFramesPerSecond)
+{
+  animationParameters.copyFromFloats(startFrame, endFrame, offset, speedFramesPerSecond);
+}
+
+void BakedVertexAnimationManager::bind(const EffectPtr& effect, bool useInstances)
+{
+  if (!_texture || !_isEnabled || !effect) {
+    return;
+  }
+
+  const auto size = _texture->getSize();
+  effect->setFloat2("bakedVertexAnimationTextureSizeInverted",
+                    1.f / static_cast<float>(size.width), 1.f / static_cast<float>(size.height));
+  effect->setFloat("bakedVertexAnimationTime", time);
+
+  if (!useInstances) {
+    effect->setVector4("bakedVertexAnimationSettings", animationParameters);
+  }
+
+  effect->setTexture("bakedVertexAnimationTexture", _texture);
+}
+
+BakedVertexAnimationManagerPtr BakedVertexAnimationManager::clone() const
+{
+  auto copy                 = BakedVertexAnimationManager::New(_scene);
+  copy->_texture            = _texture;
+  copy->_isEnabled          = _isEnabled;
+  copy->animationParameters = animationParameters;
+  copy->time                = time;
+  return copy;
+}
+
+void BakedVertexAnimationManager::_update(float deltaTimeInSeconds)
+{
+  time += deltaTimeInSeconds;
+}
+
+void BakedVertexAnimationManager::dispose(bool forceDisposeTextures)
+{
+  if (forceDisposeTextures && _texture) {
+    _texture->dispose();
+  }
+  _texture = nullptr;
+}
+
+void BakedVertexAnimationManager::AddUniforms(std::vector<std::string>& uniforms)
+{
+  uniforms.insert(uniforms.end(), {"bakedVertexAnimationSettings",
+                                   "bakedVertexAnimationTextureSizeInverted",
+                                   "bakedVertexAnimationTime"});
+}
+
+void BakedVertexAnimationManager::AddSamplers(std::vector<std::string>& samplers)
+{
+  samplers.emplace_back("bakedVertexAnimationTexture");
+}
+
+float BakedVertexAnimationManager::ComputeFrame(const Vector4& settings, float time)
+{
+  // Same operations as the bakedVertexAnimation shader include
+  const auto startFrame  = settings.x;
+  const auto endFrame    = settings.y;
+  const auto offsetFrame = settings.z;
+  const auto speed       = settings.w;
+
+  const auto totalFrames     = endFrame - startFrame + 1.f;
+  const auto t               = time * speed / totalFrames;
+  const auto frameCorrection = t < 1.f ? 0.f : 1.f;
+  const auto numOfFrames     = totalFrames - frameCorrection;
+
+  auto frameNum = (t - std::floor(t)) * numOfFrames;
+  frameNum      = frameNum + offsetFrame;
+  frameNum      = frameNum - numOfFrames * std::floor(frameNum / numOfFrames);
+  frameNum      = std::floor(frameNum);
+  return frameNum + startFrame + frameCorrection;
+}
+
+Matrix BakedVertexAnimationManager::ReadBoneMatrix(const Float32Array& vertexData, size_t boneCount,
+                                                   size_t frame, size_t boneIndex)
+{
+  // A row of the texture holds the boneCount + 1 matrices of a frame
+  const auto offset = (frame * (boneCount + 1) + boneIndex) * 16;
+  if (boneIndex > boneCount || offset + 16 > vertexData.size()) {
+    return Matrix::Identity();
+  }
+
+  return Matrix::FromArray(vertexData, static_cast<unsigned int>(offset));
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,93 @@
+#include <babylon/baked_vertex_animation/vertex_animation_baker.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace BABYLON {
+
+VertexAnimationBaker::VertexAnimationBaker(Scene* scene, const AbstractMeshPtr& mesh)
+    : _scene{scene}, _mesh{mesh}
+{
+}
+
+VertexAnimationBaker::~VertexAnimationBaker() = default;
+
+size_t VertexAnimationBaker::_boneCount() const
+{
+  return (_mesh && _mesh->skeleton()) ? _mesh->skeleton()->bones.size() : 0;
+}
+
+Float32Array VertexAnimationBaker::bakeVertexData(const std::vector<AnimationRange>& ranges)
+{
+  if (!_scene || !_mesh || !_mesh->skeleton() || ranges.empty()) {
+    return {};
+  }
+
+  const auto& skeleton = _mesh->skeleton();
+  const auto boneCount = _boneCount();
+  const auto rowSize   = (boneCount + 1) * 16;
+  size_t frameCount    = 0;
+  auto minFrame        = ranges.front().from;
+  auto maxFrame        = ranges.front().to;
+  for (const auto& range : ranges) {
+    if (range.to >= range.from) {
+      frameCount += static_cast<size_t>(std::floor(range.to - range.from)) + 1;
+    }
+    minFrame = std::min(minFrame, range.from);
+    maxFrame = std::max(maxFrame, range.to);
+  }
+
+  Float32Array vertexData(rowSize * frameCount, 0.f);
+  if (frameCount == 0) {
+    return vertexData;
+  }
+
+  // A single animatable covering every range, moved from frame to frame. The values are applied
+  // synchronously, so the skeleton can be prepared without rendering the scene.
+  skeleton->returnToRest();
+  auto animatable = _scene->beginAnimation(skeleton, minFrame, maxFrame, false, 1.f);
+
+  size_t frameIndex = 0;
+  for (const auto& range : ranges) {
+    for (auto frame = range.from; frame <= range.to; frame += 1.f, ++frameIndex) {
+      if (animatable) {
+        animatable->goToFrame(frame);
+      }
+      skeleton->prepare();
+      const auto& matrices = skeleton->getTransformMatrices(_mesh.get());
+      std::copy_n(matrices.begin(), std::min(matrices.size(), rowSize),
+                  vertexData.begin() + static_cast<std::ptrdiff_t>(frameIndex * rowSize));
+    }
+  }
+
+  if (animatable) {
+    animatable->stop();
+  }
+  skeleton->returnToRest();
+
+  return vertexData;
+}
+
+RawTexturePtr VertexAnimationBaker::textureFromBakedVertexData(const Float32Array& vertexData)
+{
+  if (!_scene || vertexData.empty() || !_mesh || !_mesh->skeleton()) {
+    return nullptr;
+  }
+
+  const auto width  = static_cast<int>((_boneCount() + 1) * 4);
+  const auto height = static_cast<int>(vertexData.size() / (static_cast<size_t>(width) * 4));
+  return RawTexture::CreateRGBATexture(ArrayBufferView(vertexData), width, height, _scene, false,
+                                       false, Constants::TEXTURE_NEAREST_SAMPLINGMODE,
+                                       Constants::TEXTURETYPE_FLOAT);
+}
+
+} // end of namespace BABYLON
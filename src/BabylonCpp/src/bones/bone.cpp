@@ -430,6 +430,7 @@ bool Bone::copyAnimationRange(Bone* source, const std::string& rangeName, int fr
       destKeys.emplace_back(IAnimationKey(orig.frame + frameOffset, mat));
     }
   }
+  animations[0]->_markKeysAsDirty();
   animations[0]->createRange(rangeName, from + frameOffset, to + frameOffset);
   return true;
 }
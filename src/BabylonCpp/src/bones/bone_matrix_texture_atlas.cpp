@@ -0,0 +1,165 @@
+#include <babylon/bones/bone_matrix_texture_atlas.h>
+
+#include <algorithm>
+
+#include <babylon/core/logging.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/raw_texture.h>
+
+namespace BABYLON {
+
+BoneMatrixTextureAtlas& BoneMatrixTextureAtlas::ForScene(Scene* scene)
+{
+  if (!scene->_boneMatrixTextureAtlas) {
+    scene->_boneMatrixTextureAtlas = std::make_unique<BoneMatrixTextureAtlas>(scene);
+  }
+
+  return *scene->_boneMatrixTextureAtlas;
+}
+
+BoneMatrixTextureAtlas::BoneMatrixTextureAtlas(Scene* scene)
+    : _scene{scene}, _width{0}, _height{0}, _texture{nullptr}, _uploadedTexelCount{0}
+{
+}
+
+BoneMatrixTextureAtlas::~BoneMatrixTextureAtlas() = default;
+
+std::optional<size_t> BoneMatrixTextureAtlas::allocate(size_t matrixCount)
+{
+  // Power of two widths, so that a few skeletons with more bones do not resize the texture
+  auto width = std::max(_width, MinWidth);
+  while (width < matrixCount * 4) {
+    width *= 2;
+  }
+
+  auto row = static_cast<size_t>(std::find(_usedRows.begin(), _usedRows.end(), false)
+                                 - _usedRows.begin());
+  auto height = std::max(_height, InitialRowCount);
+  if (row == height) {
+    height *= 2;
+  }
+
+  if (width != _width || height != _height) {
+    const auto maxTextureSize = static_cast<size_t>(_scene->getEngine()->getCaps().maxTextureSize);
+    if (width > maxTextureSize || height > maxTextureSize) {
+      BABYLON_LOGF_ERROR("BoneMatrixTextureAtlas",
+                         "Cannot allocate %zu matrices, the texture would be larger than %zu",
+                         matrixCount, maxTextureSize)
+      return std::nullopt;
+    }
+    _resize(width, height);
+  }
+
+  _usedRows[row] = true;
+  return row;
+}
+
+void BoneMatrixTextureAtlas::release(size_t row)
+{
+  if (row < _usedRows.size()) {
+    _usedRows[row] = false;
+  }
+}
+
+void BoneMatrixTextureAtlas::update(size_t row, const Float32Array& matrices)
+{
+  if (row >= _height) {
+    return;
+  }
+
+  const auto count  = std::min(matrices.size(), _width * 4);
+  const auto target = _data.begin() + static_cast<std::ptrdiff_t>(row * _width * 4);
+
+  // Range of the texels which changed
+  const auto mismatch = std::mismatch(matrices.begin(), matrices.begin() + count, target);
+  if (mismatch.first == matrices.begin() + static_cast<std::ptrdiff_t>(count)) {
+    return;
+  }
+  const auto first = static_cast<size_t>(mismatch.first - matrices.begin()) / 4;
+  auto last        = first;
+  for (auto i = count; i > first * 4; --i) {
+    if (matrices[i - 1] != target[static_cast<std::ptrdiff_t>(i - 1)]) {
+      last = (i - 1) / 4;
+      break;
+    }
+  }
+
+  std::copy(matrices.begin(), matrices.begin() + static_cast<std::ptrdiff_t>(count), target);
+
+  if (_texture) {
+    const auto texelCount = last - first + 1;
+    const auto begin      = target + static_cast<std::ptrdiff_t>(first * 4);
+    const Float32Array region(begin, begin + static_cast<std::ptrdiff_t>(texelCount * 4));
+    _texture->updateRegion(region, static_cast<int>(first), static_cast<int>(row),
+                           static_cast<int>(texelCount), 1);
+    _uploadedTexelCount += texelCount;
+  }
+}
+
+RawTexturePtr& BoneMatrixTextureAtlas::getTexture()
+{
+  return _texture;
+}
+
+size_t BoneMatrixTextureAtlas::getWidth() const
+{
+  return _width;
+}
+
+size_t BoneMatrixTextureAtlas::getHeight() const
+{
+  return _height;
+}
+
+float BoneMatrixTextureAtlas::getRowCoordinate(size_t row) const
+{
+  return _height > 0 ? (static_cast<float>(row) + 0.5f) / static_cast<float>(_height) : 0.5f;
+}
+
+size_t BoneMatrixTextureAtlas::getUploadedTexelCount() const
+{
+  return _uploadedTexelCount;
+}
+
+void BoneMatrixTextureAtlas::dispose()
+{
+  if (_texture) {
+    _texture->dispose();
+    _texture = nullptr;
+  }
+
+  _width  = 0;
+  _height = 0;
+  _data.clear();
+  _usedRows.clear();
+}
+
+void BoneMatrixTextureAtlas::_resize(size_t width, size_t height)
+{
+  // Keep the rows already allocated
+  Float32Array data(width * height * 4, 0.f);
+  for (size_t row = 0; row < _height; ++row) {
+    const auto source = _data.begin() + static_cast<std::ptrdiff_t>(row * _width * 4);
+    std::copy(source, source + static_cast<std::ptrdiff_t>(_width * 4),
+              data.begin() + static_cast<std::ptrdiff_t>(row * width * 4));
+  }
+
+  _width  = width;
+  _height = height;
+  _data   = std::move(data);
+  _usedRows.resize(height, false);
+
+  if (_texture) {
+    _texture->dispose();
+  }
+
+  _texture = RawTexture::CreateRGBATexture(_data, static_cast<int>(_width),
+                                           static_cast<int>(_height), _scene, false, false,
+                                           Constants::TEXTURE_NEAREST_SAMPLINGMODE,
+                                           Constants::TEXTURETYPE_FLOAT);
+  _uploadedTexelCount += _width * _height;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,94 @@
+#include <babylon/bones/bone_matrix_tools.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+void BoneMatrixTools::Multiply(const float* a, const float* b, float* result)
+{
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+  MultiplySSE2(a, b, result);
+#else
+  MultiplyScalar(a, b, result);
+#endif
+}
+
+void BoneMatrixTools::MultiplyScalar(const float* a, const float* b, float* result)
+{
+  float m[16];
+  for (size_t i = 0; i < 4; ++i) {
+    const auto row = a + i * 4;
+    for (size_t j = 0; j < 4; ++j) {
+      m[i * 4 + j] = row[0] * b[j] + row[1] * b[4 + j] + row[2] * b[8 + j] + row[3] * b[12 + j];
+    }
+  }
+  std::copy(m, m + 16, result);
+}
+
+bool BoneMatrixTools::MultiplySSE2(const float* a, const float* b, float* result)
+{
+#if defined(__SSE2__)
+  // Each row of the result is a combination of the rows of b
+  const auto b0 = _mm_loadu_ps(b);
+  const auto b1 = _mm_loadu_ps(b + 4);
+  const auto b2 = _mm_loadu_ps(b + 8);
+  const auto b3 = _mm_loadu_ps(b + 12);
+
+  __m128 rows[4];
+  for (size_t i = 0; i < 4; ++i) {
+    const auto row = a + i * 4;
+    auto sum       = _mm_mul_ps(_mm_set1_ps(row[0]), b0);
+    sum            = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(row[1]), b1));
+    sum            = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(row[2]), b2));
+    rows[i]        = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(row[3]), b3));
+  }
+
+  for (size_t i = 0; i < 4; ++i) {
+    _mm_storeu_ps(result + i * 4, rows[i]);
+  }
+  return true;
+#else
+  (void)a;
+  (void)b;
+  (void)result;
+  return false;
+#endif
+}
+
+void BoneMatrixTools::ComputeWorldMatrices(const int* parentIndices, const float* localMatrices,
+                                           const float* rootMatrix, float* worldMatrices,
+                                           size_t boneCount)
+{
+  for (size_t i = 0; i < boneCount; ++i) {
+    const auto local = localMatrices + i * 16;
+    const auto world = worldMatrices + i * 16;
+    if (parentIndices[i] >= 0) {
+      Multiply(local, worldMatrices + static_cast<size_t>(parentIndices[i]) * 16, world);
+    }
+    else if (rootMatrix) {
+      Multiply(local, rootMatrix, world);
+    }
+    else {
+      std::copy(local, local + 16, world);
+    }
+  }
+}
+
+void BoneMatrixTools::ComputeSkinningMatrices(const int* matrixIndices,
+                                              const float* inverseBindMatrices,
+                                              const float* worldMatrices, float* target,
+                                              size_t boneCount)
+{
+  for (size_t i = 0; i < boneCount; ++i) {
+    if (matrixIndices[i] >= 0) {
+      Multiply(inverseBindMatrices + i * 16, worldMatrices + i * 16,
+               target + static_cast<size_t>(matrixIndices[i]) * 16);
+    }
+  }
+}
+
+} // end of namespace BABYLON
@@ -3,12 +3,13 @@
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/bone.h>
+#include <babylon/bones/bone_matrix_texture_atlas.h>
+#include <babylon/bones/bone_matrix_tools.h>
+#include <babylon/bones/skeleton_pose_cache.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
-#include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
-#include <babylon/materials/textures/raw_texture.h>
 #include <babylon/maths/tmp_vectors.h>
 #include <babylon/meshes/abstract_mesh.h>
 
@@ -27,13 +28,13 @@ Skeleton::Skeleton(const std::string& iName, const std::string& iId, Scene* scen
     , isUsingTextureForMatrices{this, &Skeleton::get_isUsingTextureForMatrices}
     , uniqueId{this, &Skeleton::get_uniqueId}
     , _isDirty{true}
-    , _transformMatrixTexture{nullptr}
     , _identity{Matrix::Identity()}
     , _lastAbsoluteTransformsUpdateId{-1}
     , _canUseTextureForBones{false}
     , _uniqueId{0}
     , _useTextureToStoreBoneMatrices{true}
     , _animationPropertiesOverride{nullptr}
+    , _hasFlatBoneLayout{false}
 {
   bones.clear();
 
@@ -123,13 +124,23 @@ Float32Array& Skeleton::getTransformMatrices(AbstractMesh* mesh)
   return _transformMatrices;
 }
 
-RawTexturePtr& Skeleton::getTransformMatrixTexture(AbstractMesh* mesh)
+RawTexturePtr& Skeleton::getTransformMatrixTexture(AbstractMesh* /*mesh*/)
 {
-  if (needInitialSkinMatrix && mesh->_transformMatrixTexture) {
-    return mesh->_transformMatrixTexture;
-  }
+  return BoneMatrixTextureAtlas::ForScene(_scene).getTexture();
+}
 
-  return _transformMatrixTexture;
+float Skeleton::getTransformMatrixTextureWidth() const
+{
+  return static_cast<float>(BoneMatrixTextureAtlas::ForScene(_scene).getWidth());
+}
+
+float Skeleton::getTransformMatrixTextureRow(AbstractMesh* mesh)
+{
+  const auto& row = (needInitialSkinMatrix && mesh->_transformMatrixTextureRow) ?
+                      mesh->_transformMatrixTextureRow :
+                      _transformMatrixTextureRow;
+
+  return BoneMatrixTextureAtlas::ForScene(_scene).getRowCoordinate(row.value_or(0));
 }
 
 Scene* Skeleton::getScene()
@@ -198,7 +209,7 @@ void Skeleton::deleteAnimationRange(const std::string& _name, bool deleteFrames)
 
 AnimationRangePtr Skeleton::getAnimationRange(const std::string& _name)
 {
-  if (!stl_util::contains(_ranges, _name)) {
+  if (stl_util::contains(_ranges, _name)) {
     return _ranges[_name];
   }
 
@@ -264,6 +275,77 @@ bool Skeleton::copyAnimationRange(Skeleton* source, const std::string& _name,
   return ret;
 }
 
+void Skeleton::playClip(const SkeletonAnimationClipPtr& clip, bool loop, float speedRatio,
+                        float weight)
+{
+  if (!clip) {
+    stopClip();
+    return;
+  }
+
+  SkeletonAnimationClipPlayback playback;
+  playback.clip       = clip;
+  playback.startTime  = _scene->skeletonPoseCache->getTime();
+  playback.speedRatio = speedRatio;
+  playback.weight     = weight;
+  playback.loop       = loop;
+  _clipPlayback       = std::move(playback);
+}
+
+void Skeleton::stopClip()
+{
+  _clipPlayback = std::nullopt;
+}
+
+std::optional<SkeletonAnimationClipPlayback>& Skeleton::getClipPlayback()
+{
+  return _clipPlayback;
+}
+
+void Skeleton::_updateFromClip()
+{
+  auto& playback  = *_clipPlayback;
+  auto& poseCache = *_scene->skeletonPoseCache;
+
+  const auto frame = playback.getFrame(poseCache.getTime());
+  if (frame == playback._appliedFrame && playback.weight == playback._appliedWeight
+      && playback._boneIndices.size() == bones.size()) {
+    return;
+  }
+  playback._appliedFrame  = frame;
+  playback._appliedWeight = playback.weight;
+
+  // Bind the bones by name
+  if (playback._boneIndices.size() != bones.size()) {
+    playback._boneIndices.resize(bones.size());
+    for (size_t i = 0; i < bones.size(); ++i) {
+      playback._boneIndices[i] = playback.clip->findBone(bones[i]->name);
+    }
+  }
+
+  const auto& pose = poseCache.getPose(*playback.clip, frame);
+  for (size_t i = 0; i < bones.size(); ++i) {
+    const auto index = playback._boneIndices[i];
+    if (index < 0) {
+      continue;
+    }
+
+    const auto& bone = bones[i];
+    auto& restPose   = bone->getRestPose();
+    if (playback.weight < 1.f && restPose) {
+      auto& clipMatrix = TmpVectors::MatrixArray[1];
+      auto& result     = TmpVectors::MatrixArray[2];
+      clipMatrix.copyFrom(pose[static_cast<size_t>(index)]);
+      Matrix::DecomposeLerpToRef(*restPose, clipMatrix, std::max(playback.weight, 0.f), result);
+      bone->_matrix = result;
+    }
+    else {
+      bone->_matrix = pose[static_cast<size_t>(index)];
+    }
+    bone->markAsDirty();
+  }
+}
+
 void Skeleton::returnToRest()
 {
   for (const auto& bone : bones) {
@@ -314,6 +396,72 @@ void Skeleton::_registerMeshWithPoseMatrix(AbstractMesh* mesh)
 void Skeleton::_unregisterMeshWithPoseMatrix(AbstractMesh* mesh)
 {
   stl_util::erase(_meshesWithPoseMatrix, mesh);
+  _releaseTextureRow(mesh->_transformMatrixTextureRow);
+}
+
+void Skeleton::_updateTextureRow(std::optional<size_t>& row, const Float32Array& matrices)
+{
+  auto& atlas = BoneMatrixTextureAtlas::ForScene(_scene);
+  if (!row) {
+    row = atlas.allocate(matrices.size() / 16);
+    // Too many matrices for the texture, they are sent as uniforms
+    if (!row) {
+      _canUseTextureForBones = false;
+      return;
+    }
+  }
+
+  atlas.update(*row, matrices);
+}
+
+void Skeleton::_releaseTextureRow(std::optional<size_t>& row)
+{
+  if (row && _scene->_boneMatrixTextureAtlas) {
+    _scene->_boneMatrixTextureAtlas->release(*row);
+  }
+
+  row = std::nullopt;
+}
+
+void Skeleton::_updateBoneLayout()
+{
+  const auto boneCount = bones.size();
+  auto isUpToDate      = (_boneLayoutBones.size() == boneCount);
+  for (size_t i = 0; isUpToDate && i < boneCount; ++i) {
+    isUpToDate = _boneLayoutBones[i] == bones[i].get()
+                 && _boneLayoutParents[i] == bones[i]->getParent();
+  }
+
+  if (isUpToDate) {
+    return;
+  }
+
+  std::unordered_map<const Bone*, int> boneIndices;
+  _boneLayoutBones.resize(boneCount);
+  _boneLayoutParents.resize(boneCount);
+  for (size_t i = 0; i < boneCount; ++i) {
+    boneIndices[bones[i].get()] = static_cast<int>(i);
+    _boneLayoutBones[i]         = bones[i].get();
+    _boneLayoutParents[i]       = bones[i]->getParent();
+  }
+
+  _hasFlatBoneLayout = true;
+  _boneParentIndices.resize(boneCount);
+  _boneMatrixIndices.resize(boneCount);
+  _boneLocalMatrices.resize(boneCount * 16);
+  _boneWorldMatrices.resize(boneCount * 16);
+  _boneInverseBindMatrices.resize(boneCount * 16);
+  for (size_t i = 0; i < boneCount; ++i) {
+    const auto parentBone = bones[i]->getParent();
+    const auto it         = parentBone ? boneIndices.find(parentBone) : boneIndices.end();
+    _boneParentIndices[i] = it != boneIndices.end() ? it->second : -1;
+    // A parent which is not part of the skeleton keeps its own world matrix
+    if (parentBone && it == boneIndices.end()) {
+      _hasFlatBoneLayout = false;
+      return;
+    }
+    bones[i]->getWorldMatrix().copyToArray(_boneWorldMatrices, static_cast<unsigned>(i * 16));
+  }
 }
 
 void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
@@ -321,30 +469,68 @@ void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
 {
   onBeforeComputeObservable.notifyObservers(this);
 
-  unsigned int index = 0;
-  for (const auto& bone : bones) {
-    ++bone->_childUpdateId;
-    auto parentBone = bone->getParent();
+  _updateBoneLayout();
 
-    if (parentBone) {
-      bone->getLocalMatrix().multiplyToRef(parentBone->getWorldMatrix(), bone->getWorldMatrix());
-    }
-    else {
-      if (initialSkinMatrix.has_value()) {
-        bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, bone->getWorldMatrix());
+  const auto boneCount = bones.size();
+  if (!_hasFlatBoneLayout) {
+    // Bones parented outside of the skeleton: one bone at a time
+    unsigned int index = 0;
+    for (const auto& bone : bones) {
+      ++bone->_childUpdateId;
+      auto parentBone = bone->getParent();
+
+      if (parentBone) {
+        bone->getLocalMatrix().multiplyToRef(parentBone->getWorldMatrix(), bone->getWorldMatrix());
       }
       else {
-        bone->getWorldMatrix().copyFrom(bone->getLocalMatrix());
+        if (initialSkinMatrix.has_value()) {
+          bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, bone->getWorldMatrix());
+        }
+        else {
+          bone->getWorldMatrix().copyFrom(bone->getLocalMatrix());
+        }
+      }
+
+      if (!bone->_index.has_value() || *bone->_index != -1) {
+        auto mappedIndex
+          = !bone->_index.has_value() ? index : static_cast<unsigned int>(*bone->_index);
+        bone->getInvertedAbsoluteTransform().multiplyToArray(bone->getWorldMatrix(),
+                                                             targetMatrix, mappedIndex * 16);
       }
+      ++index;
+    }
+  }
+  else {
+    // Gather the local and inverse bind matrices
+    for (size_t i = 0; i < boneCount; ++i) {
+      const auto& bone = bones[i];
+      ++bone->_childUpdateId;
+      const auto offset = static_cast<unsigned int>(i * 16);
+      bone->getLocalMatrix().copyToArray(_boneLocalMatrices, offset);
+      bone->getInvertedAbsoluteTransform().copyToArray(_boneInverseBindMatrices, offset);
+
+      // Matrices which do not fit in the target are skipped
+      const auto mappedIndex = bone->_index.has_value() ? *bone->_index : static_cast<int>(i);
+      _boneMatrixIndices[i]
+        = (mappedIndex >= 0 && (static_cast<size_t>(mappedIndex) + 1) * 16 <= targetMatrix.size()) ?
+            mappedIndex :
+            -1;
     }
 
-    if (!bone->_index.has_value() || *bone->_index != -1) {
-      auto mappedIndex
-        = !bone->_index.has_value() ? index : static_cast<unsigned int>(*bone->_index);
-      bone->getInvertedAbsoluteTransform().multiplyToArray(bone->getWorldMatrix(), targetMatrix,
-                                                           mappedIndex * 16);
+    // One pass over the hierarchy, then one pass to compute the skinning matrices
+    BoneMatrixTools::ComputeWorldMatrices(
+      _boneParentIndices.data(), _boneLocalMatrices.data(),
+      initialSkinMatrix.has_value() ? initialSkinMatrix->m().data() : nullptr,
+      _boneWorldMatrices.data(), boneCount);
+    BoneMatrixTools::ComputeSkinningMatrices(_boneMatrixIndices.data(),
+                                             _boneInverseBindMatrices.data(),
+                                             _boneWorldMatrices.data(), targetMatrix.data(),
+                                             boneCount);
+
+    for (size_t i = 0; i < boneCount; ++i) {
+      Matrix::FromArrayToRef(_boneWorldMatrices, static_cast<unsigned int>(i * 16),
+                             bones[i]->getWorldMatrix());
     }
-    ++index;
   }
 
   _identity.copyToArray(targetMatrix, static_cast<unsigned int>(bones.size()) * 16);
@@ -352,9 +538,20 @@ void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
 
 void Skeleton::prepare()
 {
-  // Update the local matrix of bones with linked transform nodes.
+  if (_clipPlayback && _clipPlayback->clip) {
+    _updateFromClip();
+  }
+
+  // Update the local matrix of bones with linked transform nodes, except the ones animated by the
+  // clip played
   if (_numBonesWithLinkedTransformNode > 0) {
-    for (const auto& bone : bones) {
+    const auto* boneIndices
+      = _clipPlayback && _clipPlayback->clip ? &_clipPlayback->_boneIndices : nullptr;
+    for (size_t i = 0; i < bones.size(); ++i) {
+      const auto& bone = bones[i];
+      if (boneIndices && i < boneIndices->size() && (*boneIndices)[i] >= 0) {
+        continue;
+      }
       if (bone->_linkedTransformNode) {
         // Computing the world matrix also computes the local matrix.
         bone->_linkedTransformNode->computeWorldMatrix();
@@ -369,15 +566,24 @@ void Skeleton::prepare()
   }
 
   if (needInitialSkinMatrix) {
+    // Meshes sharing the same pose matrix share the same transform matrices
+    std::vector<AbstractMesh*> computedMeshes;
     for (const auto& mesh : _meshesWithPoseMatrix) {
 
       auto poseMatrix = mesh->getPoseMatrix();
 
       if (mesh->_bonesTransformMatrices.size() != 16 * (bones.size() + 1)) {
         mesh->_bonesTransformMatrices.resize(16 * (bones.size() + 1));
+        // The row may be too narrow for the new bones
+        _releaseTextureRow(mesh->_transformMatrixTextureRow);
       }
 
-      if (_synchronizedWithMesh != mesh) {
+      const auto samePoseMesh
+        = std::find_if(computedMeshes.begin(), computedMeshes.end(), [&poseMatrix](auto* other) {
+            return other->getPoseMatrix().m() == poseMatrix.m();
+          });
+
+      if (samePoseMesh == computedMeshes.end() && _synchronizedWithMesh != mesh) {
         _synchronizedWithMesh = mesh;
         // Prepare bones
         for (const auto& bone : bones) {
@@ -388,49 +594,32 @@ void Skeleton::prepare()
             bone->_updateDifferenceMatrix(tmpMatrix);
           }
         }
-
-        if (isUsingTextureForMatrices()) {
-          const auto textureWidth = static_cast<int>((bones.size() + 1) * 4);
-          if (!mesh->_transformMatrixTexture
-              || mesh->_transformMatrixTexture->getSize().width != textureWidth) {
-
-            if (mesh->_transformMatrixTexture) {
-              mesh->_transformMatrixTexture->dispose();
-            }
-
-            mesh->_transformMatrixTexture = RawTexture::CreateRGBATexture(
-              mesh->_bonesTransformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene,
-              false, false, Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
-          }
-        }
       }
 
-      _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
+      if (samePoseMesh == computedMeshes.end()) {
+        _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
+        computedMeshes.emplace_back(mesh);
+      }
+      else {
+        mesh->_bonesTransformMatrices = (*samePoseMesh)->_bonesTransformMatrices;
+      }
 
-      if (isUsingTextureForMatrices && mesh->_transformMatrixTexture) {
-        mesh->_transformMatrixTexture->update(mesh->_bonesTransformMatrices);
+      if (isUsingTextureForMatrices()) {
+        _updateTextureRow(mesh->_transformMatrixTextureRow, mesh->_bonesTransformMatrices);
       }
     }
   }
   else {
     if (_transformMatrices.size() != 16 * (bones.size() + 1)) {
       _transformMatrices.resize(16 * (bones.size() + 1));
-
-      if (isUsingTextureForMatrices) {
-        if (_transformMatrixTexture) {
-          _transformMatrixTexture->dispose();
-        }
-
-        _transformMatrixTexture = RawTexture::CreateRGBATexture(
-          _transformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene, false, false,
-          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
-      }
+      // The row may be too narrow for the new bones
+      _releaseTextureRow(_transformMatrixTextureRow);
     }
 
     _computeTransformMatrices(_transformMatrices);
 
-    if (isUsingTextureForMatrices && _transformMatrixTexture) {
-      _transformMatrixTexture->update(_transformMatrices);
+    if (isUsingTextureForMatrices()) {
+      _updateTextureRow(_transformMatrixTextureRow, _transformMatrices);
     }
   }
 
@@ -475,6 +664,9 @@ void Skeleton::enableBlending(float blendingSpeed)
 
 void Skeleton::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
+  for (const auto& mesh : _meshesWithPoseMatrix) {
+    _releaseTextureRow(mesh->_transformMatrixTextureRow);
+  }
   _meshesWithPoseMatrix.clear();
 
   // Animations
@@ -483,10 +675,7 @@ void Skeleton::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*
   // Remove from scene
   getScene()->removeSkeleton(this);
 
-  if (_transformMatrixTexture) {
-    _transformMatrixTexture->dispose();
-    _transformMatrixTexture = nullptr;
-  }
+  _releaseTextureRow(_transformMatrixTextureRow);
 }
 
 json Skeleton::serialize() const
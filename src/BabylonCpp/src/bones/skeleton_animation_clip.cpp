@@ -0,0 +1,332 @@
+#include <babylon/bones/skeleton_animation_clip.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * State of an animation interpolated at increasing frames, without the offsets of the loops
+ */
+_IAnimationState CreateState()
+{
+  _IAnimationState state;
+  state.key         = 0;
+  state.repeatCount = 0;
+  state.loopMode    = Animation::ANIMATIONLOOPMODE_CYCLE;
+  return state;
+}
+
+/**
+ * Value of an animation at a frame, clamped to its keys whose values are used as is since the
+ * matrices are not interpolated by default
+ */
+AnimationValue Evaluate(Animation& animation, float frame, _IAnimationState& state)
+{
+  const auto keyCount = animation.getKeyCount();
+  if (frame <= animation.getKeyFrame(0)) {
+    return animation.getKeyValue(0);
+  }
+  if (frame >= animation.getKeyFrame(keyCount - 1)) {
+    return animation.getKeyValue(keyCount - 1);
+  }
+
+  size_t low = 0, high = keyCount;
+  while (low < high) {
+    const auto middle = (low + high) / 2;
+    if (animation.getKeyFrame(middle) < frame) {
+      low = middle + 1;
+    }
+    else {
+      high = middle;
+    }
+  }
+
+  if (animation.getKeyFrame(low) == frame) {
+    return animation.getKeyValue(low);
+  }
+
+  return animation._interpolate(frame, state);
+}
+
+} // end of anonymous namespace
+
+SkeletonAnimationClipPtr SkeletonAnimationClip::FromAnimationRange(Skeleton* skeleton,
+                                                                   const std::string& rangeName)
+{
+  const auto range = skeleton ? skeleton->getAnimationRange(rangeName) : nullptr;
+  if (!range) {
+    return nullptr;
+  }
+
+  // Animations of the bones and of their linked transform nodes
+  const auto& bones = skeleton->bones;
+  std::vector<BoneChannels> boneChannels(bones.size());
+  Animation* firstAnimation = nullptr;
+  for (size_t i = 0; i < bones.size(); ++i) {
+    for (const auto& animation : bones[i]->animations) {
+      if (boneChannels[i].add(animation.get()) && !firstAnimation) {
+        firstAnimation = animation.get();
+      }
+    }
+    if (const auto& transformNode = bones[i]->_linkedTransformNode) {
+      for (const auto& animation : transformNode->animations) {
+        if (boneChannels[i].add(animation.get()) && !firstAnimation) {
+          firstAnimation = animation.get();
+        }
+      }
+    }
+  }
+
+  const auto framePerSecond
+    = firstAnimation ? static_cast<float>(firstAnimation->framePerSecond) : 60.f;
+  std::shared_ptr<SkeletonAnimationClip> clip(
+    new SkeletonAnimationClip(rangeName, framePerSecond, range->to - range->from));
+  for (size_t i = 0; i < bones.size(); ++i) {
+    clip->_addTrack(*bones[i], boneChannels[i], range->from, range->to);
+  }
+
+  return clip;
+}
+
+SkeletonAnimationClipPtr SkeletonAnimationClip::FromAnimationGroup(Skeleton* skeleton,
+                                                                   AnimationGroup& animationGroup)
+{
+  if (!skeleton) {
+    return nullptr;
+  }
+
+  // Animations of the group targeting the bones or their linked transform nodes
+  const auto& bones = skeleton->bones;
+  std::vector<BoneChannels> boneChannels(bones.size());
+  Animation* firstAnimation = nullptr;
+  for (const auto& targetedAnimation : animationGroup.targetedAnimations()) {
+    const auto target = targetedAnimation->target.get();
+    const auto it = std::find_if(bones.begin(), bones.end(), [target](const BonePtr& bone) {
+      return target == bone.get() || target == bone->_linkedTransformNode.get();
+    });
+    if (it == bones.end()) {
+      continue;
+    }
+    auto& channels = boneChannels[static_cast<size_t>(it - bones.begin())];
+    if (channels.add(targetedAnimation->animation.get()) && !firstAnimation) {
+      firstAnimation = targetedAnimation->animation.get();
+    }
+  }
+
+  if (!firstAnimation) {
+    return nullptr;
+  }
+
+  const float from = animationGroup.from();
+  const float to   = animationGroup.to();
+  std::shared_ptr<SkeletonAnimationClip> clip(new SkeletonAnimationClip(
+    animationGroup.name, static_cast<float>(firstAnimation->framePerSecond), to - from));
+  for (size_t i = 0; i < bones.size(); ++i) {
+    clip->_addTrack(*bones[i], boneChannels[i], from, to);
+  }
+
+  return clip;
+}
+
+Animation* SkeletonAnimationClip::BoneChannels::add(Animation* animation)
+{
+  if (!animation || animation->getKeyCount() == 0) {
+    return nullptr;
+  }
+
+  Animation** channel        = nullptr;
+  const auto dataType        = animation->dataType;
+  const auto& targetProperty = animation->targetProperty;
+  if (dataType == Animation::ANIMATIONTYPE_MATRIX) {
+    channel = &matrix;
+  }
+  else if (dataType == Animation::ANIMATIONTYPE_VECTOR3 && targetProperty == "position") {
+    channel = &position;
+  }
+  else if (dataType == Animation::ANIMATIONTYPE_QUATERNION
+           && targetProperty == "rotationQuaternion") {
+    channel = &rotation;
+  }
+  else if (dataType == Animation::ANIMATIONTYPE_VECTOR3 && targetProperty == "scaling") {
+    channel = &scaling;
+  }
+
+  if (!channel) {
+    return nullptr;
+  }
+
+  *channel = animation;
+  return animation;
+}
+
+void SkeletonAnimationClip::_addTrack(Bone& bone, const BoneChannels& channels, float from,
+                                      float to)
+{
+  // The track is sampled at the key frames of the channels and at the bounds of the clip
+  std::vector<float> frames{from, to};
+  auto animated = false;
+  for (const auto animation :
+       {channels.matrix, channels.position, channels.rotation, channels.scaling}) {
+    if (!animation) {
+      continue;
+    }
+    for (size_t key = 0; key < animation->getKeyCount(); ++key) {
+      const auto frame = animation->getKeyFrame(key);
+      if (frame >= from && frame <= to) {
+        frames.emplace_back(frame);
+        animated = true;
+      }
+    }
+  }
+
+  if (!animated) {
+    return;
+  }
+
+  std::sort(frames.begin(), frames.end());
+  frames.erase(std::unique(frames.begin(), frames.end()), frames.end());
+
+  // The components which are not animated keep their rest value
+  Matrix restMatrix = bone.getRestPose().value_or(bone.getLocalMatrix());
+  if (const auto& transformNode = bone._linkedTransformNode) {
+    transformNode->computeWorldMatrix(true);
+    restMatrix = transformNode->_localMatrix;
+  }
+  std::optional<Vector3> restScaling     = Vector3::One();
+  std::optional<Quaternion> restRotation = Quaternion::Identity();
+  std::optional<Vector3> restTranslation = Vector3::Zero();
+  restMatrix.decompose(restScaling, restRotation, restTranslation);
+
+  BoneTrack track;
+  track.boneName     = bone.name;
+  auto matrixState   = CreateState();
+  auto positionState = CreateState();
+  auto rotationState = CreateState();
+  auto scalingState  = CreateState();
+  std::optional<Vector3> scaling     = Vector3::One();
+  std::optional<Quaternion> rotation = Quaternion::Identity();
+  std::optional<Vector3> translation = Vector3::Zero();
+  for (const auto frame : frames) {
+    if (channels.matrix) {
+      Evaluate(*channels.matrix, frame, matrixState)
+        .get<Matrix>()
+        .decompose(scaling, rotation, translation);
+    }
+    else {
+      scaling  = channels.scaling ?
+                   Evaluate(*channels.scaling, frame, scalingState).get<Vector3>() :
+                   *restScaling;
+      rotation = channels.rotation ?
+                   Evaluate(*channels.rotation, frame, rotationState).get<Quaternion>() :
+                   *restRotation;
+      translation = channels.position ?
+                      Evaluate(*channels.position, frame, positionState).get<Vector3>() :
+                      *restTranslation;
+    }
+    track.frames.emplace_back(frame - from);
+    track.scalings.emplace_back(*scaling);
+    track.rotations.emplace_back(*rotation);
+    track.translations.emplace_back(*translation);
+  }
+
+  _tracks.emplace_back(std::move(track));
+}
+
+SkeletonAnimationClip::SkeletonAnimationClip(const std::string& iName, float iFramePerSecond,
+                                             float iDuration)
+    : name{iName}, framePerSecond{iFramePerSecond}, duration{iDuration}
+{
+}
+
+SkeletonAnimationClip::~SkeletonAnimationClip() = default;
+
+size_t SkeletonAnimationClip::boneCount() const
+{
+  return _tracks.size();
+}
+
+const std::string& SkeletonAnimationClip::boneName(size_t index) const
+{
+  return _tracks[index].boneName;
+}
+
+int SkeletonAnimationClip::findBone(const std::string& iBoneName) const
+{
+  const auto it = std::find_if(_tracks.begin(), _tracks.end(), [&iBoneName](const auto& track) {
+    return track.boneName == iBoneName;
+  });
+  return it == _tracks.end() ? -1 : static_cast<int>(it - _tracks.begin());
+}
+
+void SkeletonAnimationClip::evaluate(float frame, std::vector<Matrix>& localMatrices) const
+{
+  localMatrices.resize(_tracks.size());
+
+  Vector3 scaling, translation;
+  Quaternion rotation;
+  for (size_t i = 0; i < _tracks.size(); ++i) {
+    const auto& track  = _tracks[i];
+    const auto& frames = track.frames;
+
+    // Index of the first key after the frame
+    const auto next = static_cast<size_t>(std::upper_bound(frames.begin(), frames.end(), frame)
+                                          - frames.begin());
+    if (next == 0 || next == frames.size()) {
+      const auto key = next == 0 ? 0 : frames.size() - 1;
+      Matrix::ComposeToRef(track.scalings[key], track.rotations[key], track.translations[key],
+                           localMatrices[i]);
+      continue;
+    }
+
+    const auto previous = next - 1;
+    const auto gradient = (frame - frames[previous]) / (frames[next] - frames[previous]);
+    Vector3::LerpToRef(track.scalings[previous], track.scalings[next], gradient, scaling);
+    Quaternion::SlerpToRef(track.rotations[previous], track.rotations[next], gradient, rotation);
+    Vector3::LerpToRef(track.translations[previous], track.translations[next], gradient,
+                       translation);
+    Matrix::ComposeToRef(scaling, rotation, translation, localMatrices[i]);
+  }
+}
+
+size_t SkeletonAnimationClip::memorySize() const
+{
+  size_t size = sizeof(SkeletonAnimationClip);
+  for (const auto& track : _tracks) {
+    size += sizeof(BoneTrack) + track.boneName.capacity()
+            + track.frames.capacity() * sizeof(float)
+            + track.scalings.capacity() * sizeof(Vector3)
+            + track.rotations.capacity() * sizeof(Quaternion)
+            + track.translations.capacity() * sizeof(Vector3);
+  }
+  return size;
+}
+
+float SkeletonAnimationClipPlayback::getFrame(float time) const
+{
+  if (!clip) {
+    return 0.f;
+  }
+
+  const auto frame = (time - startTime) * speedRatio * clip->framePerSecond / 1000.f;
+  if (loop && clip->duration > 0.f) {
+    const auto loopFrame = std::fmod(frame, clip->duration);
+    return loopFrame < 0.f ? loopFrame + clip->duration : loopFrame;
+  }
+
+  return std::clamp(frame, 0.f, clip->duration);
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,77 @@
+#include <babylon/bones/skeleton_pose_cache.h>
+
+#include <cmath>
+#include <functional>
+
+#include <babylon/bones/skeleton_animation_clip.h>
+
+namespace BABYLON {
+
+bool SkeletonPoseCache::PoseKey::operator==(const PoseKey& other) const
+{
+  return clip == other.clip && frame == other.frame;
+}
+
+size_t SkeletonPoseCache::PoseKeyHash::operator()(const PoseKey& key) const
+{
+  return std::hash<const void*>()(key.clip) ^ (std::hash<float>()(key.frame) << 1);
+}
+
+SkeletonPoseCache::SkeletonPoseCache()
+    : enabled{true}, framePrecision{0.f}, _time{0.f}, _evaluationCount{0}, _hitCount{0}
+{
+}
+
+SkeletonPoseCache::~SkeletonPoseCache() = default;
+
+float SkeletonPoseCache::getTime() const
+{
+  return _time;
+}
+
+const std::vector<Matrix>& SkeletonPoseCache::getPose(const SkeletonAnimationClip& clip,
+                                                      float frame)
+{
+  if (framePrecision > 0.f) {
+    frame = std::round(frame / framePrecision) * framePrecision;
+  }
+
+  if (!enabled) {
+    ++_evaluationCount;
+    clip.evaluate(frame, _uncachedPose);
+    return _uncachedPose;
+  }
+
+  auto [it, inserted] = _poses.try_emplace(PoseKey{&clip, frame});
+  if (inserted) {
+    ++_evaluationCount;
+    clip.evaluate(frame, it->second);
+  }
+  else {
+    ++_hitCount;
+  }
+
+  return it->second;
+}
+
+size_t SkeletonPoseCache::getEvaluationCount() const
+{
+  return _evaluationCount;
+}
+
+size_t SkeletonPoseCache::getHitCount() const
+{
+  return _hitCount;
+}
+
+void SkeletonPoseCache::_advance(float deltaTime)
+{
+  if (deltaTime <= 0.f) {
+    return;
+  }
+
+  _time += deltaTime;
+  _poses.clear();
+}
+
+} // end of namespace BABYLON
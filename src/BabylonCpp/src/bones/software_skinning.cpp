@@ -0,0 +1,213 @@
+#include <babylon/bones/software_skinning.h>
+
+#include <algorithm>
+
+#include <babylon/core/thread_pool.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+#if defined(__SSE2__)
+
+namespace sse2 {
+
+struct BlendedMatrix {
+  __m128 rows[4];
+};
+
+inline void AccumulateInfluences(const SoftwareSkinningData& data, const float* indices,
+                                 const float* weights, BlendedMatrix& result)
+{
+  for (size_t inf = 0; inf < 4; ++inf) {
+    const auto weight = weights[inf];
+    if (weight > 0.f && indices[inf] >= 0.f) {
+      const auto matrixIndex = static_cast<size_t>(indices[inf]);
+      if (matrixIndex >= data.matrixCount) {
+        continue;
+      }
+      const auto matrix = data.matrices + matrixIndex * 16;
+      const auto scale  = _mm_set1_ps(weight);
+      for (size_t row = 0; row < 4; ++row) {
+        result.rows[row]
+          = _mm_add_ps(result.rows[row], _mm_mul_ps(_mm_loadu_ps(matrix + row * 4), scale));
+      }
+    }
+  }
+}
+
+inline void BlendMatrix(const SoftwareSkinningData& data, size_t vertex, BlendedMatrix& result)
+{
+  for (auto& row : result.rows) {
+    row = _mm_setzero_ps();
+  }
+  AccumulateInfluences(data, data.matricesIndices + vertex * 4, data.matricesWeights + vertex * 4,
+                       result);
+  if (data.matricesIndicesExtra && data.matricesWeightsExtra) {
+    AccumulateInfluences(data, data.matricesIndicesExtra + vertex * 4,
+                         data.matricesWeightsExtra + vertex * 4, result);
+  }
+}
+
+inline __m128 TransformVector(const BlendedMatrix& m, const float* v)
+{
+  auto result = _mm_mul_ps(_mm_set1_ps(v[0]), m.rows[0]);
+  result      = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(v[1]), m.rows[1]));
+  return _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(v[2]), m.rows[2]));
+}
+
+inline void TransformCoordinates(const BlendedMatrix& m, const float* source, float* target)
+{
+  float r[4];
+  _mm_storeu_ps(r, _mm_add_ps(TransformVector(m, source), m.rows[3]));
+  const auto rw = 1 / r[3];
+  target[0]     = r[0] * rw;
+  target[1]     = r[1] * rw;
+  target[2]     = r[2] * rw;
+}
+
+inline void TransformNormal(const BlendedMatrix& m, const float* source, float* target)
+{
+  float r[4];
+  _mm_storeu_ps(r, TransformVector(m, source));
+  std::copy(r, r + 3, target);
+}
+
+} // end of namespace sse2
+
+#endif
+
+namespace scalar {
+
+struct BlendedMatrix {
+  float m[16];
+};
+
+inline void AccumulateInfluences(const SoftwareSkinningData& data, const float* indices,
+                                 const float* weights, BlendedMatrix& result)
+{
+  for (size_t inf = 0; inf < 4; ++inf) {
+    const auto weight = weights[inf];
+    if (weight > 0.f && indices[inf] >= 0.f) {
+      const auto matrixIndex = static_cast<size_t>(indices[inf]);
+      if (matrixIndex >= data.matrixCount) {
+        continue;
+      }
+      const auto matrix = data.matrices + matrixIndex * 16;
+      for (size_t i = 0; i < 16; ++i) {
+        result.m[i] += matrix[i] * weight;
+      }
+    }
+  }
+}
+
+inline void BlendMatrix(const SoftwareSkinningData& data, size_t vertex, BlendedMatrix& result)
+{
+  std::fill(result.m, result.m + 16, 0.f);
+  AccumulateInfluences(data, data.matricesIndices + vertex * 4, data.matricesWeights + vertex * 4,
+                       result);
+  if (data.matricesIndicesExtra && data.matricesWeightsExtra) {
+    AccumulateInfluences(data, data.matricesIndicesExtra + vertex * 4,
+                         data.matricesWeightsExtra + vertex * 4, result);
+  }
+}
+
+inline void TransformCoordinates(const BlendedMatrix& bm, const float* source, float* target)
+{
+  const auto& m = bm.m;
+  const auto x  = source[0];
+  const auto y  = source[1];
+  const auto z  = source[2];
+  const auto rx = x * m[0] + y * m[4] + z * m[8] + m[12];
+  const auto ry = x * m[1] + y * m[5] + z * m[9] + m[13];
+  const auto rz = x * m[2] + y * m[6] + z * m[10] + m[14];
+  const auto rw = 1 / (x * m[3] + y * m[7] + z * m[11] + m[15]);
+  target[0]     = rx * rw;
+  target[1]     = ry * rw;
+  target[2]     = rz * rw;
+}
+
+inline void TransformNormal(const BlendedMatrix& bm, const float* source, float* target)
+{
+  const auto& m = bm.m;
+  const auto x  = source[0];
+  const auto y  = source[1];
+  const auto z  = source[2];
+  target[0]     = x * m[0] + y * m[4] + z * m[8];
+  target[1]     = x * m[1] + y * m[5] + z * m[9];
+  target[2]     = x * m[2] + y * m[6] + z * m[10];
+}
+
+} // end of namespace scalar
+
+// The kernels of the blended matrix type are found by argument-dependent lookup
+template <typename BlendedMatrix>
+void SkinVerticesWith(const SoftwareSkinningData& data, size_t begin, size_t end)
+{
+  if (!data.matrices || !data.matricesIndices || !data.matricesWeights) {
+    return;
+  }
+
+  end = std::min(end, data.vertexCount);
+
+  BlendedMatrix matrix;
+  for (size_t vertex = begin; vertex < end; ++vertex) {
+    BlendMatrix(data, vertex, matrix);
+
+    if (data.sourcePositions && data.positions) {
+      TransformCoordinates(matrix, data.sourcePositions + vertex * 3, data.positions + vertex * 3);
+    }
+
+    if (data.sourceNormals && data.normals) {
+      TransformNormal(matrix, data.sourceNormals + vertex * 3, data.normals + vertex * 3);
+    }
+
+    if (data.sourceTangents && data.tangents) {
+      TransformNormal(matrix, data.sourceTangents + vertex * 4, data.tangents + vertex * 4);
+      data.tangents[vertex * 4 + 3] = data.sourceTangents[vertex * 4 + 3];
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+void SoftwareSkinning::SkinVertices(const SoftwareSkinningData& data, size_t begin, size_t end)
+{
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+  SkinVerticesSSE2(data, begin, end);
+#else
+  SkinVerticesScalar(data, begin, end);
+#endif
+}
+
+void SoftwareSkinning::SkinVerticesScalar(const SoftwareSkinningData& data, size_t begin,
+                                          size_t end)
+{
+  SkinVerticesWith<scalar::BlendedMatrix>(data, begin, end);
+}
+
+bool SoftwareSkinning::SkinVerticesSSE2(const SoftwareSkinningData& data, size_t begin, size_t end)
+{
+#if defined(__SSE2__)
+  SkinVerticesWith<sse2::BlendedMatrix>(data, begin, end);
+  return true;
+#else
+  (void)data;
+  (void)begin;
+  (void)end;
+  return false;
+#endif
+}
+
+void SoftwareSkinning::Apply(const SoftwareSkinningData& data, size_t blockSize)
+{
+  ThreadPool::Default().parallelFor(
+    0, data.vertexCount, std::max<size_t>(blockSize, 1),
+    [&data](size_t begin, size_t end) { SkinVertices(data, begin, end); });
+}
+
+} // end of namespace BABYLON
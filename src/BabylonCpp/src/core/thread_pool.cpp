@@ -0,0 +1,172 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace BABYLON {
+
+namespace {
+
+struct ParallelForState {
+  size_t begin      = 0;
+  size_t end        = 0;
+  size_t grainSize  = 1;
+  size_t chunkCount = 0;
+  std::atomic<size_t> nextChunk{0};
+  std::atomic<size_t> pendingChunks{0};
+  std::mutex mutex;
+  std::condition_variable done;
+  std::exception_ptr exception = nullptr;
+  ThreadPool::RangeJob job;
+
+  // Processes chunks until none is left, returns when the range is exhausted
+  void run()
+  {
+    size_t chunk;
+    while ((chunk = nextChunk.fetch_add(1)) < chunkCount) {
+      const auto chunkBegin = begin + chunk * grainSize;
+      const auto chunkEnd   = std::min(chunkBegin + grainSize, end);
+      try {
+        job(chunkBegin, chunkEnd);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+      if (pendingChunks.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.notify_all();
+      }
+    }
+  }
+};
+
+thread_local const ThreadPool* currentWorkerPool = nullptr;
+
+} // end of anonymous namespace
+
+ThreadPool& ThreadPool::Default()
+{
+  static ThreadPool defaultPool;
+  return defaultPool;
+}
+
+ThreadPool::ThreadPool(size_t numThreads) : _stopping{false}
+{
+#ifdef __EMSCRIPTEN__
+  // No pthread support, every job is executed on the calling thread
+  numThreads = 0;
+#else
+  if (numThreads == 0) {
+    const auto hardwareThreads = std::thread::hardware_concurrency();
+    numThreads                 = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+  }
+#endif
+  _workers.reserve(numThreads);
+  for (size_t i = 0; i < numThreads; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _condition.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::size() const
+{
+  return _workers.size();
+}
+
+size_t ThreadPool::concurrency() const
+{
+  return _workers.size() + 1;
+}
+
+bool ThreadPool::isWorkerThread() const
+{
+  return currentWorkerPool == this;
+}
+
+void ThreadPool::_push(Job&& job)
+{
+  if (_workers.empty()) {
+    job();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jobs.emplace_back(std::move(job));
+  }
+  _condition.notify_one();
+}
+
+void ThreadPool::_workerLoop()
+{
+  currentWorkerPool = this;
+  for (;;) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+      if (_stopping && _jobs.empty()) {
+        return;
+      }
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+    job();
+  }
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grainSize, const RangeJob& job)
+{
+  if (end <= begin) {
+    return;
+  }
+
+  grainSize               = std::max<size_t>(grainSize, 1);
+  const size_t chunkCount = (end - begin + grainSize - 1) / grainSize;
+
+  // Nothing to share, run inline
+  if (chunkCount == 1 || _workers.empty()) {
+    job(begin, end);
+    return;
+  }
+
+  auto state           = std::make_shared<ParallelForState>();
+  state->begin         = begin;
+  state->end           = end;
+  state->grainSize     = grainSize;
+  state->chunkCount    = chunkCount;
+  state->pendingChunks = chunkCount;
+  state->job           = job;
+
+  // The calling thread processes chunks as well, so at most chunkCount - 1 helpers are needed
+  const auto helperCount = std::min(chunkCount - 1, _workers.size());
+  for (size_t i = 0; i < helperCount; ++i) {
+    _push([state]() { state->run(); });
+  }
+  state->run();
+
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() { return state->pendingChunks.load() == 0; });
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+} // end of namespace BABYLON
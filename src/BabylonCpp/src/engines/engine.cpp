@@ -1416,4 +1416,10 @@ void Engine::bindTransformFeedbackBuffer(const WebGLDataBufferPtr& value)
   _transformFeedbackExtension->bindTransformFeedbackBuffer(value);
 }
 
+void Engine::bindTransformFeedbackBufferRange(const WebGLDataBufferPtr& value, size_t byteOffset,
+                                              size_t byteLength)
+{
+  _transformFeedbackExtension->bindTransformFeedbackBufferRange(value, byteOffset, byteLength);
+}
+
 } // end of namespace BABYLON
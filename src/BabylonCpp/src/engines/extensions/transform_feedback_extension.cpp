@@ -47,4 +47,13 @@ void TransformFeedbackExtension::bindTransformFeedbackBuffer(const WebGLDataBuff
   _this->_gl->bindBufferBase(GL::TRANSFORM_FEEDBACK_BUFFER, 0, value->underlyingResource().get());
 }
 
+void TransformFeedbackExtension::bindTransformFeedbackBufferRange(const WebGLDataBufferPtr& value,
+                                                                  size_t byteOffset,
+                                                                  size_t byteLength)
+{
+  _this->_gl->bindBufferRange(GL::TRANSFORM_FEEDBACK_BUFFER, 0, value->underlyingResource().get(),
+                              static_cast<GL::GLintptr>(byteOffset),
+                              static_cast<GL::GLsizeiptr>(byteLength));
+}
+
 } // end of namespace BABYLON
@@ -4,14 +4,18 @@
 #include <babylon/actions/action_event.h>
 #include <babylon/actions/action_manager.h>
 #include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
 #include <babylon/animations/animation_group.h>
+#include <babylon/animations/animation_lod_policy.h>
 #include <babylon/animations/runtime_animation.h>
 #include <babylon/audio/audio_scene_component.h>
 #include <babylon/audio/sound.h>
 #include <babylon/audio/sound_track.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/bone.h>
+#include <babylon/bones/bone_matrix_texture_atlas.h>
 #include <babylon/bones/skeleton.h>
+#include <babylon/bones/skeleton_pose_cache.h>
 #include <babylon/cameras/arc_rotate_camera.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/free_camera.h>
@@ -19,6 +23,7 @@
 #include <babylon/collisions/collision_coordinator.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
@@ -55,8 +60,11 @@
 #include <babylon/materials/textures/procedurals/procedural_texture.h>
 #include <babylon/materials/textures/render_target_texture.h>
 #include <babylon/materials/uniform_buffer.h>
+#include <babylon/maths/color4.h>
 #include <babylon/maths/frustum.h>
+#include <babylon/maths/size.h>
 #include <babylon/maths/tmp_vectors.h>
+#include <babylon/maths/vector2.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/geometry.h>
@@ -67,6 +75,9 @@
 #include <babylon/misc/guid.h>
 #include <babylon/misc/tools.h>
 #include <babylon/morph/morph_target_manager.h>
+#include <babylon/particles/gpu_particle_buffer_pool.h>
+#include <babylon/particles/particle_arena.h>
+#include <babylon/particles/particle_budget_manager.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/physics/physics_engine.h>
 #include <babylon/physics/physics_engine_component.h>
@@ -86,6 +97,55 @@
 
 namespace BABYLON {
 
+namespace {
+
+template <typename T>
+void ScaleAndAddToRef(const AnimationValue& value, float scale, AnimationValue& result)
+{
+  auto scaled = T(value.get<T>()).scale(scale);
+  result      = result ? AnimationValue(result.get<T>().add(scaled)) : AnimationValue(scaled);
+}
+
+/**
+ * Adds a value multiplied by a scale to the result, the result being set to the scaled value if it
+ * is empty. Returns false if the type of the value cannot be blended linearly.
+ */
+bool ScaleAndAddToRef(const AnimationValue& value, float scale, AnimationValue& result)
+{
+  const auto animationType = value.animationType();
+  if (!animationType.has_value()) {
+    return false;
+  }
+
+  switch (*animationType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      result = AnimationValue((result ? result.get<float>() : 0.f) + value.get<float>() * scale);
+      return true;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      ScaleAndAddToRef<Vector3>(value, scale, result);
+      return true;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      ScaleAndAddToRef<Matrix>(value, scale, result);
+      return true;
+    case Animation::ANIMATIONTYPE_COLOR3:
+      ScaleAndAddToRef<Color3>(value, scale, result);
+      return true;
+    case Animation::ANIMATIONTYPE_COLOR4:
+      ScaleAndAddToRef<Color4>(value, scale, result);
+      return true;
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      ScaleAndAddToRef<Vector2>(value, scale, result);
+      return true;
+    case Animation::ANIMATIONTYPE_SIZE:
+      ScaleAndAddToRef<Size>(value, scale, result);
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // end of anonymous namespace
+
 size_t Scene::_uniqueIdCounter = 0;
 
 microseconds_t Scene::MinDeltaTime = std::chrono::milliseconds(1);
@@ -126,6 +186,9 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
                              &Scene::set_forceShowBoundingBoxes}
     , animationsEnabled{true}
     , useConstantAnimationDeltaTime{false}
+    , useParallelAnimationEvaluation{true}
+    , animationLODPolicy{std::make_unique<AnimationLODPolicy>()}
+    , skeletonPoseCache{std::make_unique<SkeletonPoseCache>()}
     , constantlyUpdateMeshUnderPointer{false}
     , hoverCursor{"pointer"}
     , defaultCursor{""}
@@ -1886,34 +1949,48 @@ void Scene::unregisterAfterRender(const std::function<void(Scene* scene, EventSt
   onAfterRenderObservable.removeCallback(func);
 }
 
-void Scene::_addPendingData(Mesh* /*mesh*/)
+void Scene::_addPendingData(const void* data)
 {
+  _pendingData.emplace_back(data);
 }
 
-void Scene::_addPendingData(const InternalTexturePtr& /*texure*/)
+void Scene::_addPendingData(Mesh* mesh)
 {
+  _addPendingData(static_cast<const void*>(mesh));
 }
 
-void Scene::_removePendingData(Mesh* /*mesh*/)
+void Scene::_addPendingData(const InternalTexturePtr& texture)
+{
+  _addPendingData(static_cast<const void*>(texture.get()));
+}
+
+void Scene::_removePendingData(const void* data)
 {
   const auto wasLoading = isLoading();
+  auto it               = std::find(_pendingData.begin(), _pendingData.end(), data);
+
+  if (it != _pendingData.end()) {
+    _pendingData.erase(it);
+  }
 
   if (wasLoading && !isLoading()) {
     onDataLoadedObservable.notifyObservers(this);
   }
 }
 
-void Scene::_removePendingData(const InternalTexturePtr& /*texture*/)
+void Scene::_removePendingData(Mesh* mesh)
 {
-  const auto wasLoading = isLoading();
+  _removePendingData(static_cast<const void*>(mesh));
+}
 
-  if (wasLoading && !isLoading()) {
-    onDataLoadedObservable.notifyObservers(this);
-  }
+void Scene::_removePendingData(const InternalTexturePtr& texture)
+{
+  _removePendingData(static_cast<const void*>(texture.get()));
 }
 
-void Scene::getWaitingItemsCount()
+size_t Scene::getWaitingItemsCount() const
 {
+  return _pendingData.size();
 }
 
 bool Scene::get_isLoading() const
@@ -2139,6 +2216,9 @@ void Scene::_animate()
                 Time::fpTimeSince<size_t, std::milli>(*_animationTimeLast) * animationTimeScale;
   _animationTimeLast = now;
 
+  // The skeletons playing clips are updated when they are prepared
+  skeletonPoseCache->_advance(deltaTime);
+
   // Animatable::_animate can remove elements from _activeAnimatables we need to make a copy of it
   // in order to iterate on a vector that will not be modified during the loop!
   const auto& animatables = _activeAnimatables;
@@ -2149,58 +2229,105 @@ void Scene::_animate()
   _animationTime += static_cast<int>(deltaTime);
   const auto& animationTime = _animationTime;
 
-  // We make a copy of "animatables" because animatable->_animate can suppress
+  // We make a copy of "animatables" because animatable->_endAnimate can suppress
   // elements from "animatables"
   auto animatables_copy = animatables;
+  const auto delay      = std::chrono::milliseconds(animationTime);
+
+  // Update the delays and sort the animatables between the ones which can be evaluated on worker
+  // threads and the ones which depend on other animatables
+  std::vector<Animatable*> evaluatedAnimatables, parallelAnimatables, sequentialAnimatables;
+  evaluatedAnimatables.reserve(animatables_copy.size());
+  if (animationLODPolicy->enabled) {
+    animationLODPolicy->_beginFrame(this);
+  }
   for (const auto& animatable : animatables_copy) {
-    if (animatable) {
-      if (!animatable->_animate(std::chrono::milliseconds(animationTime))
-          && animatable->disposeOnEnd) {
-        // The animation removed itself from _activeAnimatables
-        // during the call to _animate()
+    // Skipped animatables catch up with the animation time when they are updated again
+    if (animatable && animationLODPolicy->_skip(*animatable)) {
+      continue;
+    }
+    if (animatable && animatable->_beginAnimate(delay)) {
+      evaluatedAnimatables.emplace_back(animatable.get());
+      if (useParallelAnimationEvaluation && animatable->_canEvaluateInParallel()) {
+        parallelAnimatables.emplace_back(animatable.get());
+      }
+      else {
+        sequentialAnimatables.emplace_back(animatable.get());
       }
     }
   }
 
+  // Evaluate the runtime animations, the targets are not modified
+  auto& threadPool = ThreadPool::Default();
+  const auto grainSize
+    = std::max<size_t>(1, parallelAnimatables.size() / (4 * threadPool.concurrency()));
+  threadPool.parallelFor(0, parallelAnimatables.size(), grainSize,
+                         [&parallelAnimatables, delay](size_t begin, size_t end) {
+                           for (auto i = begin; i < end; ++i) {
+                             parallelAnimatables[i]->_evaluateRuntimeAnimations(delay);
+                           }
+                         });
+  for (const auto& animatable : sequentialAnimatables) {
+    animatable->_evaluateRuntimeAnimations(delay);
+  }
+
+  // Apply the values and raise the events in order
+  for (const auto& animatable : evaluatedAnimatables) {
+    if (!animatable->_endAnimate() && animatable->disposeOnEnd) {
+      // The animation removed itself from _activeAnimatables
+      // during the call to _endAnimate()
+    }
+  }
+
   // Late animation bindings
   _processLateAnimationBindings();
 }
 
-void Scene::_registerTargetForLateAnimationBinding(RuntimeAnimation* /*runtimeAnimation*/,
-                                                   const AnimationValue& /*originalValue*/)
+void Scene::_registerTargetForLateAnimationBinding(RuntimeAnimation* runtimeAnimation,
+                                                   const AnimationValue& originalValue)
 {
-  // TODO Implement
+  // The values are copied as the runtime animations can be disposed when their animatable ends
+  const auto& target             = runtimeAnimation->target();
+  const auto& targetPropertyPath = runtimeAnimation->animation()->targetPropertyPath;
+  const auto isHolder = [&target, &targetPropertyPath](const LateAnimationHolder& holder) {
+    return holder.target == target && holder.targetPropertyPath == targetPropertyPath;
+  };
+  auto& holders = _registeredForLateAnimationBindings;
+  auto it       = std::find_if(holders.begin(), holders.end(), isHolder);
+  if (it == holders.end()) {
+    holders.emplace_back(LateAnimationHolder{target, targetPropertyPath, 0.f, {}, originalValue});
+    it = std::prev(holders.end());
+  }
+
+  const auto weight = runtimeAnimation->weight();
+  it->animations.emplace_back(LateAnimationValue{*runtimeAnimation->currentValue(), weight});
+  it->totalWeight += weight;
 }
 
-AnimationValue
-Scene::_processLateAnimationBindingsForMatrices(float holderTotalWeight,
-                                                std::vector<RuntimeAnimation*>& holderAnimations,
-                                                Matrix& holderOriginalValue)
+AnimationValue Scene::_processLateAnimationBindingsForMatrices(const LateAnimationHolder& holder)
 {
   auto normalizer                           = 1.f;
   std::optional<Vector3> finalPosition      = TmpVectors::Vector3Array[0];
   std::optional<Vector3> finalScaling       = TmpVectors::Vector3Array[1];
   std::optional<Quaternion> finalQuaternion = TmpVectors::QuaternionArray[0];
   auto startIndex                           = 0u;
-  auto& originalAnimation                   = holderAnimations[0];
-  auto& originalValue                       = holderOriginalValue;
+  const auto& originalAnimation             = holder.animations[0];
+  const auto& originalValue                 = holder.originalValue.get<Matrix>();
 
   auto scale = 1.f;
-  if (holderTotalWeight < 1.f) {
+  if (holder.totalWeight < 1.f) {
     // We need to mix the original value in
     originalValue.decompose(finalScaling, finalQuaternion, finalPosition);
-    scale = 1.f - holderTotalWeight;
+    scale = 1.f - holder.totalWeight;
   }
   else {
     startIndex = 1;
     // We need to normalize the weights
-    normalizer = holderTotalWeight;
-    (*originalAnimation->currentValue())
-      .get<Matrix>()
-      .decompose(finalScaling, finalQuaternion, finalPosition);
-    scale = originalAnimation->weight / normalizer;
+    normalizer = holder.totalWeight;
+    originalAnimation.value.get<Matrix>().decompose(finalScaling, finalQuaternion, finalPosition);
+    scale = originalAnimation.weight / normalizer;
     if (scale == 1.f) {
-      return *originalAnimation->currentValue();
+      return originalAnimation.value;
     }
   }
 
@@ -2208,37 +2335,33 @@ Scene::_processLateAnimationBindingsForMatrices(float holderTotalWeight,
   finalPosition->scaleInPlace(scale);
   finalQuaternion->scaleInPlace(scale);
 
-  for (size_t animIndex = startIndex; animIndex < holderAnimations.size(); ++animIndex) {
-    auto& runtimeAnimation                      = holderAnimations[animIndex];
-    auto iScale                                 = runtimeAnimation->weight / normalizer;
+  for (size_t animIndex = startIndex; animIndex < holder.animations.size(); ++animIndex) {
+    const auto& animation                       = holder.animations[animIndex];
+    auto iScale                                 = animation.weight / normalizer;
     std::optional<Vector3> currentPosition      = TmpVectors::Vector3Array[2];
     std::optional<Vector3> currentScaling       = TmpVectors::Vector3Array[3];
     std::optional<Quaternion> currentQuaternion = TmpVectors::QuaternionArray[1];
 
-    (*runtimeAnimation->currentValue())
-      .get<Matrix>()
-      .decompose(currentScaling, currentQuaternion, currentPosition);
+    animation.value.get<Matrix>().decompose(currentScaling, currentQuaternion, currentPosition);
     currentScaling->scaleAndAddToRef(iScale, *finalScaling);
     currentQuaternion->scaleAndAddToRef(iScale, *finalQuaternion);
     currentPosition->scaleAndAddToRef(iScale, *finalPosition);
   }
 
-  auto& workValue = *originalAnimation->_animationState.workValue;
-  Matrix::ComposeToRef(*finalScaling, *finalQuaternion, *finalPosition, workValue.get<Matrix>());
-  originalAnimation->_animationState.workValue = workValue;
-  return (*originalAnimation->currentValue());
+  Matrix finalMatrix;
+  Matrix::ComposeToRef(*finalScaling, *finalQuaternion, *finalPosition, finalMatrix);
+  return AnimationValue(finalMatrix);
 }
 
-Quaternion Scene::_processLateAnimationBindingsForQuaternions(
-  float holderTotalWeight, std::vector<RuntimeAnimation*>& holderAnimations,
-  Quaternion& holderOriginalValue, Quaternion& refQuaternion)
+Quaternion Scene::_processLateAnimationBindingsForQuaternions(const LateAnimationHolder& holder,
+                                                              Quaternion& refQuaternion)
 {
-  auto& originalAnimation = holderAnimations[0];
-  auto& originalValue     = holderOriginalValue;
+  const auto& animations    = holder.animations;
+  const auto& originalValue = holder.originalValue.get<Quaternion>();
 
-  if (holderAnimations.size() == 1) {
-    Quaternion::SlerpToRef(originalValue, (*originalAnimation->currentValue()).get<Quaternion>(),
-                           std::min(1.f, holderTotalWeight), refQuaternion);
+  if (animations.size() == 1) {
+    Quaternion::SlerpToRef(originalValue, animations[0].value.get<Quaternion>(),
+                           std::min(1.f, holder.totalWeight), refQuaternion);
     return refQuaternion;
   }
 
@@ -2246,30 +2369,25 @@ Quaternion Scene::_processLateAnimationBindingsForQuaternions(
   std::vector<Quaternion> quaternions;
   Float32Array weights;
 
-  if (holderTotalWeight < 1.f) {
-    auto scale = 1.f - holderTotalWeight;
-
-    quaternions.clear();
-    weights.clear();
+  if (holder.totalWeight < 1.f) {
+    auto scale = 1.f - holder.totalWeight;
 
     quaternions.emplace_back(originalValue);
     weights.emplace_back(scale);
   }
   else {
-    if (holderAnimations.size() == 2) { // Slerp as soon as we can
-      Quaternion::SlerpToRef((*holderAnimations[0]->currentValue()).get<Quaternion>(),
-                             (*holderAnimations[1]->currentValue()).get<Quaternion>(),
-                             holderAnimations[1]->weight / holderTotalWeight, refQuaternion);
+    if (animations.size() == 2) { // Slerp as soon as we can
+      Quaternion::SlerpToRef(animations[0].value.get<Quaternion>(),
+                             animations[1].value.get<Quaternion>(),
+                             animations[1].weight / holder.totalWeight, refQuaternion);
       return refQuaternion;
     }
-    quaternions.clear();
-    weights.clear();
 
-    normalizer = holderTotalWeight;
+    normalizer = holder.totalWeight;
   }
-  for (const auto& runtimeAnimation : holderAnimations) {
-    quaternions.emplace_back((*runtimeAnimation->currentValue()).get<Quaternion>());
-    weights.emplace_back(runtimeAnimation->weight / normalizer);
+  for (const auto& animation : animations) {
+    quaternions.emplace_back(animation.value.get<Quaternion>());
+    weights.emplace_back(animation.weight / normalizer);
   }
 
   // https://gamedev.stackexchange.com/questions/62354/method-for-interpolation-between-3-quaternions
@@ -2299,7 +2417,51 @@ Quaternion Scene::_processLateAnimationBindingsForQuaternions(
 
 void Scene::_processLateAnimationBindings()
 {
-  // TODO Implement
+  for (auto& holder : _registeredForLateAnimationBindings) {
+    const auto& originalAnimation = holder.animations[0];
+    const auto& originalValue     = holder.originalValue;
+    const auto animationType      = originalValue.animationType();
+
+    AnimationValue finalValue;
+    if (animationType == Animation::ANIMATIONTYPE_MATRIX
+        && Animation::AllowMatrixDecomposeForInterpolation()) {
+      finalValue = _processLateAnimationBindingsForMatrices(holder);
+    }
+    else if (animationType == Animation::ANIMATIONTYPE_QUATERNION) {
+      Quaternion refQuaternion;
+      finalValue = _processLateAnimationBindingsForQuaternions(holder, refQuaternion);
+    }
+    else {
+      size_t startIndex = 0;
+      auto normalizer   = 1.f;
+      auto blended      = true;
+      if (holder.totalWeight < 1.f) {
+        // We need to mix the original value in
+        blended = ScaleAndAddToRef(originalValue, 1.f - holder.totalWeight, finalValue);
+      }
+      else {
+        // We need to normalize the weights
+        normalizer = holder.totalWeight;
+        blended    = ScaleAndAddToRef(originalAnimation.value,
+                                      originalAnimation.weight / normalizer, finalValue);
+        startIndex = 1;
+      }
+      for (auto index = startIndex; blended && index < holder.animations.size(); ++index) {
+        const auto& animation = holder.animations[index];
+        blended = ScaleAndAddToRef(animation.value, animation.weight / normalizer, finalValue);
+      }
+      // The values which cannot be blended are the ones of the first animation
+      if (!blended) {
+        finalValue = originalAnimation.value;
+      }
+    }
+
+    if (finalValue) {
+      holder.target->setProperty(holder.targetPropertyPath, finalValue);
+    }
+  }
+
+  _registeredForLateAnimationBindings.clear();
 }
 
 void Scene::_switchToAlternateCameraConfiguration(bool active)
@@ -3546,17 +3708,24 @@ void Scene::_evaluateActiveMeshes()
   // Particle systems
   if (particlesEnabled) {
     onBeforeParticlesRenderingObservable.notifyObservers(this);
-    for (const auto& particleSystem : particleSystems) {
+    // Iterated by index: the sub-emitters add the systems they start to the list while animating
+    for (size_t i = 0; i < particleSystems.size(); ++i) {
+      auto particleSystem = particleSystems[i].get();
       if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
         continue;
       }
 
-      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
-          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
-        _activeParticleSystems.emplace_back(particleSystem.get());
-        particleSystem->animate();
-        _renderingManager->dispatchParticles(particleSystem.get());
+      // The systems emitting from a position are always animated, from a mesh if it is enabled
+      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)) {
+        const auto& emitterMesh = std::get<AbstractMeshPtr>(particleSystem->emitter);
+        if (!emitterMesh || !emitterMesh->isEnabled()) {
+          continue;
+        }
       }
+
+      _activeParticleSystems.emplace_back(particleSystem);
+      particleSystem->animate();
+      _renderingManager->dispatchParticles(particleSystem);
     }
     onAfterParticlesRenderingObservable.notifyObservers(this);
   }
@@ -4291,8 +4460,23 @@ void Scene::dispose()
   }
 
   // Release particles
-  for (const auto& particleSystem : particleSystems) {
+  if (_particleBudgetManager) {
+    _particleBudgetManager->dispose();
+  }
+  // The systems remove themselves from the list when disposed
+  while (!particleSystems.empty()) {
+    auto particleSystem = particleSystems.back();
     particleSystem->dispose();
+    if (!particleSystems.empty() && particleSystems.back() == particleSystem) {
+      particleSystems.pop_back();
+    }
+  }
+  if (_particleArena) {
+    _particleArena->dispose();
+  }
+  if (_gpuParticleBufferPool) {
+    _gpuParticleBufferPool->dispose();
+    _gpuParticleBufferPool = nullptr;
   }
 
   // Release postProcesses
@@ -4300,6 +4484,11 @@ void Scene::dispose()
     postProcess->dispose();
   }
 
+  // Release the bone matrices of the skeletons
+  if (_boneMatrixTextureAtlas) {
+    _boneMatrixTextureAtlas->dispose();
+  }
+
   // Release textures
   for (const auto& texture : textures) {
     texture->dispose();
@@ -329,6 +329,7 @@ void ThinEngine::_initGLContext()
   _caps.astc          = _gl->getExtension("WEBGL_compressed_texture_astc") ?
                  _gl->getExtension("WEBGL_compressed_texture_astc") :
                  _gl->getExtension("WEBKIT_WEBGL_compressed_texture_astc");
+  _caps.bptc = _gl->getExtension("EXT_texture_compression_bptc");
   _caps.s3tc = (_gl->getExtension("WEBGL_compressed_texture_s3tc")
                 || _gl->getExtension("WEBKIT_WEBGL_compressed_texture_s3tc")) ?
                  std::nullopt :
@@ -2289,6 +2290,9 @@ InternalTexturePtr ThinEngine::createTexture(
         callback(std::get<ArrayBuffer>(*buffer), "");
       }
       else {
+        if (scene) {
+          scene->_removePendingData(texture);
+        }
         if (onError) {
           onError("Unable to load: only ArrayBuffer or ArrayBufferView is supported", "");
         }
@@ -2786,6 +2790,9 @@ void ThinEngine::_prepareWebGLTexture(
                needPOTTextures() ? ThinEngine::GetExponentOfTwo(height, maxTextureSize) : height);
 
   if (!_gl) {
+    if (scene) {
+      scene->_removePendingData(texture);
+    }
     return;
   }
 
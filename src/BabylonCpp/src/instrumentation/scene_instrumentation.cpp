@@ -4,6 +4,8 @@
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/misc/tools.h>
+#include <babylon/particles/particle_arena.h>
+#include <babylon/particles/particle_budget_manager.h>
 
 namespace BABYLON {
 
@@ -46,6 +48,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
     , captureCameraRenderTime{this, &SceneInstrumentation::get_captureCameraRenderTime,
                               &SceneInstrumentation::set_captureCameraRenderTime}
     , drawCallsCounter{this, &SceneInstrumentation::get_drawCallsCounter}
+    , particleAllocationsCounter{this, &SceneInstrumentation::get_particleAllocationsCounter}
+    , budgetedParticlesCounter{this, &SceneInstrumentation::get_budgetedParticlesCounter}
+    , throttledParticleSystemsCounter{this,
+                                      &SceneInstrumentation::get_throttledParticleSystemsCounter}
     , _captureActiveMeshesEvaluationTime{false}
     , _captureRenderTargetsRenderTime{false}
     , _captureFrameTime{false}
@@ -107,6 +113,10 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
         }
 
         scene->getEngine()->_drawCalls.fetchNewFrame();
+
+        if (scene->_particleArena) {
+          scene->_particleArena->_fetchNewFrame();
+        }
       });
 
   // After render
@@ -124,6 +134,21 @@ SceneInstrumentation::SceneInstrumentation(Scene* iScene)
         if (_captureInterFrameTime) {
           _interFrameTime.beginMonitoring();
         }
+
+        // Decisions taken by the particle budget manager during the frame
+        if (scene->_particleBudgetManager) {
+          const auto& budgetManager = *scene->_particleBudgetManager;
+          size_t throttledCount     = 0;
+          for (const auto& decision : budgetManager.getDecisions()) {
+            if (decision.capacity < decision.requestedCapacity || decision.updateInterval > 1) {
+              ++throttledCount;
+            }
+          }
+          _budgetedParticles.fetchNewFrame();
+          _budgetedParticles.addCount(budgetManager.getAllowedParticleCount(), true);
+          _throttledParticleSystems.fetchNewFrame();
+          _throttledParticleSystems.addCount(throttledCount, true);
+        }
       });
 }
 
@@ -474,6 +499,21 @@ PerfCounter& SceneInstrumentation::get_drawCallsCounter()
   return scene->getEngine()->_drawCalls;
 }
 
+PerfCounter& SceneInstrumentation::get_particleAllocationsCounter()
+{
+  return ParticleArena::ForScene(scene).getAllocationsCounter();
+}
+
+PerfCounter& SceneInstrumentation::get_budgetedParticlesCounter()
+{
+  return _budgetedParticles;
+}
+
+PerfCounter& SceneInstrumentation::get_throttledParticleSystemsCounter()
+{
+  return _throttledParticleSystems;
+}
+
 void SceneInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   scene->onAfterRenderObservable.remove(_onAfterRenderObserver);
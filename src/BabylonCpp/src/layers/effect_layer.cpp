@@ -369,6 +369,7 @@ bool EffectLayer::_isReady(SubMesh* subMesh, bool useInstances,
                                            "glowColor",
                                            "morphTargetInfluences",
                                            "boneTextureWidth",
+                                           "boneTextureRow",
                                            "diffuseMatrix",
                                            "emissiveMatrix",
                                            "opacityMatrix",
@@ -565,8 +566,10 @@ void EffectLayer::_renderSubMesh(SubMesh* subMesh, bool enableAlphaMode)
         }
 
         _effectLayerMapGenerationEffect->setTexture("boneSampler", boneTexture);
+        _effectLayerMapGenerationEffect->setFloat("boneTextureWidth",
+                                                  skeleton->getTransformMatrixTextureWidth());
         _effectLayerMapGenerationEffect->setFloat(
-          "boneTextureWidth", 4.f * static_cast<float>(skeleton->bones.size() + 1));
+          "boneTextureRow", skeleton->getTransformMatrixTextureRow(mesh.get()));
       }
       else {
         _effectLayerMapGenerationEffect->setMatrices("mBones",
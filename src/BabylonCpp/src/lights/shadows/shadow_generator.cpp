@@ -806,7 +806,8 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh)
         }
 
         _effect->setTexture("boneSampler", boneTexture);
-        _effect->setFloat("boneTextureWidth", 4.f * (skeleton->bones.size() + 1));
+        _effect->setFloat("boneTextureWidth", skeleton->getTransformMatrixTextureWidth());
+        _effect->setFloat("boneTextureRow", skeleton->getTransformMatrixTextureRow(mesh.get()));
       }
       else {
         _effect->setMatrices("mBones", skeleton->getTransformMatrices((mesh.get())));
@@ -1068,9 +1069,10 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances)
 
     std::string shaderName = "shadowMap";
     std::vector<std::string> uniforms{
-      "world",       "mBones",       "viewProjection",        "diffuseMatrix",    "lightData",
-      "depthValues", "biasAndScale", "morphTargetInfluences", "boneTextureWidth", "vClipPlane",
-      "vClipPlane2", "vClipPlane3",  "vClipPlane4",           "vClipPlane5",      "vClipPlane6"};
+      "world",       "mBones",         "viewProjection",        "diffuseMatrix",    "lightData",
+      "depthValues", "biasAndScale",   "morphTargetInfluences", "boneTextureWidth", "boneTextureRow",
+      "vClipPlane",  "vClipPlane2",    "vClipPlane3",           "vClipPlane4",      "vClipPlane5",
+      "vClipPlane6"};
     std::vector<std::string> samplers{"diffuseSampler", "boneSampler"};
 
     // Custom shader?
@@ -0,0 +1,654 @@
+#include <babylon/loading/plugins/obj/obj_parser.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+#include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+enum class OBJEventType { Group, UseMtl, MtlLib, Unhandled };
+
+/**
+ * Keyword changing the mesh or material state, the faces following an event are stored in a new
+ * segment.
+ */
+struct OBJEvent {
+  OBJEventType type;
+  std::string value;
+}; // end of struct OBJEvent
+
+constexpr uint8_t OBJ_HAS_UV            = 1 << 0;
+constexpr uint8_t OBJ_HAS_NORMAL        = 1 << 1;
+constexpr uint8_t OBJ_RELATIVE_POSITION = 1 << 2;
+constexpr uint8_t OBJ_RELATIVE_UV       = 1 << 3;
+constexpr uint8_t OBJ_RELATIVE_NORMAL   = 1 << 4;
+
+/**
+ * Face corner: indices of position, uv and normal. Negative (relative) OBJ indices are resolved
+ * against the chunk local attribute count and flagged, the chunk base offset is added once all
+ * chunks are parsed.
+ */
+struct OBJCorner {
+  int64_t position = 0;
+  int64_t uv       = 0;
+  int64_t normal   = 0;
+  uint8_t flags    = 0;
+
+  bool operator==(const OBJCorner& other) const
+  {
+    return position == other.position && uv == other.uv && normal == other.normal
+           && flags == other.flags;
+  }
+}; // end of struct OBJCorner
+
+struct OBJCornerHash {
+  size_t operator()(const OBJCorner& corner) const
+  {
+    auto hash = static_cast<uint64_t>(corner.position) * 0x9E3779B97F4A7C15ull;
+    hash ^= static_cast<uint64_t>(corner.uv) + 0x632BE59BD9B4E019ull + (hash << 6) + (hash >> 2);
+    hash ^= static_cast<uint64_t>(corner.normal) + 0x85EBCA77C2B2AE63ull + (hash << 6)
+            + (hash >> 2);
+    hash ^= corner.flags;
+    return static_cast<size_t>(hash);
+  }
+}; // end of struct OBJCornerHash
+
+/**
+ * Faces located between two events of a chunk, with their own (deduplicated) vertex index space.
+ */
+struct OBJSegment {
+  std::vector<OBJCorner> vertices;
+  IndicesArray indices;
+  Float32Array positions;
+  Float32Array normals;
+  Float32Array uvs;
+  Float32Array colors;
+}; // end of struct OBJSegment
+
+struct OBJChunk {
+  Float32Array positions; // [x, y, z]
+  Float32Array colors;    // [r, g, b, a]
+  Float32Array normals;   // [x, y, z]
+  Float32Array uvs;       // [u, v]
+  // segments[0] precedes events[0], segments[i + 1] follows events[i]
+  std::vector<OBJSegment> segments;
+  std::vector<OBJEvent> events;
+  // Offsets of the chunk attributes in the merged attribute arrays
+  int64_t positionBase = 0;
+  int64_t uvBase       = 0;
+  int64_t normalBase   = 0;
+}; // end of struct OBJChunk
+
+inline bool isBlank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skipBlanks(const char* p, const char* end)
+{
+  while (p < end && isBlank(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+inline const char* skipToken(const char* p, const char* end)
+{
+  while (p < end && !isBlank(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+inline std::string trimmedRest(const char* p, const char* end)
+{
+  p = skipBlanks(p, end);
+  while (end > p && isBlank(*(end - 1))) {
+    --end;
+  }
+  return std::string(p, end);
+}
+
+inline bool parseFloat(const char*& p, const char* end, float& value)
+{
+  p = skipBlanks(p, end);
+  if (p < end && *p == '+') {
+    ++p;
+  }
+  if (p >= end) {
+    return false;
+  }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const auto result = std::from_chars(p, end, value);
+  if (result.ec != std::errc()) {
+    return false;
+  }
+  p = result.ptr;
+#else
+  // The buffer is the content of a std::string, hence null terminated, and strtof stops at the
+  // first blank or line feed
+  char* parsedEnd = nullptr;
+  value           = std::strtof(p, &parsedEnd);
+  if (parsedEnd == p || parsedEnd > end) {
+    return false;
+  }
+  p = parsedEnd;
+#endif
+  return true;
+}
+
+inline bool parseIndex(const char*& p, const char* end, int64_t& value)
+{
+  if (p < end && *p == '+') {
+    ++p;
+  }
+  const auto result = std::from_chars(p, end, value);
+  if (result.ec != std::errc() || value == 0) {
+    return false;
+  }
+  p = result.ptr;
+  return true;
+}
+
+/**
+ * Converts a 1-based (or negative, relative) OBJ index into a 0-based index.
+ */
+inline int64_t resolveIndex(int64_t index, size_t localCount, uint8_t relativeFlag, uint8_t& flags)
+{
+  if (index > 0) {
+    return index - 1;
+  }
+  flags |= relativeFlag;
+  return static_cast<int64_t>(localCount) + index;
+}
+
+/**
+ * Parses a face corner: "v", "v/vt", "v/vt/vn" or "v//vn".
+ */
+bool parseCorner(const char*& p, const char* end, const OBJChunk& chunk, OBJCorner& corner)
+{
+  corner = OBJCorner{};
+  int64_t index;
+  if (!parseIndex(p, end, index)) {
+    return false;
+  }
+  corner.position = resolveIndex(index, chunk.positions.size() / 3, OBJ_RELATIVE_POSITION,
+                                 corner.flags);
+  if (p < end && *p == '/') {
+    ++p;
+    if (p < end && *p != '/') {
+      if (!parseIndex(p, end, index)) {
+        return false;
+      }
+      corner.uv = resolveIndex(index, chunk.uvs.size() / 2, OBJ_RELATIVE_UV, corner.flags);
+      corner.flags |= OBJ_HAS_UV;
+    }
+    if (p < end && *p == '/') {
+      ++p;
+      if (!parseIndex(p, end, index)) {
+        return false;
+      }
+      corner.normal
+        = resolveIndex(index, chunk.normals.size() / 3, OBJ_RELATIVE_NORMAL, corner.flags);
+      corner.flags |= OBJ_HAS_NORMAL;
+    }
+  }
+  return p == end || isBlank(*p);
+}
+
+class OBJChunkParser {
+
+public:
+  OBJChunkParser(OBJChunk& chunk, const OBJParserOptions& options)
+      : _chunk{chunk}, _options{options}
+  {
+    _chunk.segments.emplace_back();
+  }
+
+  void parse(const char* p, const char* end)
+  {
+    while (p < end) {
+      auto lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+      if (!lineEnd) {
+        lineEnd = end;
+      }
+      _parseLine(p, lineEnd);
+      p = lineEnd + 1;
+    }
+  }
+
+private:
+  void _parseLine(const char* p, const char* end)
+  {
+    const auto lineBegin = p = skipBlanks(p, end);
+    // Comment or newLine
+    if (p == end || *p == '#') {
+      return;
+    }
+
+    const auto keywordEnd  = skipToken(p, end);
+    const auto keywordSize = static_cast<size_t>(keywordEnd - p);
+    const auto isKeyword   = [p, keywordSize](const char* keyword) {
+      return std::strlen(keyword) == keywordSize && std::memcmp(p, keyword, keywordSize) == 0;
+    };
+    p = keywordEnd;
+
+    if (isKeyword("v")) {
+      // "v x y z [r g b [a]]"
+      std::array<float, 7> values{};
+      size_t count = 0;
+      while (count < values.size() && parseFloat(p, end, values[count])) {
+        ++count;
+      }
+      if (count < 3) {
+        _addEvent(OBJEventType::Unhandled, std::string(lineBegin, end));
+        return;
+      }
+      _chunk.positions.insert(_chunk.positions.end(), values.begin(), values.begin() + 3);
+      if (_options.importVertexColors) {
+        if (count >= 6) {
+          _chunk.colors.insert(_chunk.colors.end(), values.begin() + 3, values.begin() + 6);
+          _chunk.colors.emplace_back(count >= 7 ? values[6] : 1.f);
+        }
+        else {
+          _chunk.colors.insert(_chunk.colors.end(), {0.5f, 0.5f, 0.5f, 1.f});
+        }
+      }
+    }
+    else if (isKeyword("vn")) {
+      // "vn x y z"
+      float x, y, z;
+      if (!parseFloat(p, end, x) || !parseFloat(p, end, y) || !parseFloat(p, end, z)) {
+        _addEvent(OBJEventType::Unhandled, std::string(lineBegin, end));
+        return;
+      }
+      _chunk.normals.insert(_chunk.normals.end(), {x, y, z});
+    }
+    else if (isKeyword("vt")) {
+      // "vt u v [w]", w is not supported by BABYLON
+      float u, v;
+      if (!parseFloat(p, end, u) || !parseFloat(p, end, v)) {
+        _addEvent(OBJEventType::Unhandled, std::string(lineBegin, end));
+        return;
+      }
+      _chunk.uvs.insert(_chunk.uvs.end(), {u * _options.uvScaling.x, v * _options.uvScaling.y});
+    }
+    else if (isKeyword("f")) {
+      _corners.clear();
+      OBJCorner corner;
+      while ((p = skipBlanks(p, end)) < end) {
+        if (!parseCorner(p, end, _chunk, corner)) {
+          _addEvent(OBJEventType::Unhandled, std::string(lineBegin, end));
+          return;
+        }
+        _corners.emplace_back(corner);
+      }
+      if (_corners.size() < 3) {
+        _addEvent(OBJEventType::Unhandled, std::string(lineBegin, end));
+        return;
+      }
+      // Create triangles from the polygon (triangle fan)
+      for (size_t i = 1; i + 1 < _corners.size(); ++i) {
+        _addCorner(_corners[0]);
+        _addCorner(_corners[i]);
+        _addCorner(_corners[i + 1]);
+      }
+    }
+    else if (isKeyword("g") || isKeyword("o")) {
+      _addEvent(OBJEventType::Group, trimmedRest(p, end));
+    }
+    else if (isKeyword("usemtl")) {
+      _addEvent(OBJEventType::UseMtl, trimmedRest(p, end));
+    }
+    else if (isKeyword("mtllib")) {
+      _addEvent(OBJEventType::MtlLib, trimmedRest(p, end));
+    }
+    else if (isKeyword("s")) {
+      // Smoothing groups are not supported
+    }
+    else {
+      _addEvent(OBJEventType::Unhandled, std::string(lineBegin, end));
+    }
+  }
+
+  void _addEvent(OBJEventType type, std::string&& value)
+  {
+    _chunk.events.emplace_back(OBJEvent{type, std::move(value)});
+    _chunk.segments.emplace_back();
+    _tupleIndices.clear();
+  }
+
+  /**
+   * Adds the index of the corner to the current segment, adding a new vertex if the tuple
+   * (position, normal[, uv]) was not seen yet in the segment.
+   */
+  void _addCorner(const OBJCorner& corner)
+  {
+    auto& segment = _chunk.segments.back();
+    auto key      = corner;
+    if (!_options.optimizeWithUV) {
+      key.uv = 0;
+      key.flags &= static_cast<uint8_t>(~(OBJ_HAS_UV | OBJ_RELATIVE_UV));
+    }
+    const auto nextIndex = static_cast<uint32_t>(segment.vertices.size());
+    const auto inserted  = _tupleIndices.emplace(key, nextIndex);
+    if (inserted.second) {
+      segment.vertices.emplace_back(corner);
+    }
+    segment.indices.emplace_back(inserted.first->second);
+  }
+
+private:
+  OBJChunk& _chunk;
+  const OBJParserOptions& _options;
+  std::vector<OBJCorner> _corners;
+  std::unordered_map<OBJCorner, uint32_t, OBJCornerHash> _tupleIndices;
+}; // end of class OBJChunkParser
+
+/**
+ * Adds the chunk base offsets to the relative indices of the vertices of a segment, and merges the
+ * vertices which then reference the same tuple (an absolute and a relative index of a same
+ * attribute are only known to match once the chunks are parsed).
+ */
+void resolveSegment(OBJSegment& segment, const OBJChunk& chunk, const OBJParserOptions& options)
+{
+  constexpr auto relativeFlags = OBJ_RELATIVE_POSITION | OBJ_RELATIVE_UV | OBJ_RELATIVE_NORMAL;
+  std::unordered_map<OBJCorner, uint32_t, OBJCornerHash> tupleIndices;
+  std::vector<uint32_t> remap(segment.vertices.size());
+  size_t vertexCount = 0;
+  for (size_t i = 0; i < segment.vertices.size(); ++i) {
+    auto corner = segment.vertices[i];
+    if (corner.flags & OBJ_RELATIVE_POSITION) {
+      corner.position += chunk.positionBase;
+    }
+    if (corner.flags & OBJ_RELATIVE_UV) {
+      corner.uv += chunk.uvBase;
+    }
+    if (corner.flags & OBJ_RELATIVE_NORMAL) {
+      corner.normal += chunk.normalBase;
+    }
+    corner.flags &= static_cast<uint8_t>(~relativeFlags);
+    auto key = corner;
+    if (!options.optimizeWithUV) {
+      key.uv = 0;
+      key.flags &= static_cast<uint8_t>(~OBJ_HAS_UV);
+    }
+    const auto inserted = tupleIndices.emplace(key, static_cast<uint32_t>(vertexCount));
+    if (inserted.second) {
+      segment.vertices[vertexCount++] = corner;
+    }
+    remap[i] = inserted.first->second;
+  }
+  if (vertexCount == segment.vertices.size()) {
+    return;
+  }
+  segment.vertices.resize(vertexCount);
+  for (auto& index : segment.indices) {
+    index = remap[index];
+  }
+}
+
+/**
+ * Gathers the vertex data referenced by the segments of a chunk from the merged attributes.
+ */
+void unwrapChunk(OBJChunk& chunk, const std::vector<OBJChunk>& chunks,
+                 const OBJParserOptions& options, int64_t positionCount, int64_t uvCount,
+                 int64_t normalCount)
+{
+  // Locates the attribute with the given global index
+  const auto fetch = [&chunks](int64_t index, size_t stride, int64_t OBJChunk::*base,
+                               Float32Array OBJChunk::*array) -> const float* {
+    auto it = std::upper_bound(chunks.begin(), chunks.end(), index,
+                               [base](int64_t i, const OBJChunk& c) { return i < c.*base; });
+    const auto& owner = *(--it);
+    return &(owner.*array)[static_cast<size_t>(index - owner.*base) * stride];
+  };
+
+  for (auto& segment : chunk.segments) {
+    resolveSegment(segment, chunk, options);
+    const auto vertexCount = segment.vertices.size();
+    segment.positions.resize(vertexCount * 3);
+    segment.normals.resize(vertexCount * 3);
+    segment.uvs.resize(vertexCount * 2);
+    if (options.importVertexColors) {
+      segment.colors.resize(vertexCount * 4);
+    }
+    for (size_t i = 0; i < vertexCount; ++i) {
+      const auto& corner  = segment.vertices[i];
+      const auto position = corner.position;
+      const auto uv       = corner.uv;
+      const auto normal   = corner.normal;
+
+      const bool validPosition = position >= 0 && position < positionCount;
+      if (validPosition) {
+        std::copy_n(fetch(position, 3, &OBJChunk::positionBase, &OBJChunk::positions), 3,
+                    &segment.positions[i * 3]);
+      }
+      // Default value for normals is Up
+      if ((corner.flags & OBJ_HAS_NORMAL) && normal >= 0 && normal < normalCount) {
+        std::copy_n(fetch(normal, 3, &OBJChunk::normalBase, &OBJChunk::normals), 3,
+                    &segment.normals[i * 3]);
+      }
+      else {
+        segment.normals[i * 3 + 1] = 1.f;
+      }
+      // Default value for uvs is Zero
+      if ((corner.flags & OBJ_HAS_UV) && uv >= 0 && uv < uvCount) {
+        std::copy_n(fetch(uv, 2, &OBJChunk::uvBase, &OBJChunk::uvs), 2, &segment.uvs[i * 2]);
+      }
+      if (options.importVertexColors) {
+        if (validPosition) {
+          std::copy_n(fetch(position, 4, &OBJChunk::positionBase, &OBJChunk::colors), 4,
+                      &segment.colors[i * 4]);
+        }
+        else {
+          std::fill_n(&segment.colors[i * 4], 4, 0.5f);
+          segment.colors[i * 4 + 3] = 1.f;
+        }
+      }
+    }
+    segment.vertices = {};
+  }
+}
+
+/**
+ * Rebuilds the meshes from the chunks, in file order.
+ */
+class OBJMeshBuilder {
+
+public:
+  OBJMeshBuilder(OBJParseResult& result, const OBJParserOptions& options)
+      : _result{result}, _options{options}
+  {
+  }
+
+  void addSegment(OBJSegment& segment)
+  {
+    const auto indexOffset = static_cast<uint32_t>(_current.positions.size() / 3);
+    _current.indices.reserve(_current.indices.size() + segment.indices.size());
+    for (const auto index : segment.indices) {
+      _current.indices.emplace_back(index + indexOffset);
+    }
+    _append(_current.positions, segment.positions);
+    _append(_current.normals, segment.normals);
+    _append(_current.uvs, segment.uvs);
+    if (_options.importVertexColors) {
+      _append(_current.colors, segment.colors);
+    }
+    segment = {};
+  }
+
+  void addEvent(const OBJEvent& event)
+  {
+    switch (event.type) {
+      case OBJEventType::Group: {
+        // Create a new mesh corresponding to the name of the group
+        _addPreviousObjMesh();
+        MeshObject objMesh;
+        objMesh.name = event.value;
+        _result.meshes.emplace_back(std::move(objMesh));
+        _objMeshName     = event.value;
+        _hasMeshes       = true;
+        _isFirstMaterial = true;
+        _increment       = 1;
+      } break;
+      case OBJEventType::UseMtl: {
+        _materialNameFromObj = event.value;
+        // If this new material is in the same mesh
+        if (!_isFirstMaterial || !_hasMeshes) {
+          // Set the data for the previous mesh
+          _addPreviousObjMesh();
+          // Create a new mesh
+          MeshObject objMesh;
+          objMesh.name = (!_objMeshName.empty() ? _objMeshName : "mesh") + "_mm"
+                         + std::to_string(_increment);
+          objMesh.materialName = _materialNameFromObj;
+          ++_increment;
+          _result.meshes.emplace_back(std::move(objMesh));
+          _hasMeshes = true;
+        }
+        // Set the material name if the previous line define a mesh
+        if (_hasMeshes && _isFirstMaterial) {
+          // Set the material name to the previous mesh (1 material per mesh)
+          _result.meshes.back().materialName = _materialNameFromObj;
+          _isFirstMaterial                   = false;
+        }
+      } break;
+      case OBJEventType::MtlLib:
+        _result.mtlFileName = event.value;
+        break;
+      case OBJEventType::Unhandled:
+        BABYLON_LOGF_ERROR("OBJParser", "Unhandled expression at line : %s", event.value.c_str())
+        break;
+    }
+  }
+
+  void finish()
+  {
+    if (_hasMeshes) {
+      // Set the data for the last mesh
+      _setData(_result.meshes.back());
+    }
+    else {
+      // If no o or g keyword found, create a single mesh (named by the caller)
+      MeshObject objMesh;
+      objMesh.materialName = _materialNameFromObj;
+      _setData(objMesh);
+      _result.meshes.emplace_back(std::move(objMesh));
+    }
+  }
+
+private:
+  static void _append(Float32Array& target, const Float32Array& source)
+  {
+    target.insert(target.end(), source.begin(), source.end());
+  }
+
+  void _addPreviousObjMesh()
+  {
+    // Check if it is not the first mesh. Otherwise we don't have data.
+    if (!_result.meshes.empty()) {
+      _setData(_result.meshes.back());
+    }
+  }
+
+  void _setData(MeshObject& mesh)
+  {
+    // Reverse tab. Otherwise face are displayed in the wrong sense
+    std::reverse(_current.indices.begin(), _current.indices.end());
+    mesh.indices   = std::move(_current.indices);
+    mesh.positions = std::move(_current.positions);
+    mesh.normals   = std::move(_current.normals);
+    mesh.uvs       = std::move(_current.uvs);
+    if (_options.importVertexColors) {
+      mesh.colors = std::move(_current.colors);
+    }
+    _current = {};
+  }
+
+private:
+  OBJParseResult& _result;
+  const OBJParserOptions& _options;
+  MeshObject _current;
+  std::string _objMeshName;
+  std::string _materialNameFromObj;
+  size_t _increment     = 1;
+  bool _hasMeshes       = false;
+  bool _isFirstMaterial = true;
+}; // end of class OBJMeshBuilder
+
+} // end of anonymous namespace
+
+OBJParseResult OBJParser::Parse(const std::string& data, const OBJParserOptions& options,
+                                ThreadPool* pool)
+{
+  if (!pool) {
+    pool = &ThreadPool::Default();
+  }
+
+  // Split the file into chunks at line boundaries
+  const auto minChunkSize = std::max<size_t>(options.minChunkSize, 1);
+  const auto chunkCount   = std::clamp<size_t>(data.size() / minChunkSize, 1,
+                                             pool->concurrency() * 4);
+  std::vector<size_t> chunkBounds{0};
+  for (size_t i = 1; i < chunkCount; ++i) {
+    auto bound = std::max(data.size() * i / chunkCount, chunkBounds.back());
+    bound      = data.find('\n', bound);
+    if (bound == std::string::npos) {
+      break;
+    }
+    chunkBounds.emplace_back(bound + 1);
+  }
+  chunkBounds.emplace_back(data.size());
+
+  // Tokenize the chunks
+  std::vector<OBJChunk> chunks(chunkBounds.size() - 1);
+  pool->parallelFor(0, chunks.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      OBJChunkParser parser(chunks[i], options);
+      parser.parse(data.data() + chunkBounds[i], data.data() + chunkBounds[i + 1]);
+    }
+  });
+
+  // Compute the offsets of the chunks in the merged index spaces
+  int64_t positionCount = 0, uvCount = 0, normalCount = 0;
+  for (auto& chunk : chunks) {
+    chunk.positionBase = positionCount;
+    chunk.uvBase       = uvCount;
+    chunk.normalBase   = normalCount;
+    positionCount += static_cast<int64_t>(chunk.positions.size() / 3);
+    uvCount += static_cast<int64_t>(chunk.uvs.size() / 2);
+    normalCount += static_cast<int64_t>(chunk.normals.size() / 3);
+  }
+
+  // Resolve the vertex data of each segment
+  pool->parallelFor(0, chunks.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      unwrapChunk(chunks[i], chunks, options, positionCount, uvCount, normalCount);
+    }
+  });
+
+  // Merge the segments into meshes, in file order
+  OBJParseResult result;
+  OBJMeshBuilder builder(result, options);
+  for (auto& chunk : chunks) {
+    builder.addSegment(chunk.segments[0]);
+    for (size_t i = 0; i < chunk.events.size(); ++i) {
+      builder.addEvent(chunk.events[i]);
+      builder.addSegment(chunk.segments[i + 1]);
+    }
+  }
+  builder.finish();
+
+  return result;
+}
+
+} // end of namespace BABYLON
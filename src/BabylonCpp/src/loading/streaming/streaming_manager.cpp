@@ -0,0 +1,375 @@
+#include <babylon/loading/streaming/streaming_manager.h>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include <babylon/asio/asio.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/core/logging.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * State shared by the levels of a streamed mesh.
+ */
+struct StreamedMeshState {
+  std::weak_ptr<Mesh> master;
+  std::vector<float> distances;
+  std::vector<MeshPtr> lodMeshes;
+
+  // Re-registers the resident levels, the finest one being used for every lower distance
+  void refreshLODLevels()
+  {
+    auto mesh = master.lock();
+    if (!mesh) {
+      return;
+    }
+    for (const auto& lodMesh : lodMeshes) {
+      if (lodMesh) {
+        mesh->removeLODLevel(lodMesh);
+      }
+    }
+    std::optional<size_t> finest = std::nullopt;
+    for (size_t i = 0; i < lodMeshes.size(); ++i) {
+      if (!lodMeshes[i]) {
+        continue;
+      }
+      if (finest) {
+        mesh->addLODLevel(distances[*finest], lodMeshes[*finest]);
+      }
+      finest = i;
+    }
+    if (finest) {
+      mesh->addLODLevel(0.f, lodMeshes[*finest]);
+    }
+  }
+}; // end of struct StreamedMeshState
+
+} // end of anonymous namespace
+
+StreamingManager::StreamingManager(Scene* scene, const StreamingManagerOptions& options)
+    : _scene{scene}
+    , _options{options}
+    , _nextAssetId{0}
+    , _frameId{0}
+    , _residentBytes{0}
+    , _pendingRequests{0}
+    , _onBeforeRenderObserver{nullptr}
+    , _alive{std::make_shared<bool>(true)}
+{
+  if (!_options.fetch) {
+    _options.fetch = [](const std::string& url,
+                        const asio::OnSuccessFunction<ArrayBuffer>& onSuccess,
+                        const asio::OnErrorFunction& onError) {
+      asio::LoadAssetAsync_Binary(url, onSuccess, onError);
+    };
+  }
+
+  if (_scene && _options.autoUpdate) {
+    _onBeforeRenderObserver
+      = _scene->onBeforeRenderObservable.add([this](Scene*, EventState&) { update(); });
+  }
+}
+
+StreamingManager::~StreamingManager()
+{
+  if (_scene) {
+    _scene->onBeforeRenderObservable.remove(_onBeforeRenderObserver);
+    // Do not keep the scene waiting for data which will never arrive
+    for (auto& item : _assets) {
+      if (item.second.loading && item.second.residentLevel < 0) {
+        _scene->_removePendingData(&item.second);
+      }
+    }
+  }
+}
+
+StreamingManager::AssetId StreamingManager::addAsset(const StreamingAssetOptions& options)
+{
+  const auto id = _nextAssetId++;
+  auto& asset   = _assets[id];
+  asset.options = options;
+  asset.levels.resize(options.levels.size());
+  for (size_t i = 0; i < options.levels.size(); ++i) {
+    asset.levels[i].options = options.levels[i];
+  }
+  return id;
+}
+
+StreamingManager::AssetId StreamingManager::addMesh(const MeshPtr& mesh,
+                                                    const std::vector<StreamingMeshLODLevel>& levels)
+{
+  auto state    = std::make_shared<StreamedMeshState>();
+  state->master = mesh;
+  state->lodMeshes.resize(levels.size());
+
+  StreamingAssetOptions options;
+  options.name = mesh->name;
+  mesh->computeWorldMatrix(true);
+  const auto& boundingSphere = mesh->getBoundingInfo()->boundingSphere;
+  options.center             = boundingSphere.centerWorld;
+  options.radius             = boundingSphere.radiusWorld;
+
+  for (size_t i = 0; i < levels.size(); ++i) {
+    const auto& level = levels[i];
+    state->distances.emplace_back(level.distance);
+
+    StreamingLODLevel lodLevel;
+    lodLevel.url               = level.url;
+    lodLevel.minScreenCoverage = level.minScreenCoverage;
+    lodLevel.onLoaded = [state, i, createMesh = level.createMesh](const ArrayBuffer& data) {
+      state->lodMeshes[i] = createMesh ? createMesh(data) : nullptr;
+      state->refreshLODLevels();
+      return data.size();
+    };
+    lodLevel.onEvicted = [state, i]() {
+      auto lodMesh = state->lodMeshes[i];
+      if (!lodMesh) {
+        return;
+      }
+      if (auto master = state->master.lock()) {
+        master->removeLODLevel(lodMesh);
+      }
+      state->lodMeshes[i] = nullptr;
+      lodMesh->dispose();
+      state->refreshLODLevels();
+    };
+    options.levels.emplace_back(std::move(lodLevel));
+  }
+
+  return addAsset(options);
+}
+
+void StreamingManager::removeAsset(AssetId id)
+{
+  auto it = _assets.find(id);
+  if (it == _assets.end()) {
+    return;
+  }
+
+  auto& asset = it->second;
+  if (_scene && asset.loading && asset.residentLevel < 0) {
+    _scene->_removePendingData(&asset);
+  }
+  while (asset.residentLevel >= 0) {
+    _evict(asset);
+  }
+  _assets.erase(it);
+}
+
+void StreamingManager::update()
+{
+  if (!_scene) {
+    return;
+  }
+
+  auto camera = _scene->activeCamera();
+  if (!camera) {
+    // Without point of view, only the coarsest levels are streamed
+    _issueRequests();
+    return;
+  }
+
+  update(camera->globalPosition(), std::tan(camera->fov * 0.5f));
+}
+
+void StreamingManager::update(const Vector3& eyePosition, float tanHalfFov)
+{
+  ++_frameId;
+  tanHalfFov = std::max(tanHalfFov, 1e-4f);
+
+  for (auto& item : _assets) {
+    auto& asset = item.second;
+    if (asset.levels.empty()) {
+      continue;
+    }
+
+    // Fraction of the screen height covered by the bounding sphere
+    const auto radius   = std::max(asset.options.radius, 1e-4f);
+    const auto distance = std::max(Vector3::Distance(eyePosition, asset.options.center), radius);
+    const auto coverage = std::min(radius / (distance * tanHalfFov), 1.f);
+
+    asset.priority    = coverage * asset.options.priorityBias;
+    asset.wantedLevel = 0;
+    for (size_t i = 1; i < asset.levels.size(); ++i) {
+      if (coverage >= asset.levels[i].options.minScreenCoverage) {
+        asset.wantedLevel = i;
+      }
+    }
+    for (size_t i = 0; i <= asset.wantedLevel; ++i) {
+      asset.levels[i].lastWantedFrame = _frameId;
+    }
+  }
+
+  _evictColdLevels();
+  _issueRequests();
+}
+
+int StreamingManager::residentLevel(AssetId id) const
+{
+  auto it = _assets.find(id);
+  return it == _assets.end() ? -1 : it->second.residentLevel;
+}
+
+size_t StreamingManager::residentBytes() const
+{
+  return _residentBytes;
+}
+
+size_t StreamingManager::pendingRequests() const
+{
+  return _pendingRequests;
+}
+
+void StreamingManager::_issueRequests()
+{
+  if (_pendingRequests >= _options.maxConcurrentRequests) {
+    return;
+  }
+
+  // Next level of each asset: coarsest levels first, then by decreasing priority
+  std::vector<std::pair<AssetId, Asset*>> candidates;
+  for (auto& item : _assets) {
+    auto& asset          = item.second;
+    const auto nextLevel = static_cast<size_t>(asset.residentLevel + 1);
+    if (asset.loading || nextLevel >= asset.levels.size()
+        || (nextLevel > 0 && nextLevel > asset.wantedLevel)
+        || asset.levels[nextLevel].state == LevelState::Failed) {
+      continue;
+    }
+    candidates.emplace_back(item.first, &asset);
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+    const auto aCoarsest = a.second->residentLevel < 0;
+    const auto bCoarsest = b.second->residentLevel < 0;
+    if (aCoarsest != bCoarsest) {
+      return aCoarsest;
+    }
+    if (a.second->priority != b.second->priority) {
+      return a.second->priority > b.second->priority;
+    }
+    return a.first < b.first;
+  });
+
+  for (const auto& candidate : candidates) {
+    if (_pendingRequests >= _options.maxConcurrentRequests) {
+      break;
+    }
+    _request(candidate.first, *candidate.second,
+             static_cast<size_t>(candidate.second->residentLevel + 1));
+  }
+}
+
+void StreamingManager::_request(AssetId id, Asset& asset, size_t levelIndex)
+{
+  asset.loading                  = true;
+  asset.levels[levelIndex].state = LevelState::Loading;
+  ++_pendingRequests;
+
+  if (_scene && _options.waitForCoarsestLevels && levelIndex == 0) {
+    _scene->_addPendingData(&asset);
+  }
+
+  std::weak_ptr<bool> alive = _alive;
+  _options.fetch(
+    asset.levels[levelIndex].options.url,
+    [this, alive, id, levelIndex](const ArrayBuffer& data) {
+      if (!alive.expired()) {
+        _onLevelLoaded(id, levelIndex, data);
+      }
+    },
+    [this, alive, id, levelIndex](const std::string& message) {
+      if (!alive.expired()) {
+        _onLevelError(id, levelIndex, message);
+      }
+    });
+}
+
+void StreamingManager::_onLevelLoaded(AssetId id, size_t levelIndex, const ArrayBuffer& data)
+{
+  --_pendingRequests;
+  auto it = _assets.find(id);
+  if (it == _assets.end()) {
+    // Asset removed while loading
+    return;
+  }
+
+  auto& asset   = it->second;
+  auto& level   = asset.levels[levelIndex];
+  asset.loading = false;
+
+  level.byteSize = level.options.onLoaded ? level.options.onLoaded(data) : data.size();
+  level.state    = LevelState::Resident;
+  _residentBytes += level.byteSize;
+  asset.residentLevel = static_cast<int>(levelIndex);
+
+  if (_scene && _options.waitForCoarsestLevels && levelIndex == 0) {
+    _scene->_removePendingData(&asset);
+  }
+}
+
+void StreamingManager::_onLevelError(AssetId id, size_t levelIndex, const std::string& message)
+{
+  --_pendingRequests;
+  auto it = _assets.find(id);
+  if (it == _assets.end()) {
+    return;
+  }
+
+  auto& asset                    = it->second;
+  asset.loading                  = false;
+  asset.levels[levelIndex].state = LevelState::Failed;
+  BABYLON_LOGF_WARN("StreamingManager", "Unable to load level %zu of %s: %s", levelIndex,
+                    asset.options.name.c_str(), message.c_str())
+
+  if (_scene && _options.waitForCoarsestLevels && levelIndex == 0) {
+    _scene->_removePendingData(&asset);
+  }
+}
+
+void StreamingManager::_evict(Asset& asset)
+{
+  auto& level = asset.levels[static_cast<size_t>(asset.residentLevel)];
+  if (level.options.onEvicted) {
+    level.options.onEvicted();
+  }
+  _residentBytes -= level.byteSize;
+  level.byteSize = 0;
+  level.state    = LevelState::NotLoaded;
+  --asset.residentLevel;
+}
+
+void StreamingManager::_evictColdLevels()
+{
+  while (_residentBytes > _options.memoryBudget) {
+    // Finest resident level (the coarsest level is never evicted) which went cold, lowest priority
+    // first
+    Asset* victim = nullptr;
+    for (auto& item : _assets) {
+      auto& asset = item.second;
+      if (asset.residentLevel <= 0 || asset.loading) {
+        continue;
+      }
+      const auto& level = asset.levels[static_cast<size_t>(asset.residentLevel)];
+      if (_frameId - level.lastWantedFrame < _options.coldFrames) {
+        continue;
+      }
+      if (!victim || asset.priority < victim->priority) {
+        victim = &asset;
+      }
+    }
+    if (!victim) {
+      break;
+    }
+    _evict(*victim);
+  }
+}
+
+} // end of namespace BABYLON
@@ -1,6 +1,7 @@
 #include <babylon/materials/material_helper.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -185,10 +186,25 @@ void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines&
   }
 }
 
+void MaterialHelper::PrepareDefinesForBakedVertexAnimation(AbstractMesh* mesh,
+                                                           MaterialDefines& defines)
+{
+  // Only for the materials supporting the baked vertex animation texture
+  if (!stl_util::contains(defines.boolDef, "BAKED_VERTEX_ANIMATION_TEXTURE")) {
+    return;
+  }
+
+  const auto& manager = mesh->bakedVertexAnimationManager();
+  defines.boolDef["BAKED_VERTEX_ANIMATION_TEXTURE"]
+    = manager && manager->isEnabled() && manager->texture() != nullptr
+      && defines.intDef["NUM_BONE_INFLUENCERS"] > 0;
+}
+
 void MaterialHelper::PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialDefines& defines)
 {
   const auto& manager = static_cast<Mesh*>(mesh)->morphTargetManager();
-  if (manager) {
+  // Targets blended on the CPU are already applied to the vertex data
+  if (manager && !manager->useCPUBlending()) {
     defines.boolDef["MORPHTARGETS_UV"]      = manager->supportsUVs() && defines["UV1"];
     defines.boolDef["MORPHTARGETS_TANGENT"] = manager->supportsTangents() && defines["TANGENT"];
     defines.boolDef["MORPHTARGETS_NORMAL"]  = manager->supportsNormals() && defines["NORMAL"];
@@ -241,6 +257,7 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
 
   if (useBones) {
     PrepareDefinesForBones(mesh, defines);
+    PrepareDefinesForBakedVertexAnimation(mesh, defines);
   }
 
   if (useMorphTargets) {
@@ -631,6 +648,15 @@ void MaterialHelper::PrepareAttributesForBones(std::vector<std::string>& attribs
   }
 }
 
+void MaterialHelper::PrepareAttributesForBakedVertexAnimation(std::vector<std::string>& attribs,
+                                                              MaterialDefines& defines)
+{
+  if (stl_util::contains(defines.boolDef, "BAKED_VERTEX_ANIMATION_TEXTURE")
+      && defines["BAKED_VERTEX_ANIMATION_TEXTURE"] && defines["INSTANCES"]) {
+    attribs.emplace_back(BakedVertexAnimationManager::SettingsInstancedKind);
+  }
+}
+
 void MaterialHelper::PrepareAttributesForInstances(std::vector<std::string>& attribs,
                                                    MaterialDefines& defines)
 {
@@ -717,7 +743,8 @@ void MaterialHelper::BindBonesParameters(AbstractMesh* mesh, const EffectPtr& ef
     if (skeleton->isUsingTextureForMatrices && effect->getUniformIndex("boneTextureWidth") > -1) {
       const auto& boneTexture = skeleton->getTransformMatrixTexture(mesh);
       effect->setTexture("boneSampler", boneTexture);
-      effect->setFloat("boneTextureWidth", 4.f * (skeleton->bones.size() + 1.f));
+      effect->setFloat("boneTextureWidth", skeleton->getTransformMatrixTextureWidth());
+      effect->setFloat("boneTextureRow", skeleton->getTransformMatrixTextureRow(mesh));
     }
     else {
       const auto& matrices = skeleton->getTransformMatrices(mesh);
@@ -729,12 +756,25 @@ void MaterialHelper::BindBonesParameters(AbstractMesh* mesh, const EffectPtr& ef
   }
 }
 
+void MaterialHelper::BindBakedVertexAnimationParameters(AbstractMesh* mesh,
+                                                       const EffectPtr& effect, bool useInstances)
+{
+  if (!effect || !mesh) {
+    return;
+  }
+
+  const auto& manager = mesh->bakedVertexAnimationManager();
+  if (manager) {
+    manager->bind(effect, useInstances);
+  }
+}
+
 void MaterialHelper::BindMorphTargetParameters(AbstractMesh* abstractMesh, const EffectPtr& effect)
 {
   auto mesh = static_cast<Mesh*>(abstractMesh);
   if (mesh) {
     auto manager = mesh->morphTargetManager();
-    if (!abstractMesh || !manager) {
+    if (!abstractMesh || !manager || manager->useCPUBlending()) {
       return;
     }
 
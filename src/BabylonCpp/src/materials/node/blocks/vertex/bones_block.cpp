@@ -38,6 +38,7 @@ void BonesBlock::initialize(NodeMaterialBuildState& state)
 {
   state._excludeVariableName("boneSampler");
   state._excludeVariableName("boneTextureWidth");
+  state._excludeVariableName("boneTextureRow");
   state._excludeVariableName("mBones");
   state._excludeVariableName("BonesPerMesh");
 }
@@ -153,6 +154,7 @@ BonesBlock& BonesBlock::_buildBlock(NodeMaterialBuildState& state)
 
   // Register internal uniforms and samplers
   state.uniforms.emplace_back("boneTextureWidth");
+  state.uniforms.emplace_back("boneTextureRow");
   state.uniforms.emplace_back("mBones");
 
   state.samplers.emplace_back("boneSampler");
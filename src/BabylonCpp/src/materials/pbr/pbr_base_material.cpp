@@ -1,5 +1,6 @@
 #include <babylon/materials/pbr/pbr_base_material.h>
 
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
@@ -578,6 +579,7 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
 
   MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines, *fallbacks);
   MaterialHelper::PrepareAttributesForInstances(attribs, defines);
+  MaterialHelper::PrepareAttributesForBakedVertexAnimation(attribs, defines);
   MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
 
   std::string shaderName = "pbr";
@@ -647,6 +649,7 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
                                     "vReflectionMicrosurfaceInfos",
                                     "vTangentSpaceParams",
                                     "boneTextureWidth",
+                                    "boneTextureRow",
                                     "vDebugMode"};
 
   std::vector<std::string> samplers{
@@ -656,6 +659,9 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
     "reflectionSamplerHigh",  "irradianceSampler",   "microSurfaceSampler",
     "environmentBrdfSampler", "boneSampler"};
 
+  BakedVertexAnimationManager::AddUniforms(uniforms);
+  BakedVertexAnimationManager::AddSamplers(samplers);
+
   std::vector<std::string> uniformBuffers{"Material", "Scene"};
 
   PBRSubSurfaceConfiguration::AddUniforms(uniforms);
@@ -1137,6 +1143,9 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   // Bones
   MaterialHelper::BindBonesParameters(mesh, _activeEffect);
 
+  // Baked vertex animation
+  MaterialHelper::BindBakedVertexAnimationParameters(mesh, _activeEffect, defines["INSTANCES"]);
+
   BaseTexturePtr reflectionTexture = nullptr;
   auto& ubo                        = *_uniformBuffer;
   if (mustRebind) {
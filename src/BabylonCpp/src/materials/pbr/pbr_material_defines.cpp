@@ -95,6 +95,7 @@ PBRMaterialDefines::PBRMaterialDefines()
     {"INSTANCES", false}, //
 
     {"BONETEXTURE", false}, //
+    {"BAKED_VERTEX_ANIMATION_TEXTURE", false}, //
 
     {"NONUNIFORMSCALING", false}, //
 
@@ -363,6 +363,10 @@ bool ShaderMaterial::isReady(AbstractMesh* mesh, bool useInstances)
         _options.uniforms.emplace_back("boneTextureWidth");
       }
 
+      if (!stl_util::contains(_options.uniforms, "boneTextureRow")) {
+        _options.uniforms.emplace_back("boneTextureRow");
+      }
+
       if (!stl_util::contains(_options.samplers, "boneSampler")) {
         _options.samplers.emplace_back("boneSampler");
       }
@@ -2,6 +2,7 @@
 
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/json_util.h>
@@ -773,6 +774,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
 
     MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines, *fallbacks);
     MaterialHelper::PrepareAttributesForInstances(attribs, defines);
+    MaterialHelper::PrepareAttributesForBakedVertexAnimation(attribs, defines);
     MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
 
     std::string shaderName{"default"};
@@ -830,7 +832,8 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
                                       "logarithmicDepthConstant",
                                       "vTangentSpaceParams",
                                       "alphaCutOff",
-                                      "boneTextureWidth"};
+                                      "boneTextureWidth",
+                                      "boneTextureRow"};
     std::vector<std::string> samplers{
       "diffuseSampler",        "ambientSampler",      "opacitySampler",
       "reflectionCubeSampler", "reflection2DSampler", "emissiveSampler",
@@ -838,6 +841,9 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
       "refractionCubeSampler", "refraction2DSampler", "boneSampler"};
     std::vector<std::string> uniformBuffers{"Material", "Scene"};
 
+    BakedVertexAnimationManager::AddUniforms(uniforms);
+    BakedVertexAnimationManager::AddSamplers(samplers);
+
     ImageProcessingConfiguration::PrepareUniforms(uniforms, defines);
     ImageProcessingConfiguration::PrepareSamplers(samplers, defines);
 
@@ -997,6 +1003,9 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
 
   // Bones
   MaterialHelper::BindBonesParameters(mesh, effect);
+
+  // Baked vertex animation
+  MaterialHelper::BindBakedVertexAnimationParameters(mesh, effect, defines["INSTANCES"]);
   auto& ubo = *_uniformBuffer;
   if (mustRebind) {
     ubo.bindToEffect(effect.get(), "Material");
@@ -45,6 +45,7 @@ StandardMaterialDefines::StandardMaterialDefines()
     {"VERTEXCOLOR", false},                                 //
     {"VERTEXALPHA", false},                                 //
     {"BONETEXTURE", false},                                 //
+    {"BAKED_VERTEX_ANIMATION_TEXTURE", false},              //
     {"INSTANCES", false},                                   //
     {"GLOSSINESS", false},                                  //
     {"ROUGHNESS", false},                                   //
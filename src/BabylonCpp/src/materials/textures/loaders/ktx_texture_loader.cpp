@@ -1,8 +1,10 @@
 #include <babylon/materials/textures/loaders/ktx_texture_loader.h>
 
+#include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/misc/khronos_texture_container.h>
+#include <babylon/misc/khronos_texture_container2.h>
 #include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
@@ -82,6 +84,29 @@ void _KTXTextureLoader::loadData(
       true, [&ktx, &texture]() -> void { ktx.uploadLevels(texture, texture->generateMipMaps); },
       ktx.isInvalid);
   }
+  else if (KhronosTextureContainer2::IsValid(data)) {
+    // Transcoded on a worker thread, the callback is raised on the main thread
+    auto engine = texture->getEngine();
+    KhronosTextureContainer2 ktx2(engine);
+    ktx2.decodeAsync(data, [ktx2, texture, callback](const KTX2DecodedTexture& decoded) {
+      if (decoded.levels.empty()) {
+        BABYLON_LOG_ERROR("KTXTextureLoader", "Failed to decode KTX2 texture: ",
+                          decoded.errorMessage)
+        callback(
+          0, 0, false, false, []() -> void {}, true);
+        return;
+      }
+      texture->_invertVScale = decoded.isCompressed && !texture->invertY;
+      const auto loadMipmap
+        = texture->generateMipMaps && (!decoded.isCompressed || decoded.levels.size() > 1);
+      callback(
+        decoded.levels[0].width, decoded.levels[0].height, loadMipmap, decoded.isCompressed,
+        [&ktx2, &texture, &decoded, loadMipmap]() -> void {
+          ktx2.uploadLevels(texture, decoded, loadMipmap);
+        },
+        false);
+    });
+  }
   else {
     callback(
       0, 0, false, false, []() -> void {}, true);
@@ -3,6 +3,7 @@
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/materials/textures/internal_texture.h>
 
 namespace BABYLON {
@@ -30,6 +31,16 @@ void RawTexture::update(const ArrayBufferView& data)
   }
 }
 
+void RawTexture::updateRegion(const ArrayBufferView& data, int xOffset, int yOffset, int width,
+                              int height)
+{
+  if (_texture) {
+    _engine->_bindTextureDirectly(GL::TEXTURE_2D, _texture, true);
+    _engine->updateTextureData(_texture, data, xOffset, yOffset, width, height);
+    _engine->_bindTextureDirectly(GL::TEXTURE_2D, nullptr, true);
+  }
+}
+
 std::unique_ptr<RawTexture> RawTexture::CreateLuminanceTexture(const ArrayBufferView& data,
                                                                int width, int height, Scene* scene,
                                                                bool generateMipMaps, bool iInvertY,
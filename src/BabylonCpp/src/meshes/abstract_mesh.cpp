@@ -123,8 +123,10 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
         {},           // actions
         std::nullopt  // freezeWorldMatrix
       }}
-    , _transformMatrixTexture{nullptr}
+    , _transformMatrixTextureRow{std::nullopt}
     , skeleton{this, &AbstractMesh::get_skeleton, &AbstractMesh::set_skeleton}
+    , bakedVertexAnimationManager{this, &AbstractMesh::get_bakedVertexAnimationManager,
+                                  &AbstractMesh::set_bakedVertexAnimationManager}
     , edgesRenderer{this, &AbstractMesh::get_edgesRenderer}
     , isBlocked{this, &AbstractMesh::get_isBlocked}
     , useBones{this, &AbstractMesh::get_useBones}
@@ -716,8 +718,9 @@ std::vector<Vector3>& AbstractMesh::get__positions()
 
 void AbstractMesh::set_skeleton(const SkeletonPtr& value)
 {
+  // Also releases the row of the mesh in the bone matrix texture
   auto& iSkeleton = _internalAbstractMeshDataInfo._skeleton;
-  if (iSkeleton && iSkeleton->needInitialSkinMatrix) {
+  if (iSkeleton) {
     iSkeleton->_unregisterMeshWithPoseMatrix(this);
   }
 
@@ -739,6 +742,21 @@ SkeletonPtr& AbstractMesh::get_skeleton()
   return _internalAbstractMeshDataInfo._skeleton;
 }
 
+void AbstractMesh::set_bakedVertexAnimationManager(const BakedVertexAnimationManagerPtr& value)
+{
+  if (_internalAbstractMeshDataInfo._bakedVertexAnimationManager == value) {
+    return;
+  }
+
+  _internalAbstractMeshDataInfo._bakedVertexAnimationManager = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+BakedVertexAnimationManagerPtr& AbstractMesh::get_bakedVertexAnimationManager()
+{
+  return _internalAbstractMeshDataInfo._bakedVertexAnimationManager;
+}
+
 Vector3& AbstractMesh::get_scaling()
 {
   return _scaling;
@@ -1535,12 +1553,11 @@ void AbstractMesh::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
   }
 
   // Skeleton
-  _internalAbstractMeshDataInfo._skeleton = nullptr;
-
-  if (_transformMatrixTexture) {
-    _transformMatrixTexture->dispose();
-    _transformMatrixTexture = nullptr;
+  auto& iSkeleton = _internalAbstractMeshDataInfo._skeleton;
+  if (iSkeleton) {
+    iSkeleton->_unregisterMeshWithPoseMatrix(this);
   }
+  iSkeleton = nullptr;
 
   // Intersections in progress
   for (const auto& other : _intersectionsInProgress) {
@@ -1747,6 +1764,11 @@ AbstractMesh& AbstractMesh::updateFacetData()
   }
   data.facetParameters.depthSortedFacets = data.depthSortedFacets;
   VertexData::ComputeNormals(positions, indices, normals, data.facetParameters);
+  // The parameters hold copies of the facet data arrays
+  data.facetNormals      = std::move(data.facetParameters.facetNormals);
+  data.facetPositions    = std::move(data.facetParameters.facetPositions);
+  data.facetPartitioning = std::move(data.facetParameters.facetPartitioning);
+  data.depthSortedFacets = std::move(data.facetParameters.depthSortedFacets);
 
   if (data.facetDepthSort && data.facetDepthSortEnabled) {
     BABYLON::stl_util::sort_js_style(data.depthSortedFacets, data.facetDepthSortFunction);
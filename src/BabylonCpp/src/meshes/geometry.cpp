@@ -26,6 +26,7 @@ namespace BABYLON {
 Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData, bool updatable,
                    Mesh* mesh)
     : delayLoadState{Constants::DELAYLOADSTATE_NONE}
+    , _softwareSkinningFrameId{-1}
     , boundingBias(this, &Geometry::get_boundingBias, &Geometry::set_boundingBias)
     , meshes(this, &Geometry::get_meshes)
     , extend(this, &Geometry::get_extend)
@@ -281,7 +282,8 @@ void Geometry::_updateBoundingInfo(bool updateExtends, const Float32Array& data)
   }
 }
 
-void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind)
+void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind,
+                     const std::unordered_map<std::string, VertexBufferPtr>& overrideVertexBuffers)
 {
   if (!effect) {
     return;
@@ -297,7 +299,13 @@ void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind)
     return;
   }
 
-  if (indexToBind != _indexBuffer /*|| _vertexArrayObjects.empty()*/) {
+  for (const auto& [kind, vertexBuffer] : overrideVertexBuffers) {
+    if (vertexBuffer) {
+      vbs[kind] = vertexBuffer;
+    }
+  }
+
+  if (indexToBind != _indexBuffer || !overrideVertexBuffers.empty()) {
     _engine->bindBuffers(vbs, indexToBind, effect);
     return;
   }
@@ -41,6 +41,9 @@ InstancedMesh::InstancedMesh(const std::string& iName, const MeshPtr& source)
 
   infiniteDistance = source->infiniteDistance();
 
+  // Instanced buffers start with the values of the source mesh
+  instancedBuffers = source->instancedBuffers;
+
   setPivotMatrix(source->getPivotMatrix());
 
   refreshBoundingInfo();
@@ -3,6 +3,7 @@
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
+#include <babylon/bones/software_skinning.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
@@ -53,6 +54,7 @@
 #include <babylon/meshes/ground_mesh.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/misc/file_tools.h>
@@ -434,12 +436,13 @@ MeshPtr Mesh::getLODLevelAtDistance(float distance)
 Mesh& Mesh::removeLODLevel(const MeshPtr& mesh)
 {
   auto& _LODLevels = _internalMeshDataInfo->_LODLevels;
-  for (const auto& level : _LODLevels) {
-    if (level->mesh == mesh) {
-      stl_util::erase(_LODLevels, level);
-      if (mesh) {
-        mesh->_masterMesh = nullptr;
-      }
+  const auto it    = std::remove_if(
+    _LODLevels.begin(), _LODLevels.end(),
+    [&mesh](const MeshLODLevelPtr& level) { return level->mesh == mesh; });
+  if (it != _LODLevels.end()) {
+    _LODLevels.erase(it, _LODLevels.end());
+    if (mesh) {
+      mesh->_masterMesh = nullptr;
     }
   }
 
@@ -698,6 +701,8 @@ void Mesh::_preActivate()
 
   internalDataInfo._preActivateId        = sceneRenderId;
   _instanceDataStorage->visibleInstances = nullptr;
+
+  _syncCPUMorphTargets();
 }
 
 Mesh* Mesh::_preActivateForIntermediateRendering(int renderId)
@@ -867,6 +872,18 @@ AbstractMesh* Mesh::updateVerticesData(const std::string& kind, const Float32Arr
   if (!_geometry) {
     return this;
   }
+
+  // The data written replaces the data without morphing of the CPU blended morph targets
+  auto& internalDataInfo = *_internalMeshDataInfo;
+  if (internalDataInfo._morphBase && internalDataInfo._sourcePositions.empty()
+      && (kind == VertexBuffer::PositionKind || kind == VertexBuffer::NormalKind
+          || kind == VertexBuffer::TangentKind)) {
+    _restoreCPUMorphTargets(nullptr);
+    internalDataInfo._morphBase          = std::make_shared<_MorphTargetsCPUBase>();
+    internalDataInfo._morphBaseManager   = internalDataInfo._morphTargetManager.get();
+    internalDataInfo._morphBlendingDirty = true;
+  }
+
   if (!makeItUnique) {
     _geometry->updateVerticesData(kind, data, updateExtends);
   }
@@ -924,7 +941,7 @@ AbstractMesh* Mesh::setIndices(const IndicesArray& indices, size_t totalVertices
 
     auto scene = getScene();
 
-    Geometry(Geometry::RandomId(), scene, vertexData.get(), updatable, this);
+    Geometry::New(Geometry::RandomId(), scene, vertexData.get(), updatable, this);
   }
   else {
     _geometry->setIndices(indices, totalVertices, updatable);
@@ -986,7 +1003,12 @@ void Mesh::_bind(SubMesh* subMesh, const EffectPtr& effect, unsigned int fillMod
   }
 
   // VBOs
-  _geometry->_bind(effect, indexToBind);
+  if (instancedBuffers.empty()) {
+    _geometry->_bind(effect, indexToBind);
+  }
+  else {
+    _geometry->_bind(effect, indexToBind, _userInstancedBuffersStorage.vertexBuffers);
+  }
 }
 
 void Mesh::_draw(SubMesh* subMesh, int fillMode, size_t instancesCount, bool /*alternate*/)
@@ -1174,13 +1196,90 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
   return *this;
 }
 
-void Mesh::registerInstancedBuffer(const std::string& /*kind*/, size_t /*stride*/)
+void Mesh::registerInstancedBuffer(const std::string& kind, size_t stride)
 {
+  // Remove existing one
+  removeVerticesData(kind);
+
+  // Creates the instancedBuffer field if not present
+  auto& storage = _userInstancedBuffersStorage;
+  if (!stl_util::contains(instancedBuffers, kind)) {
+    instancedBuffers[kind] = Float32Array(stride, 0.f);
+  }
+  storage.strides[kind] = stride;
+  storage.sizes[kind]   = stride * 32; // Initial size
+  storage.data[kind]    = Float32Array(storage.sizes[kind], 0.f);
+  storage.vertexBuffers[kind] = std::make_shared<VertexBuffer>(
+    getScene()->getEngine(), storage.data[kind], kind, true, false, stride, true);
+
+  for (const auto& instance : instances) {
+    if (!stl_util::contains(instance->instancedBuffers, kind)) {
+      instance->instancedBuffers[kind] = instancedBuffers[kind];
+    }
+  }
+
+  _markSubMeshesAsAttributesDirty();
 }
 
-void Mesh::_processInstancedBuffers(const std::vector<InstancedMesh*>& /*visibleInstances*/,
-                                    bool /*renderSelf*/)
+void Mesh::_processInstancedBuffers(const std::vector<InstancedMesh*>& visibleInstances,
+                                    bool renderSelf)
 {
+  auto& storage            = _userInstancedBuffersStorage;
+  const auto instanceCount = visibleInstances.size() + (renderSelf ? 1 : 0);
+
+  const auto copyValue = [](const Float32Array& value, Float32Array& data, size_t offset,
+                            size_t stride) {
+    const auto count = std::min(value.size(), stride);
+    std::copy(value.begin(), value.begin() + static_cast<std::ptrdiff_t>(count),
+              data.begin() + static_cast<std::ptrdiff_t>(offset));
+    std::fill(data.begin() + static_cast<std::ptrdiff_t>(offset + count),
+              data.begin() + static_cast<std::ptrdiff_t>(offset + stride), 0.f);
+  };
+
+  for (const auto& [kind, value] : instancedBuffers) {
+    if (!stl_util::contains(storage.strides, kind)) {
+      continue;
+    }
+
+    const auto stride       = storage.strides[kind];
+    const auto expectedSize = (instanceCount + 1) * stride;
+    auto size               = std::max(storage.sizes[kind], stride);
+
+    while (size < expectedSize) {
+      size *= 2;
+    }
+
+    auto& data = storage.data[kind];
+    if (data.size() != size) {
+      data                = Float32Array(size, 0.f);
+      storage.sizes[kind] = size;
+      if (storage.vertexBuffers[kind]) {
+        storage.vertexBuffers[kind]->dispose();
+        storage.vertexBuffers[kind] = nullptr;
+      }
+    }
+
+    size_t offset = 0;
+    if (renderSelf) {
+      copyValue(value, data, offset, stride);
+      offset += stride;
+    }
+
+    for (const auto& instance : visibleInstances) {
+      const auto it = instance->instancedBuffers.find(kind);
+      copyValue(it != instance->instancedBuffers.end() ? it->second : value, data, offset, stride);
+      offset += stride;
+    }
+
+    // Update vertex buffer
+    if (!storage.vertexBuffers[kind]) {
+      storage.vertexBuffers[kind] = std::make_shared<VertexBuffer>(
+        getScene()->getEngine(), data, kind, true, false, stride, true);
+    }
+    else {
+      storage.vertexBuffers[kind]->updateDirectly(data, 0);
+    }
+  }
 }
 
 Mesh& Mesh::_processRendering(
@@ -2421,6 +2520,26 @@ Mesh& Mesh::synchronizeInstances()
   return *this;
 }
 
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings, bool parallelProcessing,
+                     SimplificationType simplificationType,
+                     const std::function<void(Mesh* mesh)>& successCallback)
+{
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.simplificationType = simplificationType;
+  task.mesh               = shared_from_base<Mesh>();
+  task.successCallback    = [weakMesh = task.mesh, successCallback]() {
+    // The mesh can be released while its levels are simplified on worker threads
+    auto mesh = weakMesh.lock();
+    if (mesh && successCallback) {
+      successCallback(mesh.get());
+    }
+  };
+  task.parallelProcessing = parallelProcessing;
+  getScene()->simplificationQueue()->addTask(task);
+  return *this;
+}
+
 void Mesh::optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback)
 {
   successCallback(nullptr);
@@ -2503,7 +2622,34 @@ void Mesh::_syncGeometryWithMorphTargetManager()
 
   _markSubMeshesAsAttributesDirty();
 
-  auto iMorphTargetManager = _internalMeshDataInfo->_morphTargetManager;
+  auto& internalDataInfo   = *_internalMeshDataInfo;
+  auto iMorphTargetManager = internalDataInfo._morphTargetManager;
+  const auto cpuBlending   = iMorphTargetManager && iMorphTargetManager->useCPUBlending();
+  if (internalDataInfo._morphBase
+      && (!cpuBlending || internalDataInfo._morphBaseManager != iMorphTargetManager.get())) {
+    // Back to the data without morphing, and to the dense targets for the GPU morphing
+    _restoreCPUMorphTargets(cpuBlending ? nullptr : iMorphTargetManager);
+  }
+
+  if (cpuBlending) {
+    // The targets are blended in the vertex data, the target vertex buffers are removed below
+    if (!internalDataInfo._morphBase) {
+      if (internalDataInfo._sourcePositions.empty()) {
+        // Only used to make the buffers updatable, the moved vertices being written in place
+        setPositionsForCPUSkinning();
+        setNormalsForCPUSkinning();
+        setTangentsForCPUSkinning();
+        internalDataInfo._sourcePositions.clear();
+        internalDataInfo._sourceNormals.clear();
+        internalDataInfo._sourceTangents.clear();
+      }
+      internalDataInfo._morphBase        = std::make_shared<_MorphTargetsCPUBase>();
+      internalDataInfo._morphBaseManager = iMorphTargetManager.get();
+    }
+    internalDataInfo._morphBlendingDirty = true;
+    iMorphTargetManager                  = nullptr;
+  }
+
   if (iMorphTargetManager && iMorphTargetManager->vertexCount()) {
     if (iMorphTargetManager->vertexCount() != getTotalVertices()) {
       BABYLON_LOG_ERROR("Mesh",
@@ -2566,6 +2712,124 @@ void Mesh::_syncGeometryWithMorphTargetManager()
   }
 }
 
+void Mesh::_syncCPUMorphTargets()
+{
+  auto& internalDataInfo     = *_internalMeshDataInfo;
+  const auto& morphTargetMgr = internalDataInfo._morphTargetManager;
+  if (!morphTargetMgr || !morphTargetMgr->useCPUBlending() || !internalDataInfo._morphBase) {
+    return;
+  }
+
+  const auto updateId = morphTargetMgr->_getInfluencesUpdateId();
+  if (!internalDataInfo._morphBlendingDirty
+      && internalDataInfo._morphInfluencesUpdateId == updateId) {
+    return;
+  }
+
+  internalDataInfo._morphBlendingDirty      = false;
+  internalDataInfo._morphInfluencesUpdateId = updateId;
+
+  // A mesh skinned on the CPU is morphed before the skinning, in its source data
+  if (!internalDataInfo._sourcePositions.empty()) {
+    morphTargetMgr->blendOnCPU(*internalDataInfo._morphBase, internalDataInfo._sourcePositions,
+                               internalDataInfo._sourceNormals, internalDataInfo._sourceTangents);
+    if (_geometry) {
+      // Skin again during this frame
+      _geometry->_softwareSkinningFrameId = -1;
+    }
+    return;
+  }
+
+  // Only the moved vertices are written and uploaded
+  auto positionsBuffer = getVertexBuffer(VertexBuffer::PositionKind);
+  auto normalsBuffer   = getVertexBuffer(VertexBuffer::NormalKind);
+  auto tangentsBuffer  = getVertexBuffer(VertexBuffer::TangentKind);
+  if (!positionsBuffer) {
+    return;
+  }
+
+  Float32Array noData;
+  const auto range = morphTargetMgr->blendOnCPU(
+    *internalDataInfo._morphBase, positionsBuffer->getData(),
+    normalsBuffer ? normalsBuffer->getData() : noData,
+    tangentsBuffer ? tangentsBuffer->getData() : noData);
+  _uploadVerticesRange(VertexBuffer::PositionKind, 3, range);
+  _uploadVerticesRange(VertexBuffer::NormalKind, 3, range);
+  _uploadVerticesRange(VertexBuffer::TangentKind, 4, range);
+}
+
+void Mesh::_restoreCPUMorphTargets(const MorphTargetManagerPtr& manager)
+{
+  auto& internalDataInfo = *_internalMeshDataInfo;
+  auto base              = std::move(internalDataInfo._morphBase);
+  internalDataInfo._morphBase          = nullptr;
+  internalDataInfo._morphBaseManager   = nullptr;
+  internalDataInfo._morphBlendingDirty = false;
+  if (!base) {
+    return;
+  }
+
+  // A mesh skinned on the CPU was morphed in its source data
+  if (!internalDataInfo._sourcePositions.empty()) {
+    base->restore(internalDataInfo._sourcePositions, internalDataInfo._sourceNormals,
+                  internalDataInfo._sourceTangents);
+    if (manager) {
+      manager->_decompressTargets(internalDataInfo._sourcePositions,
+                                  internalDataInfo._sourceNormals,
+                                  internalDataInfo._sourceTangents);
+    }
+    if (_geometry) {
+      _geometry->_softwareSkinningFrameId = -1;
+    }
+    return;
+  }
+
+  auto positionsBuffer = getVertexBuffer(VertexBuffer::PositionKind);
+  auto normalsBuffer   = getVertexBuffer(VertexBuffer::NormalKind);
+  auto tangentsBuffer  = getVertexBuffer(VertexBuffer::TangentKind);
+  if (!positionsBuffer) {
+    return;
+  }
+
+  Float32Array noData;
+  auto& positions    = positionsBuffer->getData();
+  auto& normals      = normalsBuffer ? normalsBuffer->getData() : noData;
+  auto& tangents     = tangentsBuffer ? tangentsBuffer->getData() : noData;
+  const auto range   = base->restore(positions, normals, tangents);
+  _uploadVerticesRange(VertexBuffer::PositionKind, 3, range);
+  _uploadVerticesRange(VertexBuffer::NormalKind, 3, range);
+  _uploadVerticesRange(VertexBuffer::TangentKind, 4, range);
+  if (manager) {
+    manager->_decompressTargets(positions, normals, tangents);
+  }
+}
+
+void Mesh::_uploadVerticesRange(const std::string& kind, size_t stride,
+                                const std::pair<size_t, size_t>& range)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer || range.first >= range.second) {
+    return;
+  }
+
+  const auto& data = vertexBuffer->getData();
+  auto& buffer     = vertexBuffer->getBuffer();
+  if (!buffer || !vertexBuffer->isUpdatable() || data.size() < range.second * stride) {
+    return;
+  }
+
+  auto engine = getScene()->getEngine();
+  if (vertexBuffer->byteOffset != 0 || vertexBuffer->byteStride != stride * sizeof(float)) {
+    engine->updateDynamicVertexBuffer(buffer, data);
+    return;
+  }
+
+  const Float32Array vertices(data.begin() + static_cast<long>(range.first * stride),
+                              data.begin() + static_cast<long>(range.second * stride));
+  engine->updateDynamicVertexBuffer(buffer, vertices,
+                                    static_cast<int>(range.first * stride * sizeof(float)));
+}
+
 std::vector<Vector3> Mesh::createInnerPoints(size_t pointsNb)
 {
   const auto& boundInfo = getBoundingInfo();
@@ -3380,6 +3644,24 @@ Float32Array& Mesh::setNormalsForCPUSkinning()
   return internalDataInfo._sourceNormals;
 }
 
+Float32Array& Mesh::setTangentsForCPUSkinning()
+{
+  auto& internalDataInfo = *_internalMeshDataInfo;
+  if (internalDataInfo._sourceTangents.empty()) {
+    auto iSource = getVerticesData(VertexBuffer::TangentKind);
+    if (iSource.empty()) {
+      return internalDataInfo._sourceTangents;
+    }
+
+    internalDataInfo._sourceTangents = iSource;
+
+    if (!isVertexBufferUpdatable(VertexBuffer::TangentKind)) {
+      setVerticesData(VertexBuffer::TangentKind, iSource, true);
+    }
+  }
+  return internalDataInfo._sourceTangents;
+}
+
 Mesh* Mesh::applySkeleton(const SkeletonPtr& iSkeleton)
 {
   if (!_geometry) {
@@ -3417,19 +3699,9 @@ Mesh* Mesh::applySkeleton(const SkeletonPtr& iSkeleton)
     setNormalsForCPUSkinning();
   }
 
-  // positionsData checks for not being Float32Array will only pass at most
-  // once
-  auto positionsData = getVerticesData(VertexBuffer::PositionKind);
-
-  if (positionsData.empty()) {
-    return this;
-  }
-
-  // normalsData checks for not being Float32Array will only pass at most once
-  auto normalsData = getVerticesData(VertexBuffer::NormalKind);
-
-  if (normalsData.empty()) {
-    return this;
+  if (isVerticesDataPresent(VertexBuffer::TangentKind)
+      && internalDataInfo._sourceTangents.empty()) {
+    setTangentsForCPUSkinning();
   }
 
   auto matricesIndicesData = getVerticesData(VertexBuffer::MatricesIndicesKind);
@@ -3444,59 +3716,84 @@ Mesh* Mesh::applySkeleton(const SkeletonPtr& iSkeleton)
     = needExtras ? getVerticesData(VertexBuffer::MatricesIndicesExtraKind) : Float32Array();
   auto matricesWeightsExtraData
     = needExtras ? getVerticesData(VertexBuffer::MatricesWeightsExtraKind) : Float32Array();
+  needExtras = !matricesIndicesExtraData.empty() && !matricesWeightsExtraData.empty();
 
-  auto skeletonMatrices = iSkeleton->getTransformMatrices(this);
-
-  auto tempVector3 = Vector3::Zero();
-  Matrix finalMatrix;
-  Matrix tempMatrix;
-
-  unsigned int matWeightIdx = 0;
-  unsigned int inf;
-  float weight;
-  for (unsigned int index = 0; index < positionsData.size(); index += 3, matWeightIdx += 4) {
-    for (inf = 0; inf < 4; ++inf) {
-      weight = matricesWeightsData[matWeightIdx + inf];
-      if (weight > 0.f) {
-        Matrix::FromFloat32ArrayToRefScaled(
-          skeletonMatrices,
-          static_cast<unsigned int>(std::floor(matricesIndicesData[matWeightIdx + inf] * 16)),
-          weight, tempMatrix);
-        finalMatrix.addToSelf(tempMatrix);
-      }
-    }
-    if (needExtras) {
-      for (inf = 0; inf < 4; ++inf) {
-        weight = matricesWeightsExtraData[matWeightIdx + inf];
-        if (weight > 0.f) {
-          Matrix::FromFloat32ArrayToRefScaled(skeletonMatrices,
-                                              static_cast<unsigned int>(std::floor(
-                                                matricesIndicesExtraData[matWeightIdx + inf] * 16)),
-                                              weight, tempMatrix);
-          finalMatrix.addToSelf(tempMatrix);
-        }
-      }
-    }
+  const auto& sourcePositions = internalDataInfo._sourcePositions;
+  const auto& sourceNormals   = internalDataInfo._sourceNormals;
+  const auto& sourceTangents  = internalDataInfo._sourceTangents;
 
-    Vector3::TransformCoordinatesFromFloatsToRef(
-      internalDataInfo._sourcePositions[index], internalDataInfo._sourcePositions[index + 1],
-      internalDataInfo._sourcePositions[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(positionsData, index);
+  if (sourcePositions.empty() || sourceNormals.empty()) {
+    return this;
+  }
 
-    Vector3::TransformNormalFromFloatsToRef(
-      internalDataInfo._sourceNormals[index], internalDataInfo._sourceNormals[index + 1],
-      internalDataInfo._sourceNormals[index + 2], finalMatrix, tempVector3);
-    tempVector3.toArray(normalsData, index);
+  auto& positionsData = internalDataInfo._skinnedPositions;
+  auto& normalsData   = internalDataInfo._skinnedNormals;
+  auto& tangentsData  = internalDataInfo._skinnedTangents;
+  if (positionsData.size() != sourcePositions.size()) {
+    positionsData = sourcePositions;
+  }
+  if (normalsData.size() != sourceNormals.size()) {
+    normalsData = sourceNormals;
+  }
+  if (tangentsData.size() != sourceTangents.size()) {
+    tangentsData = sourceTangents;
+  }
 
-    finalMatrix.reset();
+  const auto& skeletonMatrices = iSkeleton->getTransformMatrices(this);
+
+  SoftwareSkinningData data;
+  data.matrices        = skeletonMatrices.data();
+  data.matrixCount     = skeletonMatrices.size() / 16;
+  data.matricesIndices = matricesIndicesData.data();
+  data.matricesWeights = matricesWeightsData.data();
+  data.sourcePositions = sourcePositions.data();
+  data.positions       = positionsData.data();
+  data.sourceNormals   = sourceNormals.data();
+  data.normals         = normalsData.data();
+  data.vertexCount     = std::min(
+    std::min(sourcePositions.size(), sourceNormals.size()) / 3,
+    std::min(matricesIndicesData.size(), matricesWeightsData.size()) / 4);
+  if (needExtras) {
+    data.matricesIndicesExtra = matricesIndicesExtraData.data();
+    data.matricesWeightsExtra = matricesWeightsExtraData.data();
+    data.vertexCount          = std::min(
+      data.vertexCount,
+      std::min(matricesIndicesExtraData.size(), matricesWeightsExtraData.size()) / 4);
+  }
+  if (!sourceTangents.empty() && sourceTangents.size() / 4 >= data.vertexCount) {
+    data.sourceTangents = sourceTangents.data();
+    data.tangents       = tangentsData.data();
   }
 
+  SoftwareSkinning::Apply(data);
+
   updateVerticesData(VertexBuffer::PositionKind, positionsData);
   updateVerticesData(VertexBuffer::NormalKind, normalsData);
+  if (data.tangents) {
+    updateVerticesData(VertexBuffer::TangentKind, tangentsData);
+  }
 
   return this;
 }
 
+const Float32Array& Mesh::getSoftwareSkinnedVerticesData(const std::string& kind) const
+{
+  static const Float32Array empty;
+
+  const auto& internalDataInfo = *_internalMeshDataInfo;
+  if (kind == VertexBuffer::PositionKind) {
+    return internalDataInfo._skinnedPositions;
+  }
+  if (kind == VertexBuffer::NormalKind) {
+    return internalDataInfo._skinnedNormals;
+  }
+  if (kind == VertexBuffer::TangentKind) {
+    return internalDataInfo._skinnedTangents;
+  }
+
+  return empty;
+}
+
 MinMax Mesh::GetMinMax(const std::vector<AbstractMeshPtr>& meshes)
 {
   bool minVectorSet = false;
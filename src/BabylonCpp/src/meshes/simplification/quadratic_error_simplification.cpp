@@ -0,0 +1,730 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+#include <babylon/asio/asio.h>
+#include <babylon/asio/internal/sync_callback_runner.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/materials/material.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/isimplification_settings.h>
+#include <babylon/meshes/simplification/quadratic_matrix.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+enum class VertexKind {
+  /** Inside of the surface, can move to any neighbor */
+  Manifold,
+  /** On a border of the surface, can only move along the border */
+  Border,
+  /** On an attribute seam, can only move along the seam with its twin */
+  Seam,
+  /** Can not move */
+  Locked
+};
+
+/** Vertex without open edge, vertex with several open edges */
+constexpr uint32_t NoEdge    = std::numeric_limits<uint32_t>::max();
+constexpr uint32_t ManyEdges = NoEdge - 1;
+
+/** Weight of the planes keeping the borders and the seams in place */
+constexpr float BorderWeight = 10.f;
+
+struct Collapse {
+  float error;
+  uint32_t from;
+  uint32_t to;
+  uint32_t version;
+
+  bool operator<(const Collapse& other) const
+  {
+    // Smallest error on top of the heap
+    return error > other.error;
+  }
+}; // end of struct Collapse
+
+void SetOpenEdge(uint32_t& openEdge, uint32_t vertex)
+{
+  openEdge = (openEdge == NoEdge || openEdge == vertex) ? vertex : ManyEdges;
+}
+
+/** Dot product of the normals of the triangles (p, a, b) and (q, a, b) */
+float NormalsDot(const Vector3& p, const Vector3& q, const Vector3& a, const Vector3& b)
+{
+  const auto pa = a - p;
+  const auto pb = b - p;
+  const auto qa = a - q;
+  const auto qb = b - q;
+  return (pa.y * pb.z - pa.z * pb.y) * (qa.y * qb.z - qa.z * qb.y)
+         + (pa.z * pb.x - pa.x * pb.z) * (qa.z * qb.x - qa.x * qb.z)
+         + (pa.x * pb.y - pa.y * pb.x) * (qa.x * qb.y - qa.y * qb.x);
+}
+
+/**
+ * Half-edge collapses of an indexed triangle list, the vertices being collapsed into one of their
+ * neighbors by increasing error.
+ */
+class EdgeCollapser {
+
+public:
+  EdgeCollapser(const Float32Array& positionData, const IndicesArray& indices)
+      : triangles{indices}, triangleCount{0}, maxError{0.f}
+  {
+    const auto vertexCount = static_cast<uint32_t>(positionData.size() / 3);
+    _rescalePositions(positionData, vertexCount);
+
+    alive.resize(triangles.size() / 3);
+    vertexTriangles.resize(vertexCount);
+    for (uint32_t t = 0; t < alive.size(); ++t) {
+      const auto* triangle = &triangles[3 * t];
+      alive[t] = triangle[0] < vertexCount && triangle[1] < vertexCount
+                 && triangle[2] < vertexCount;
+      if (alive[t]) {
+        for (uint32_t k = 0; k < 3; ++k) {
+          vertexTriangles[triangle[k]].emplace_back(t);
+        }
+      }
+    }
+
+    _weldVertices(positionData, vertexCount);
+
+    // The triangles degenerated by the welding are dropped
+    for (uint32_t t = 0; t < alive.size(); ++t) {
+      if (alive[t] && _isDegenerate(t)) {
+        alive[t] = false;
+      }
+      triangleCount += alive[t] ? 1 : 0;
+    }
+
+    _classifyVertices(vertexCount);
+
+    versions.resize(vertexCount, 0);
+    removed.resize(vertexCount, false);
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+      _pickCollapse(v);
+    }
+  }
+
+  void collapse(size_t targetTriangleCount)
+  {
+    while (triangleCount > targetTriangleCount && !_heap.empty()) {
+      const auto collapse = _heap.top();
+      _heap.pop();
+      // The neighborhood of the vertex changed since the collapse was picked
+      if (removed[collapse.from] || collapse.version != versions[collapse.from]) {
+        continue;
+      }
+      _applyCollapse(collapse);
+    }
+  }
+
+private:
+  void _rescalePositions(const Float32Array& positionData, uint32_t vertexCount)
+  {
+    // The quadrics are computed in the unit cube, keeping them accurate in single precision
+    Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max());
+    Vector3 maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                    std::numeric_limits<float>::lowest());
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+      minimum.minimizeInPlaceFromFloats(positionData[3 * v + 0], positionData[3 * v + 1],
+                                        positionData[3 * v + 2]);
+      maximum.maximizeInPlaceFromFloats(positionData[3 * v + 0], positionData[3 * v + 1],
+                                        positionData[3 * v + 2]);
+    }
+    const auto size   = maximum - minimum;
+    const auto extent = std::max(std::max(size.x, size.y), size.z);
+    const auto scale  = extent > 0.f ? 1.f / extent : 1.f;
+
+    positions.reserve(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+      positions.emplace_back((positionData[3 * v + 0] - minimum.x) * scale,
+                             (positionData[3 * v + 1] - minimum.y) * scale,
+                             (positionData[3 * v + 2] - minimum.z) * scale);
+    }
+  }
+
+  void _weldVertices(const Float32Array& positionData, uint32_t vertexCount)
+  {
+    // The used vertices sharing a position form a ring of wedges, the first one representing the
+    // position
+    remap.resize(vertexCount);
+    wedges.resize(vertexCount);
+    std::vector<uint32_t> order;
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+      remap[v] = wedges[v] = v;
+      if (!vertexTriangles[v].empty()) {
+        order.emplace_back(v);
+      }
+    }
+
+    const auto lessThan = [&positionData](uint32_t a, uint32_t b) {
+      return std::lexicographical_compare(&positionData[3 * a], &positionData[3 * a + 3],
+                                          &positionData[3 * b], &positionData[3 * b + 3]);
+    };
+    std::sort(order.begin(), order.end(), lessThan);
+    for (size_t begin = 0, end = 0; begin < order.size(); begin = end) {
+      for (end = begin + 1; end < order.size() && !lessThan(order[begin], order[end]); ++end) {
+        remap[order[end]] = order[begin];
+      }
+      for (size_t i = begin; i < end; ++i) {
+        wedges[order[i]] = order[i + 1 < end ? i + 1 : begin];
+      }
+    }
+  }
+
+  void _classifyVertices(uint32_t vertexCount)
+  {
+    quadrics.resize(vertexCount);
+    weights.resize(vertexCount, 0.0);
+    openInc.resize(vertexCount, NoEdge);
+    openOut.resize(vertexCount, NoEdge);
+    for (uint32_t t = 0; t < alive.size(); ++t) {
+      if (!alive[t]) {
+        continue;
+      }
+      const auto* triangle = &triangles[3 * t];
+      const auto& p0       = positions[triangle[0]];
+      auto normal = Vector3::Cross(positions[triangle[1]] - p0, positions[triangle[2]] - p0);
+      const auto length = normal.length();
+      if (length > 0.f) {
+        normal.scaleInPlace(1.f / length);
+        for (uint32_t k = 0; k < 3; ++k) {
+          _addPlane(remap[triangle[k]], normal, -Vector3::Dot(normal, p0), 0.5f * length);
+          weights[remap[triangle[k]]] += 0.5f * length;
+        }
+      }
+
+      // The edges without opposite edge are the borders of the surface and the seams, the
+      // vertices of a seam having the same position but different indices on both sides
+      for (uint32_t k = 0; k < 3; ++k) {
+        const auto from = triangle[k];
+        const auto to   = triangle[(k + 1) % 3];
+        if (_hasEdge(to, from)) {
+          continue;
+        }
+        SetOpenEdge(openOut[from], to);
+        SetOpenEdge(openInc[to], from);
+
+        // Plane containing the open edge and perpendicular to the triangle
+        const auto edge       = positions[to] - positions[from];
+        auto edgeNormal       = Vector3::Cross(edge, normal);
+        const auto edgeLength = edge.length();
+        if (length > 0.f && edgeNormal.length() > 0.f) {
+          edgeNormal.normalize();
+          const auto d = -Vector3::Dot(edgeNormal, positions[from]);
+          _addPlane(remap[from], edgeNormal, d, edgeLength * BorderWeight);
+          _addPlane(remap[to], edgeNormal, d, edgeLength * BorderWeight);
+        }
+      }
+    }
+
+    kinds.resize(vertexCount, VertexKind::Locked);
+    const auto isSingleEdge = [](uint32_t edge) { return edge < ManyEdges; };
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+      const auto w = wedges[v];
+      if (vertexTriangles[v].empty()) {
+        continue;
+      }
+      if (w == v) {
+        if (openInc[v] == NoEdge && openOut[v] == NoEdge) {
+          kinds[v] = VertexKind::Manifold;
+        }
+        else if (isSingleEdge(openInc[v]) && isSingleEdge(openOut[v])) {
+          kinds[v] = VertexKind::Border;
+        }
+      }
+      else if (wedges[w] == v && isSingleEdge(openInc[v]) && isSingleEdge(openOut[v])
+               && isSingleEdge(openInc[w]) && isSingleEdge(openOut[w])
+               && remap[openInc[v]] == remap[openOut[w]]
+               && remap[openOut[v]] == remap[openInc[w]]) {
+        kinds[v] = VertexKind::Seam;
+      }
+    }
+  }
+
+  void _addPlane(uint32_t position, const Vector3& normal, float d, float weight)
+  {
+    auto data = QuadraticMatrix::DataFromNumbers(normal.x, normal.y, normal.z, d);
+    for (auto& value : data) {
+      value *= weight;
+    }
+    quadrics[position].addArrayInPlace(data);
+  }
+
+  bool _hasEdge(uint32_t from, uint32_t to) const
+  {
+    for (auto t : vertexTriangles[from]) {
+      const auto* triangle = &triangles[3 * t];
+      const auto k         = triangle[0] == from ? 0u : triangle[1] == from ? 1u : 2u;
+      if (alive[t] && triangle[(k + 1) % 3] == to) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool _isDegenerate(uint32_t t) const
+  {
+    const auto* triangle = &triangles[3 * t];
+    return remap[triangle[0]] == remap[triangle[1]] || remap[triangle[1]] == remap[triangle[2]]
+           || remap[triangle[2]] == remap[triangle[0]];
+  }
+
+  float _collapseError(uint32_t from, uint32_t to) const
+  {
+    auto quadric = quadrics[remap[from]];
+    quadric.addInPlace(quadrics[remap[to]]);
+    const auto& position = positions[to];
+    const auto weight    = weights[remap[from]] + weights[remap[to]];
+    const auto error     = quadric.evaluate(position.x, position.y, position.z);
+    return static_cast<float>(std::max(error, 0.0) / (weight > 0.0 ? weight : 1.0));
+  }
+
+  uint32_t _twinTarget(uint32_t from, uint32_t to) const
+  {
+    // The seam runs the other way on the side of the twin
+    const auto twin = wedges[from];
+    return to == openOut[from] ? openInc[twin] : openOut[twin];
+  }
+
+  bool _flipsTriangle(uint32_t from, uint32_t to) const
+  {
+    const auto& source = positions[from];
+    const auto& target = positions[to];
+    for (auto t : vertexTriangles[from]) {
+      if (!alive[t]) {
+        continue;
+      }
+      const auto* triangle = &triangles[3 * t];
+      // The triangles of the collapsed edge disappear
+      if (remap[triangle[0]] == remap[to] || remap[triangle[1]] == remap[to]
+          || remap[triangle[2]] == remap[to]) {
+        continue;
+      }
+      const auto k  = triangle[0] == from ? 0u : triangle[1] == from ? 1u : 2u;
+      const auto& a = positions[triangle[(k + 1) % 3]];
+      const auto& b = positions[triangle[(k + 2) % 3]];
+      if (NormalsDot(source, target, a, b) <= 0.f) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t _countTriangles(uint32_t v) const
+  {
+    return static_cast<size_t>(std::count_if(vertexTriangles[v].begin(), vertexTriangles[v].end(),
+                                              [this](uint32_t t) { return alive[t]; }));
+  }
+
+  void _pickCollapse(uint32_t v)
+  {
+    ++versions[v];
+    const auto kind = kinds[v];
+    if (removed[v] || kind == VertexKind::Locked) {
+      return;
+    }
+    // A border vertex with a single triangle would leave a dangling border edge
+    if (kind != VertexKind::Manifold
+        && (_countTriangles(v) < 2
+            || (kind == VertexKind::Seam && _countTriangles(wedges[v]) < 2))) {
+      return;
+    }
+
+    _candidates.clear();
+    const auto consider = [&](uint32_t to) {
+      if (to < ManyEdges && remap[to] != remap[v]) {
+        _candidates.emplace_back(Collapse{_collapseError(v, to), v, to, versions[v]});
+      }
+    };
+
+    if (kind == VertexKind::Manifold) {
+      // Each neighbor follows the vertex in one of the triangles around it
+      for (auto t : vertexTriangles[v]) {
+        if (alive[t]) {
+          const auto* triangle = &triangles[3 * t];
+          consider(triangle[0] == v ? triangle[1] : triangle[1] == v ? triangle[2] : triangle[0]);
+        }
+      }
+    }
+    else {
+      consider(openOut[v]);
+      consider(openInc[v]);
+    }
+
+    // The flips are only checked from the smallest error until a valid collapse is found
+    std::sort(_candidates.begin(), _candidates.end(),
+              [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+    for (const auto& candidate : _candidates) {
+      if (_isValidCollapse(candidate)) {
+        _heap.push(candidate);
+        return;
+      }
+    }
+  }
+
+  bool _isValidCollapse(const Collapse& collapse) const
+  {
+    if (_flipsTriangle(collapse.from, collapse.to)) {
+      return false;
+    }
+    if (kinds[collapse.from] != VertexKind::Seam) {
+      return true;
+    }
+    const auto twinTo = _twinTarget(collapse.from, collapse.to);
+    return twinTo < ManyEdges && remap[twinTo] == remap[collapse.to]
+           && !_flipsTriangle(wedges[collapse.from], twinTo);
+  }
+
+  void _updateOpenEdges(uint32_t from, uint32_t to)
+  {
+    const auto previous = openInc[from];
+    const auto next     = openOut[from];
+    if (to == next) {
+      if (previous < ManyEdges) {
+        openOut[previous] = to;
+      }
+      openInc[to] = previous;
+    }
+    else {
+      if (next < ManyEdges) {
+        openInc[next] = to;
+      }
+      openOut[to] = next;
+    }
+    _affected.emplace_back(previous);
+    _affected.emplace_back(next);
+  }
+
+  void _moveVertex(uint32_t from, uint32_t to)
+  {
+    for (auto t : vertexTriangles[from]) {
+      if (!alive[t]) {
+        continue;
+      }
+      auto* triangle = &triangles[3 * t];
+      std::replace(triangle, triangle + 3, from, to);
+      if (_isDegenerate(t)) {
+        alive[t] = false;
+        --triangleCount;
+      }
+      else {
+        vertexTriangles[to].emplace_back(t);
+      }
+    }
+    vertexTriangles[from].clear();
+    removed[from] = true;
+
+    auto& toTriangles = vertexTriangles[to];
+    toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+                                     [this](uint32_t t) { return !alive[t]; }),
+                      toTriangles.end());
+    _affected.emplace_back(to);
+  }
+
+  void _applyCollapse(const Collapse& collapse)
+  {
+    const auto from = collapse.from;
+    const auto to   = collapse.to;
+    const auto kind = kinds[from];
+
+    _affected.clear();
+    quadrics[remap[to]].addInPlace(quadrics[remap[from]]);
+    weights[remap[to]] += weights[remap[from]];
+    if (kind == VertexKind::Seam) {
+      const auto twinFrom = wedges[from];
+      const auto twinTo   = _twinTarget(from, to);
+      _updateOpenEdges(from, to);
+      _updateOpenEdges(twinFrom, twinTo);
+      _moveVertex(from, to);
+      _moveVertex(twinFrom, twinTo);
+    }
+    else {
+      if (kind == VertexKind::Border) {
+        _updateOpenEdges(from, to);
+      }
+      _moveVertex(from, to);
+    }
+    maxError = std::max(maxError, collapse.error);
+
+    // The errors and the flips of the neighbors and of their twins changed
+    const auto moved = _affected;
+    for (auto v : moved) {
+      if (v < ManyEdges) {
+        for (auto t : vertexTriangles[v]) {
+          if (alive[t]) {
+            _affected.insert(_affected.end(), &triangles[3 * t], &triangles[3 * t + 3]);
+          }
+        }
+      }
+    }
+    const auto neighbors = _affected.size();
+    for (size_t i = 0; i < neighbors; ++i) {
+      const auto v = _affected[i];
+      if (v < ManyEdges && kinds[v] == VertexKind::Seam) {
+        _affected.emplace_back(wedges[v]);
+      }
+    }
+    std::sort(_affected.begin(), _affected.end());
+    _affected.erase(std::unique(_affected.begin(), _affected.end()), _affected.end());
+    for (auto v : _affected) {
+      if (v < ManyEdges && !removed[v]) {
+        _pickCollapse(v);
+      }
+    }
+  }
+
+public:
+  std::vector<Vector3> positions;
+  IndicesArray triangles;
+  std::vector<uint8_t> alive;
+  size_t triangleCount;
+  std::vector<uint32_t> remap;
+  std::vector<uint32_t> wedges;
+  std::vector<VertexKind> kinds;
+  std::vector<uint32_t> openInc;
+  std::vector<uint32_t> openOut;
+  std::vector<std::vector<uint32_t>> vertexTriangles;
+  std::vector<QuadraticMatrix> quadrics;
+  std::vector<double> weights;
+  std::vector<uint32_t> versions;
+  std::vector<uint8_t> removed;
+  float maxError;
+
+private:
+  std::priority_queue<Collapse> _heap;
+  std::vector<uint32_t> _affected;
+  std::vector<Collapse> _candidates;
+
+}; // end of class EdgeCollapser
+
+} // end of anonymous namespace
+
+struct QuadraticErrorSimplification::SourceData {
+  IndicesArray indices;
+  std::vector<size_t> indexCounts;
+  std::vector<unsigned int> materialIndices;
+  Float32Array positions;
+  std::vector<std::pair<std::string, Float32Array>> vertexData;
+}; // end of struct QuadraticErrorSimplification::SourceData
+
+struct QuadraticErrorSimplification::SimplifiedData {
+  IndicesArray indices;
+  std::vector<size_t> indexCounts;
+  std::vector<unsigned int> materialIndices;
+  size_t vertexCount = 0;
+  std::vector<std::pair<std::string, Float32Array>> vertexData;
+}; // end of struct QuadraticErrorSimplification::SimplifiedData
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : _mesh{mesh ? mesh->shared_from_base<Mesh>() : nullptr}, _sourceData{nullptr}
+{
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification() = default;
+
+QuadraticErrorSimplificationResult
+QuadraticErrorSimplification::SimplifyIndices(const Float32Array& positions,
+                                              const IndicesArray& indices, float quality,
+                                              const std::vector<size_t>& indexCounts)
+{
+  QuadraticErrorSimplificationResult result;
+  result.sourceTriangleCount = indices.size() / 3;
+  if (indexCounts.empty()) {
+    result.indexCounts = {indices.size() - indices.size() % 3};
+  }
+  else {
+    result.indexCounts = indexCounts;
+  }
+
+  EdgeCollapser collapser(positions, indices);
+  const auto targetTriangleCount = static_cast<size_t>(
+    std::ceil(std::clamp(quality, 0.f, 1.f) * static_cast<float>(result.sourceTriangleCount)));
+  collapser.collapse(targetTriangleCount);
+
+  // The remaining triangles keep their order and their range
+  result.indices.reserve(3 * collapser.triangleCount);
+  size_t start = 0;
+  for (auto& indexCount : result.indexCounts) {
+    const auto end = std::min(start + indexCount, indices.size());
+    indexCount     = 0;
+    for (auto t = start / 3; t < end / 3; ++t) {
+      if (collapser.alive[t]) {
+        result.indices.insert(result.indices.end(), &collapser.triangles[3 * t],
+                              &collapser.triangles[3 * t + 3]);
+        indexCount += 3;
+      }
+    }
+    start = end;
+  }
+  result.triangleCount = result.indices.size() / 3;
+  result.error         = std::sqrt(collapser.maxError);
+
+  return result;
+}
+
+std::shared_ptr<const QuadraticErrorSimplification::SourceData>
+QuadraticErrorSimplification::_getSourceData()
+{
+  if (_sourceData) {
+    return _sourceData;
+  }
+
+  auto mesh = _mesh.lock();
+  if (!mesh || mesh->isDisposed()) {
+    return nullptr;
+  }
+
+  auto source            = std::make_shared<SourceData>();
+  source->positions      = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto vertexCount = source->positions.size() / 3;
+  auto indices           = mesh->getIndices();
+  if (vertexCount == 0) {
+    return nullptr;
+  }
+  if (indices.empty()) {
+    indices.resize(vertexCount - vertexCount % 3);
+    std::iota(indices.begin(), indices.end(), 0u);
+  }
+
+  // The submeshes are simplified together, each one keeping its triangles
+  if (mesh->subMeshes.empty()) {
+    source->indices = indices;
+    source->indexCounts.emplace_back(indices.size());
+    source->materialIndices.emplace_back(0u);
+  }
+  for (const auto& subMesh : mesh->subMeshes) {
+    const auto start = std::min(static_cast<size_t>(subMesh->indexStart), indices.size());
+    const auto end   = std::min(start + subMesh->indexCount, indices.size());
+    source->indices.insert(source->indices.end(), indices.begin() + start, indices.begin() + end);
+    source->indexCounts.emplace_back(end - start);
+    source->materialIndices.emplace_back(subMesh->materialIndex);
+  }
+
+  for (const auto& kind : mesh->getVerticesDataKinds()) {
+    auto data = mesh->getVerticesData(kind);
+    if (!data.empty() && data.size() % vertexCount == 0) {
+      source->vertexData.emplace_back(kind, std::move(data));
+    }
+  }
+
+  _sourceData = source;
+  return _sourceData;
+}
+
+std::shared_ptr<QuadraticErrorSimplification::SimplifiedData>
+QuadraticErrorSimplification::_simplify(const SourceData& source, float quality)
+{
+  auto result = SimplifyIndices(source.positions, source.indices, quality, source.indexCounts);
+
+  // The vertices are renumbered by first use, the unused ones being dropped
+  const auto vertexCount = source.positions.size() / 3;
+  std::vector<uint32_t> newIndices(vertexCount, NoEdge);
+  std::vector<uint32_t> sourceVertices;
+  auto simplified = std::make_shared<SimplifiedData>();
+  simplified->indices.reserve(result.indices.size());
+  for (auto index : result.indices) {
+    if (newIndices[index] == NoEdge) {
+      newIndices[index] = static_cast<uint32_t>(sourceVertices.size());
+      sourceVertices.emplace_back(index);
+    }
+    simplified->indices.emplace_back(newIndices[index]);
+  }
+  simplified->indexCounts     = std::move(result.indexCounts);
+  simplified->materialIndices = source.materialIndices;
+  simplified->vertexCount     = sourceVertices.size();
+
+  for (const auto& [kind, data] : source.vertexData) {
+    const auto stride = data.size() / vertexCount;
+    Float32Array newData;
+    newData.reserve(sourceVertices.size() * stride);
+    for (auto v : sourceVertices) {
+      newData.insert(newData.end(), data.begin() + v * stride, data.begin() + (v + 1) * stride);
+    }
+    simplified->vertexData.emplace_back(kind, std::move(newData));
+  }
+
+  return simplified;
+}
+
+MeshPtr QuadraticErrorSimplification::_reconstructMesh(Mesh& mesh,
+                                                       const SimplifiedData& simplified)
+{
+  if (simplified.indices.empty()) {
+    return nullptr;
+  }
+
+  auto newMesh      = Mesh::New(mesh.name + "Decimated", mesh.getScene());
+  newMesh->material = mesh.material();
+  newMesh->parent   = mesh.parent();
+  newMesh->setIndices(simplified.indices, simplified.vertexCount);
+  for (const auto& [kind, data] : simplified.vertexData) {
+    newMesh->setVerticesData(kind, data, false, data.size() / simplified.vertexCount);
+  }
+
+  newMesh->releaseSubMeshes();
+  size_t start = 0;
+  for (size_t i = 0; i < simplified.indexCounts.size(); ++i) {
+    const auto indexCount = simplified.indexCounts[i];
+    if (indexCount > 0) {
+      SubMesh::CreateFromIndices(simplified.materialIndices[i], static_cast<unsigned>(start),
+                                 indexCount, newMesh);
+    }
+    start += indexCount;
+  }
+
+  // Shown when added as LOD level
+  newMesh->isVisible = false;
+  return newMesh;
+}
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+{
+  // The optimizeMesh setting is not needed, the vertices sharing a position being welded
+  auto source = _getSourceData();
+  if (!source || source->indices.empty()) {
+    if (successCallback) {
+      successCallback(nullptr);
+    }
+    return;
+  }
+
+  const auto quality      = settings.quality;
+  const auto onSimplified = [mesh = _mesh, successCallback](const SimplifiedData& simplified) {
+    auto sourceMesh = mesh.lock();
+    MeshPtr newMesh = nullptr;
+    if (sourceMesh && !sourceMesh->isDisposed()) {
+      newMesh = _reconstructMesh(*sourceMesh, simplified);
+    }
+    if (successCallback) {
+      successCallback(newMesh);
+    }
+  };
+
+  auto& threadPool = ThreadPool::Default();
+  if (threadPool.size() == 0 || asio::IsAsyncDisabled()) {
+    onSimplified(*_simplify(*source, quality));
+    return;
+  }
+
+  // The source data is read only, shared by the levels simplified in parallel
+  threadPool.enqueue([source, quality, onSimplified]() {
+    auto simplified = _simplify(*source, quality);
+    asio::sync_callback_runner::PushCallback(
+      [simplified, onSimplified]() { onSimplified(*simplified); });
+  });
+}
+
+} // end of namespace BABYLON
@@ -1,5 +1,7 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 #include <babylon/meshes/simplification/simplification_settings.h>
 
 namespace BABYLON {
@@ -18,8 +20,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running   = true;
+    auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -28,18 +30,87 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
+  auto simplifier = getSimplifier(task);
+  auto sharedTask = std::make_shared<const ISimplificationTask>(task);
+  if (!simplifier || task.settings.empty()) {
+    _endSimplification(*sharedTask);
+    return;
+  }
+
+  if (task.parallelProcessing) {
+    // All the levels are simplified at the same time on the worker threads
+    auto remaining = std::make_shared<size_t>(task.settings.size());
+    for (const auto& setting : task.settings) {
+      simplifier->simplify(setting, [weakQueue = weak_from_this(), sharedTask, setting,
+                                     remaining](const MeshPtr& newMesh) {
+        auto queue = weakQueue.lock();
+        if (!queue) {
+          return;
+        }
+        queue->_addLODLevel(*sharedTask, setting, newMesh);
+        if (--(*remaining) == 0) {
+          queue->_endSimplification(*sharedTask);
+        }
+      });
+    }
+  }
+  else {
+    _simplifyLevel(simplifier, sharedTask, 0);
+  }
+}
+
+void SimplificationQueue::_simplifyLevel(const std::shared_ptr<ISimplifier>& simplifier,
+                                         const std::shared_ptr<const ISimplificationTask>& task,
+                                         size_t index)
+{
+  if (index == task->settings.size()) {
+    _endSimplification(*task);
+    return;
+  }
+
+  // The next level is simplified once the previous one is added
+  simplifier->simplify(task->settings[index], [weakQueue = weak_from_this(), simplifier, task,
+                                                index](const MeshPtr& newMesh) {
+    if (auto queue = weakQueue.lock()) {
+      queue->_addLODLevel(*task, task->settings[index], newMesh);
+      queue->_simplifyLevel(simplifier, task, index + 1);
+    }
+  });
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+void SimplificationQueue::_addLODLevel(const ISimplificationTask& task,
+                                       const ISimplificationSettings& setting,
+                                       const MeshPtr& simplifiedMesh)
 {
+  // The simplified mesh is null if the mesh was disposed in the meantime
+  auto mesh = task.mesh.lock();
+  if (mesh && simplifiedMesh) {
+    mesh->addLODLevel(setting.distance, simplifiedMesh);
+    simplifiedMesh->isVisible = true;
+  }
+}
+
+void SimplificationQueue::_endSimplification(const ISimplificationTask& task)
+{
+  if (task.successCallback) {
+    task.successCallback();
+  }
+  executeNext();
+}
+
+std::shared_ptr<ISimplifier> SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+{
+  auto mesh = task.mesh.lock();
+  if (!mesh) {
+    return nullptr;
+  }
+
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_shared<QuadraticErrorSimplification>(mesh.get());
   }
 }
 
@@ -3256,6 +3256,18 @@ std::unique_ptr<VertexData> VertexData::CreateTorusKnot(TorusKnotOptions& option
 
 void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
                                 Float32Array& normals, std::optional<FacetParameters> options)
+{
+  _ComputeNormals(positions, indices, normals, options ? &(*options) : nullptr);
+}
+
+void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
+                                Float32Array& normals, FacetParameters& options)
+{
+  _ComputeNormals(positions, indices, normals, &options);
+}
+
+void VertexData::_ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
+                                 Float32Array& normals, FacetParameters* options)
 {
   if (normals.size() < positions.size()) {
     normals.resize(positions.size());
@@ -0,0 +1,148 @@
+#include <babylon/misc/depth_sorter.h>
+
+#include <limits>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr unsigned int RadixBits    = 11;
+constexpr uint32_t RadixBucketCount = 1u << RadixBits;
+constexpr uint32_t RadixMask        = RadixBucketCount - 1;
+constexpr unsigned int RadixPasses  = 3;
+
+// Below this number of items the insertion sort is always used
+constexpr size_t SmallSortCount = 64;
+
+inline uint32_t KeyOf(uint64_t item)
+{
+  return static_cast<uint32_t>(item >> 32);
+}
+
+} // end of anonymous namespace
+
+DepthSorter::DepthSorter()
+    : incremental{true}, maxIncrementalMoveRatio{0.5f}, _lastSortWasIncremental{false}
+{
+}
+
+DepthSorter::~DepthSorter() = default;
+
+const std::vector<uint32_t>& DepthSorter::sort(const float* depths, size_t count, bool descending)
+{
+  return sort(count, [depths](size_t i) { return depths[i]; }, descending);
+}
+
+const std::vector<uint32_t>& DepthSorter::order() const
+{
+  return _order;
+}
+
+bool DepthSorter::lastSortWasIncremental() const
+{
+  return _lastSortWasIncremental;
+}
+
+void DepthSorter::reset()
+{
+  _order.clear();
+}
+
+const std::vector<uint32_t>& DepthSorter::_sortKeys()
+{
+  const auto count       = _keys.size();
+  const auto usePrevious = incremental && _order.size() == count;
+
+  _items.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    const auto index = usePrevious ? _order[i] : static_cast<uint32_t>(i);
+    _items[i]        = (static_cast<uint64_t>(_keys[index]) << 32) | index;
+  }
+
+  auto sorted = false;
+  if (count < SmallSortCount) {
+    sorted = _insertionSort(std::numeric_limits<size_t>::max());
+  }
+  else if (usePrevious) {
+    sorted = _insertionSort(static_cast<size_t>(maxIncrementalMoveRatio * count));
+  }
+  _lastSortWasIncremental = sorted && usePrevious;
+
+  if (!sorted) {
+    _radixSort();
+  }
+
+  _order.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    _order[i] = static_cast<uint32_t>(_items[i]);
+  }
+
+  return _order;
+}
+
+bool DepthSorter::_insertionSort(size_t maxMoves)
+{
+  size_t moves = 0;
+  for (size_t i = 1; i < _items.size(); ++i) {
+    const auto item = _items[i];
+    const auto key  = KeyOf(item);
+    auto j          = i;
+    while (j > 0 && KeyOf(_items[j - 1]) > key) {
+      _items[j] = _items[j - 1];
+      --j;
+    }
+    _items[j] = item;
+
+    moves += i - j;
+    if (moves > maxMoves) {
+      // The partially sorted items are left for the radix sort, which does not need any order
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void DepthSorter::_radixSort()
+{
+  const auto count = _items.size();
+
+  // Histograms of the 3 digits, computed in a single pass
+  _histograms.assign(RadixPasses * RadixBucketCount, 0);
+  auto* histograms = _histograms.data();
+  for (const auto item : _items) {
+    const auto key = KeyOf(item);
+    ++histograms[key & RadixMask];
+    ++histograms[RadixBucketCount + ((key >> RadixBits) & RadixMask)];
+    ++histograms[2 * RadixBucketCount + (key >> (2 * RadixBits))];
+  }
+
+  _buffer.resize(count);
+  for (unsigned int pass = 0; pass < RadixPasses; ++pass) {
+    auto* histogram    = histograms + pass * RadixBucketCount;
+    const auto shift   = 32 + pass * RadixBits;
+    const auto digitOf = [shift](uint64_t item) {
+      return static_cast<uint32_t>(item >> shift) & RadixMask;
+    };
+
+    // Skip the pass when all the keys share its digit
+    if (histogram[digitOf(_items[0])] == count) {
+      continue;
+    }
+
+    // Offsets of the buckets
+    uint32_t offset = 0;
+    for (uint32_t bucket = 0; bucket < RadixBucketCount; ++bucket) {
+      const auto bucketCount = histogram[bucket];
+      histogram[bucket]      = offset;
+      offset += bucketCount;
+    }
+
+    for (const auto item : _items) {
+      _buffer[histogram[digitOf(item)]++] = item;
+    }
+    _items.swap(_buffer);
+  }
+}
+
+} // end of namespace BABYLON
@@ -36,7 +36,9 @@
 #include <babylon/core/logging.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/loading/progress_event.h>
+#include <babylon/misc/pixel_tools.h>
 #include <babylon/misc/string_tools.h>
+#include <babylon/misc/texture_decode_pool.h>
 #include <babylon/utils/base64.h>
 
 #include <stdexcept>
@@ -64,9 +66,12 @@ void FileTools::LoadImageFromUrl(
 
   std::string filename = url;
 
+  // Decode on a worker thread, only the upload remains to be done on the main thread
   auto onArrayBufferReceived = [=](const ArrayBuffer& buffer) {
-    auto image = ArrayBufferToImage(buffer, flipVertically);
-    onLoad(image);
+    TextureDecodeOptions options;
+    options.flipVertically = flipVertically;
+    TextureDecodePool::Default().decodeAsync(
+      buffer, options, [onLoad](const DecodedImage& decoded) { onLoad(decoded.image); });
   };
   auto onErrorWrapper = [=](const std::string& errorMessage) { onError(errorMessage, ""); };
 
@@ -110,22 +115,10 @@ Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertical
   if (buffer.empty()) {
     return Image();
   }
-  auto bufferSize = static_cast<int>(buffer.size());
-  int w = -1, h = -1, n = -1;
-  int req_comp = STBI_rgb_alpha;
 
-  stbi_set_flip_vertically_on_load(flipVertically);
-  unsigned char* ucharBuffer
-    = stbi_load_from_memory(buffer.data(), bufferSize, &w, &h, &n, req_comp);
-  stbi_set_flip_vertically_on_load(false);
-
-  if (!ucharBuffer)
-    return Image();
-
-  n = STBI_rgb_alpha;
-  Image image(ucharBuffer, w * h * n, w, h, n, (n == 3) ? GL::RGB : GL::RGBA);
-  stbi_image_free(ucharBuffer);
-  return image;
+  TextureDecodeOptions options;
+  options.flipVertically = flipVertically;
+  return TextureDecodePool::Decode(buffer, options).image;
 }
 
 Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
@@ -248,8 +241,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
     req_comp = 4;
     int bits = 8;
 
-    stbi_set_flip_vertically_on_load(flipVertically);
-
     // It is possible that the image we want to load is a 16bit per channel
     // image We are going to attempt to load it as 16bit per channel, and if it
     // worked, set the image data accodingly. We are casting the returned
@@ -281,8 +272,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
       return false;
     }
 
-    stbi_set_flip_vertically_on_load(false);
-
     if ((w < 1) || (h < 1)) {
       stbi_image_free(data);
       BABYLON_LOG_ERROR("StringToImage", "Invalid image data for image")
@@ -305,6 +294,12 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
       }
     }
 
+    // Flipped after the decoding, the global flip flag of stb_image is not thread-safe
+    if (flipVertically) {
+      PixelTools::FlipVertically(data, static_cast<size_t>(w * req_comp * (bits / 8)),
+                                 static_cast<size_t>(h));
+    }
+
     image.width  = w;
     image.height = h;
     image.depth  = req_comp;
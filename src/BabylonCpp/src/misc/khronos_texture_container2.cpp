@@ -0,0 +1,698 @@
+#include <babylon/misc/khronos_texture_container2.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include <babylon/asio/asio.h>
+#include <babylon/asio/internal/sync_callback_runner.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/constants.h>
+#include <babylon/engines/engine_capabilities.h>
+#include <babylon/engines/thin_engine.h>
+#include <babylon/materials/textures/internal_texture.h>
+
+namespace BABYLON {
+
+namespace {
+
+// '«', 'K', 'T', 'X', ' ', '2', '0', '»', '\r', '\n', '\x1A', '\n'
+constexpr uint8_t KTX2_IDENTIFIER[12]
+  = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+// identifier + header elements + supercompression global data offsets
+constexpr size_t KTX2_HEADER_LEN      = 12 + (13 * 4) + (2 * 8);
+constexpr size_t KTX2_LEVEL_INDEX_LEN = 3 * 8;
+
+// Data format descriptor color models
+constexpr uint8_t KHR_DF_MODEL_ETC1S = 163;
+constexpr uint8_t KHR_DF_MODEL_UASTC = 166;
+// Data format descriptor channel ids
+constexpr uint8_t KHR_DF_CHANNEL_ETC1S_AAA  = 15;
+constexpr uint8_t KHR_DF_CHANNEL_UASTC_RGBA = 3;
+constexpr uint8_t KHR_DF_CHANNEL_UASTC_RRRG = 5;
+// Data format descriptor transfer functions
+constexpr uint8_t KHR_DF_TRANSFER_SRGB = 2;
+
+struct KTX2Level {
+  uint64_t byteOffset             = 0;
+  uint64_t byteLength             = 0;
+  uint64_t uncompressedByteLength = 0;
+}; // end of struct KTX2Level
+
+struct KTX2FileInfo {
+  uint32_t vkFormat               = 0;
+  uint32_t pixelWidth             = 0;
+  uint32_t pixelHeight            = 0;
+  uint32_t supercompressionScheme = 0;
+  uint64_t sgdByteOffset          = 0;
+  uint64_t sgdByteLength          = 0;
+  std::vector<KTX2Level> levels;
+  uint8_t colorModel  = 0;
+  bool hasAlpha       = false;
+  bool isInGammaSpace = false;
+  std::string errorMessage;
+}; // end of struct KTX2FileInfo
+
+// Formats which can be uploaded as stored in the file
+struct KTX2VkFormat {
+  uint32_t vkFormat;
+  unsigned int internalFormat;
+  bool isCompressed;
+  bool hasAlpha;
+  bool isInGammaSpace;
+}; // end of struct KTX2VkFormat
+
+// vkFormat, internal format, is compressed, has alpha, is in gamma space
+constexpr KTX2VkFormat KTX2_VK_FORMATS[] = {
+  {37, Constants::TEXTUREFORMAT_RGBA, false, true, false}, // R8G8B8A8_UNORM
+  {43, Constants::TEXTUREFORMAT_RGBA, false, true, true}, // R8G8B8A8_SRGB
+  {131, Constants::TEXTUREFORMAT_COMPRESSED_RGB_S3TC_DXT1, true, false, false}, // BC1_RGB_UNORM
+  {132, Constants::TEXTUREFORMAT_COMPRESSED_RGB_S3TC_DXT1, true, false, true}, // BC1_RGB_SRGB
+  {137, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT5, true, true, false}, // BC3_UNORM
+  {138, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT5, true, true, true}, // BC3_SRGB
+  {145, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM, true, true, false}, // BC7_UNORM
+  {146, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM, true, true, true}, // BC7_SRGB
+  {147, Constants::TEXTUREFORMAT_COMPRESSED_RGB8_ETC2, true, false, false}, // ETC2_R8G8B8
+  {148, Constants::TEXTUREFORMAT_COMPRESSED_RGB8_ETC2, true, false, true}, // ETC2 sRGB
+  {151, Constants::TEXTUREFORMAT_COMPRESSED_RGBA8_ETC2_EAC, true, true, false}, // ETC2_R8G8B8A8
+  {152, Constants::TEXTUREFORMAT_COMPRESSED_RGBA8_ETC2_EAC, true, true, true}, // ETC2 sRGB
+  {157, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_ASTC_4x4, true, true, false}, // ASTC_4x4
+  {158, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_ASTC_4x4, true, true, true}, // ASTC_4x4 sRGB
+};
+
+// Formats decoded to RGBA when they cannot be uploaded as stored in the file
+struct KTX2RGBAFallback {
+  uint32_t vkFormat;
+  // Bytes per pixel of the uncompressed formats, 0 for the S3TC formats
+  uint8_t channelCount;
+  bool isBGR;
+  bool hasAlpha;
+  bool isInGammaSpace;
+}; // end of struct KTX2RGBAFallback
+
+// vkFormat, channel count, is BGR, has alpha, is in gamma space
+constexpr KTX2RGBAFallback KTX2_RGBA_FALLBACKS[] = {
+  {9, 1, false, false, false}, // R8_UNORM
+  {15, 1, false, false, true}, // R8_SRGB
+  {16, 2, false, false, false}, // R8G8_UNORM
+  {22, 2, false, false, true}, // R8G8_SRGB
+  {23, 3, false, false, false}, // R8G8B8_UNORM
+  {29, 3, false, false, true}, // R8G8B8_SRGB
+  {30, 3, true, false, false}, // B8G8R8_UNORM
+  {36, 3, true, false, true}, // B8G8R8_SRGB
+  {44, 4, true, true, false}, // B8G8R8A8_UNORM
+  {50, 4, true, true, true}, // B8G8R8A8_SRGB
+  {131, 0, false, false, false}, // BC1_RGB_UNORM
+  {132, 0, false, false, true}, // BC1_RGB_SRGB
+  {137, 0, false, true, false}, // BC3_UNORM
+  {138, 0, false, true, true}, // BC3_SRGB
+};
+
+std::mutex gTranscodersMutex;
+std::vector<KTX2TranscoderPtr> gTranscoders;
+
+uint32_t ReadUint32(const uint8_t* data)
+{
+  return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+         | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+uint64_t ReadUint64(const uint8_t* data)
+{
+  return static_cast<uint64_t>(ReadUint32(data))
+         | (static_cast<uint64_t>(ReadUint32(data + 4)) << 32);
+}
+
+// Expands 8 bits per channel pixels to RGBA, the missing channels being 0 and alpha 255
+bool ExpandToRGBA(const KTX2RGBAFallback& format, const uint8_t* data, size_t byteLength,
+                  size_t width, size_t height, Uint8Array& output)
+{
+  const auto pixelCount = width * height;
+  if (byteLength < pixelCount * format.channelCount) {
+    return false;
+  }
+
+  output.assign(4 * pixelCount, 0);
+  for (size_t p = 0; p < pixelCount; ++p) {
+    const auto pixel = data + p * format.channelCount;
+    const auto rgba  = output.data() + 4 * p;
+    for (size_t c = 0; c < format.channelCount; ++c) {
+      rgba[c] = pixel[c];
+    }
+    if (format.channelCount < 4) {
+      rgba[3] = 255;
+    }
+    if (format.isBGR) {
+      std::swap(rgba[0], rgba[2]);
+    }
+  }
+  return true;
+}
+
+// Decodes the 4x4 colors of a BC1 block, BC3 blocks always using 4 colors
+void DecodeBC1Block(const uint8_t* block, bool isBC3, uint8_t (&colors)[16][4])
+{
+  const uint32_t color0 = block[0] | (block[1] << 8);
+  const uint32_t color1 = block[2] | (block[3] << 8);
+
+  uint8_t palette[4][4];
+  for (size_t i = 0; i < 2; ++i) {
+    const auto color = i == 0 ? color0 : color1;
+    const auto r     = (color >> 11) & 0x1F;
+    const auto g     = (color >> 5) & 0x3F;
+    const auto b     = color & 0x1F;
+    palette[i][0]    = static_cast<uint8_t>((r << 3) | (r >> 2));
+    palette[i][1]    = static_cast<uint8_t>((g << 2) | (g >> 4));
+    palette[i][2]    = static_cast<uint8_t>((b << 3) | (b >> 2));
+    palette[i][3]    = 255;
+  }
+  for (size_t c = 0; c < 3; ++c) {
+    if (isBC3 || color0 > color1) {
+      palette[2][c] = static_cast<uint8_t>((2 * palette[0][c] + palette[1][c]) / 3);
+      palette[3][c] = static_cast<uint8_t>((palette[0][c] + 2 * palette[1][c]) / 3);
+    }
+    else {
+      // The fourth color is black, its alpha ignored by the RGB formats
+      palette[2][c] = static_cast<uint8_t>((palette[0][c] + palette[1][c]) / 2);
+      palette[3][c] = 0;
+    }
+  }
+  palette[2][3] = palette[3][3] = 255;
+
+  const auto indices = ReadUint32(block + 4);
+  for (size_t p = 0; p < 16; ++p) {
+    const auto& color = palette[(indices >> (2 * p)) & 3];
+    std::copy(std::begin(color), std::end(color), std::begin(colors[p]));
+  }
+}
+
+// Decodes the 4x4 alphas of a BC3 block
+void DecodeBC3AlphaBlock(const uint8_t* block, uint8_t (&colors)[16][4])
+{
+  uint32_t alphas[8] = {block[0], block[1]};
+  if (alphas[0] > alphas[1]) {
+    for (uint32_t i = 2; i < 8; ++i) {
+      alphas[i] = ((8 - i) * alphas[0] + (i - 1) * alphas[1]) / 7;
+    }
+  }
+  else {
+    for (uint32_t i = 2; i < 6; ++i) {
+      alphas[i] = ((6 - i) * alphas[0] + (i - 1) * alphas[1]) / 5;
+    }
+    alphas[6] = 0;
+    alphas[7] = 255;
+  }
+
+  uint64_t indices = 0;
+  for (size_t i = 0; i < 6; ++i) {
+    indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+  }
+  for (size_t p = 0; p < 16; ++p) {
+    colors[p][3] = static_cast<uint8_t>(alphas[(indices >> (3 * p)) & 7]);
+  }
+}
+
+// Decodes BC1 (8 bytes per block) or BC3 (16 bytes per block) data to RGBA
+bool DecodeS3TCToRGBA(bool isBC3, const uint8_t* data, size_t byteLength, size_t width,
+                      size_t height, Uint8Array& output)
+{
+  const size_t blockSize  = isBC3 ? 16 : 8;
+  const auto blocksPerRow = (width + 3) / 4;
+  const auto blocksPerCol = (height + 3) / 4;
+  if (byteLength < blocksPerRow * blocksPerCol * blockSize) {
+    return false;
+  }
+
+  output.assign(4 * width * height, 0);
+  uint8_t colors[16][4];
+  for (size_t by = 0; by < blocksPerCol; ++by) {
+    for (size_t bx = 0; bx < blocksPerRow; ++bx) {
+      const auto block = data + (by * blocksPerRow + bx) * blockSize;
+      if (isBC3) {
+        DecodeBC1Block(block + 8, true, colors);
+        DecodeBC3AlphaBlock(block, colors);
+      }
+      else {
+        DecodeBC1Block(block, false, colors);
+      }
+      // The blocks of the last row and column can exceed the level
+      for (size_t y = 0; y < 4 && by * 4 + y < height; ++y) {
+        for (size_t x = 0; x < 4 && bx * 4 + x < width; ++x) {
+          const auto& color = colors[y * 4 + x];
+          std::copy(std::begin(color), std::end(color),
+                    output.begin()
+                      + static_cast<std::ptrdiff_t>(4 * ((by * 4 + y) * width + bx * 4 + x)));
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool DecodeToRGBA(const KTX2RGBAFallback& format, const uint8_t* data, size_t byteLength,
+                  size_t width, size_t height, Uint8Array& output)
+{
+  if (format.channelCount > 0) {
+    return ExpandToRGBA(format, data, byteLength, width, height, output);
+  }
+  return DecodeS3TCToRGBA(format.hasAlpha, data, byteLength, width, height, output);
+}
+
+bool ParseFile(const uint8_t* data, size_t byteLength, KTX2FileInfo& info)
+{
+  if (byteLength < KTX2_HEADER_LEN || !std::equal(std::begin(KTX2_IDENTIFIER),
+                                                  std::end(KTX2_IDENTIFIER), data)) {
+    info.errorMessage = "texture missing KTX2 identifier";
+    return false;
+  }
+
+  info.vkFormat               = ReadUint32(data + 12);
+  info.pixelWidth             = ReadUint32(data + 20);
+  info.pixelHeight            = ReadUint32(data + 24);
+  const auto pixelDepth       = ReadUint32(data + 28);
+  const auto layerCount       = ReadUint32(data + 32);
+  const auto faceCount        = ReadUint32(data + 36);
+  const auto levelCount       = std::max(1u, ReadUint32(data + 40));
+  info.supercompressionScheme = ReadUint32(data + 44);
+  const auto dfdByteOffset    = ReadUint32(data + 48);
+  const auto dfdByteLength    = ReadUint32(data + 52);
+  info.sgdByteOffset          = ReadUint64(data + 64);
+  info.sgdByteLength          = ReadUint64(data + 72);
+
+  if (info.pixelWidth == 0 || info.pixelHeight == 0 || pixelDepth != 0) {
+    info.errorMessage = "only 2D textures currently supported";
+    return false;
+  }
+  if (layerCount != 0) {
+    info.errorMessage = "texture arrays not currently supported";
+    return false;
+  }
+  if (faceCount != 1) {
+    info.errorMessage = "cube textures not currently supported";
+    return false;
+  }
+  if (KTX2_HEADER_LEN + levelCount * KTX2_LEVEL_INDEX_LEN > byteLength
+      || info.sgdByteOffset > byteLength || info.sgdByteLength > byteLength - info.sgdByteOffset) {
+    info.errorMessage = "truncated KTX2 file";
+    return false;
+  }
+
+  for (size_t i = 0; i < levelCount; ++i) {
+    const auto entry = data + KTX2_HEADER_LEN + i * KTX2_LEVEL_INDEX_LEN;
+    KTX2Level level;
+    level.byteOffset             = ReadUint64(entry);
+    level.byteLength             = ReadUint64(entry + 8);
+    level.uncompressedByteLength = ReadUint64(entry + 16);
+    if (level.byteOffset > byteLength || level.byteLength > byteLength - level.byteOffset) {
+      info.errorMessage = "truncated KTX2 file";
+      return false;
+    }
+    info.levels.emplace_back(level);
+  }
+
+  // Basic data format descriptor: total size, vendor / type, version / size, then the color model
+  if (dfdByteLength >= 4 + 24
+      && static_cast<size_t>(dfdByteOffset) + dfdByteLength <= byteLength) {
+    const auto dfd       = data + dfdByteOffset + 4;
+    const auto blockSize = ReadUint32(dfd + 4) >> 16;
+    auto numSamples      = blockSize >= 24 ? (blockSize - 24) / 16 : 0;
+    // The samples announced by a malformed descriptor may not fit in it
+    if (24 + numSamples * 16 > dfdByteLength - 4) {
+      numSamples = 0;
+    }
+    info.colorModel           = dfd[8];
+    info.isInGammaSpace       = dfd[10] == KHR_DF_TRANSFER_SRGB;
+    const auto firstChannelId = numSamples > 0 ? (dfd[24 + 3] & 0xF) : 0;
+    const auto lastChannelId  = numSamples > 0 ? (dfd[24 + (numSamples - 1) * 16 + 3] & 0xF) : 0;
+    if (info.colorModel == KHR_DF_MODEL_ETC1S) {
+      info.hasAlpha = numSamples == 2 && lastChannelId == KHR_DF_CHANNEL_ETC1S_AAA;
+    }
+    else if (info.colorModel == KHR_DF_MODEL_UASTC) {
+      info.hasAlpha = firstChannelId == KHR_DF_CHANNEL_UASTC_RGBA
+                      || firstChannelId == KHR_DF_CHANNEL_UASTC_RRRG;
+    }
+  }
+
+  return true;
+}
+
+unsigned int GetInternalFormat(KTX2TranscodeTarget target, const KTX2DecoderOptions& options)
+{
+  switch (target) {
+    case KTX2TranscodeTarget::ASTC_4x4_RGBA:
+      return Constants::TEXTUREFORMAT_COMPRESSED_RGBA_ASTC_4x4;
+    case KTX2TranscodeTarget::BC7_RGBA:
+      return Constants::TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM;
+    case KTX2TranscodeTarget::BC3_RGBA:
+      return Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT5;
+    case KTX2TranscodeTarget::BC1_RGB:
+      return Constants::TEXTUREFORMAT_COMPRESSED_RGB_S3TC_DXT1;
+    case KTX2TranscodeTarget::ETC2_RGBA:
+      return Constants::TEXTUREFORMAT_COMPRESSED_RGBA8_ETC2_EAC;
+    case KTX2TranscodeTarget::ETC1_RGB:
+      // ETC1 data is valid ETC2 RGB data
+      return options.etc1 ? Constants::TEXTUREFORMAT_COMPRESSED_RGB_ETC1_WEBGL :
+                            Constants::TEXTUREFORMAT_COMPRESSED_RGB8_ETC2;
+    case KTX2TranscodeTarget::RGBA32:
+    default:
+      return Constants::TEXTUREFORMAT_RGBA;
+  }
+}
+
+bool IsSupported(unsigned int internalFormat, const KTX2DecoderOptions& options)
+{
+  switch (internalFormat) {
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_ASTC_4x4:
+      return options.astc;
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM:
+      return options.bptc;
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA_S3TC_DXT5:
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGB_S3TC_DXT1:
+      return options.s3tc;
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGBA8_ETC2_EAC:
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGB8_ETC2:
+      return options.etc2;
+    case Constants::TEXTUREFORMAT_COMPRESSED_RGB_ETC1_WEBGL:
+      return options.etc1;
+    default:
+      return true;
+  }
+}
+
+// The targets to try, by order of preference
+std::vector<KTX2TranscodeTarget> GetCandidateTargets(KTX2SourceTextureFormat sourceFormat,
+                                                     bool hasAlpha,
+                                                     const KTX2DecoderOptions& options)
+{
+  std::vector<KTX2TranscodeTarget> targets;
+  if (options.forceRGBA) {
+    targets.emplace_back(KTX2TranscodeTarget::RGBA32);
+    return targets;
+  }
+
+  const auto addLowQualityTargets = [&]() {
+    if (hasAlpha && options.etc2) {
+      targets.emplace_back(KTX2TranscodeTarget::ETC2_RGBA);
+    }
+    if (!hasAlpha && (options.etc1 || options.etc2)) {
+      targets.emplace_back(KTX2TranscodeTarget::ETC1_RGB);
+    }
+    if (options.s3tc) {
+      targets.emplace_back(hasAlpha ? KTX2TranscodeTarget::BC3_RGBA : KTX2TranscodeTarget::BC1_RGB);
+    }
+  };
+
+  if (sourceFormat == KTX2SourceTextureFormat::UASTC4x4) {
+    // UASTC maps losslessly to ASTC and with little loss to BC7
+    if (options.astc) {
+      targets.emplace_back(KTX2TranscodeTarget::ASTC_4x4_RGBA);
+    }
+    if (options.bptc) {
+      targets.emplace_back(KTX2TranscodeTarget::BC7_RGBA);
+    }
+    if (!options.useRGBAIfASTCBC7NotAvailableWhenUASTC) {
+      addLowQualityTargets();
+    }
+  }
+  else {
+    // ETC1S maps losslessly to ETC1
+    addLowQualityTargets();
+    if (options.bptc) {
+      targets.emplace_back(KTX2TranscodeTarget::BC7_RGBA);
+    }
+    if (options.astc) {
+      targets.emplace_back(KTX2TranscodeTarget::ASTC_4x4_RGBA);
+    }
+  }
+  targets.emplace_back(KTX2TranscodeTarget::RGBA32);
+
+  return targets;
+}
+
+} // end of anonymous namespace
+
+KTX2DecoderOptions KhronosTextureContainer2::DefaultDecoderOptions;
+
+void KhronosTextureContainer2::RegisterTranscoder(const KTX2TranscoderPtr& transcoder)
+{
+  std::lock_guard<std::mutex> lock(gTranscodersMutex);
+  gTranscoders.insert(gTranscoders.begin(), transcoder);
+}
+
+void KhronosTextureContainer2::ClearTranscoders()
+{
+  std::lock_guard<std::mutex> lock(gTranscodersMutex);
+  gTranscoders.clear();
+}
+
+bool KhronosTextureContainer2::IsValid(const ArrayBufferView& data)
+{
+  const auto& buffer = data.uint8Array();
+  if (buffer.size() < data.byteOffset + 12) {
+    return false;
+  }
+  return std::equal(std::begin(KTX2_IDENTIFIER), std::end(KTX2_IDENTIFIER),
+                    buffer.begin() + static_cast<std::ptrdiff_t>(data.byteOffset));
+}
+
+KTX2DecodedTexture KhronosTextureContainer2::Decode(const ArrayBufferView& data,
+                                                    const KTX2DecoderOptions& options,
+                                                    ThreadPool* pool)
+{
+  KTX2DecodedTexture decoded;
+  const auto& buffer = data.uint8Array();
+  if (buffer.size() < data.byteOffset) {
+    decoded.errorMessage = "texture missing KTX2 identifier";
+    return decoded;
+  }
+  const auto fileData       = buffer.data() + data.byteOffset;
+  const auto fileByteLength = buffer.size() - data.byteOffset;
+
+  KTX2FileInfo info;
+  if (!ParseFile(fileData, fileByteLength, info)) {
+    decoded.errorMessage = info.errorMessage;
+    return decoded;
+  }
+
+  const auto levelCount = info.levels.size();
+  decoded.levels.resize(levelCount);
+  for (size_t i = 0; i < levelCount; ++i) {
+    decoded.levels[i].width  = static_cast<int>(std::max(1u, info.pixelWidth >> i));
+    decoded.levels[i].height = static_cast<int>(std::max(1u, info.pixelHeight >> i));
+  }
+
+  auto& threadPool = pool ? *pool : ThreadPool::Default();
+
+  // GPU format stored as is, or decoded to RGBA if it cannot be uploaded
+  if (info.vkFormat != 0) {
+    const auto format
+      = std::find_if(std::begin(KTX2_VK_FORMATS), std::end(KTX2_VK_FORMATS),
+                     [&info](const KTX2VkFormat& f) { return f.vkFormat == info.vkFormat; });
+    const auto fallback
+      = std::find_if(std::begin(KTX2_RGBA_FALLBACKS), std::end(KTX2_RGBA_FALLBACKS),
+                     [&info](const KTX2RGBAFallback& f) { return f.vkFormat == info.vkFormat; });
+    const auto isStored = format != std::end(KTX2_VK_FORMATS)
+                          && IsSupported(format->internalFormat, options);
+    if (format == std::end(KTX2_VK_FORMATS) && fallback == std::end(KTX2_RGBA_FALLBACKS)) {
+      decoded.errorMessage = "unsupported vkFormat " + std::to_string(info.vkFormat);
+    }
+    else if (info.supercompressionScheme != SupercompressionScheme_None) {
+      decoded.errorMessage = "supercompressed vkFormat textures not currently supported";
+    }
+    else if (!isStored && fallback == std::end(KTX2_RGBA_FALLBACKS)) {
+      decoded.errorMessage = "compressed format not supported on this platform";
+    }
+    if (!decoded.errorMessage.empty()) {
+      decoded.levels.clear();
+      return decoded;
+    }
+
+    if (isStored) {
+      decoded.internalFormat = format->internalFormat;
+      decoded.isCompressed   = format->isCompressed;
+      decoded.hasAlpha       = format->hasAlpha;
+      decoded.isInGammaSpace = format->isInGammaSpace;
+      for (size_t i = 0; i < levelCount; ++i) {
+        const auto levelData = fileData + info.levels[i].byteOffset;
+        decoded.levels[i].data.assign(levelData, levelData + info.levels[i].byteLength);
+      }
+      return decoded;
+    }
+
+    // The levels are independent, decode them in parallel
+    decoded.internalFormat = Constants::TEXTUREFORMAT_RGBA;
+    decoded.hasAlpha       = fallback->hasAlpha;
+    decoded.isInGammaSpace = fallback->isInGammaSpace;
+    std::atomic<bool> failed{false};
+    threadPool.parallelFor(0, levelCount, 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const auto& level = info.levels[i];
+        if (!DecodeToRGBA(*fallback, fileData + level.byteOffset,
+                          static_cast<size_t>(level.byteLength),
+                          static_cast<size_t>(decoded.levels[i].width),
+                          static_cast<size_t>(decoded.levels[i].height), decoded.levels[i].data)) {
+          failed = true;
+        }
+      }
+    });
+    if (failed) {
+      decoded.levels.clear();
+      decoded.errorMessage = "truncated KTX2 level";
+    }
+    return decoded;
+  }
+
+  // Basis Universal
+  KTX2SourceTextureFormat sourceFormat;
+  if (info.colorModel == KHR_DF_MODEL_ETC1S
+      || info.supercompressionScheme == SupercompressionScheme_BasisLZ) {
+    sourceFormat = KTX2SourceTextureFormat::ETC1S;
+  }
+  else if (info.colorModel == KHR_DF_MODEL_UASTC) {
+    sourceFormat = KTX2SourceTextureFormat::UASTC4x4;
+  }
+  else {
+    decoded.levels.clear();
+    decoded.errorMessage = "unsupported KTX2 color model " + std::to_string(info.colorModel);
+    return decoded;
+  }
+  decoded.hasAlpha       = info.hasAlpha;
+  decoded.isInGammaSpace = info.isInGammaSpace;
+
+  std::vector<KTX2TranscoderPtr> transcoders;
+  {
+    std::lock_guard<std::mutex> lock(gTranscodersMutex);
+    transcoders = gTranscoders;
+  }
+
+  KTX2TranscoderPtr transcoder = nullptr;
+  auto targetFormat            = KTX2TranscodeTarget::RGBA32;
+  for (const auto target : GetCandidateTargets(sourceFormat, info.hasAlpha, options)) {
+    for (const auto& candidate : transcoders) {
+      if (candidate->canTranscode(sourceFormat, target, info.isInGammaSpace)) {
+        transcoder   = candidate;
+        targetFormat = target;
+        break;
+      }
+    }
+    if (transcoder) {
+      break;
+    }
+  }
+  if (!transcoder) {
+    decoded.levels.clear();
+    decoded.errorMessage = sourceFormat == KTX2SourceTextureFormat::ETC1S ?
+                             "no transcoder registered for ETC1S textures" :
+                             "no transcoder registered for UASTC textures";
+    return decoded;
+  }
+
+  decoded.internalFormat = GetInternalFormat(targetFormat, options);
+  decoded.isCompressed   = targetFormat != KTX2TranscodeTarget::RGBA32;
+  decoded.transcoderName = transcoder->name();
+
+  // The levels are independent, transcode them in parallel
+  std::atomic<bool> failed{false};
+  threadPool.parallelFor(0, levelCount, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const auto& level = info.levels[i];
+      KTX2TranscodeRequest request;
+      request.sourceFormat                     = sourceFormat;
+      request.targetFormat                     = targetFormat;
+      request.level                            = static_cast<uint32_t>(i);
+      request.width                            = static_cast<uint32_t>(decoded.levels[i].width);
+      request.height                           = static_cast<uint32_t>(decoded.levels[i].height);
+      request.supercompressionScheme           = info.supercompressionScheme;
+      request.uncompressedByteLength           = level.uncompressedByteLength;
+      request.hasAlpha                         = info.hasAlpha;
+      request.isInGammaSpace                   = info.isInGammaSpace;
+      request.encodedData                      = fileData + level.byteOffset;
+      request.encodedByteLength                = static_cast<size_t>(level.byteLength);
+      request.supercompressionGlobalData       = fileData + info.sgdByteOffset;
+      request.supercompressionGlobalDataLength = static_cast<size_t>(info.sgdByteLength);
+      if (!transcoder->transcode(request, decoded.levels[i].data)) {
+        failed = true;
+      }
+    }
+  });
+
+  if (failed) {
+    decoded.levels.clear();
+    decoded.errorMessage = "transcoding failed with " + decoded.transcoderName;
+  }
+
+  return decoded;
+}
+
+KhronosTextureContainer2::KhronosTextureContainer2(ThinEngine* engine) : _engine{engine}
+{
+}
+
+KhronosTextureContainer2::~KhronosTextureContainer2() = default;
+
+KTX2DecoderOptions KhronosTextureContainer2::decoderOptions() const
+{
+  // The formats declared in the default options are added to the ones reported by the engine,
+  // the extensions are not always exposed by the rendering context
+  auto options = KhronosTextureContainer2::DefaultDecoderOptions;
+  if (_engine) {
+    const auto& caps = _engine->getCaps();
+    options.astc     = options.astc || caps.astc != nullptr;
+    options.bptc     = options.bptc || caps.bptc != nullptr;
+    options.s3tc     = options.s3tc || caps.s3tc.has_value();
+    options.etc2     = options.etc2 || caps.etc2 != nullptr;
+    options.etc1     = options.etc1 || caps.etc1 != nullptr;
+  }
+  return options;
+}
+
+void KhronosTextureContainer2::decodeAsync(const ArrayBufferView& data,
+                                           const OnDecodedFunction& onDecoded) const
+{
+  const auto options = decoderOptions();
+  auto& threadPool   = ThreadPool::Default();
+  if (threadPool.size() == 0 || asio::IsAsyncDisabled()) {
+    auto decoded = KhronosTextureContainer2::Decode(data, options);
+    if (onDecoded) {
+      onDecoded(decoded);
+    }
+    return;
+  }
+
+  threadPool.enqueue([data, options, onDecoded]() {
+    auto decoded
+      = std::make_shared<KTX2DecodedTexture>(KhronosTextureContainer2::Decode(data, options));
+    if (onDecoded) {
+      asio::sync_callback_runner::PushCallback([decoded, onDecoded]() { onDecoded(*decoded); });
+    }
+  });
+}
+
+void KhronosTextureContainer2::uploadLevels(const InternalTexturePtr& texture,
+                                            const KTX2DecodedTexture& decoded,
+                                            bool loadMipmaps) const
+{
+  auto engine = _engine ? _engine : texture->getEngine();
+  if (decoded.levels.empty()) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer2", "No level to upload: ", decoded.errorMessage)
+    return;
+  }
+
+  if (!decoded.isCompressed) {
+    // Mipmaps are generated by the engine
+    engine->_uploadDataToTextureDirectly(texture, ArrayBufferView(decoded.levels[0].data), 0, 0,
+                                         static_cast<int>(Constants::TEXTUREFORMAT_RGBA), true);
+    return;
+  }
+
+  const auto levelCount = loadMipmaps ? decoded.levels.size() : 1;
+  for (size_t level = 0; level < levelCount; ++level) {
+    const auto& levelData = decoded.levels[level];
+    engine->_uploadCompressedDataToTextureDirectly(texture, decoded.internalFormat, levelData.width,
+                                                   levelData.height, levelData.data, 0,
+                                                   static_cast<int>(level));
+  }
+}
+
+} // end of namespace BABYLON
@@ -1,11 +1,18 @@
 #include <babylon/misc/optimization/particles_optimization.h>
 
+#include <algorithm>
+
 #include <babylon/engines/scene.h>
+#include <babylon/particles/particle_budget_manager.h>
 
 namespace BABYLON {
 
-ParticlesOptimization::ParticlesOptimization(int iPriority)
+ParticlesOptimization::ParticlesOptimization(int iPriority, size_t iMaxParticles,
+                                             size_t iMinParticles)
     : SceneOptimization{iPriority}
+    , maxParticles{iMaxParticles}
+    , minParticles{iMinParticles}
+    , _currentBudget{0}
 {
 }
 
@@ -13,8 +20,18 @@ ParticlesOptimization::~ParticlesOptimization() = default;
 
 bool ParticlesOptimization::apply(Scene* scene)
 {
-  scene->particlesEnabled = false;
-  return true;
+  if (maxParticles == 0) {
+    scene->particlesEnabled = false;
+    return true;
+  }
+
+  _currentBudget = (_currentBudget == 0) ? maxParticles : _currentBudget / 2;
+
+  auto& budgetManager        = ParticleBudgetManager::ForScene(scene);
+  budgetManager.enabled      = true;
+  budgetManager.maxParticles = std::max(_currentBudget, minParticles);
+
+  return _currentBudget <= minParticles;
 }
 
 } // end of namespace BABYLON
@@ -35,18 +35,18 @@ SceneOptimizerOptions::LowDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<MergeMeshesOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<ShadowsOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<PostProcessesOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 1024));
+  result.optimizations.emplace_back(std::make_shared<TextureOptimization>(priority, 1024));
 
   return result;
 }
@@ -57,26 +57,26 @@ SceneOptimizerOptions::ModerateDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<MergeMeshesOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<ShadowsOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<PostProcessesOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 512));
+  result.optimizations.emplace_back(std::make_shared<TextureOptimization>(priority, 512));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(RenderTargetsOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<RenderTargetsOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(HardwareScalingOptimization(priority, 2));
+  result.optimizations.emplace_back(std::make_shared<HardwareScalingOptimization>(priority, 2));
 
   return result;
 }
@@ -87,26 +87,26 @@ SceneOptimizerOptions::HighDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<MergeMeshesOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<ShadowsOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<PostProcessesOptimization>(priority));
+  result.optimizations.emplace_back(std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 256));
+  result.optimizations.emplace_back(std::make_shared<TextureOptimization>(priority, 256));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(RenderTargetsOptimization(priority));
+  result.optimizations.emplace_back(std::make_shared<RenderTargetsOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(HardwareScalingOptimization(priority, 4));
+  result.optimizations.emplace_back(std::make_shared<HardwareScalingOptimization>(priority, 4));
 
   return result;
 }
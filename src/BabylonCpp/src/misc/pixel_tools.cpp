@@ -0,0 +1,190 @@
+#include <babylon/misc/pixel_tools.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <babylon/core/structs.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+#define BABYLON_PIXEL_TOOLS_SSE2
+#include <emmintrin.h>
+#if defined(__SSSE3__)
+#define BABYLON_PIXEL_TOOLS_SSSE3
+#include <tmmintrin.h>
+#endif
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Exact rounded division by 255 for x in [0, 255 * 255]
+inline uint8_t div255(uint32_t x)
+{
+  x += 128;
+  return static_cast<uint8_t>((x + (x >> 8)) >> 8);
+}
+
+#ifdef BABYLON_PIXEL_TOOLS_SSE2
+inline __m128i div255_epu16(__m128i x)
+{
+  x = _mm_add_epi16(x, _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// Multiplies the RGB lanes of two RGBA pixels (unpacked to 16 bits) by their alpha lane
+inline __m128i premultiply_epu16(__m128i px)
+{
+  // Broadcast the alpha of each pixel to its 4 lanes
+  auto alpha = _mm_shufflelo_epi16(px, _MM_SHUFFLE(3, 3, 3, 3));
+  alpha      = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+  // Keep the alpha lanes untouched by multiplying them by 255
+  const auto alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+  alpha                = _mm_or_si128(_mm_andnot_si128(alphaMask, alpha),
+                        _mm_and_si128(alphaMask, _mm_set1_epi16(255)));
+  return div255_epu16(_mm_mullo_epi16(px, alpha));
+}
+#endif
+
+} // end of anonymous namespace
+
+void PixelTools::FlipVertically(uint8_t* pixels, size_t rowBytes, size_t height)
+{
+  if (!pixels || rowBytes == 0 || height < 2) {
+    return;
+  }
+  // memcpy is already vectorized by the standard library
+  std::vector<uint8_t> tmp(rowBytes);
+  for (size_t top = 0, bottom = height - 1; top < bottom; ++top, --bottom) {
+    auto topRow    = pixels + top * rowBytes;
+    auto bottomRow = pixels + bottom * rowBytes;
+    std::memcpy(tmp.data(), topRow, rowBytes);
+    std::memcpy(topRow, bottomRow, rowBytes);
+    std::memcpy(bottomRow, tmp.data(), rowBytes);
+  }
+}
+
+void PixelTools::ExpandToRGBA(const uint8_t* src, int components, uint8_t* dst, size_t pixelCount)
+{
+  size_t i = 0;
+  switch (components) {
+    case 4:
+      std::memcpy(dst, src, pixelCount * 4);
+      break;
+    case 3:
+#ifdef BABYLON_PIXEL_TOOLS_SSSE3
+    {
+      // 4 pixels per iteration, the last 16 bytes load must stay within the source
+      const auto shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+      const auto opaque  = _mm_set1_epi32(static_cast<int>(0xFF000000));
+      for (; i + 6 <= pixelCount; i += 4) {
+        const auto rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4),
+                         _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), opaque));
+      }
+    }
+#endif
+      for (; i < pixelCount; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = 255;
+      }
+      break;
+    case 2:
+      for (; i < pixelCount; ++i) {
+        dst[i * 4 + 0] = dst[i * 4 + 1] = dst[i * 4 + 2] = src[i * 2 + 0];
+        dst[i * 4 + 3]                                   = src[i * 2 + 1];
+      }
+      break;
+    case 1:
+      for (; i < pixelCount; ++i) {
+        dst[i * 4 + 0] = dst[i * 4 + 1] = dst[i * 4 + 2] = src[i];
+        dst[i * 4 + 3]                                   = 255;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void PixelTools::PremultiplyAlpha(uint8_t* rgba, size_t pixelCount)
+{
+  size_t i = 0;
+#ifdef BABYLON_PIXEL_TOOLS_SSE2
+  const auto zero = _mm_setzero_si128();
+  for (; i + 4 <= pixelCount; i += 4) {
+    auto ptr      = reinterpret_cast<__m128i*>(rgba + i * 4);
+    const auto px = _mm_loadu_si128(ptr);
+    const auto lo = premultiply_epu16(_mm_unpacklo_epi8(px, zero));
+    const auto hi = premultiply_epu16(_mm_unpackhi_epi8(px, zero));
+    _mm_storeu_si128(ptr, _mm_packus_epi16(lo, hi));
+  }
+#endif
+  for (; i < pixelCount; ++i) {
+    auto px      = rgba + i * 4;
+    const auto a = px[3];
+    px[0]        = div255(px[0] * a);
+    px[1]        = div255(px[1] * a);
+    px[2]        = div255(px[2] * a);
+  }
+}
+
+Image PixelTools::DownsampleRGBA(const Image& image)
+{
+  const auto srcWidth  = static_cast<size_t>(image.width);
+  const auto srcHeight = static_cast<size_t>(image.height);
+  const auto width     = std::max<size_t>(srcWidth / 2, 1);
+  const auto height    = std::max<size_t>(srcHeight / 2, 1);
+  if (srcWidth == 0 || srcHeight == 0 || image.data.size() < srcWidth * srcHeight * 4) {
+    return Image();
+  }
+
+  Image mip;
+  mip.width  = static_cast<int>(width);
+  mip.height = static_cast<int>(height);
+  mip.depth  = 4;
+  mip.mode   = GL::RGBA;
+  mip.data.resize(width * height * 4);
+
+  const auto src = image.data.data();
+  auto dst       = mip.data.data();
+  for (size_t y = 0; y < height; ++y) {
+    const auto row0 = src + std::min(2 * y, srcHeight - 1) * srcWidth * 4;
+    const auto row1 = src + std::min(2 * y + 1, srcHeight - 1) * srcWidth * 4;
+    auto out        = dst + y * width * 4;
+    size_t x        = 0;
+#ifdef BABYLON_PIXEL_TOOLS_SSE2
+    // 2 destination pixels (4 source columns) per iteration
+    const auto zero = _mm_setzero_si128();
+    const auto two  = _mm_set1_epi16(2);
+    for (; 2 * x + 4 <= srcWidth; x += 2) {
+      const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + 2 * x * 4));
+      const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + 2 * x * 4));
+      // Vertical sums of source columns (0, 1) and (2, 3)
+      const auto lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+      const auto hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+      // Horizontal sums, in the low 64 bits
+      const auto sumLo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+      const auto sumHi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+      auto sum         = _mm_unpacklo_epi64(sumLo, sumHi);
+      sum              = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(sum, zero));
+    }
+#endif
+    for (; x < width; ++x) {
+      const auto c0 = std::min(2 * x, srcWidth - 1) * 4;
+      const auto c1 = std::min(2 * x + 1, srcWidth - 1) * 4;
+      for (size_t c = 0; c < 4; ++c) {
+        const auto sum = row0[c0 + c] + row0[c1 + c] + row1[c0 + c] + row1[c1 + c] + 2u;
+        out[x * 4 + c] = static_cast<uint8_t>(sum >> 2);
+      }
+    }
+  }
+
+  return mip;
+}
+
+} // end of namespace BABYLON
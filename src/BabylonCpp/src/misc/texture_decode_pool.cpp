@@ -0,0 +1,133 @@
+#include <babylon/misc/texture_decode_pool.h>
+
+#include <stb_image/stb_image.h>
+
+#include <babylon/asio/asio.h>
+#include <babylon/asio/internal/sync_callback_runner.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/misc/pixel_tools.h>
+
+namespace BABYLON {
+
+TextureDecodePool& TextureDecodePool::Default()
+{
+  static TextureDecodePool defaultPool;
+  return defaultPool;
+}
+
+DecodedImage TextureDecodePool::Decode(const ArrayBuffer& buffer,
+                                       const TextureDecodeOptions& options)
+{
+  DecodedImage decoded;
+  if (buffer.empty()) {
+    decoded.errorMessage = "Empty image buffer";
+    return decoded;
+  }
+
+  // Decode with the native number of channels, the global flip flag of stb_image is never set
+  int w = 0, h = 0, n = 0;
+  auto pixels
+    = stbi_load_from_memory(buffer.data(), static_cast<int>(buffer.size()), &w, &h, &n, 0);
+  if (!pixels) {
+    decoded.errorMessage = "Unknown image format. STB cannot decode image data for image";
+    return decoded;
+  }
+
+  const auto pixelCount = static_cast<size_t>(w) * static_cast<size_t>(h);
+  auto& image           = decoded.image;
+  image.width           = w;
+  image.height          = h;
+  image.depth           = 4;
+  image.mode            = GL::RGBA;
+  image.data.resize(pixelCount * 4);
+  PixelTools::ExpandToRGBA(pixels, n, image.data.data(), pixelCount);
+  stbi_image_free(pixels);
+
+  if (options.flipVertically) {
+    PixelTools::FlipVertically(image.data.data(), static_cast<size_t>(w) * 4,
+                               static_cast<size_t>(h));
+  }
+  if (options.premultiplyAlpha && (n == 2 || n == 4)) {
+    PixelTools::PremultiplyAlpha(image.data.data(), pixelCount);
+  }
+  if (options.generateMipMaps) {
+    const Image* level = &image;
+    while (level->width > 1 || level->height > 1) {
+      decoded.mipMaps.emplace_back(PixelTools::DownsampleRGBA(*level));
+      level = &decoded.mipMaps.back();
+    }
+  }
+
+  return decoded;
+}
+
+TextureDecodePool::TextureDecodePool(ThreadPool* pool)
+    : _pool{pool ? pool : &ThreadPool::Default()}, _pendingDecodes{0}
+{
+}
+
+TextureDecodePool::~TextureDecodePool()
+{
+  // The jobs reference the pool, the remaining callbacks do not
+  _waitWorkers();
+}
+
+void TextureDecodePool::decodeAsync(ArrayBuffer buffer, const TextureDecodeOptions& options,
+                                    const OnDecodedFunction& onDecoded)
+{
+  if (_pool->size() == 0 || asio::IsAsyncDisabled()) {
+    auto decoded = Decode(buffer, options);
+    if (onDecoded) {
+      onDecoded(decoded);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_pendingDecodes;
+  }
+  _pool->enqueue([this, buffer = std::move(buffer), options, onDecoded]() {
+    auto decoded = std::make_shared<DecodedImage>(Decode(buffer, options));
+    if (onDecoded) {
+      asio::sync_callback_runner::PushCallback([decoded, onDecoded]() { onDecoded(*decoded); });
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_pendingDecodes == 0) {
+      _idle.notify_all();
+    }
+  });
+}
+
+std::vector<DecodedImage> TextureDecodePool::decodeAll(const std::vector<ArrayBuffer>& buffers,
+                                                       const TextureDecodeOptions& options)
+{
+  std::vector<DecodedImage> decoded(buffers.size());
+  _pool->parallelFor(0, buffers.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      decoded[i] = Decode(buffers[i], options);
+    }
+  });
+  return decoded;
+}
+
+size_t TextureDecodePool::pendingDecodes() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pendingDecodes;
+}
+
+void TextureDecodePool::waitAll()
+{
+  _waitWorkers();
+  asio::sync_callback_runner::CallAllPendingCallbacks();
+}
+
+void TextureDecodePool::_waitWorkers()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _idle.wait(lock, [this]() { return _pendingDecodes == 0; });
+}
+
+} // end of namespace BABYLON
@@ -10,6 +10,59 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * Compresses a dense target stream against the xyz components of the base data, which has stride
+ * floats per vertex. The dense data is released when compressed.
+ */
+SparseMorphDeltas CompressStream(const Float32Array& base, size_t stride, Float32Array& data,
+                                 float tolerance)
+{
+  if (data.empty() || base.size() % stride != 0 || base.size() / stride * 3 != data.size()) {
+    return SparseMorphDeltas();
+  }
+
+  SparseMorphDeltas deltas;
+  if (stride == 3) {
+    deltas = SparseMorphDeltas::Compress(base, data, 3, tolerance);
+  }
+  else {
+    Float32Array baseXYZ;
+    baseXYZ.reserve(data.size());
+    for (size_t i = 0; i < base.size(); i += stride) {
+      baseXYZ.insert(baseXYZ.end(), base.begin() + static_cast<long>(i),
+                     base.begin() + static_cast<long>(i + 3));
+    }
+    deltas = SparseMorphDeltas::Compress(baseXYZ, data, 3, tolerance);
+  }
+
+  Float32Array().swap(data);
+  return deltas;
+}
+
+/**
+ * Restores a dense target stream from the xyz components of the base data.
+ */
+void DecompressStream(const Float32Array& base, size_t stride, SparseMorphDeltas& deltas,
+                      Float32Array& data)
+{
+  if (deltas.vertexCount == 0 || base.size() != deltas.vertexCount * stride) {
+    return;
+  }
+
+  data.clear();
+  data.reserve(deltas.vertexCount * 3);
+  for (size_t i = 0; i < base.size(); i += stride) {
+    data.insert(data.end(), base.begin() + static_cast<long>(i),
+                base.begin() + static_cast<long>(i + 3));
+  }
+  deltas.accumulate(1.f, data.data());
+  deltas = SparseMorphDeltas();
+}
+
+} // end of anonymous namespace
+
 MorphTarget::MorphTarget(const std::string& name, float iInfluence, Scene* scene)
     : influence{this, &MorphTarget::get_influence, &MorphTarget::set_influence}
     , uniqueId{this, &MorphTarget::get_uniqueId}
@@ -19,6 +72,7 @@ MorphTarget::MorphTarget(const std::string& name, float iInfluence, Scene* scene
     , hasUVs{this, &MorphTarget::get_hasUVs}
     , _name{name}
     , _scene{scene ? scene : Engine::LastCreatedScene()}
+    , _compressed{false}
     , _influence{-1.f} // -1  means Undefined
     , _uniqueId{0}
     , _animationPropertiesOverride{nullptr}
@@ -106,17 +160,17 @@ size_t MorphTarget::get_uniqueId() const
 
 bool MorphTarget::get_hasPositions() const
 {
-  return !_positions.empty();
+  return !_positions.empty() || _sparsePositions.vertexCount > 0;
 }
 
 bool MorphTarget::get_hasNormals() const
 {
-  return !_normals.empty();
+  return !_normals.empty() || _sparseNormals.vertexCount > 0;
 }
 
 bool MorphTarget::get_hasTangents() const
 {
-  return !_tangents.empty();
+  return !_tangents.empty() || _sparseTangents.vertexCount > 0;
 }
 
 bool MorphTarget::get_hasUVs() const
@@ -133,7 +187,9 @@ void MorphTarget::setPositions(const Float32Array& data)
 {
   const auto hadPositions = hasPositions();
 
-  _positions = data;
+  _positions       = data;
+  _sparsePositions = SparseMorphDeltas();
+  _compressed      = false;
 
   if (hadPositions != hasPositions) {
     _onDataLayoutChanged.notifyObservers(nullptr);
@@ -149,7 +205,9 @@ void MorphTarget::setNormals(const Float32Array& data)
 {
   const auto hadNormals = hasNormals();
 
-  _normals = data;
+  _normals       = data;
+  _sparseNormals = SparseMorphDeltas();
+  _compressed    = false;
 
   if (hadNormals != hasNormals) {
     _onDataLayoutChanged.notifyObservers(nullptr);
@@ -175,7 +233,9 @@ void MorphTarget::setTangents(const Float32Array& data)
 {
   const auto hadTangents = hasTangents();
 
-  _tangents = data;
+  _tangents       = data;
+  _sparseTangents = SparseMorphDeltas();
+  _compressed     = false;
 
   if (hadTangents != hasTangents) {
     _onDataLayoutChanged.notifyObservers(nullptr);
@@ -282,4 +342,61 @@ MorphTargetPtr MorphTarget::FromMesh(const AbstractMeshPtr& mesh, std::string na
   return result;
 }
 
+size_t MorphTarget::getMemorySize() const
+{
+  return (_positions.size() + _normals.size() + _tangents.size() + _uvs.size()) * sizeof(float)
+         + _sparsePositions.memorySize() + _sparseNormals.memorySize()
+         + _sparseTangents.memorySize();
+}
+
+void MorphTarget::_compress(const Float32Array& basePositions, const Float32Array& baseNormals,
+                            const Float32Array& baseTangents, float tolerance)
+{
+  // The data set since the previous compression is compressed, the rest is already sparse
+  if (!_positions.empty()) {
+    _sparsePositions = CompressStream(basePositions, 3, _positions, tolerance);
+  }
+  if (!_normals.empty()) {
+    _sparseNormals = CompressStream(baseNormals, 3, _normals, tolerance);
+  }
+  if (!_tangents.empty()) {
+    _sparseTangents = CompressStream(baseTangents, 4, _tangents, tolerance);
+  }
+  _compressed = true;
+}
+
+void MorphTarget::_decompress(const Float32Array& basePositions, const Float32Array& baseNormals,
+                              const Float32Array& baseTangents)
+{
+  DecompressStream(basePositions, 3, _sparsePositions, _positions);
+  DecompressStream(baseNormals, 3, _sparseNormals, _normals);
+  DecompressStream(baseTangents, 4, _sparseTangents, _tangents);
+  _compressed = false;
+}
+
+bool MorphTarget::_isCompressed() const
+{
+  return _compressed;
+}
+
+size_t MorphTarget::_getVertexCount() const
+{
+  return _positions.empty() ? _sparsePositions.vertexCount : _positions.size() / 3;
+}
+
+const SparseMorphDeltas& MorphTarget::_getSparsePositions() const
+{
+  return _sparsePositions;
+}
+
+const SparseMorphDeltas& MorphTarget::_getSparseNormals() const
+{
+  return _sparseNormals;
+}
+
+const SparseMorphDeltas& MorphTarget::_getSparseTangents() const
+{
+  return _sparseTangents;
+}
+
 } // end of namespace BABYLON
@@ -1,5 +1,7 @@
 #include <babylon/morph/morph_target_manager.h>
 
+#include <algorithm>
+
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
@@ -21,11 +23,17 @@ MorphTargetManager::MorphTargetManager(Scene* scene)
     , numTargets{this, &MorphTargetManager::get_numTargets}
     , numInfluencers{this, &MorphTargetManager::get_numInfluencers}
     , influences{this, &MorphTargetManager::get_influences}
+    , useCPUBlending{this, &MorphTargetManager::get_useCPUBlending,
+                     &MorphTargetManager::set_useCPUBlending}
+    , cpuBlendingTolerance{0.f}
     , _supportsNormals{false}
     , _supportsTangents{false}
     , _supportsUVs{false}
     , _vertexCount{0}
     , _uniqueId{0}
+    , _useCPUBlending{false}
+    , _influencesUpdateId{0}
+    , _targetsLayoutId{0}
 {
   _scene = scene ? scene : Engine::LastCreatedScene();
 }
@@ -81,6 +89,27 @@ Float32Array& MorphTargetManager::get_influences()
   return _influences;
 }
 
+bool MorphTargetManager::get_useCPUBlending() const
+{
+  return _useCPUBlending;
+}
+
+void MorphTargetManager::set_useCPUBlending(bool value)
+{
+  if (_useCPUBlending == value) {
+    return;
+  }
+
+  _useCPUBlending = value;
+  ++_influencesUpdateId;
+  synchronize();
+}
+
+size_t MorphTargetManager::_getInfluencesUpdateId() const
+{
+  return _influencesUpdateId;
+}
+
 MorphTargetPtr MorphTargetManager::getActiveTarget(size_t index)
 {
   if (index < _activeTargets.size()) {
@@ -121,6 +150,7 @@ void MorphTargetManager::removeTarget(MorphTarget* target)
     size_t index = static_cast<size_t>(it - _targets.begin());
     target->onInfluenceChanged.remove(_targetInfluenceChangedObservers[index]);
     target->_onDataLayoutChanged.remove(_targetDataLayoutChangedObservers[index]);
+    ++_targetsLayoutId;
     _syncActiveTargets(true);
   }
 }
@@ -159,9 +189,8 @@ void MorphTargetManager::_syncActiveTargets(bool needUpdate)
     _supportsTangents = _supportsTangents && target->hasTangents();
     _supportsUVs      = _supportsUVs && target->hasUVs();
 
-    const auto& positions = target->getPositions();
-    if (!positions.empty()) {
-      const auto iVertexCount = positions.size() / 3;
+    const auto iVertexCount = target->_getVertexCount();
+    if (iVertexCount) {
       if (_vertexCount == 0) {
         _vertexCount = iVertexCount;
       }
@@ -178,6 +207,8 @@ void MorphTargetManager::_syncActiveTargets(bool needUpdate)
     _influences = _tempInfluences;
   }
 
+  ++_influencesUpdateId;
+
   if (needUpdate) {
     synchronize();
   }
@@ -197,6 +228,151 @@ void MorphTargetManager::synchronize()
   }
 }
 
+std::pair<size_t, size_t> _MorphTargetsCPUBase::restore(Float32Array& meshPositions,
+                                                        Float32Array& meshNormals,
+                                                        Float32Array& meshTangents) const
+{
+  const auto vertexCount = meshPositions.size() / 3;
+  const auto hasNormals  = meshNormals.size() == meshPositions.size()
+                          && normals.size() == positions.size();
+  const auto hasTangents
+    = meshTangents.size() == vertexCount * 4 && tangents.size() == vertices.size() * 4;
+  auto first = vertexCount;
+  size_t end = 0;
+  for (size_t i = 0; i < vertices.size() && positions.size() == vertices.size() * 3; ++i) {
+    const auto vertex = static_cast<size_t>(vertices[i]);
+    if (vertex >= vertexCount) {
+      continue;
+    }
+    std::copy_n(positions.begin() + static_cast<long>(i * 3), 3,
+                meshPositions.begin() + static_cast<long>(vertex * 3));
+    if (hasNormals) {
+      std::copy_n(normals.begin() + static_cast<long>(i * 3), 3,
+                  meshNormals.begin() + static_cast<long>(vertex * 3));
+    }
+    if (hasTangents) {
+      std::copy_n(tangents.begin() + static_cast<long>(i * 4), 4,
+                  meshTangents.begin() + static_cast<long>(vertex * 4));
+    }
+    first = std::min(first, vertex);
+    end   = std::max(end, vertex + 1);
+  }
+
+  return first < end ? std::make_pair(first, end) : std::make_pair(size_t(0), size_t(0));
+}
+
+std::pair<size_t, size_t> MorphTargetManager::blendOnCPU(_MorphTargetsCPUBase& base,
+                                                         Float32Array& positions,
+                                                         Float32Array& normals,
+                                                         Float32Array& tangents)
+{
+  const auto vertexCount = positions.size() / 3;
+  const auto hasNormals  = normals.size() == positions.size();
+  const auto hasTangents = tangents.size() == vertexCount * 4;
+
+  // Back to the data without morphing, only the vertices moved by the targets being stored
+  auto range = base.restore(positions, normals, tangents);
+
+  // The targets set since the previous blending are compressed against this data
+  static const Float32Array empty;
+  for (const auto& target : _targets) {
+    if (!target->_isCompressed()) {
+      target->_compress(positions, hasNormals ? normals : empty, hasTangents ? tangents : empty,
+                        cpuBlendingTolerance);
+      ++_targetsLayoutId;
+    }
+  }
+
+  if (base.layoutId != _targetsLayoutId) {
+    base.vertices.clear();
+    for (const auto& target : _targets) {
+      for (const auto* deltas : {&target->_getSparsePositions(), &target->_getSparseNormals(),
+                                 &target->_getSparseTangents()}) {
+        if (deltas->vertexCount == vertexCount) {
+          base.vertices.insert(base.vertices.end(), deltas->indices.begin(),
+                               deltas->indices.end());
+        }
+      }
+    }
+    std::sort(base.vertices.begin(), base.vertices.end());
+    base.vertices.erase(std::unique(base.vertices.begin(), base.vertices.end()),
+                        base.vertices.end());
+
+    base.positions.clear();
+    base.normals.clear();
+    base.tangents.clear();
+    for (auto index : base.vertices) {
+      const auto vertex = static_cast<long>(index);
+      base.positions.insert(base.positions.end(), positions.begin() + vertex * 3,
+                            positions.begin() + vertex * 3 + 3);
+      if (hasNormals) {
+        base.normals.insert(base.normals.end(), normals.begin() + vertex * 3,
+                            normals.begin() + vertex * 3 + 3);
+      }
+      if (hasTangents) {
+        base.tangents.insert(base.tangents.end(), tangents.begin() + vertex * 4,
+                             tangents.begin() + vertex * 4 + 4);
+      }
+    }
+    base.layoutId = _targetsLayoutId;
+  }
+
+  if (!base.vertices.empty()) {
+    const auto first = static_cast<size_t>(base.vertices.front());
+    const auto end   = static_cast<size_t>(base.vertices.back()) + 1;
+    if (range.first < range.second) {
+      range = {std::min(range.first, first), std::max(range.second, end)};
+    }
+    else {
+      range = {first, end};
+    }
+  }
+
+  for (const auto& target : _activeTargets) {
+    const auto influence = target->influence();
+    if (influence == 0.f) {
+      continue;
+    }
+
+    const auto& sparsePositions = target->_getSparsePositions();
+    if (sparsePositions.vertexCount == vertexCount) {
+      sparsePositions.accumulate(influence, positions.data());
+    }
+    const auto& sparseNormals = target->_getSparseNormals();
+    if (enableNormalMorphing && hasNormals && sparseNormals.vertexCount == vertexCount) {
+      sparseNormals.accumulate(influence, normals.data());
+    }
+    const auto& sparseTangents = target->_getSparseTangents();
+    if (enableTangentMorphing && hasTangents && sparseTangents.vertexCount == vertexCount) {
+      sparseTangents.accumulate(influence, tangents.data(), 4);
+    }
+  }
+
+  return range;
+}
+
+void MorphTargetManager::_decompressTargets(const Float32Array& positions,
+                                            const Float32Array& normals,
+                                            const Float32Array& tangents)
+{
+  for (const auto& target : _targets) {
+    if (target->_isCompressed()) {
+      target->_decompress(positions, normals, tangents);
+      ++_targetsLayoutId;
+    }
+  }
+}
+
+size_t MorphTargetManager::getTargetsMemorySize() const
+{
+  size_t size = 0;
+  for (const auto& target : _targets) {
+    size += target->getMemorySize();
+  }
+
+  return size;
+}
+
 MorphTargetManagerPtr MorphTargetManager::Parse(const json& serializationObject, Scene* scene)
 {
   auto result = MorphTargetManager::New(scene);
@@ -0,0 +1,137 @@
+#include <babylon/morph/sparse_morph_deltas.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+SparseMorphDeltas SparseMorphDeltas::Compress(const Float32Array& base, const Float32Array& target,
+                                              size_t components, float tolerance)
+{
+  SparseMorphDeltas result;
+  result.components = components;
+
+  if (components == 0 || components > MaxComponents || base.size() != target.size()
+      || base.size() % components != 0) {
+    return result;
+  }
+
+  result.vertexCount = base.size() / components;
+
+  float maxDelta = 0.f;
+  for (size_t i = 0; i < base.size(); ++i) {
+    maxDelta = std::max(maxDelta, std::abs(target[i] - base[i]));
+  }
+
+  if (maxDelta == 0.f || maxDelta <= tolerance) {
+    return result;
+  }
+
+  result.scale = maxDelta / 32767.f;
+
+  for (size_t vertex = 0; vertex < result.vertexCount; ++vertex) {
+    const auto offset = vertex * components;
+    bool moved        = false;
+    for (size_t c = 0; c < components && !moved; ++c) {
+      moved = std::abs(target[offset + c] - base[offset + c]) > tolerance;
+    }
+    if (!moved) {
+      continue;
+    }
+
+    result.indices.emplace_back(static_cast<uint32_t>(vertex));
+    for (size_t c = 0; c < MaxComponents; ++c) {
+      const auto delta = c < components ? target[offset + c] - base[offset + c] : 0.f;
+      const auto value = std::clamp(std::round(delta / result.scale), -32767.f, 32767.f);
+      result.values.emplace_back(static_cast<int16_t>(value));
+    }
+  }
+
+  return result;
+}
+
+void SparseMorphDeltas::accumulate(float influence, float* output, size_t stride) const
+{
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+  accumulateSSE2(influence, output, stride);
+#else
+  accumulateScalar(influence, output, stride);
+#endif
+}
+
+void SparseMorphDeltas::accumulateScalar(float influence, float* output, size_t stride) const
+{
+  if (indices.empty() || influence == 0.f) {
+    return;
+  }
+
+  stride       = std::max(stride, components);
+  const auto k = influence * scale;
+
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const auto target = output + static_cast<size_t>(indices[i]) * stride;
+    const auto delta  = values.data() + i * MaxComponents;
+    for (size_t c = 0; c < components; ++c) {
+      target[c] += static_cast<float>(delta[c]) * k;
+    }
+  }
+}
+
+bool SparseMorphDeltas::accumulateSSE2(float influence, float* output, size_t stride) const
+{
+#if defined(__SSE2__)
+  if (components < 3) {
+    accumulateScalar(influence, output, stride);
+    return true;
+  }
+  if (indices.empty() || influence == 0.f) {
+    return true;
+  }
+
+  stride        = std::max(stride, components);
+  const auto k  = influence * scale;
+  const auto kv = _mm_set1_ps(k);
+  // The 4th lane of 3 components deltas is written back unchanged
+  const auto mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, components == 4 ? -1 : 0));
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const auto vertex = static_cast<size_t>(indices[i]);
+    const auto target = output + vertex * stride;
+    const auto delta  = values.data() + i * MaxComponents;
+    // The 4th lane of a 3 floats stride overlaps the next vertex, the last vertex is updated lane
+    // by lane to stay in bounds
+    if (stride == 3 && vertex + 1 == vertexCount) {
+      for (size_t c = 0; c < 3; ++c) {
+        target[c] += static_cast<float>(delta[c]) * k;
+      }
+      continue;
+    }
+    const auto raw      = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(delta));
+    const auto integers = _mm_srai_epi32(_mm_unpacklo_epi16(raw, raw), 16);
+    const auto current  = _mm_loadu_ps(target);
+    const auto sum      = _mm_add_ps(current, _mm_mul_ps(_mm_cvtepi32_ps(integers), kv));
+    _mm_storeu_ps(target, _mm_or_ps(_mm_and_ps(mask, sum), _mm_andnot_ps(mask, current)));
+  }
+  return true;
+#else
+  (void)influence;
+  (void)output;
+  (void)stride;
+  return false;
+#endif
+}
+
+size_t SparseMorphDeltas::memorySize() const
+{
+  return indices.size() * sizeof(uint32_t) + values.size() * sizeof(int16_t);
+}
+
+bool SparseMorphDeltas::empty() const
+{
+  return indices.empty();
+}
+
+} // end of namespace BABYLON
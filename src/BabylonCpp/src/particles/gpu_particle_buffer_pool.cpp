@@ -0,0 +1,180 @@
+#include <babylon/particles/gpu_particle_buffer_pool.h>
+
+#include <algorithm>
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/buffer.h>
+
+namespace BABYLON {
+
+GPUParticleRangeAllocator::GPUParticleRangeAllocator(size_t pageCapacity)
+    : _pageCapacity{std::max(pageCapacity, static_cast<size_t>(1))}
+{
+}
+
+GPUParticleRangeAllocator::~GPUParticleRangeAllocator() = default;
+
+GPUParticleBufferRange GPUParticleRangeAllocator::allocate(size_t count)
+{
+  count = std::max(count, static_cast<size_t>(1));
+
+  for (size_t page = 0; page < _freeRanges.size(); ++page) {
+    auto& freeRanges = _freeRanges[page];
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it) {
+      if (it->second < count) {
+        continue;
+      }
+      const auto offset    = it->first;
+      const auto remaining = it->second - count;
+      freeRanges.erase(it);
+      if (remaining > 0) {
+        freeRanges[offset + count] = remaining;
+      }
+      _usedCounts[page] += count;
+      return {page, offset, count};
+    }
+  }
+
+  // New page
+  const auto page     = _freeRanges.size();
+  const auto capacity = std::max(_pageCapacity, count);
+  _pageCapacities.emplace_back(capacity);
+  _usedCounts.emplace_back(count);
+  _freeRanges.emplace_back();
+  if (capacity > count) {
+    _freeRanges[page][count] = capacity - count;
+  }
+  return {page, 0, count};
+}
+
+void GPUParticleRangeAllocator::release(const GPUParticleBufferRange& range)
+{
+  if (range.page >= _freeRanges.size() || range.count == 0) {
+    return;
+  }
+
+  auto& freeRanges = _freeRanges[range.page];
+  auto offset      = range.offset;
+  auto count       = range.count;
+  const auto next  = freeRanges.lower_bound(offset);
+
+  // Merge with the following free range
+  if (next != freeRanges.end() && next->first == offset + count) {
+    count += next->second;
+    freeRanges.erase(next);
+  }
+
+  // Merge with the preceding free range
+  auto it = freeRanges.lower_bound(offset);
+  if (it != freeRanges.begin()) {
+    --it;
+    if (it->first + it->second == offset) {
+      offset = it->first;
+      count += it->second;
+      freeRanges.erase(it);
+    }
+  }
+
+  freeRanges[offset] = count;
+  _usedCounts[range.page] -= std::min(range.count, _usedCounts[range.page]);
+}
+
+size_t GPUParticleRangeAllocator::getPageCount() const
+{
+  return _pageCapacities.size();
+}
+
+size_t GPUParticleRangeAllocator::getPageCapacity(size_t page) const
+{
+  return page < _pageCapacities.size() ? _pageCapacities[page] : 0;
+}
+
+size_t GPUParticleRangeAllocator::getUsedCount(size_t page) const
+{
+  return page < _usedCounts.size() ? _usedCounts[page] : 0;
+}
+
+void GPUParticleRangeAllocator::clear()
+{
+  _pageCapacities.clear();
+  _usedCounts.clear();
+  _freeRanges.clear();
+}
+
+GPUParticleBufferPool& GPUParticleBufferPool::ForScene(Scene* scene)
+{
+  if (!scene->_gpuParticleBufferPool) {
+    scene->_gpuParticleBufferPool = std::make_unique<GPUParticleBufferPool>(scene);
+  }
+
+  return *scene->_gpuParticleBufferPool;
+}
+
+GPUParticleBufferPool::GPUParticleBufferPool(Scene* scene, size_t pageCapacity)
+    : _scene{scene}, _pageCapacity{pageCapacity}
+{
+}
+
+GPUParticleBufferPool::~GPUParticleBufferPool() = default;
+
+GPUParticleBufferAllocation GPUParticleBufferPool::allocate(size_t stride,
+                                                            const Float32Array& data)
+{
+  auto it = _pages.find(stride);
+  if (it == _pages.end()) {
+    it = _pages.emplace(stride, StridePages{GPUParticleRangeAllocator(_pageCapacity), {}}).first;
+  }
+  auto& pages = it->second;
+
+  GPUParticleBufferAllocation allocation;
+  allocation.stride = stride;
+  allocation.range  = pages.allocator.allocate(stride > 0 ? data.size() / stride : 0);
+
+  if (allocation.range.page >= pages.buffers.size()) {
+    auto engine         = _scene->getEngine();
+    const auto capacity = pages.allocator.getPageCapacity(allocation.range.page);
+    const Float32Array emptyData(capacity * stride, 0.f);
+    pages.buffers.emplace_back(std::array<std::unique_ptr<Buffer>, 2>{
+      {std::make_unique<Buffer>(engine, emptyData, true, stride),
+       std::make_unique<Buffer>(engine, emptyData, true, stride)}});
+  }
+
+  auto& buffers = pages.buffers[allocation.range.page];
+  for (size_t i = 0; i < 2; ++i) {
+    buffers[i]->updateDirectly(data, allocation.range.offset * stride);
+    allocation.buffers[i] = buffers[i].get();
+  }
+
+  return allocation;
+}
+
+void GPUParticleBufferPool::release(const GPUParticleBufferAllocation& allocation)
+{
+  auto it = _pages.find(allocation.stride);
+  if (it != _pages.end()) {
+    it->second.allocator.release(allocation.range);
+  }
+}
+
+size_t GPUParticleBufferPool::getPageCount() const
+{
+  size_t pageCount = 0;
+  for (const auto& item : _pages) {
+    pageCount += item.second.buffers.size();
+  }
+  return pageCount;
+}
+
+void GPUParticleBufferPool::dispose()
+{
+  for (auto& item : _pages) {
+    for (auto& buffers : item.second.buffers) {
+      for (auto& buffer : buffers) {
+        buffer->dispose();
+      }
+    }
+  }
+  _pages.clear();
+}
+
+} // end of namespace BABYLON
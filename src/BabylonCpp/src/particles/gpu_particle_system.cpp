@@ -26,6 +26,7 @@
 #include <babylon/particles/emittertypes/box_particle_emitter.h>
 #include <babylon/particles/emittertypes/custom_particle_emitter.h>
 #include <babylon/particles/emittertypes/iparticle_emitter_type.h>
+#include <babylon/particles/gpu_particle_buffer_pool.h>
 #include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
@@ -44,12 +45,14 @@ GPUParticleSystem::GPUParticleSystem(const std::string& iName, size_t capacity,
     : BaseParticleSystem{iName}
     , activeParticleCount{this, &GPUParticleSystem::get_activeParticleCount,
                           &GPUParticleSystem::set_activeParticleCount}
+    , usePooledBuffers{false}
     , _accumulatedCount{0}
     , _renderEffect{nullptr}
     , _updateEffect{nullptr}
     , _buffer0{nullptr}
     , _buffer1{nullptr}
     , _spriteBuffer{nullptr}
+    , _bufferAllocation{nullptr}
     , _targetIndex{0}
     , _sourceBuffer{nullptr}
     , _targetBuffer{nullptr}
@@ -557,12 +560,13 @@ void GPUParticleSystem::_reset()
   _releaseBuffers();
 }
 
-WebGLVertexArrayObjectPtr GPUParticleSystem::_createUpdateVAO(Buffer* source)
+WebGLVertexArrayObjectPtr GPUParticleSystem::_createUpdateVAO(Buffer* source, size_t baseOffset)
 {
   std::unordered_map<std::string, VertexBufferPtr> updateVertexBuffers;
-  updateVertexBuffers["position"] = source->createVertexBuffer(VertexBuffer::PositionKind, 0, 3);
+  updateVertexBuffers["position"]
+    = source->createVertexBuffer(VertexBuffer::PositionKind, baseOffset, 3);
 
-  size_t offset = 3;
+  size_t offset = baseOffset + 3;
   if (particleEmitterType->getClassName() == "CustomParticleEmitter") {
     updateVertexBuffers["initialPosition"]
       = source->createVertexBuffer("initialPosition", offset, 3);
@@ -627,13 +631,14 @@ WebGLVertexArrayObjectPtr GPUParticleSystem::_createUpdateVAO(Buffer* source)
   return vao;
 }
 
-WebGLVertexArrayObjectPtr GPUParticleSystem::_createRenderVAO(Buffer* source, Buffer* spriteSource)
+WebGLVertexArrayObjectPtr GPUParticleSystem::_createRenderVAO(Buffer* source, Buffer* spriteSource,
+                                                              size_t baseOffset)
 {
   std::unordered_map<std::string, VertexBufferPtr> renderVertexBuffers;
-  auto attributesStrideSizeT = static_cast<size_t>(_attributesStrideSize);
-  renderVertexBuffers["position"]
-    = source->createVertexBuffer(VertexBuffer::PositionKind, 0, 3, attributesStrideSizeT, true);
-  size_t offset = 3;
+  auto attributesStrideSizeT      = static_cast<size_t>(_attributesStrideSize);
+  renderVertexBuffers["position"] = source->createVertexBuffer(
+    VertexBuffer::PositionKind, baseOffset, 3, attributesStrideSizeT, true);
+  size_t offset = baseOffset + 3;
   if (particleEmitterType->getClassName() == "CustomParticleEmitter") {
     offset += 3;
   }
@@ -676,7 +681,7 @@ WebGLVertexArrayObjectPtr GPUParticleSystem::_createRenderVAO(Buffer* source, Bu
 
   if (_isAnimationSheetEnabled) {
     renderVertexBuffers["cellIndex"] = source->createVertexBuffer(
-      VertexBuffer::CellIndexKind, attributesStrideSizeT, 1, _attributesStrideSize, true);
+      VertexBuffer::CellIndexKind, offset, 1, _attributesStrideSize, true);
     offset += 1;
     if (spriteRandomStartCell) {
       renderVertexBuffers["cellStartOffset"] = source->createVertexBuffer(
@@ -705,7 +710,7 @@ WebGLVertexArrayObjectPtr GPUParticleSystem::_createRenderVAO(Buffer* source, Bu
 
 void GPUParticleSystem::_initialize(bool force)
 {
-  if (_buffer0 && !force) {
+  if ((_buffer0 || _bufferAllocation) && !force) {
     return;
   }
 
@@ -837,23 +842,41 @@ void GPUParticleSystem::_initialize(bool force)
   };
 
   // Buffers
-  _buffer0      = std::make_unique<Buffer>(engine, data, false, _attributesStrideSize);
-  _buffer1      = std::make_unique<Buffer>(engine, data, false, _attributesStrideSize);
+  Buffer* buffer0   = nullptr;
+  Buffer* buffer1   = nullptr;
+  size_t baseOffset = 0;
+  if (usePooledBuffers) {
+    auto& pool = GPUParticleBufferPool::ForScene(_scene);
+    if (_bufferAllocation) {
+      pool.release(*_bufferAllocation);
+    }
+    _bufferAllocation = std::make_unique<GPUParticleBufferAllocation>(
+      pool.allocate(static_cast<size_t>(_attributesStrideSize), data));
+    buffer0    = _bufferAllocation->buffers[0];
+    buffer1    = _bufferAllocation->buffers[1];
+    baseOffset = _bufferAllocation->range.offset * static_cast<size_t>(_attributesStrideSize);
+  }
+  else {
+    _buffer0 = std::make_unique<Buffer>(engine, data, false, _attributesStrideSize);
+    _buffer1 = std::make_unique<Buffer>(engine, data, false, _attributesStrideSize);
+    buffer0  = _buffer0.get();
+    buffer1  = _buffer1.get();
+  }
   _spriteBuffer = std::make_unique<Buffer>(engine, spriteData, false, 4);
 
   // Update VAO
   _updateVAO.clear();
-  _updateVAO.emplace_back(_createUpdateVAO(_buffer0.get()));
-  _updateVAO.emplace_back(_createUpdateVAO(_buffer1.get()));
+  _updateVAO.emplace_back(_createUpdateVAO(buffer0, baseOffset));
+  _updateVAO.emplace_back(_createUpdateVAO(buffer1, baseOffset));
 
   // Render VAO
   _renderVAO.clear();
-  _renderVAO.emplace_back(_createRenderVAO(_buffer1.get(), _spriteBuffer.get()));
-  _renderVAO.emplace_back(_createRenderVAO(_buffer0.get(), _spriteBuffer.get()));
+  _renderVAO.emplace_back(_createRenderVAO(buffer1, _spriteBuffer.get(), baseOffset));
+  _renderVAO.emplace_back(_createRenderVAO(buffer0, _spriteBuffer.get(), baseOffset));
 
   // Links
-  _sourceBuffer = _buffer0.get();
-  _targetBuffer = _buffer1.get();
+  _sourceBuffer = buffer0;
+  _targetBuffer = buffer1;
 }
 
 void GPUParticleSystem::_recreateUpdateEffect()
@@ -1278,8 +1301,16 @@ size_t GPUParticleSystem::render(bool preWarm)
   // Bind source VAO
   _engine->bindVertexArrayObject(_updateVAO[_targetIndex], nullptr);
 
-  // Update
-  _engine->bindTransformFeedbackBuffer(_targetBuffer->getBuffer());
+  // Update (only the range of the particles of this system when the buffers are shared)
+  if (_bufferAllocation) {
+    const auto byteStride = static_cast<size_t>(_attributesStrideSize) * sizeof(float);
+    _engine->bindTransformFeedbackBufferRange(_targetBuffer->getBuffer(),
+                                              _bufferAllocation->range.offset * byteStride,
+                                              _bufferAllocation->range.count * byteStride);
+  }
+  else {
+    _engine->bindTransformFeedbackBuffer(_targetBuffer->getBuffer());
+  }
   _engine->setRasterizerState(false);
   _engine->beginTransformFeedback();
   _engine->drawArraysType(Material::PointListDrawMode, 0, static_cast<int>(_currentActiveCount));
@@ -1391,6 +1422,13 @@ void GPUParticleSystem::_releaseBuffers()
     _spriteBuffer->dispose();
     _spriteBuffer = nullptr;
   }
+  if (_bufferAllocation) {
+    // The pool is released with the scene, which does not create it again
+    if (_scene->_gpuParticleBufferPool) {
+      _scene->_gpuParticleBufferPool->release(*_bufferAllocation);
+    }
+    _bufferAllocation = nullptr;
+  }
 }
 
 void GPUParticleSystem::_releaseVAOs()
@@ -0,0 +1,231 @@
+#include <babylon/particles/particle_arena.h>
+
+#include <algorithm>
+
+#include <babylon/engines/scene.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
+
+namespace BABYLON {
+
+ParticleArena& ParticleArena::ForScene(Scene* scene)
+{
+  if (!scene->_particleArena) {
+    scene->_particleArena = std::make_unique<ParticleArena>(scene);
+  }
+
+  return *scene->_particleArena;
+}
+
+ParticleArena::ParticleArena(Scene* scene)
+    : blockSize{256}
+    , _scene{scene}
+    , _particleCount{0}
+    , _allocationCount{0}
+    , _frameAllocationCount{0}
+    , _subSystemCount{0}
+{
+}
+
+ParticleArena::~ParticleArena() = default;
+
+ParticleArena::FreeList& ParticleArena::_getThreadFreeList()
+{
+  static std::atomic<size_t> threadCount{0};
+  thread_local const size_t threadIndex = threadCount++;
+  return _freeLists[threadIndex % MaxThreadFreeLists];
+}
+
+Particle* ParticleArena::acquireParticle(ParticleSystem* particleSystem)
+{
+  auto& freeList = _getThreadFreeList();
+  std::lock_guard<std::mutex> lock(freeList.mutex);
+  if (freeList.particles.empty() && !_stealParticles(freeList)) {
+    _allocateBlock(particleSystem, freeList);
+  }
+
+  auto particle = freeList.particles.back();
+  freeList.particles.pop_back();
+
+  // The particle may come from another system, with other options
+  *particle = Particle(particleSystem);
+  return particle;
+}
+
+void ParticleArena::releaseParticle(Particle* particle)
+{
+  auto& freeList = _getThreadFreeList();
+  std::lock_guard<std::mutex> lock(freeList.mutex);
+  _reserveFreeList(freeList, 1);
+  freeList.particles.emplace_back(particle);
+}
+
+void ParticleArena::releaseParticles(std::vector<Particle*>& particles)
+{
+  if (particles.empty()) {
+    return;
+  }
+
+  auto& freeList = _getThreadFreeList();
+  {
+    std::lock_guard<std::mutex> lock(freeList.mutex);
+    _reserveFreeList(freeList, particles.size());
+    freeList.particles.insert(freeList.particles.end(), particles.begin(), particles.end());
+  }
+  particles.clear();
+}
+
+bool ParticleArena::_stealParticles(FreeList& freeList)
+{
+  // The free lists are only tried, two threads stealing from each other cannot block
+  for (auto& other : _freeLists) {
+    if (&other == &freeList) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(other.mutex, std::try_to_lock);
+    if (lock.owns_lock() && !other.particles.empty()) {
+      std::swap(freeList.particles, other.particles);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ParticleArena::_allocateBlock(ParticleSystem* particleSystem, FreeList& freeList)
+{
+  const auto count = std::max(blockSize, static_cast<size_t>(1));
+  _reserveFreeList(freeList, count);
+
+  std::lock_guard<std::mutex> lock(_blocksMutex);
+  _blocks.emplace_back();
+  auto& block = _blocks.back();
+  block.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    block.emplace_back(particleSystem);
+    freeList.particles.emplace_back(&block.back());
+  }
+  _particleCount += count;
+  _countAllocation();
+}
+
+void ParticleArena::_reserveFreeList(FreeList& freeList, size_t count)
+{
+  auto& particles = freeList.particles;
+  if (particles.size() + count > particles.capacity()) {
+    particles.reserve(std::max(particles.size() + count, 2 * particles.capacity()));
+    _countAllocation();
+  }
+}
+
+void ParticleArena::_countAllocation()
+{
+  // Only the total matters, the increments do not order other memory operations
+  _allocationCount.fetch_add(1, std::memory_order_relaxed);
+  _frameAllocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+ParticleSystem* ParticleArena::acquireSubSystem(ParticleSystem* templateSystem)
+{
+  auto& pool = _subSystemPools[templateSystem];
+  if (!pool.onTemplateDisposeObserver) {
+    pool.onTemplateDisposeObserver = templateSystem->onDisposeObservable.add(
+      [this](ParticleSystem* particleSystem, EventState& /*es*/) {
+        _removeSubSystemPool(particleSystem);
+      });
+  }
+
+  if (!pool.freeSystems.empty()) {
+    auto subSystem = pool.freeSystems.back();
+    pool.freeSystems.pop_back();
+    return subSystem;
+  }
+
+  ++_subSystemCount;
+  _countAllocation();
+  return templateSystem->_instantiateSubSystem();
+}
+
+void ParticleArena::releaseSubSystem(ParticleSystem* subSystem)
+{
+  auto it = _subSystemPools.find(subSystem->_subEmitterTemplate);
+  if (it == _subSystemPools.end()) {
+    _scene->_toBeDisposed.emplace_back(subSystem);
+    return;
+  }
+
+  auto& freeSystems = it->second.freeSystems;
+  if (freeSystems.size() == freeSystems.capacity()) {
+    _countAllocation();
+  }
+  freeSystems.emplace_back(subSystem);
+}
+
+void ParticleArena::_removeSubSystemPool(ParticleSystem* templateSystem)
+{
+  auto it = _subSystemPools.find(templateSystem);
+  if (it == _subSystemPools.end()) {
+    return;
+  }
+
+  // The stopped systems are disposed after the frame, the running ones when they end
+  for (auto subSystem : it->second.freeSystems) {
+    _scene->_toBeDisposed.emplace_back(subSystem);
+  }
+  _subSystemPools.erase(it);
+}
+
+size_t ParticleArena::getAllocationCount() const
+{
+  return _allocationCount.load(std::memory_order_relaxed);
+}
+
+size_t ParticleArena::getParticleCount() const
+{
+  return _particleCount;
+}
+
+size_t ParticleArena::getFreeParticleCount() const
+{
+  size_t count = 0;
+  for (const auto& freeList : _freeLists) {
+    std::lock_guard<std::mutex> lock(freeList.mutex);
+    count += freeList.particles.size();
+  }
+  return count;
+}
+
+size_t ParticleArena::getSubSystemCount() const
+{
+  return _subSystemCount;
+}
+
+size_t ParticleArena::getFreeSubSystemCount() const
+{
+  size_t count = 0;
+  for (const auto& item : _subSystemPools) {
+    count += item.second.freeSystems.size();
+  }
+  return count;
+}
+
+PerfCounter& ParticleArena::getAllocationsCounter()
+{
+  return _allocationsCounter;
+}
+
+void ParticleArena::_fetchNewFrame()
+{
+  _allocationsCounter.fetchNewFrame();
+  _allocationsCounter.addCount(_frameAllocationCount.exchange(0, std::memory_order_relaxed), true);
+}
+
+void ParticleArena::dispose()
+{
+  for (auto& item : _subSystemPools) {
+    item.first->onDisposeObservable.remove(item.second.onTemplateDisposeObserver);
+  }
+  _subSystemPools.clear();
+}
+
+} // end of namespace BABYLON
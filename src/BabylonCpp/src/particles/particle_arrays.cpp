@@ -0,0 +1,520 @@
+#include <babylon/particles/particle_arrays.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/misc/color_gradient.h>
+#include <babylon/misc/factor_gradient.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * Gradients flattened for the kernels: the values picked between value1 and value2 with the seed
+ * of the particles.
+ */
+struct GradientTable {
+  std::vector<float> gradients;
+  std::vector<float> values1;
+  std::vector<float> values2;
+
+  [[nodiscard]] bool empty() const
+  {
+    return gradients.empty();
+  }
+};
+
+GradientTable ToTable(const std::vector<FactorGradient>* gradients)
+{
+  GradientTable table;
+  if (gradients) {
+    for (const auto& gradient : *gradients) {
+      table.gradients.emplace_back(gradient.gradient);
+      table.values1.emplace_back(gradient.factor1);
+      table.values2.emplace_back(gradient.factor2.value_or(gradient.factor1));
+    }
+  }
+  return table;
+}
+
+std::array<GradientTable, 4> ToTables(const std::vector<ColorGradient>* gradients)
+{
+  std::array<GradientTable, 4> tables;
+  if (gradients) {
+    for (const auto& gradient : *gradients) {
+      const auto& color1 = gradient.color1;
+      const auto& color2 = gradient.color2.value_or(gradient.color1);
+      const std::array<float, 4> values1{color1.r, color1.g, color1.b, color1.a};
+      const std::array<float, 4> values2{color2.r, color2.g, color2.b, color2.a};
+      for (size_t c = 0; c < 4; ++c) {
+        tables[c].gradients.emplace_back(gradient.gradient);
+        tables[c].values1.emplace_back(values1[c]);
+        tables[c].values2.emplace_back(values2[c]);
+      }
+    }
+  }
+  return tables;
+}
+
+/**
+ * One particle per operation.
+ */
+struct ScalarLanes {
+  using V                       = float;
+  using M                       = bool;
+  static constexpr size_t Width = 1;
+
+  static V Load(const float* p)
+  {
+    return *p;
+  }
+  static void Store(float* p, V v)
+  {
+    *p = v;
+  }
+  static V Set(float f)
+  {
+    return f;
+  }
+  static V Add(V a, V b)
+  {
+    return a + b;
+  }
+  static V Sub(V a, V b)
+  {
+    return a - b;
+  }
+  static V Mul(V a, V b)
+  {
+    return a * b;
+  }
+  static V Div(V a, V b)
+  {
+    return a / b;
+  }
+  // Same results as _mm_min_ps / _mm_max_ps
+  static V Min(V a, V b)
+  {
+    return a < b ? a : b;
+  }
+  static V Max(V a, V b)
+  {
+    return a > b ? a : b;
+  }
+  static V Sqrt(V a)
+  {
+    return std::sqrt(a);
+  }
+  static M Greater(V a, V b)
+  {
+    return a > b;
+  }
+  static M GreaterEqual(V a, V b)
+  {
+    return a >= b;
+  }
+  static V Select(M mask, V a, V b)
+  {
+    return mask ? a : b;
+  }
+};
+
+#if defined(__SSE2__)
+
+/**
+ * Four particles per operation.
+ */
+struct SseLanes {
+  using V                       = __m128;
+  using M                       = __m128;
+  static constexpr size_t Width = 4;
+
+  static V Load(const float* p)
+  {
+    return _mm_loadu_ps(p);
+  }
+  static void Store(float* p, V v)
+  {
+    _mm_storeu_ps(p, v);
+  }
+  static V Set(float f)
+  {
+    return _mm_set1_ps(f);
+  }
+  static V Add(V a, V b)
+  {
+    return _mm_add_ps(a, b);
+  }
+  static V Sub(V a, V b)
+  {
+    return _mm_sub_ps(a, b);
+  }
+  static V Mul(V a, V b)
+  {
+    return _mm_mul_ps(a, b);
+  }
+  static V Div(V a, V b)
+  {
+    return _mm_div_ps(a, b);
+  }
+  static V Min(V a, V b)
+  {
+    return _mm_min_ps(a, b);
+  }
+  static V Max(V a, V b)
+  {
+    return _mm_max_ps(a, b);
+  }
+  static V Sqrt(V a)
+  {
+    return _mm_sqrt_ps(a);
+  }
+  static M Greater(V a, V b)
+  {
+    return _mm_cmpgt_ps(a, b);
+  }
+  static M GreaterEqual(V a, V b)
+  {
+    return _mm_cmpge_ps(a, b);
+  }
+  static V Select(M mask, V a, V b)
+  {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+  }
+};
+
+#endif // __SSE2__
+
+/**
+ * Samples a gradient table at the given ratios (GradientHelper::GetCurrentGradient): the value of
+ * the first gradient before it, of the last one after it, else interpolated in the segment
+ * containing the ratio.
+ */
+template <typename L>
+typename L::V Sample(const GradientTable& table, typename L::V ratio, typename L::V seed)
+{
+  const auto pick = [&table, &seed](size_t index) {
+    const auto value1 = L::Set(table.values1[index]);
+    return L::Add(value1, L::Mul(L::Sub(L::Set(table.values2[index]), value1), seed));
+  };
+
+  auto value     = pick(0);
+  auto nextValue = value;
+  for (size_t k = 0; k + 1 < table.gradients.size(); ++k) {
+    const auto currentValue = nextValue;
+    nextValue               = pick(k + 1);
+
+    const auto start = table.gradients[k];
+    const auto range = table.gradients[k + 1] - start;
+    const auto scale
+      = range > 0.f ?
+          L::Min(L::Max(L::Div(L::Sub(ratio, L::Set(start)), L::Set(range)), L::Set(0.f)),
+                 L::Set(1.f)) :
+          L::Set(1.f);
+    const auto interpolated = L::Add(currentValue, L::Mul(L::Sub(nextValue, currentValue), scale));
+    value = L::Select(L::GreaterEqual(ratio, L::Set(start)), interpolated, value);
+  }
+
+  return value;
+}
+
+struct UpdateContext {
+  const ParticleArraysUpdate& parameters;
+  std::array<GradientTable, 4> colors;
+  GradientTable sizes;
+  GradientTable angularSpeeds;
+  GradientTable velocities;
+  GradientTable limitVelocities;
+  GradientTable drags;
+};
+
+/**
+ * Updates the particles [begin, end), end - begin being a multiple of L::Width.
+ */
+template <typename L>
+void UpdateParticles(ParticleArrays& a, const UpdateContext& context, size_t begin, size_t end)
+{
+  using V                = typename L::V;
+  const auto& parameters = context.parameters;
+
+  const auto zero     = L::Set(0.f);
+  const auto one      = L::Set(1.f);
+  const auto step     = L::Set(parameters.step);
+  const auto gravityX = L::Set(parameters.gravity.x);
+  const auto gravityY = L::Set(parameters.gravity.y);
+  const auto gravityZ = L::Set(parameters.gravity.z);
+  const auto damping  = L::Set(parameters.limitVelocityDamping);
+
+  for (size_t i = begin; i < end; i += L::Width) {
+    // Age, the last step of a dying particle stops at its life time
+    const auto previousAge = L::Load(&a.age[i]);
+    const auto lifeTime    = L::Load(&a.lifeTime[i]);
+    const auto age         = L::Add(previousAge, step);
+    const auto dying       = L::Greater(age, lifeTime);
+    const auto scaledStep  = L::Select(dying, L::Sub(lifeTime, previousAge), step);
+    const auto clampedAge  = L::Select(dying, lifeTime, age);
+    L::Store(&a.age[i], clampedAge);
+    const auto ratio = L::Div(clampedAge, lifeTime);
+    const auto seed  = L::Load(&a.gradientSeed[i]);
+
+    // Color
+    if (!context.colors[0].empty()) {
+      L::Store(&a.colorR[i], Sample<L>(context.colors[0], ratio, seed));
+      L::Store(&a.colorG[i], Sample<L>(context.colors[1], ratio, seed));
+      L::Store(&a.colorB[i], Sample<L>(context.colors[2], ratio, seed));
+      L::Store(&a.colorA[i], Sample<L>(context.colors[3], ratio, seed));
+    }
+    else {
+      const auto stepColor = [&](Float32Array& color, const Float32Array& colorStep) {
+        return L::Add(L::Load(&color[i]), L::Mul(L::Load(&colorStep[i]), scaledStep));
+      };
+      L::Store(&a.colorR[i], stepColor(a.colorR, a.colorStepR));
+      L::Store(&a.colorG[i], stepColor(a.colorG, a.colorStepG));
+      L::Store(&a.colorB[i], stepColor(a.colorB, a.colorStepB));
+      L::Store(&a.colorA[i], L::Max(stepColor(a.colorA, a.colorStepA), zero));
+    }
+
+    // Angular speed
+    auto angularSpeed = L::Load(&a.angularSpeed[i]);
+    if (!context.angularSpeeds.empty()) {
+      angularSpeed = Sample<L>(context.angularSpeeds, ratio, seed);
+      L::Store(&a.angularSpeed[i], angularSpeed);
+    }
+    L::Store(&a.angle[i], L::Add(L::Load(&a.angle[i]), L::Mul(angularSpeed, scaledStep)));
+
+    // Velocity
+    auto directionScale = scaledStep;
+    if (!context.velocities.empty()) {
+      directionScale = L::Mul(directionScale, Sample<L>(context.velocities, ratio, seed));
+    }
+    V directionX       = L::Load(&a.directionX[i]);
+    V directionY       = L::Load(&a.directionY[i]);
+    V directionZ       = L::Load(&a.directionZ[i]);
+    V scaledDirectionX = L::Mul(directionX, directionScale);
+    V scaledDirectionY = L::Mul(directionY, directionScale);
+    V scaledDirectionZ = L::Mul(directionZ, directionScale);
+
+    // Limit velocity, applied to the next steps
+    if (!context.limitVelocities.empty()) {
+      const auto limitVelocity   = Sample<L>(context.limitVelocities, ratio, seed);
+      const auto currentVelocity = L::Sqrt(L::Add(
+        L::Add(L::Mul(directionX, directionX), L::Mul(directionY, directionY)),
+        L::Mul(directionZ, directionZ)));
+      const auto limited = L::Greater(currentVelocity, limitVelocity);
+      directionX         = L::Select(limited, L::Mul(directionX, damping), directionX);
+      directionY         = L::Select(limited, L::Mul(directionY, damping), directionY);
+      directionZ         = L::Select(limited, L::Mul(directionZ, damping), directionZ);
+    }
+
+    // Drag
+    if (!context.drags.empty()) {
+      const auto drag  = L::Sub(one, Sample<L>(context.drags, ratio, seed));
+      scaledDirectionX = L::Mul(scaledDirectionX, drag);
+      scaledDirectionY = L::Mul(scaledDirectionY, drag);
+      scaledDirectionZ = L::Mul(scaledDirectionZ, drag);
+    }
+
+    L::Store(&a.positionX[i], L::Add(L::Load(&a.positionX[i]), scaledDirectionX));
+    L::Store(&a.positionY[i], L::Add(L::Load(&a.positionY[i]), scaledDirectionY));
+    L::Store(&a.positionZ[i], L::Add(L::Load(&a.positionZ[i]), scaledDirectionZ));
+
+    // Gravity
+    L::Store(&a.directionX[i], L::Add(directionX, L::Mul(gravityX, scaledStep)));
+    L::Store(&a.directionY[i], L::Add(directionY, L::Mul(gravityY, scaledStep)));
+    L::Store(&a.directionZ[i], L::Add(directionZ, L::Mul(gravityZ, scaledStep)));
+
+    // Size
+    if (!context.sizes.empty()) {
+      L::Store(&a.size[i], Sample<L>(context.sizes, ratio, seed));
+    }
+  }
+}
+
+/**
+ * Updates the particles [begin, end) on the calling thread, the particles after the last group of
+ * L::Width particles one by one.
+ */
+template <typename L>
+void UpdateRange(ParticleArrays& a, const UpdateContext& context, size_t begin, size_t end)
+{
+  const auto lanesEnd = begin + ((end - begin) / L::Width) * L::Width;
+  UpdateParticles<L>(a, context, begin, lanesEnd);
+  UpdateParticles<ScalarLanes>(a, context, lanesEnd, end);
+}
+
+template <typename L>
+void Update(ParticleArrays& a, const ParticleArraysUpdate& parameters)
+{
+  if (a.count() == 0) {
+    return;
+  }
+
+  // The gradients are flattened once, the blocks only read them
+  const UpdateContext context{parameters,
+                              ToTables(parameters.colorGradients),
+                              ToTable(parameters.sizeGradients),
+                              ToTable(parameters.angularSpeedGradients),
+                              ToTable(parameters.velocityGradients),
+                              ToTable(parameters.limitVelocityGradients),
+                              ToTable(parameters.dragGradients)};
+  ThreadPool::Default().parallelFor(0, a.count(), std::max<size_t>(parameters.blockSize, 4),
+                                    [&a, &context](size_t begin, size_t end) {
+                                      UpdateRange<L>(a, context, begin, end);
+                                    });
+}
+
+} // end of anonymous namespace
+
+ParticleArrays::ParticleArrays() : _count{0}
+{
+}
+
+ParticleArrays::~ParticleArrays() = default;
+
+size_t ParticleArrays::count() const
+{
+  return _count;
+}
+
+size_t ParticleArrays::capacity() const
+{
+  return age.size();
+}
+
+void ParticleArrays::reserve(size_t iCapacity)
+{
+  for (auto stream : _streams()) {
+    stream->resize(iCapacity, 0.f);
+  }
+  _count = std::min(_count, iCapacity);
+}
+
+size_t ParticleArrays::add()
+{
+  if (_count == capacity()) {
+    return _count;
+  }
+
+  for (auto stream : _streams()) {
+    (*stream)[_count] = 0.f;
+  }
+  return _count++;
+}
+
+void ParticleArrays::clear()
+{
+  _count = 0;
+}
+
+void ParticleArrays::update(const ParticleArraysUpdate& parameters)
+{
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+  updateSSE2(parameters);
+#else
+  updateScalar(parameters);
+#endif
+}
+
+void ParticleArrays::updateScalar(const ParticleArraysUpdate& parameters)
+{
+  Update<ScalarLanes>(*this, parameters);
+}
+
+bool ParticleArrays::updateSSE2(const ParticleArraysUpdate& parameters)
+{
+#if defined(__SSE2__)
+  Update<SseLanes>(*this, parameters);
+  return true;
+#else
+  (void)parameters;
+  return false;
+#endif
+}
+
+size_t ParticleArrays::removeDeadParticles()
+{
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+  return *removeDeadParticlesSSE2();
+#else
+  return removeDeadParticlesScalar();
+#endif
+}
+
+size_t ParticleArrays::removeDeadParticlesScalar()
+{
+  const auto initialCount = _count;
+
+  size_t i = 0;
+  while (i < _count) {
+    if (age[i] >= lifeTime[i]) {
+      // The moved particle is checked at the next iteration
+      _move(--_count, i);
+    }
+    else {
+      ++i;
+    }
+  }
+
+  return initialCount - _count;
+}
+
+std::optional<size_t> ParticleArrays::removeDeadParticlesSSE2()
+{
+#if defined(__SSE2__)
+  const auto initialCount = _count;
+
+  size_t i = 0;
+  while (i < _count) {
+    // Skip the blocks of living particles
+    if (i + 4 <= _count) {
+      auto mask = _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(&age[i]), _mm_loadu_ps(&lifeTime[i])));
+      if (mask == 0) {
+        i += 4;
+        continue;
+      }
+      while ((mask & 1) == 0) {
+        mask >>= 1;
+        ++i;
+      }
+    }
+    if (age[i] >= lifeTime[i]) {
+      // The moved particle is checked at the next iteration
+      _move(--_count, i);
+    }
+    else {
+      ++i;
+    }
+  }
+
+  return initialCount - _count;
+#else
+  return std::nullopt;
+#endif
+}
+
+std::array<Float32Array*, ParticleArrays::StreamCount> ParticleArrays::_streams()
+{
+  return {&positionX,  &positionY,  &positionZ,  &directionX, &directionY, &directionZ,
+          &colorR,     &colorG,     &colorB,     &colorA,     &colorStepR, &colorStepG,
+          &colorStepB, &colorStepA, &age,        &lifeTime,   &size,       &scaleX,
+          &scaleY,     &angle,      &angularSpeed, &gradientSeed};
+}
+
+void ParticleArrays::_move(size_t from, size_t to)
+{
+  if (from == to) {
+    return;
+  }
+
+  for (auto stream : _streams()) {
+    (*stream)[to] = (*stream)[from];
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,267 @@
+#include <babylon/particles/particle_budget_manager.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/cameras/camera.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/plane.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/particles/particle_system.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Number of steps of the search of the budget scale
+constexpr unsigned int BudgetSearchSteps = 32;
+
+bool IsSphereInFrustum(const std::array<Plane, 6>& frustumPlanes, const Vector3& center,
+                       float radius)
+{
+  for (const auto& plane : frustumPlanes) {
+    if (plane.dotCoordinate(center) < -radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
+ParticleBudgetManager& ParticleBudgetManager::ForScene(Scene* scene)
+{
+  if (!scene->_particleBudgetManager) {
+    scene->_particleBudgetManager = std::make_unique<ParticleBudgetManager>(scene);
+  }
+
+  return *scene->_particleBudgetManager;
+}
+
+ParticleBudgetManager::ParticleBudgetManager(Scene* scene)
+    : enabled{true}
+    , maxParticles{10000}
+    , maxOverdraw{0.f}
+    , fullRateScreenSize{0.1f}
+    , maxUpdateInterval{4}
+    , minWeight{0.05f}
+    , emitterRadius{1.f}
+    , _scene{scene}
+    , _onBeforeParticlesRenderingObserver{nullptr}
+    , _updateFrameId{-1}
+    , _liveParticleCount{0}
+    , _allowedParticleCount{0}
+    , _estimatedOverdraw{0.f}
+{
+  if (_scene) {
+    // Notified for each camera and rendering group, the decisions are taken once per frame
+    _onBeforeParticlesRenderingObserver = _scene->onBeforeParticlesRenderingObservable.add(
+      [this](Scene* scene, EventState& /*es*/) {
+        if (scene->getFrameId() != _updateFrameId) {
+          _updateFrameId = scene->getFrameId();
+          update();
+        }
+      });
+  }
+}
+
+ParticleBudgetManager::~ParticleBudgetManager() = default;
+
+void ParticleBudgetManager::update()
+{
+  auto camera = _scene ? _scene->activeCamera() : nullptr;
+  if (!enabled || !camera) {
+    _reset();
+    return;
+  }
+
+  _decisions.clear();
+  _liveParticleCount = 0;
+
+  const auto& cameraPosition = camera->globalPosition();
+  const auto& frustumPlanes  = _scene->frustumPlanes();
+  const auto tanHalfFov      = std::max(std::tan(camera->fov * 0.5f), 1e-3f);
+  const auto aspectRatio     = std::max(_scene->getEngine()->getAspectRatio(*camera), 1e-3f);
+
+  for (const auto& system : _scene->particleSystems) {
+    auto particleSystem = dynamic_cast<ParticleSystem*>(system.get());
+    if (!particleSystem || !particleSystem->isStarted() || !particleSystem->hasEmitter()) {
+      continue;
+    }
+
+    ParticleBudgetDecision decision;
+    decision.particleSystem    = particleSystem;
+    decision.liveParticles     = particleSystem->getActiveParticleCount();
+    decision.requestedCapacity = particleSystem->getCapacity();
+
+    Vector3 center;
+    auto radius = emitterRadius;
+    if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)) {
+      const auto& boundingSphere
+        = std::get<AbstractMeshPtr>(particleSystem->emitter)->getBoundingInfo()->boundingSphere;
+      center = boundingSphere.centerWorld;
+      radius = std::max(boundingSphere.radiusWorld, emitterRadius);
+    }
+    else {
+      center = std::get<Vector3>(particleSystem->emitter);
+    }
+
+    // Sizes relative to the height of the screen
+    decision.distance = Vector3::Distance(center, cameraPosition);
+    const auto height = 2.f * std::max(decision.distance, camera->minZ) * tanHalfFov;
+    const auto maxSize
+      = particleSystem->maxSize * std::max(particleSystem->maxScaleX, particleSystem->maxScaleY);
+    decision.visible            = IsSphereInFrustum(frustumPlanes, center, radius);
+    decision.screenSize         = 2.f * radius / height;
+    decision.particleScreenArea = (maxSize / height) * (maxSize / height) / aspectRatio;
+
+    _liveParticleCount += decision.liveParticles;
+    _decisions.emplace_back(decision);
+  }
+
+  allocate(_decisions);
+
+  _allowedParticleCount = 0;
+  _estimatedOverdraw    = 0.f;
+  for (const auto& decision : _decisions) {
+    _allowedParticleCount += decision.capacity;
+    _estimatedOverdraw += static_cast<float>(decision.capacity) * decision.particleScreenArea;
+
+    auto particleSystem                   = decision.particleSystem;
+    particleSystem->_budgetCapacity       = decision.capacity;
+    particleSystem->_budgetEmitRateScale  = decision.emitRateScale;
+    particleSystem->_budgetUpdateInterval = decision.updateInterval;
+  }
+
+  onDecisionsAppliedObservable.notifyObservers(this);
+}
+
+void ParticleBudgetManager::allocate(std::vector<ParticleBudgetDecision>& decisions) const
+{
+  const auto lowestWeight    = std::clamp(minWeight, 1e-3f, 1.f);
+  const auto largestInterval = std::max(maxUpdateInterval, 1u);
+
+  // Update intervals and weights from the screen sizes
+  std::vector<float> weights(decisions.size());
+  size_t requestedCount = 0;
+  for (size_t i = 0; i < decisions.size(); ++i) {
+    auto& decision = decisions[i];
+    if (!decision.visible) {
+      decision.updateInterval = largestInterval;
+      weights[i]              = lowestWeight;
+    }
+    else if (decision.screenSize >= fullRateScreenSize) {
+      decision.updateInterval = 1;
+      weights[i]              = 1.f;
+    }
+    else {
+      const auto interval     = fullRateScreenSize / std::max(decision.screenSize, 1e-6f);
+      decision.updateInterval = static_cast<unsigned int>(
+        std::clamp(std::floor(interval), 1.f, static_cast<float>(largestInterval)));
+      weights[i] = std::max(decision.screenSize / fullRateScreenSize, lowestWeight);
+    }
+    requestedCount += decision.requestedCapacity;
+  }
+
+  // Share the particle budget: each system gets min(capacity, capacity * weight * scale), the
+  // scale being searched so that the sum matches the budget
+  auto allowedCount = [&decisions, &weights](float scale) {
+    float count = 0.f;
+    for (size_t i = 0; i < decisions.size(); ++i) {
+      count += static_cast<float>(decisions[i].requestedCapacity)
+               * std::min(1.f, weights[i] * scale);
+    }
+    return count;
+  };
+
+  auto scale = std::numeric_limits<float>::max();
+  if (requestedCount > maxParticles) {
+    auto low  = 0.f;
+    auto high = 1.f / lowestWeight;
+    for (unsigned int step = 0; step < BudgetSearchSteps; ++step) {
+      const auto middle = (low + high) * 0.5f;
+      if (allowedCount(middle) > static_cast<float>(maxParticles)) {
+        high = middle;
+      }
+      else {
+        low = middle;
+      }
+    }
+    scale = low;
+  }
+
+  std::vector<float> shares(decisions.size());
+  auto overdraw = 0.f;
+  for (size_t i = 0; i < decisions.size(); ++i) {
+    shares[i] = std::min(1.f, weights[i] * scale);
+    overdraw += static_cast<float>(decisions[i].requestedCapacity) * shares[i]
+                * decisions[i].particleScreenArea;
+  }
+
+  // Scale all the shares down when the particles cover too many screens
+  const auto overdrawScale
+    = (maxOverdraw > 0.f && overdraw > maxOverdraw) ? maxOverdraw / overdraw : 1.f;
+
+  for (size_t i = 0; i < decisions.size(); ++i) {
+    auto& decision         = decisions[i];
+    const auto share       = shares[i] * overdrawScale;
+    decision.capacity      = static_cast<size_t>(
+      std::floor(static_cast<float>(decision.requestedCapacity) * share + 1e-3f));
+    decision.emitRateScale = share;
+  }
+}
+
+const std::vector<ParticleBudgetDecision>& ParticleBudgetManager::getDecisions() const
+{
+  return _decisions;
+}
+
+size_t ParticleBudgetManager::getLiveParticleCount() const
+{
+  return _liveParticleCount;
+}
+
+size_t ParticleBudgetManager::getAllowedParticleCount() const
+{
+  return _allowedParticleCount;
+}
+
+float ParticleBudgetManager::getEstimatedOverdraw() const
+{
+  return _estimatedOverdraw;
+}
+
+void ParticleBudgetManager::dispose()
+{
+  _reset();
+  if (_scene && _onBeforeParticlesRenderingObserver) {
+    _scene->onBeforeParticlesRenderingObservable.remove(_onBeforeParticlesRenderingObserver);
+    _onBeforeParticlesRenderingObserver = nullptr;
+  }
+  onDecisionsAppliedObservable.clear();
+}
+
+void ParticleBudgetManager::_reset()
+{
+  // The decisions may point to disposed systems, only the systems of the scene are restored
+  if (_scene) {
+    for (const auto& system : _scene->particleSystems) {
+      auto particleSystem = dynamic_cast<ParticleSystem*>(system.get());
+      if (!particleSystem) {
+        continue;
+      }
+      particleSystem->_budgetCapacity       = std::numeric_limits<size_t>::max();
+      particleSystem->_budgetEmitRateScale  = 1.f;
+      particleSystem->_budgetUpdateInterval = 1;
+    }
+  }
+  _decisions.clear();
+  _liveParticleCount    = 0;
+  _allowedParticleCount = 0;
+  _estimatedOverdraw    = 0.f;
+}
+
+} // end of namespace BABYLON
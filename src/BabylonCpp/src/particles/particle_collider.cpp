@@ -0,0 +1,122 @@
+#include <babylon/particles/particle_collider.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/particles/particle_arrays.h>
+#include <babylon/particles/signed_distance_field.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Number of particles sampled at once in the field
+constexpr size_t SampleBlockSize = 64;
+
+/**
+ * Pushes a particle out of the geometry and reflects its velocity.
+ * @returns false if the particle does not collide
+ */
+bool Respond(float distance, float gx, float gy, float gz, float radius, float restitution,
+             float friction, float& px, float& py, float& pz, float& vx, float& vy, float& vz)
+{
+  const auto penetration = radius - distance;
+  const auto length      = std::sqrt(gx * gx + gy * gy + gz * gz);
+  if (penetration <= 0.f || length == 0.f) {
+    return false;
+  }
+
+  const auto nx = gx / length;
+  const auto ny = gy / length;
+  const auto nz = gz / length;
+  px += nx * penetration;
+  py += ny * penetration;
+  pz += nz * penetration;
+
+  // Only the velocity moving into the geometry is reflected
+  const auto normalVelocity = vx * nx + vy * ny + vz * nz;
+  if (normalVelocity < 0.f) {
+    const auto tangentScale = 1.f - friction;
+    const auto normalScale  = -restitution * normalVelocity - tangentScale * normalVelocity;
+    vx                      = vx * tangentScale + nx * normalScale;
+    vy                      = vy * tangentScale + ny * normalScale;
+    vz                      = vz * tangentScale + nz * normalScale;
+  }
+
+  return true;
+}
+
+} // end of anonymous namespace
+
+ParticleCollider::ParticleCollider(const SignedDistanceFieldPtr& iField)
+    : field{iField}, radius{0.f}, restitution{0.5f}, friction{0.1f}, blockSize{4096}
+{
+}
+
+ParticleCollider::~ParticleCollider() = default;
+
+bool ParticleCollider::collide(Vector3& position, Vector3& velocity) const
+{
+  if (!field) {
+    return false;
+  }
+
+  Vector3 gradient;
+  const auto distance = field->sample(position, gradient);
+  return Respond(distance, gradient.x, gradient.y, gradient.z, radius, restitution, friction,
+                 position.x, position.y, position.z, velocity.x, velocity.y, velocity.z);
+}
+
+size_t ParticleCollider::collide(ParticleArrays& particles) const
+{
+  if (!field) {
+    return 0;
+  }
+
+  std::atomic<size_t> collisionCount{0};
+  ThreadPool::Default().parallelFor(
+    0, particles.count(), std::max(blockSize, SampleBlockSize),
+    [this, &particles, &collisionCount](size_t begin, size_t end) {
+      collisionCount += collideRange(particles, begin, end);
+    });
+  return collisionCount;
+}
+
+size_t ParticleCollider::collideRange(ParticleArrays& particles, size_t begin, size_t end) const
+{
+  if (!field) {
+    return 0;
+  }
+
+  end                   = std::min(end, particles.count());
+  size_t collisionCount = 0;
+  float distances[SampleBlockSize];
+  float gradientX[SampleBlockSize];
+  float gradientY[SampleBlockSize];
+  float gradientZ[SampleBlockSize];
+  for (auto block = begin; block < end; block += SampleBlockSize) {
+    const auto count = std::min(SampleBlockSize, end - block);
+    field->sample(count, &particles.positionX[block], &particles.positionY[block],
+                  &particles.positionZ[block], distances, gradientX, gradientY, gradientZ);
+
+    for (size_t i = 0; i < count; ++i) {
+      if (distances[i] >= radius) {
+        continue;
+      }
+      const auto p = block + i;
+      if (Respond(distances[i], gradientX[i], gradientY[i], gradientZ[i], radius, restitution,
+                  friction, particles.positionX[p], particles.positionY[p],
+                  particles.positionZ[p], particles.directionX[p], particles.directionY[p],
+                  particles.directionZ[p])) {
+        ++collisionCount;
+      }
+    }
+  }
+
+  return collisionCount;
+}
+
+} // end of namespace BABYLON
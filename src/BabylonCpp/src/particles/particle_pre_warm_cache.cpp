@@ -0,0 +1,76 @@
+#include <babylon/particles/particle_pre_warm_cache.h>
+
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+bool ParticlePreWarmState::matches(const ParticlePreWarmState& other) const
+{
+  return preWarmCycles == other.preWarmCycles && preWarmStepOffset == other.preWarmStepOffset
+         && updateSpeed == other.updateSpeed && emission.capacity == other.emission.capacity
+         && emitRate == other.emitRate && minLifeTime == other.minLifeTime
+         && maxLifeTime == other.maxLifeTime && !emitter.expired()
+         && !emitter.owner_before(other.emitter) && !other.emitter.owner_before(emitter);
+}
+
+void ParticlePreWarmState::moveToEmitter(const Matrix& emitterWorldMatrix)
+{
+  auto worldMatrix            = emitterWorldMatrix;
+  auto transform              = Matrix::Invert(emission.emitterWorldMatrix).multiply(worldMatrix);
+  emission.emitterWorldMatrix = worldMatrix;
+  if (transform.isIdentity()) {
+    return;
+  }
+
+  Vector3 result;
+  for (size_t i = 0; i < particles.count(); ++i) {
+    Vector3::TransformCoordinatesFromFloatsToRef(particles.positionX[i], particles.positionY[i],
+                                                 particles.positionZ[i], transform, result);
+    particles.positionX[i] = result.x;
+    particles.positionY[i] = result.y;
+    particles.positionZ[i] = result.z;
+    Vector3::TransformNormalFromFloatsToRef(particles.directionX[i], particles.directionY[i],
+                                            particles.directionZ[i], transform, result);
+    particles.directionX[i] = result.x;
+    particles.directionY[i] = result.y;
+    particles.directionZ[i] = result.z;
+  }
+}
+
+ParticlePreWarmCache& ParticlePreWarmCache::Default()
+{
+  static ParticlePreWarmCache cache;
+  return cache;
+}
+
+ParticlePreWarmCache::ParticlePreWarmCache() = default;
+
+ParticlePreWarmCache::~ParticlePreWarmCache() = default;
+
+ParticlePreWarmStatePtr ParticlePreWarmCache::get(const std::string& key) const
+{
+  auto it = _states.find(key);
+  return it != _states.end() ? it->second : nullptr;
+}
+
+void ParticlePreWarmCache::set(const std::string& key, const ParticlePreWarmStatePtr& state)
+{
+  _states[key] = state;
+}
+
+void ParticlePreWarmCache::remove(const std::string& key)
+{
+  _states.erase(key);
+}
+
+void ParticlePreWarmCache::clear()
+{
+  _states.clear();
+}
+
+size_t ParticlePreWarmCache::size() const
+{
+  return _states.size();
+}
+
+} // end of namespace BABYLON
@@ -1,10 +1,16 @@
 #include <babylon/particles/particle_system.h>
 
+#include <chrono>
+#include <future>
+#include <limits>
+
+#include <babylon/asio/asio.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/effect.h>
@@ -27,19 +33,54 @@
 #include <babylon/misc/string_tools.h>
 #include <babylon/particles/emittertypes/box_particle_emitter.h>
 #include <babylon/particles/emittertypes/cone_particle_emitter.h>
+#include <babylon/particles/emittertypes/cylinder_particle_emitter.h>
 #include <babylon/particles/emittertypes/hemispheric_particle_emitter.h>
 #include <babylon/particles/emittertypes/point_particle_emitter.h>
 #include <babylon/particles/emittertypes/sphere_directed_particle_emitter.h>
 #include <babylon/particles/emittertypes/sphere_particle_emitter.h>
 #include <babylon/particles/particle.h>
+#include <babylon/particles/particle_arena.h>
+#include <babylon/particles/particle_arrays.h>
+#include <babylon/particles/particle_collider.h>
+#include <babylon/particles/particle_pre_warm_cache.h>
 #include <babylon/particles/sub_emitter.h>
 
 namespace BABYLON {
 
+/**
+ * Hidden, pre-warm simulated on the default thread pool, shared with the job. The settings
+ * reference copies of the gradients, the emitter and the collider of the system, which can be
+ * changed on the main thread meanwhile.
+ */
+struct ParticleSystem::PreWarmJob {
+  ParticlePreWarmState state;
+  std::unique_ptr<Particle> particle;
+  std::vector<FactorGradient> emitRateGradients;
+  std::vector<FactorGradient> lifeTimeGradients;
+  std::vector<FactorGradient> startSizeGradients;
+  std::vector<FactorGradient> sizeGradients;
+  std::vector<FactorGradient> angularSpeedGradients;
+  std::vector<FactorGradient> velocityGradients;
+  std::vector<FactorGradient> limitVelocityGradients;
+  std::vector<FactorGradient> dragGradients;
+  std::vector<ColorGradient> colorGradients;
+  std::unique_ptr<IParticleEmitterType> particleEmitterType;
+  std::unique_ptr<ParticleCollider> collider;
+  ParticleArraysSettings settings;
+  std::atomic<bool> cancelled{false};
+  std::future<void> done;
+};
+
 ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene* scene,
                                const EffectPtr& customEffect, bool iIsAnimationSheetEnabled,
                                float epsilon)
     : BaseParticleSystem{iName}
+    , useParticleArrays{false}
+    , collider{nullptr}
+    , preWarmAsync{false}
+    , _budgetEmitRateScale{1.f}
+    , _budgetCapacity{std::numeric_limits<size_t>::max()}
+    , _budgetUpdateInterval{1}
     , onDispose{this, &ParticleSystem::set_onDispose}
     , _currentEmitRateGradient{std::nullopt}
     , _currentEmitRate1{0.f}
@@ -48,7 +89,9 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
     , _currentStartSize1{0.f}
     , _currentStartSize2{0.f}
     , _disposeEmitterOnDispose{false}
-    , _newPartsExcess{0}
+    , _subEmitterTemplate{nullptr}
+    , _newPartsExcess{0.f}
+    , _preWarmJob{nullptr}
     , _scaledColorStep{Color4(0.f, 0.f, 0.f, 0.f)}
     , _colorDiff{Color4(0.f, 0.f, 0.f, 0.f)}
     , _scaledDirection{Vector3::Zero()}
@@ -57,7 +100,10 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
     , _useInstancing{false}
     , _started{false}
     , _stopped{false}
-    , _actualFrame{0}
+    , _actualFrame{0.f}
+    , _scaledUpdateSpeed{0.f}
+    , _budgetSkippedFrames{0}
+    , _budgetSkippedRatio{0.f}
     , _vertexBufferSize{11}
     , _rawTextureWidth{256}
     , _rampGradientsTexture{nullptr}
@@ -101,7 +147,7 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
 
     for (unsigned int index = 0; index < _particles.size(); ++index) {
       auto particle          = particles[index];
-      auto scaledUpdateSpeed = static_cast<float>(_scaledUpdateSpeed);
+      auto scaledUpdateSpeed = _scaledUpdateSpeed;
       auto previousAge       = particle->age;
       particle->age += scaledUpdateSpeed;
 
@@ -329,7 +375,10 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
   };
 }
 
-ParticleSystem::~ParticleSystem() = default;
+ParticleSystem::~ParticleSystem()
+{
+  _cancelPreWarm();
+}
 
 Type ParticleSystem::type() const
 {
@@ -791,8 +840,27 @@ bool ParticleSystem::isStarted() const
   return _started;
 }
 
+bool ParticleSystem::isPreWarming() const
+{
+  return _preWarmJob != nullptr;
+}
+
 void ParticleSystem::_prepareSubEmitterInternalArray()
 {
+  // Each template is an end sub-emitter of its own, kept while the templates do not change
+  const auto unchanged = std::equal(
+    subEmitters.begin(), subEmitters.end(), _subEmitters.begin(), _subEmitters.end(),
+    [](ParticleSystem* subEmitter, const std::vector<ParticleSystem*>& group) {
+      return group.size() == 1 && group[0] == subEmitter;
+    });
+  if (unchanged) {
+    return;
+  }
+
+  _subEmitters.clear();
+  for (auto subEmitter : subEmitters) {
+    _subEmitters.emplace_back(std::vector<ParticleSystem*>{subEmitter});
+  }
 }
 
 void ParticleSystem::start(size_t delay)
@@ -802,6 +870,8 @@ void ParticleSystem::start(size_t delay)
       "Particle system started with a targetStopDuration dependant gradient "
       "(eg. startSizeGradients) but no targetStopDuration set");
   }
+  // The particles of a previous pre-warm are discarded
+  _cancelPreWarm();
   if (delay > 0) {
     // Timeout
   }
@@ -839,9 +909,7 @@ void ParticleSystem::start(size_t delay)
   }
 
   if (preWarmCycles) {
-    for (size_t index = 0; index < preWarmCycles; ++index) {
-      animate(true);
-    }
+    _preWarm();
   }
 }
 
@@ -862,8 +930,18 @@ void ParticleSystem::stop(bool stopSubEmitters)
 
 void ParticleSystem::reset()
 {
-  _stockParticles.clear();
-  _particles.clear();
+  _cancelPreWarm();
+  auto& particleArena = ParticleArena::ForScene(_scene);
+  particleArena.releaseParticles(_stockParticles);
+  particleArena.releaseParticles(_particles);
+  if (_particleArrays) {
+    _particleArrays->clear();
+  }
+}
+
+size_t ParticleSystem::getActiveParticleCount() const
+{
+  return _particleArrays ? _particles.size() + _particleArrays->count() : _particles.size();
 }
 
 void ParticleSystem::_appendParticleVertex(unsigned int index, Particle* particle, int offsetX,
@@ -988,7 +1066,7 @@ Particle* ParticleSystem::_createParticle()
     particle->_reset();
   }
   else {
-    particle = new Particle(this);
+    particle = ParticleArena::ForScene(_scene).acquireParticle(this);
   }
 
   // Attach emitters
@@ -1011,44 +1089,56 @@ void ParticleSystem::_removeFromRoot()
   _rootParticleSystem = nullptr;
 }
 
-void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
+void ParticleSystem::_emitFromParticle(Particle* particle)
 {
   if (_subEmitters.empty()) {
     return;
   }
-#if 0
-  auto templateIndex
-    = static_cast<size_t>(std::floor(Math::random() * subEmitters.size()));
-
-  auto subSystem
-    = subEmitters[templateIndex]->clone(name + "_sub", particle->position);
-  subSystem._rootParticleSystem = this;
-  activeSubSystems.emplace_back(subSystem);
-  subSystem.start();
-#endif
+
+  auto templateIndex = static_cast<size_t>(std::floor(Math::random() * _subEmitters.size()));
+  templateIndex      = std::min(templateIndex, _subEmitters.size() - 1);
+
+  // The systems are recycled by template instead of being cloned
+  auto& particleArena = ParticleArena::ForScene(_scene);
+  for (auto subEmitter : _subEmitters[templateIndex]) {
+    auto subSystem                 = particleArena.acquireSubSystem(subEmitter);
+    subSystem->emitter             = particle->position;
+    subSystem->_rootParticleSystem = this;
+    activeSubSystems.emplace_back(subSystem);
+    subSystem->start();
+  }
 }
 
 void ParticleSystem::_update(int newParticles)
 {
   // Update current
-  _alive = !_particles.empty();
+  _alive = getActiveParticleCount() > 0;
 
-  if (std::holds_alternative<AbstractMeshPtr>(emitter)) {
-    auto emitterMesh    = std::get<AbstractMeshPtr>(emitter);
-    _emitterWorldMatrix = emitterMesh->getWorldMatrix();
+  _emitterWorldMatrix = _computeEmitterWorldMatrix();
+
+  if (_canUseParticleArrays()) {
+    _updateParticleArrays(newParticles);
+    return;
   }
-  else {
-    auto emitterPosition = std::get<Vector3>(emitter);
-    _emitterWorldMatrix
-      = Matrix::Translation(emitterPosition.x, emitterPosition.y, emitterPosition.z);
+
+  // The particles stored in the arrays are dropped when switching back to Particle objects
+  if (_particleArrays) {
+    _particleArrays->clear();
   }
 
   updateFunction(_particles);
 
+  if (collider && !isLocal) {
+    for (auto particle : _particles) {
+      collider->collide(particle->position, particle->direction);
+    }
+  }
+
   // Add new ones
-  Particle* particle = nullptr;
+  Particle* particle   = nullptr;
+  const auto capacity = std::min(_capacity, _budgetCapacity);
   for (int index = 0; index < newParticles; ++index) {
-    if (_particles.size() == _capacity) {
+    if (_particles.size() >= capacity) {
       break;
     }
 
@@ -1123,7 +1213,7 @@ void ParticleSystem::_update(int newParticles)
     particle->direction.scaleInPlace(emitPower);
 
     // Size
-    if (!_sizeGradients.empty()) {
+    if (_sizeGradients.empty()) {
       particle->size = Scalar::RandomRange(minSize, maxSize);
     }
     else {
@@ -1161,7 +1251,7 @@ void ParticleSystem::_update(int newParticles)
     }
 
     // Angle
-    if (!_angularSpeedGradients.empty()) {
+    if (_angularSpeedGradients.empty()) {
       particle->angularSpeed = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
     }
     else {
@@ -1205,7 +1295,7 @@ void ParticleSystem::_update(int newParticles)
     }
 
     // Drag
-    if (_dragGradients.empty()) {
+    if (!_dragGradients.empty()) {
       particle->_currentDragGradient = _dragGradients[0];
       particle->_currentDrag1        = particle->_currentDragGradient->getFactor();
 
@@ -1276,6 +1366,489 @@ void ParticleSystem::_update(int newParticles)
   }
 }
 
+bool ParticleSystem::_canUseParticleArrays()
+{
+  return useParticleArrays && !isLocal && !noiseTexture() && !_useRampGradients
+         && !_isAnimationSheetEnabled && subEmitters.empty();
+}
+
+void ParticleSystem::_updateParticleArrays(int newParticles)
+{
+  if (!_particleArrays) {
+    _particleArrays = std::make_unique<ParticleArrays>();
+    _particleArrays->reserve(_capacity);
+    _emissionParticle = std::make_unique<Particle>(this);
+  }
+
+  // Recycle the particles emitted before switching to the arrays
+  if (!_particles.empty()) {
+    _stockParticles.insert(_stockParticles.end(), _particles.begin(), _particles.end());
+    _particles.clear();
+  }
+
+  const auto settings = _getParticleArraysSettings(_scaledUpdateSpeed);
+  auto& particles     = *_particleArrays;
+  particles.update(settings.update);
+  if (settings.collider) {
+    settings.collider->collide(particles);
+  }
+  particles.removeDeadParticles();
+
+  // Add new ones, the emitter functions are given a scratch particle
+  ParticleArraysEmission emission;
+  emission.particle                 = _emissionParticle.get();
+  emission.emitterWorldMatrix       = _emitterWorldMatrix;
+  emission.capacity                 = std::min(_capacity, _budgetCapacity);
+  emission.actualFrame              = _actualFrame;
+  emission.currentStartSizeGradient = _currentStartSizeGradient;
+  emission.currentStartSize1        = _currentStartSize1;
+  emission.currentStartSize2        = _currentStartSize2;
+  _emitParticleArrays(particles, newParticles, emission, settings);
+  _currentStartSizeGradient = emission.currentStartSizeGradient;
+  _currentStartSize1        = emission.currentStartSize1;
+  _currentStartSize2        = emission.currentStartSize2;
+}
+
+ParticleArraysSettings ParticleSystem::_getParticleArraysSettings(float step) const
+{
+  ParticleArraysSettings settings;
+  settings.emitRate                = static_cast<float>(emitRate) * _budgetEmitRateScale;
+  settings.emitRateGradients       = &_emitRateGradients;
+  settings.targetStopDuration      = targetStopDuration;
+  settings.minLifeTime             = minLifeTime;
+  settings.maxLifeTime             = maxLifeTime;
+  settings.minEmitPower            = minEmitPower;
+  settings.maxEmitPower            = maxEmitPower;
+  settings.minSize                 = minSize;
+  settings.maxSize                 = maxSize;
+  settings.minScaleX               = minScaleX;
+  settings.maxScaleX               = maxScaleX;
+  settings.minScaleY               = minScaleY;
+  settings.maxScaleY               = maxScaleY;
+  settings.minAngularSpeed         = minAngularSpeed;
+  settings.maxAngularSpeed         = maxAngularSpeed;
+  settings.minInitialRotation      = minInitialRotation;
+  settings.maxInitialRotation      = maxInitialRotation;
+  settings.color1                  = color1;
+  settings.color2                  = color2;
+  settings.colorDead               = colorDead;
+  settings.inheritedVelocityOffset = _inheritedVelocityOffset;
+  settings.lifeTimeGradients       = &_lifeTimeGradients;
+  settings.startSizeGradients      = &_startSizeGradients;
+  settings.particleEmitterType     = particleEmitterType.get();
+  settings.startPositionFunction   = startPositionFunction ? &startPositionFunction : nullptr;
+  settings.startDirectionFunction  = startDirectionFunction ? &startDirectionFunction : nullptr;
+  settings.collider                = collider.get();
+
+  auto& update                  = settings.update;
+  update.step                   = step;
+  update.gravity                = gravity;
+  update.colorGradients         = &_colorGradients;
+  update.sizeGradients          = &_sizeGradients;
+  update.angularSpeedGradients  = &_angularSpeedGradients;
+  update.velocityGradients      = &_velocityGradients;
+  update.limitVelocityGradients = &_limitVelocityGradients;
+  update.limitVelocityDamping   = limitVelocityDamping;
+  update.dragGradients          = &_dragGradients;
+  return settings;
+}
+
+void ParticleSystem::_emitParticleArrays(ParticleArrays& particles, int newParticles,
+                                         ParticleArraysEmission& emission,
+                                         const ParticleArraysSettings& settings)
+{
+  static const std::vector<FactorGradient> noFactorGradients;
+  static const std::vector<ColorGradient> noColorGradients;
+  const auto& lifeTimeGradients
+    = settings.lifeTimeGradients ? *settings.lifeTimeGradients : noFactorGradients;
+  const auto& startSizeGradients
+    = settings.startSizeGradients ? *settings.startSizeGradients : noFactorGradients;
+  const auto& sizeGradients
+    = settings.update.sizeGradients ? *settings.update.sizeGradients : noFactorGradients;
+  const auto& angularSpeedGradients = settings.update.angularSpeedGradients ?
+                                        *settings.update.angularSpeedGradients :
+                                        noFactorGradients;
+  const auto& colorGradients
+    = settings.update.colorGradients ? *settings.update.colorGradients : noColorGradients;
+  const auto targetStopDuration = settings.targetStopDuration;
+
+  auto particle = emission.particle;
+  Color4 colorDiff;
+  for (int index = 0; index < newParticles; ++index) {
+    if (particles.count() >= emission.capacity) {
+      break;
+    }
+
+    const auto p = particles.add();
+    particle->_reset();
+    const auto seed           = Math::random();
+    particles.gradientSeed[p] = seed;
+
+    // The first gradients are sampled with the seed of the particle, as during the updates
+    const auto seededFactor = [seed](const FactorGradient& gradient) {
+      return Scalar::Lerp(gradient.factor1, gradient.factor2.value_or(gradient.factor1), seed);
+    };
+
+    // Life time
+    if (targetStopDuration && !lifeTimeGradients.empty()) {
+      auto ratio = static_cast<float>(Scalar::Clamp(emission.actualFrame / targetStopDuration));
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        ratio, lifeTimeGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float /*scale*/) {
+          auto gradient = (ratio - currentGradient.gradient)
+                          / (nextGradient.gradient - currentGradient.gradient);
+          particle->lifeTime
+            = Scalar::Lerp(currentGradient.getFactor(), nextGradient.getFactor(), gradient);
+        });
+    }
+    else {
+      particle->lifeTime = Scalar::RandomRange(settings.minLifeTime, settings.maxLifeTime);
+    }
+    particles.lifeTime[p] = particle->lifeTime;
+
+    // Emitter
+    auto emitPower = Scalar::RandomRange(settings.minEmitPower, settings.maxEmitPower);
+
+    if (settings.startPositionFunction) {
+      (*settings.startPositionFunction)(emission.emitterWorldMatrix, particle->position, particle,
+                                        false);
+    }
+    else {
+      settings.particleEmitterType->startPositionFunction(emission.emitterWorldMatrix,
+                                                          particle->position, particle, false);
+    }
+
+    if (settings.startDirectionFunction) {
+      (*settings.startDirectionFunction)(emission.emitterWorldMatrix, particle->direction, particle,
+                                         false);
+    }
+    else {
+      settings.particleEmitterType->startDirectionFunction(emission.emitterWorldMatrix,
+                                                           particle->direction, particle, false);
+    }
+
+    particle->direction.scaleInPlace(emitPower);
+
+    // Inherited Velocity
+    particle->direction.addInPlace(settings.inheritedVelocityOffset);
+
+    particles.positionX[p]  = particle->position.x;
+    particles.positionY[p]  = particle->position.y;
+    particles.positionZ[p]  = particle->position.z;
+    particles.directionX[p] = particle->direction.x;
+    particles.directionY[p] = particle->direction.y;
+    particles.directionZ[p] = particle->direction.z;
+
+    // Size
+    if (sizeGradients.empty()) {
+      particles.size[p] = Scalar::RandomRange(settings.minSize, settings.maxSize);
+    }
+    else {
+      particles.size[p] = seededFactor(sizeGradients[0]);
+    }
+
+    // Size and scale
+    Vector2 scale(Scalar::RandomRange(settings.minScaleX, settings.maxScaleX),
+                  Scalar::RandomRange(settings.minScaleY, settings.maxScaleY));
+
+    // Adjust scale by start size
+    if (!startSizeGradients.empty() && targetStopDuration) {
+      auto ratio = emission.actualFrame / static_cast<float>(targetStopDuration);
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        ratio, startSizeGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float gradientScale) {
+          if (currentGradient != emission.currentStartSizeGradient) {
+            emission.currentStartSize1        = emission.currentStartSize2;
+            emission.currentStartSize2        = nextGradient.getFactor();
+            emission.currentStartSizeGradient = currentGradient;
+          }
+
+          scale.scaleInPlace(Scalar::Lerp(emission.currentStartSize1, emission.currentStartSize2,
+                                          gradientScale));
+        });
+    }
+    particles.scaleX[p] = scale.x;
+    particles.scaleY[p] = scale.y;
+
+    // Angle
+    if (angularSpeedGradients.empty()) {
+      particles.angularSpeed[p]
+        = Scalar::RandomRange(settings.minAngularSpeed, settings.maxAngularSpeed);
+    }
+    else {
+      particles.angularSpeed[p] = seededFactor(angularSpeedGradients[0]);
+    }
+    particles.angle[p]
+      = Scalar::RandomRange(settings.minInitialRotation, settings.maxInitialRotation);
+
+    // Color
+    if (colorGradients.empty()) {
+      auto step = Scalar::RandomRange(0.f, 1.f);
+
+      Color4::LerpToRef(settings.color1, settings.color2, step, particle->color);
+
+      settings.colorDead.subtractToRef(particle->color, colorDiff);
+      colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+    }
+    else {
+      const auto& colorGradient = colorGradients[0];
+      Color4::LerpToRef(colorGradient.color1,
+                        colorGradient.color2.value_or(colorGradient.color1), seed,
+                        particle->color);
+    }
+    particles.colorR[p]     = particle->color.r;
+    particles.colorG[p]     = particle->color.g;
+    particles.colorB[p]     = particle->color.b;
+    particles.colorA[p]     = particle->color.a;
+    particles.colorStepR[p] = particle->colorStep.r;
+    particles.colorStepG[p] = particle->colorStep.g;
+    particles.colorStepB[p] = particle->colorStep.b;
+    particles.colorStepA[p] = particle->colorStep.a;
+  }
+}
+
+Matrix ParticleSystem::_computeEmitterWorldMatrix()
+{
+  if (std::holds_alternative<AbstractMeshPtr>(emitter)) {
+    return std::get<AbstractMeshPtr>(emitter)->getWorldMatrix();
+  }
+
+  const auto& emitterPosition = std::get<Vector3>(emitter);
+  return Matrix::Translation(emitterPosition.x, emitterPosition.y, emitterPosition.z);
+}
+
+bool ParticleSystem::_canPreWarmAsync()
+{
+  if (!_canUseParticleArrays() || startPositionFunction || startDirectionFunction
+      || !particleEmitterType) {
+    return false;
+  }
+
+  // The mesh and custom emitters use the shared temporary vectors or user functions
+  auto emitterType = particleEmitterType.get();
+  return dynamic_cast<BoxParticleEmitter*>(emitterType)
+         || dynamic_cast<ConeParticleEmitter*>(emitterType)
+         || dynamic_cast<CylinderParticleEmitter*>(emitterType)
+         || dynamic_cast<HemisphericParticleEmitter*>(emitterType)
+         || dynamic_cast<PointParticleEmitter*>(emitterType)
+         || dynamic_cast<SphereParticleEmitter*>(emitterType);
+}
+
+void ParticleSystem::_preWarm()
+{
+  // Particle objects and manual emission, the cycles are animated on the calling thread
+  if (!_canUseParticleArrays() || manualEmitCount > -1) {
+    for (size_t index = 0; index < preWarmCycles; ++index) {
+      animate(true);
+    }
+    return;
+  }
+
+  const auto capacity = std::min(_capacity, _budgetCapacity);
+  auto settings       = _getParticleArraysSettings(0.f);
+
+  ParticlePreWarmState state;
+  state.preWarmCycles     = preWarmCycles;
+  state.preWarmStepOffset = static_cast<float>(preWarmStepOffset);
+  state.updateSpeed       = updateSpeed;
+  state.emitRate          = settings.emitRate;
+  state.minLifeTime       = minLifeTime;
+  state.maxLifeTime       = maxLifeTime;
+  state.emitter           = particleEmitterType;
+  state.emission.capacity = capacity;
+
+  // Particles pre-warmed by a system created from the same template
+  if (!preWarmSnapshotKey.empty()) {
+    auto snapshot = ParticlePreWarmCache::Default().get(preWarmSnapshotKey);
+    if (snapshot && snapshot->matches(state)) {
+      _applyPreWarmState(*snapshot, false);
+      return;
+    }
+  }
+
+  state.particles.reserve(capacity);
+  state.emission.emitterWorldMatrix       = _computeEmitterWorldMatrix();
+  state.emission.actualFrame              = _actualFrame;
+  state.emission.currentStartSizeGradient = _currentStartSizeGradient;
+  state.emission.currentStartSize1        = _currentStartSize1;
+  state.emission.currentStartSize2        = _currentStartSize2;
+  state.newPartsExcess                    = _newPartsExcess;
+  state.stopped                           = _stopped;
+  state.currentEmitRateGradient           = _currentEmitRateGradient;
+  state.currentEmitRate1                  = _currentEmitRate1;
+  state.currentEmitRate2                  = _currentEmitRate2;
+
+  auto& threadPool = ThreadPool::Default();
+  if (!preWarmAsync || !_canPreWarmAsync() || threadPool.size() == 0
+      || asio::IsAsyncDisabled()) {
+    if (!_emissionParticle) {
+      _emissionParticle = std::make_unique<Particle>(this);
+    }
+    const std::atomic<bool> cancelled{false};
+    state.emission.particle = _emissionParticle.get();
+    _simulatePreWarm(state, settings, cancelled);
+    _applyPreWarmState(std::move(state), true);
+    return;
+  }
+
+  // The job owns its scratch particle and copies of the properties read by the simulation, the
+  // system is not animated until the particles are swapped
+  auto job                     = std::make_shared<PreWarmJob>();
+  job->state                   = std::move(state);
+  job->particle                = std::make_unique<Particle>(this);
+  job->state.emission.particle = job->particle.get();
+  job->emitRateGradients       = _emitRateGradients;
+  job->lifeTimeGradients       = _lifeTimeGradients;
+  job->startSizeGradients      = _startSizeGradients;
+  job->sizeGradients           = _sizeGradients;
+  job->angularSpeedGradients   = _angularSpeedGradients;
+  job->velocityGradients       = _velocityGradients;
+  job->limitVelocityGradients  = _limitVelocityGradients;
+  job->dragGradients           = _dragGradients;
+  job->colorGradients          = _colorGradients;
+  job->particleEmitterType     = particleEmitterType->clone();
+  if (collider) {
+    job->collider = std::make_unique<ParticleCollider>(*collider);
+  }
+
+  settings.emitRateGradients             = &job->emitRateGradients;
+  settings.lifeTimeGradients             = &job->lifeTimeGradients;
+  settings.startSizeGradients            = &job->startSizeGradients;
+  settings.particleEmitterType           = job->particleEmitterType.get();
+  settings.collider                      = job->collider.get();
+  settings.update.colorGradients         = &job->colorGradients;
+  settings.update.sizeGradients          = &job->sizeGradients;
+  settings.update.angularSpeedGradients  = &job->angularSpeedGradients;
+  settings.update.velocityGradients      = &job->velocityGradients;
+  settings.update.limitVelocityGradients = &job->limitVelocityGradients;
+  settings.update.dragGradients          = &job->dragGradients;
+  job->settings                          = settings;
+
+  job->done = threadPool.enqueue(
+    [job]() { _simulatePreWarm(job->state, job->settings, job->cancelled); });
+  _preWarmJob = job;
+}
+
+void ParticleSystem::_simulatePreWarm(ParticlePreWarmState& state,
+                                      const ParticleArraysSettings& settings,
+                                      const std::atomic<bool>& cancelled)
+{
+  // Same emission as animate(true), the state and the settings replacing the members of the system
+  const auto step               = state.updateSpeed * state.preWarmStepOffset;
+  const auto targetStopDuration = settings.targetStopDuration;
+  auto update                   = settings.update;
+  update.step                   = step;
+  auto& particles               = state.particles;
+  auto& emission                = state.emission;
+  for (size_t cycle = 0; cycle < state.preWarmCycles && !cancelled; ++cycle) {
+    auto rate = settings.emitRate;
+
+    if (settings.emitRateGradients && !settings.emitRateGradients->empty()
+        && targetStopDuration) {
+      auto ratio = emission.actualFrame / static_cast<float>(targetStopDuration);
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        ratio, *settings.emitRateGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state.currentEmitRateGradient) {
+            state.currentEmitRate1        = state.currentEmitRate2;
+            state.currentEmitRate2        = nextGradient.getFactor();
+            state.currentEmitRateGradient = currentGradient;
+          }
+
+          rate = Scalar::Lerp(state.currentEmitRate1, state.currentEmitRate2, scale);
+        });
+    }
+
+    auto newParticles = static_cast<int>(rate * step);
+    state.newPartsExcess += rate * step - static_cast<float>(newParticles);
+
+    if (state.newPartsExcess > 1.f) {
+      const auto excess = static_cast<int>(state.newPartsExcess);
+      newParticles += excess;
+      state.newPartsExcess -= static_cast<float>(excess);
+    }
+
+    if (!state.stopped) {
+      emission.actualFrame += step;
+
+      if (targetStopDuration && emission.actualFrame >= targetStopDuration) {
+        state.stopped = true;
+      }
+    }
+    else {
+      newParticles = 0;
+    }
+
+    particles.update(update);
+    if (settings.collider) {
+      settings.collider->collide(particles);
+    }
+    particles.removeDeadParticles();
+    _emitParticleArrays(particles, newParticles, emission, settings);
+
+    if (state.stopped && particles.count() == 0) {
+      break;
+    }
+  }
+}
+
+bool ParticleSystem::_finishPreWarm()
+{
+  if (_preWarmJob->done.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+    return false;
+  }
+
+  auto job    = _preWarmJob;
+  _preWarmJob = nullptr;
+  job->done.get();
+  _applyPreWarmState(std::move(job->state), true);
+  return true;
+}
+
+void ParticleSystem::_applyPreWarmState(ParticlePreWarmState state, bool store)
+{
+  state.emission.particle = nullptr;
+  if (store && !preWarmSnapshotKey.empty()) {
+    ParticlePreWarmCache::Default().set(preWarmSnapshotKey,
+                                        std::make_shared<ParticlePreWarmState>(state));
+  }
+
+  // The particles follow the emitter moved since the simulation
+  _emitterWorldMatrix = _computeEmitterWorldMatrix();
+  state.moveToEmitter(_emitterWorldMatrix);
+
+  if (!_particleArrays) {
+    _particleArrays   = std::make_unique<ParticleArrays>();
+    _emissionParticle = std::make_unique<Particle>(this);
+  }
+  *_particleArrays = std::move(state.particles);
+  _particleArrays->reserve(_capacity);
+
+  _actualFrame              = state.emission.actualFrame;
+  _currentStartSizeGradient = state.emission.currentStartSizeGradient;
+  _currentStartSize1        = state.emission.currentStartSize1;
+  _currentStartSize2        = state.emission.currentStartSize2;
+  _newPartsExcess           = state.newPartsExcess;
+  _stopped                  = _stopped || state.stopped;
+  _currentEmitRateGradient  = state.currentEmitRateGradient;
+  _currentEmitRate1         = state.currentEmitRate1;
+  _currentEmitRate2         = state.currentEmitRate2;
+}
+
+void ParticleSystem::_cancelPreWarm()
+{
+  if (!_preWarmJob) {
+    return;
+  }
+
+  _preWarmJob->cancelled = true;
+  _preWarmJob->done.wait();
+  _preWarmJob = nullptr;
+}
+
 std::vector<std::string> ParticleSystem::_GetAttributeNamesOrOptions(bool iIsAnimationSheetEnabled,
                                                                      bool iIsBillboardBased,
                                                                      bool iUseRampGradients)
@@ -1415,6 +1988,11 @@ void ParticleSystem::animate(bool preWarmOnly)
     return;
   }
 
+  // The system is animated once its pre-warmed particles are swapped in
+  if (_preWarmJob && (preWarmOnly || !_finishPreWarm())) {
+    return;
+  }
+
   if (!preWarmOnly) {
     // Check
     if (!isReady()) {
@@ -1427,8 +2005,25 @@ void ParticleSystem::animate(bool preWarmOnly)
     _currentRenderId = _scene->getFrameId();
   }
 
-  _scaledUpdateSpeed = static_cast<int>(
-    updateSpeed * (preWarmOnly ? preWarmStepOffset : _scene->getAnimationRatio()));
+  auto animationRatio = preWarmOnly ? preWarmStepOffset : _scene->getAnimationRatio();
+
+  // The frames skipped by the budget manager are caught up by the next update
+  if (!preWarmOnly && _budgetUpdateInterval > 1) {
+    _budgetSkippedRatio += animationRatio;
+    if (++_budgetSkippedFrames < _budgetUpdateInterval) {
+      return;
+    }
+    animationRatio       = _budgetSkippedRatio;
+    _budgetSkippedFrames = 0;
+    _budgetSkippedRatio  = 0.f;
+  }
+  else if (_budgetSkippedFrames > 0) {
+    animationRatio += _budgetSkippedRatio;
+    _budgetSkippedFrames = 0;
+    _budgetSkippedRatio  = 0.f;
+  }
+
+  _scaledUpdateSpeed = updateSpeed * animationRatio;
 
   // Determine the number of particles we need to create
   int newParticles = 0;
@@ -1439,7 +2034,7 @@ void ParticleSystem::animate(bool preWarmOnly)
     manualEmitCount = 0;
   }
   else {
-    auto rate = static_cast<float>(emitRate);
+    auto rate = static_cast<float>(emitRate) * _budgetEmitRateScale;
 
     if (!_emitRateGradients.empty() && targetStopDuration) {
       auto ratio = static_cast<float>(_actualFrame) / static_cast<float>(targetStopDuration);
@@ -1458,12 +2053,13 @@ void ParticleSystem::animate(bool preWarmOnly)
     }
 
     newParticles = static_cast<int>(rate * _scaledUpdateSpeed);
-    _newPartsExcess += static_cast<int>(rate * _scaledUpdateSpeed - newParticles);
+    _newPartsExcess += rate * _scaledUpdateSpeed - static_cast<float>(newParticles);
   }
 
-  if (_newPartsExcess > 1) {
-    newParticles += _newPartsExcess >> 0;
-    _newPartsExcess -= _newPartsExcess >> 0;
+  if (_newPartsExcess > 1.f) {
+    const auto excess = static_cast<int>(_newPartsExcess);
+    newParticles += excess;
+    _newPartsExcess -= static_cast<float>(excess);
   }
 
   _alive = false;
@@ -1487,7 +2083,11 @@ void ParticleSystem::animate(bool preWarmOnly)
       if (onAnimationEnd) {
         onAnimationEnd();
       }
-      if (disposeOnStop) {
+      if (_subEmitterTemplate) {
+        _removeFromRoot();
+        ParticleArena::ForScene(_scene).releaseSubSystem(this);
+      }
+      else if (disposeOnStop) {
         _scene->_toBeDisposed.emplace_back(this);
       }
     }
@@ -1500,6 +2100,9 @@ void ParticleSystem::animate(bool preWarmOnly)
       _appendParticleVertices(offset, particle);
       offset += _useInstancing ? 1 : 4;
     }
+    if (_particleArrays && _particleArrays->count() > 0) {
+      _appendParticleArrayVertices();
+    }
 
     if (_vertexBuffer) {
       _vertexBuffer->update(_vertexData);
@@ -1521,6 +2124,53 @@ void ParticleSystem::_appendParticleVertices(unsigned int offset, Particle* part
   }
 }
 
+void ParticleSystem::_appendParticleArrayVertices()
+{
+  static constexpr std::array<std::array<float, 2>, 4> offsets{
+    {{{0.f, 0.f}}, {{1.f, 0.f}}, {{1.f, 1.f}}, {{0.f, 1.f}}}};
+
+  const auto& particles          = *_particleArrays;
+  const auto verticesPerParticle = _useInstancing ? 1ull : 4ull;
+  const auto writeDirection
+    = !_isBillboardBased || billboardMode == ParticleSystem::BILLBOARDMODE_STRETCHED;
+
+  ThreadPool::Default().parallelFor(
+    0, particles.count(), 4096, [&](size_t begin, size_t end) {
+      for (size_t p = begin; p < end; ++p) {
+        auto direction = Vector3(particles.directionX[p], particles.directionY[p],
+                                 particles.directionZ[p]);
+        if (!_isBillboardBased && direction.x == 0.f && direction.z == 0.f) {
+          direction.x = 0.001f;
+        }
+
+        auto offset = p * verticesPerParticle * _vertexBufferSize;
+        for (size_t vertex = 0; vertex < verticesPerParticle; ++vertex) {
+          _vertexData[offset++] = particles.positionX[p] + worldOffset.x;
+          _vertexData[offset++] = particles.positionY[p] + worldOffset.y;
+          _vertexData[offset++] = particles.positionZ[p] + worldOffset.z;
+          _vertexData[offset++] = particles.colorR[p];
+          _vertexData[offset++] = particles.colorG[p];
+          _vertexData[offset++] = particles.colorB[p];
+          _vertexData[offset++] = particles.colorA[p];
+          _vertexData[offset++] = particles.angle[p];
+          _vertexData[offset++] = particles.scaleX[p] * particles.size[p];
+          _vertexData[offset++] = particles.scaleY[p] * particles.size[p];
+
+          if (writeDirection) {
+            _vertexData[offset++] = direction.x;
+            _vertexData[offset++] = direction.y;
+            _vertexData[offset++] = direction.z;
+          }
+
+          if (!_useInstancing) {
+            _vertexData[offset++] = offsets[vertex][0];
+            _vertexData[offset++] = offsets[vertex][1];
+          }
+        }
+      }
+    });
+}
+
 void ParticleSystem::rebuild()
 {
   _createIndexBuffer();
@@ -1536,9 +2186,9 @@ void ParticleSystem::rebuild()
 
 bool ParticleSystem::isReady()
 {
-  if (!std::holds_alternative<AbstractMeshPtr>(emitter) || !std::holds_alternative<Vector3>(emitter)
-      || !_imageProcessingConfiguration->isReady() || !particleTexture
-      || !particleTexture->isReady()) {
+  if (!hasEmitter()
+      || (_imageProcessingConfiguration && !_imageProcessingConfiguration->isReady())
+      || !particleTexture || !particleTexture->isReady()) {
     return false;
   }
 
@@ -1628,20 +2278,20 @@ size_t ParticleSystem::_render(unsigned int iBlendMode)
 
   if (_useInstancing) {
     engine->drawArraysType(Material::TriangleFanDrawMode, 0, 4,
-                           static_cast<int>(_particles.size()));
+                           static_cast<int>(getActiveParticleCount()));
   }
   else {
     engine->drawElementsType(Material::TriangleFillMode, 0,
-                             static_cast<int>(_particles.size() * 6));
+                             static_cast<int>(getActiveParticleCount() * 6));
   }
 
-  return _particles.size();
+  return getActiveParticleCount();
 }
 
 size_t ParticleSystem::render(bool /*preWarm*/)
 {
   // Check
-  if (!isReady() || !_particles.empty()) {
+  if (!isReady() || getActiveParticleCount() == 0) {
     return 0;
   }
 
@@ -1668,6 +2318,8 @@ size_t ParticleSystem::render(bool /*preWarm*/)
 
 void ParticleSystem::dispose(bool disposeTexture, bool /*disposeMaterialAndTextures*/)
 {
+  _cancelPreWarm();
+
   if (_vertexBuffer) {
     _vertexBuffer->dispose();
     _vertexBuffer = nullptr;
@@ -1700,6 +2352,13 @@ void ParticleSystem::dispose(bool disposeTexture, bool /*disposeMaterialAndTextu
 
   _removeFromRoot();
 
+  // The running sub-systems end on their own
+  for (auto subSystem : activeSubSystems) {
+    subSystem->_rootParticleSystem = nullptr;
+    subSystem->stop();
+  }
+  activeSubSystems.clear();
+
   if (!_subEmitters.empty()) {
     for (auto& subEmitter1 : _subEmitters) {
       for (auto& subEmitter2 : subEmitter1) {
@@ -1729,6 +2388,92 @@ void ParticleSystem::dispose(bool disposeTexture, bool /*disposeMaterialAndTextu
   reset();
 }
 
+ParticleSystem* ParticleSystem::_instantiateSubSystem()
+{
+  // The scene owns the new system
+  auto subSystem = new ParticleSystem(name + "_sub", _capacity, _scene, _customEffect,
+                                      _isAnimationSheetEnabled, _epsilon);
+  subSystem->_isSubEmitter       = true;
+  subSystem->_subEmitterTemplate = this;
+
+  // Rendering
+  subSystem->renderingGroupId = renderingGroupId;
+  subSystem->layerMask        = layerMask;
+  subSystem->particleTexture  = particleTexture;
+  subSystem->blendMode        = blendMode;
+  subSystem->forceDepthWrite  = forceDepthWrite;
+  subSystem->textureMask      = textureMask;
+  subSystem->isBillboardBased = get_isBillboardBased();
+  subSystem->billboardMode    = billboardMode;
+  subSystem->isLocal          = get_isLocal();
+  subSystem->worldOffset      = worldOffset;
+  subSystem->translationPivot = translationPivot;
+
+  // Emission
+  subSystem->particleEmitterType    = particleEmitterType;
+  subSystem->startDirectionFunction = startDirectionFunction;
+  subSystem->startPositionFunction  = startPositionFunction;
+  subSystem->emitRate               = emitRate;
+  subSystem->updateSpeed            = updateSpeed;
+  subSystem->targetStopDuration     = targetStopDuration;
+  subSystem->preWarmCycles          = preWarmCycles;
+  subSystem->preWarmStepOffset      = preWarmStepOffset;
+  subSystem->preWarmAsync           = preWarmAsync;
+  subSystem->preWarmSnapshotKey     = preWarmSnapshotKey;
+  subSystem->subEmitters            = subEmitters;
+
+  // Particles
+  subSystem->minLifeTime          = minLifeTime;
+  subSystem->maxLifeTime          = maxLifeTime;
+  subSystem->minSize              = minSize;
+  subSystem->maxSize              = maxSize;
+  subSystem->minScaleX            = minScaleX;
+  subSystem->maxScaleX            = maxScaleX;
+  subSystem->minScaleY            = minScaleY;
+  subSystem->maxScaleY            = maxScaleY;
+  subSystem->color1               = color1;
+  subSystem->color2               = color2;
+  subSystem->colorDead            = colorDead;
+  subSystem->gravity              = gravity;
+  subSystem->minEmitPower         = minEmitPower;
+  subSystem->maxEmitPower         = maxEmitPower;
+  subSystem->minAngularSpeed      = minAngularSpeed;
+  subSystem->maxAngularSpeed      = maxAngularSpeed;
+  subSystem->minInitialRotation   = minInitialRotation;
+  subSystem->maxInitialRotation   = maxInitialRotation;
+  subSystem->limitVelocityDamping = limitVelocityDamping;
+  subSystem->noiseTexture         = noiseTexture();
+  subSystem->noiseStrength        = noiseStrength;
+  subSystem->useParticleArrays    = useParticleArrays;
+  subSystem->collider             = collider;
+
+  // Animation sheet
+  subSystem->spriteCellChangeSpeed = spriteCellChangeSpeed;
+  subSystem->startSpriteCellID     = startSpriteCellID;
+  subSystem->endSpriteCellID       = endSpriteCellID;
+  subSystem->spriteCellWidth       = spriteCellWidth;
+  subSystem->spriteCellHeight      = spriteCellHeight;
+  subSystem->spriteRandomStartCell = spriteRandomStartCell;
+
+  // Gradients
+  subSystem->_colorGradients         = _colorGradients;
+  subSystem->_sizeGradients          = _sizeGradients;
+  subSystem->_lifeTimeGradients      = _lifeTimeGradients;
+  subSystem->_angularSpeedGradients  = _angularSpeedGradients;
+  subSystem->_velocityGradients      = _velocityGradients;
+  subSystem->_limitVelocityGradients = _limitVelocityGradients;
+  subSystem->_dragGradients          = _dragGradients;
+  subSystem->_emitRateGradients      = _emitRateGradients;
+  subSystem->_startSizeGradients     = _startSizeGradients;
+  subSystem->_colorRemapGradients    = _colorRemapGradients;
+  subSystem->_alphaRemapGradients    = _alphaRemapGradients;
+  subSystem->_rampGradients          = _rampGradients;
+  subSystem->_createRampGradientTexture();
+  subSystem->useRampGradients = _useRampGradients;
+
+  return subSystem;
+}
+
 std::vector<AnimationPtr> ParticleSystem::getAnimations()
 {
   return animations;
@@ -0,0 +1,202 @@
+#include <babylon/particles/point_cloud_octree.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <unordered_set>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/maths/plane.h>
+
+namespace BABYLON {
+
+PointCloudOctreeNode::PointCloudOctreeNode(const Vector3& iMinimum, const Vector3& iMaximum,
+                                           size_t iDepth)
+    : minimum{iMinimum}, maximum{iMaximum}, depth{iDepth}, version{0}
+{
+}
+
+PointCloudOctreeNode::~PointCloudOctreeNode() = default;
+
+size_t PointCloudOctreeNode::count() const
+{
+  return positions.size() / 3;
+}
+
+Vector3 PointCloudOctreeNode::getCenter() const
+{
+  return minimum.add(maximum).scale(0.5f);
+}
+
+float PointCloudOctreeNode::getRadius() const
+{
+  return maximum.subtract(minimum).length() * 0.5f;
+}
+
+PointCloudOctree::PointCloudOctree(const Vector3& minimum, const Vector3& maximum, bool hasColors,
+                                   size_t gridSize, size_t maxDepth)
+    : _hasColors{hasColors}
+    , _gridSize{std::clamp(gridSize, static_cast<size_t>(1), static_cast<size_t>(1024))}
+    , _maxDepth{maxDepth}
+    , _pointCount{0}
+    , _nodeCount{1}
+{
+  // The nodes are cubes, so that the spacing is the same along the three axes
+  const auto extent = maximum.subtract(minimum);
+  const auto size   = std::max({extent.x, extent.y, extent.z, 1e-6f});
+  _root = std::make_unique<PointCloudOctreeNode>(minimum, minimum.add(Vector3(size, size, size)),
+                                                 0);
+}
+
+PointCloudOctree::~PointCloudOctree() = default;
+
+std::vector<PointCloudOctreeNode*> PointCloudOctree::addPoints(const float* positions,
+                                                               const float* colors, size_t count)
+{
+  std::vector<PointCloudOctreeNode*> nodes;
+  std::unordered_set<PointCloudOctreeNode*> changedNodes;
+  for (size_t i = 0; i < count; ++i) {
+    auto node = _addPoint(positions + 3 * i, _hasColors && colors ? colors + 4 * i : nullptr);
+    if (changedNodes.insert(node).second) {
+      nodes.emplace_back(node);
+      ++node->version;
+    }
+  }
+  _pointCount += count;
+  return nodes;
+}
+
+PointCloudOctreeNode* PointCloudOctree::_addPoint(const float* position, const float* color)
+{
+  const auto& rootMin = _root->minimum;
+  const auto& rootMax = _root->maximum;
+  const Vector3 point(std::clamp(position[0], rootMin.x, rootMax.x),
+                      std::clamp(position[1], rootMin.y, rootMax.y),
+                      std::clamp(position[2], rootMin.z, rootMax.z));
+  const auto maxCell           = static_cast<float>(_gridSize - 1);
+  static const float White[4] = {1.f, 1.f, 1.f, 1.f};
+
+  auto node = _root.get();
+  while (true) {
+    const auto size = node->maximum.x - node->minimum.x;
+    auto stored     = node->depth >= _maxDepth;
+    if (!stored) {
+      // Cell of the occupancy grid of the node containing the point
+      const auto scale    = static_cast<float>(_gridSize) / size;
+      const auto gridSize = static_cast<uint32_t>(_gridSize);
+
+      const auto x = static_cast<uint32_t>(std::min((point.x - node->minimum.x) * scale, maxCell));
+      const auto y = static_cast<uint32_t>(std::min((point.y - node->minimum.y) * scale, maxCell));
+      const auto z = static_cast<uint32_t>(std::min((point.z - node->minimum.z) * scale, maxCell));
+      stored       = node->_occupiedCells.insert(x + gridSize * (y + gridSize * z)).second;
+    }
+    if (stored) {
+      stl_util::concat(node->positions, {point.x, point.y, point.z});
+      if (_hasColors) {
+        const auto* pointColor = color ? color : White;
+        stl_util::concat(node->colors,
+                         {pointColor[0], pointColor[1], pointColor[2], pointColor[3]});
+      }
+      return node;
+    }
+
+    // Occupied cell, the point goes down to the child of its octant
+    const auto center   = node->getCenter();
+    const size_t octant = (point.x >= center.x ? 1 : 0) + (point.y >= center.y ? 2 : 0)
+                          + (point.z >= center.z ? 4 : 0);
+    auto& child         = node->children[octant];
+    if (!child) {
+      const Vector3 minimum(octant & 1 ? center.x : node->minimum.x,
+                            octant & 2 ? center.y : node->minimum.y,
+                            octant & 4 ? center.z : node->minimum.z);
+      const auto halfSize = size * 0.5f;
+      child               = std::make_unique<PointCloudOctreeNode>(
+        minimum, minimum.add(Vector3(halfSize, halfSize, halfSize)), node->depth + 1);
+      ++_nodeCount;
+    }
+    node = child.get();
+  }
+}
+
+size_t PointCloudOctree::selectNodes(const std::array<Plane, 6>& frustumPlanes,
+                                     const Vector3& cameraPosition, float projectionFactor,
+                                     float minProjectedSize, size_t pointBudget,
+                                     std::vector<PointCloudOctreeNode*>& nodes) const
+{
+  nodes.clear();
+
+  using Candidate = std::pair<float, PointCloudOctreeNode*>;
+  const auto projectedSize = [&](const PointCloudOctreeNode& node) {
+    const auto radius   = node.getRadius();
+    const auto distance = Vector3::Distance(node.getCenter(), cameraPosition);
+    // The camera is inside the bounding sphere, the node covers the whole screen
+    if (distance <= radius) {
+      return std::numeric_limits<float>::max();
+    }
+    return radius * projectionFactor / distance;
+  };
+  const auto isVisible = [&frustumPlanes](const PointCloudOctreeNode& node) {
+    for (const auto& plane : frustumPlanes) {
+      const Vector3 corner(plane.normal.x >= 0.f ? node.maximum.x : node.minimum.x,
+                           plane.normal.y >= 0.f ? node.maximum.y : node.minimum.y,
+                           plane.normal.z >= 0.f ? node.maximum.z : node.minimum.z);
+      if (plane.dotCoordinate(corner) < 0.f) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // Largest projected sizes first
+  std::priority_queue<Candidate> candidates;
+  candidates.emplace(projectedSize(*_root), _root.get());
+  size_t pointCount = 0;
+  while (!candidates.empty()) {
+    const auto [size, node] = candidates.top();
+    candidates.pop();
+    if (size < minProjectedSize || !isVisible(*node)) {
+      continue;
+    }
+    if (pointCount + node->count() > pointBudget) {
+      break;
+    }
+    nodes.emplace_back(node);
+    pointCount += node->count();
+    for (const auto& child : node->children) {
+      if (child) {
+        candidates.emplace(projectedSize(*child), child.get());
+      }
+    }
+  }
+
+  return pointCount;
+}
+
+PointCloudOctreeNode* PointCloudOctree::getRoot() const
+{
+  return _root.get();
+}
+
+bool PointCloudOctree::hasColors() const
+{
+  return _hasColors;
+}
+
+size_t PointCloudOctree::getPointCount() const
+{
+  return _pointCount;
+}
+
+size_t PointCloudOctree::getNodeCount() const
+{
+  return _nodeCount;
+}
+
+float PointCloudOctree::getSpacing(size_t depth) const
+{
+  const auto size = _root->maximum.x - _root->minimum.x;
+  return size / static_cast<float>(_gridSize) / std::pow(2.f, static_cast<float>(depth));
+}
+
+} // end of namespace BABYLON
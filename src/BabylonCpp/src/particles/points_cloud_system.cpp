@@ -1,9 +1,14 @@
 #include <babylon/particles/points_cloud_system.h>
 
+#include <algorithm>
+#include <limits>
+#include <random>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/collisions/picking_info.h>
 #include <babylon/core/logging.h>
 #include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/engine_store.h>
 #include <babylon/materials/standard_material.h>
@@ -13,10 +18,195 @@
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/particles/cloud_point.h>
+#include <babylon/particles/particle_collider.h>
 #include <babylon/particles/points_group.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Bounding volume hierarchy of the triangles of a mesh, used to cast the rays of the volume
+ * sampling from several threads (Ray::intersectsMesh uses shared temporaries).
+ */
+class TriangleBVH {
+
+public:
+  TriangleBVH(const Float32Array& positions, const IndicesArray& indices)
+  {
+    const auto nbTriangles = indices.size() / 3;
+    _triangles.resize(9 * nbTriangles);
+    _order.resize(nbTriangles);
+    std::vector<float> centroids(3 * nbTriangles);
+    for (size_t t = 0; t < nbTriangles; ++t) {
+      const auto* v0 = &positions[3 * indices[3 * t]];
+      const auto* v1 = &positions[3 * indices[3 * t + 1]];
+      const auto* v2 = &positions[3 * indices[3 * t + 2]];
+      for (size_t c = 0; c < 3; ++c) {
+        _triangles[9 * t + c]     = v0[c];
+        _triangles[9 * t + 3 + c] = v1[c] - v0[c];
+        _triangles[9 * t + 6 + c] = v2[c] - v0[c];
+        centroids[3 * t + c]      = (v0[c] + v1[c] + v2[c]) / 3.f;
+      }
+      _order[t] = static_cast<uint32_t>(t);
+    }
+    if (nbTriangles > 0) {
+      _nodes.emplace_back();
+      _build(0, 0, static_cast<uint32_t>(nbTriangles), centroids);
+    }
+  }
+
+  /**
+   * @brief Returns the distance to the closest triangle hit by a ray, -1 if none.
+   */
+  [[nodiscard]] float intersect(const Vector3& origin, const Vector3& direction,
+                                float length) const
+  {
+    const float o[3]   = {origin.x, origin.y, origin.z};
+    const float d[3]   = {direction.x, direction.y, direction.z};
+    const float inv[3] = {1.f / d[0], 1.f / d[1], 1.f / d[2]};
+    auto closest       = length;
+    auto hit           = false;
+    std::vector<uint32_t> stack;
+    if (!_nodes.empty()) {
+      stack.emplace_back(0);
+    }
+    while (!stack.empty()) {
+      const auto& node = _nodes[stack.back()];
+      stack.pop_back();
+      if (!_intersectsBox(node, o, inv, closest)) {
+        continue;
+      }
+      if (node.count == 0) {
+        stack.emplace_back(node.left);
+        stack.emplace_back(node.left + 1);
+        continue;
+      }
+      for (auto i = node.start; i < node.start + node.count; ++i) {
+        const auto distance = _intersectsTriangle(&_triangles[9 * _order[i]], o, d);
+        if (distance > 0.f && distance < closest) {
+          closest = distance;
+          hit     = true;
+        }
+      }
+    }
+    return hit ? closest : -1.f;
+  }
+
+private:
+  struct Node {
+    float minimum[3];
+    float maximum[3];
+    uint32_t start; // first triangle of a leaf, in _order
+    uint32_t count; // number of triangles of a leaf, 0 for an inner node
+    uint32_t left;  // first child of an inner node, the second one follows
+  };
+
+  void _build(size_t nodeIndex, uint32_t start, uint32_t end, const std::vector<float>& centroids)
+  {
+    Node node{};
+    for (size_t c = 0; c < 3; ++c) {
+      node.minimum[c] = std::numeric_limits<float>::max();
+      node.maximum[c] = std::numeric_limits<float>::lowest();
+    }
+    float centroidMin[3] = {node.minimum[0], node.minimum[1], node.minimum[2]};
+    float centroidMax[3] = {node.maximum[0], node.maximum[1], node.maximum[2]};
+    for (auto i = start; i < end; ++i) {
+      const auto* triangle = &_triangles[9 * _order[i]];
+      for (size_t c = 0; c < 3; ++c) {
+        for (const auto value : {triangle[c], triangle[c] + triangle[3 + c],
+                                 triangle[c] + triangle[6 + c]}) {
+          node.minimum[c] = std::min(node.minimum[c], value);
+          node.maximum[c] = std::max(node.maximum[c], value);
+        }
+        centroidMin[c] = std::min(centroidMin[c], centroids[3 * _order[i] + c]);
+        centroidMax[c] = std::max(centroidMax[c], centroids[3 * _order[i] + c]);
+      }
+    }
+
+    if (end - start <= 4) {
+      node.start        = start;
+      node.count        = end - start;
+      _nodes[nodeIndex] = node;
+      return;
+    }
+
+    // Median split along the largest extent of the centroids
+    size_t axis = 0;
+    for (size_t c = 1; c < 3; ++c) {
+      if (centroidMax[c] - centroidMin[c] > centroidMax[axis] - centroidMin[axis]) {
+        axis = c;
+      }
+    }
+    const auto middle = start + (end - start) / 2;
+    std::nth_element(_order.begin() + start, _order.begin() + middle, _order.begin() + end,
+                     [&centroids, axis](uint32_t a, uint32_t b) {
+                       return centroids[3 * a + axis] < centroids[3 * b + axis];
+                     });
+
+    node.left = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+    _nodes.emplace_back();
+    _nodes[nodeIndex] = node;
+    _build(node.left, start, static_cast<uint32_t>(middle), centroids);
+    _build(node.left + 1, static_cast<uint32_t>(middle), end, centroids);
+  }
+
+  static bool _intersectsBox(const Node& node, const float* o, const float* inv, float length)
+  {
+    auto tMin = 0.f;
+    auto tMax = length;
+    for (size_t c = 0; c < 3; ++c) {
+      auto t0 = (node.minimum[c] - o[c]) * inv[c];
+      auto t1 = (node.maximum[c] - o[c]) * inv[c];
+      if (t0 > t1) {
+        std::swap(t0, t1);
+      }
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+      if (tMin > tMax) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Moller-Trumbore, the triangle being stored as vertex0, edge1 and edge2 */
+  static float _intersectsTriangle(const float* triangle, const float* o, const float* d)
+  {
+    const auto* v0 = triangle;
+    const auto* e1 = triangle + 3;
+    const auto* e2 = triangle + 6;
+    const float p[3]
+      = {d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0]};
+    const auto det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+    if (std::abs(det) < 1e-12f) {
+      return -1.f;
+    }
+    const auto invDet = 1.f / det;
+    const float s[3]  = {o[0] - v0[0], o[1] - v0[1], o[2] - v0[2]};
+    const auto u      = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+    if (u < 0.f || u > 1.f) {
+      return -1.f;
+    }
+    const float q[3]
+      = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+    const auto v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * invDet;
+    if (v < 0.f || u + v > 1.f) {
+      return -1.f;
+    }
+    return (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * invDet;
+  }
+
+private:
+  std::vector<Node> _nodes;
+  std::vector<float> _triangles;
+  std::vector<uint32_t> _order;
+
+}; // end of class TriangleBVH
+
+} // end of anonymous namespace
+
 PointsCloudSystem::PointsCloudSystem(const std::string& iName, size_t pointSize, Scene* scene,
                                      const std::optional<PointsCloudSystemOptions>& options)
     : nbParticles{0}
@@ -31,6 +221,7 @@ PointsCloudSystem::PointsCloudSystem(const std::string& iName, size_t pointSize,
                              &PointsCloudSystem::set_computeParticleTexture}
     , computeBoundingBox{this, &PointsCloudSystem::get_computeBoundingBox,
                          &PointsCloudSystem::set_computeBoundingBox}
+    , collider{nullptr}
     , _updatable{true}
     , _isVisibilityBoxLocked{false}
     , _alwaysVisible{false}
@@ -70,7 +261,7 @@ MeshPtr PointsCloudSystem::_buildMesh()
   _uvs32       = Float32Array(_uvs);
   _colors32    = Float32Array(_colors);
 
-  auto vertexData = std::unique_ptr<VertexData>();
+  auto vertexData = std::make_unique<VertexData>();
   vertexData->set(_positions32, VertexBuffer::PositionKind);
 
   if (_uvs32.size() > 0) {
@@ -132,7 +323,8 @@ Color4 PointsCloudSystem::_getColorIndicesForCoord(const PointsGroup& pointsGrou
   const auto greenForCoord        = imageData[greenIndex];
   const auto blueForCoord         = imageData[blueIndex];
   const auto alphaForCoord        = imageData[alphaIndex];
-  return Color4(redForCoord / 255.f, greenForCoord / 255.f, blueForCoord / 255.f, alphaForCoord);
+  return Color4(redForCoord / 255.f, greenForCoord / 255.f, blueForCoord / 255.f,
+                alphaForCoord / 255.f);
 }
 
 void PointsCloudSystem::_setPointsColorOrUV(const MeshPtr& mesh, const PointsGroupPtr& pointsGroup,
@@ -167,240 +359,166 @@ void PointsCloudSystem::_setPointsColorOrUV(const MeshPtr& mesh, const PointsGro
     }
   }
 
-  size_t idxPoints = 0;
-
-  auto id0     = 0u;
-  auto id1     = 0u;
-  auto id2     = 0u;
-  auto v0X     = 0.f;
-  auto v0Y     = 0.f;
-  auto v0Z     = 0.f;
-  auto v1X     = 0.f;
-  auto v1Y     = 0.f;
-  auto v1Z     = 0.f;
-  auto v2X     = 0.f;
-  auto v2Y     = 0.f;
-  auto v2Z     = 0.f;
-  auto vertex0 = Vector3::Zero();
-  auto vertex1 = Vector3::Zero();
-  auto vertex2 = Vector3::Zero();
-  auto vec0    = Vector3::Zero();
-  auto vec1    = Vector3::Zero();
+  // Offsets of the points of each facet, the facets being sampled in parallel
+  const auto nbFacets = std::min(meshInd.size() / 3, pointsGroup->_groupDensity.size());
+  std::vector<size_t> offsets(nbFacets + 1, 0);
+  for (size_t index = 0; index < nbFacets; ++index) {
+    offsets[index + 1] = offsets[index] + static_cast<size_t>(pointsGroup->_groupDensity[index]);
+  }
+  const auto nbPoints = offsets[nbFacets];
+
+  // Points with uvs in UV mode, with colors otherwise
+  const auto setUVs        = colorFromTexture.has_value() && !*colorFromTexture;
+  const auto setColors     = !colorFromTexture.has_value() || *colorFromTexture;
+  const auto textureColors = colorFromTexture.value_or(false) && hasTexture.value_or(false)
+                             && pointsGroup->_groupImageData && !meshUV.empty();
+  const auto vertexColors  = colorFromTexture.value_or(false) && !meshCol.empty();
+  const auto range         = static_cast<float>(iRange.value_or(0));
+  const auto width         = static_cast<float>(pointsGroup->_groupImgWidth);
+  const auto height        = static_cast<float>(pointsGroup->_groupImgHeight);
+  Float32Array positions(3 * nbPoints);
+  Float32Array uvs(setUVs && !meshUV.empty() ? 2 * nbPoints : 0);
+  Float32Array colors(setColors ? 4 * nbPoints : 0);
+
+  // The facet normals are computed once, ray casts use a hierarchy which is safe to share
+  std::vector<Vector3> facetNormals;
+  std::unique_ptr<TriangleBVH> bvh;
+  if (isVolume) {
+    facetNormals.resize(nbFacets);
+    for (size_t index = 0; index < nbFacets; ++index) {
+      facetNormals[index] = mesh->getFacetNormal(index).normalize().scale(-1.f);
+    }
+    bvh = std::make_unique<TriangleBVH>(meshPos, meshInd);
+  }
 
-  auto uv0X  = 0.f;
-  auto uv0Y  = 0.f;
-  auto uv1X  = 0.f;
-  auto uv1Y  = 0.f;
-  auto uv2X  = 0.f;
-  auto uv2Y  = 0.f;
-  auto uv0   = Vector2::Zero();
-  auto uv1   = Vector2::Zero();
-  auto uv2   = Vector2::Zero();
-  auto uvec0 = Vector2::Zero();
-  auto uvec1 = Vector2::Zero();
-
-  auto col0X   = 0.f;
-  auto col0Y   = 0.f;
-  auto col0Z   = 0.f;
-  auto col0A   = 0.f;
-  auto col1X   = 0.f;
-  auto col1Y   = 0.f;
-  auto col1Z   = 0.f;
-  auto col1A   = 0.f;
-  auto col2X   = 0.f;
-  auto col2Y   = 0.f;
-  auto col2Z   = 0.f;
-  auto col2A   = 0.f;
-  auto col0    = Vector4::Zero();
-  auto col1    = Vector4::Zero();
-  auto col2    = Vector4::Zero();
-  auto colvec0 = Vector4::Zero();
-  auto colvec1 = Vector4::Zero();
-
-  auto lamda = 0.f;
-  auto mu    = 0.f;
-  auto range = iRange.value_or(0);
-
-  Vector3 facetPoint;
-  Vector2 uvPoint;
-  auto colPoint = Vector4(0.f, 0.f, 0.f, 0.f);
-
-  auto norm          = Vector3::Zero();
-  auto tang          = Vector3::Zero();
-  auto biNorm        = Vector3::Zero();
-  auto angle         = 0.f;
-  auto facetPlaneVec = Vector3::Zero();
-
-  auto gap      = 0.f;
-  auto distance = 0.f;
-  auto ray      = Ray(Vector3::Zero(), Vector3(1.f, 0.f, 0.f));
-  PickingInfo pickInfo;
-  auto direction = Vector3::Zero();
-
-  for (auto index = 0u; index < meshInd.size() / 3; ++index) {
-    id0 = meshInd[3 * index];
-    id1 = meshInd[3 * index + 1];
-    id2 = meshInd[3 * index + 2];
-    v0X = meshPos[3 * id0];
-    v0Y = meshPos[3 * id0 + 1];
-    v0Z = meshPos[3 * id0 + 2];
-    v1X = meshPos[3 * id1];
-    v1Y = meshPos[3 * id1 + 1];
-    v1Z = meshPos[3 * id1 + 2];
-    v2X = meshPos[3 * id2];
-    v2Y = meshPos[3 * id2 + 1];
-    v2Z = meshPos[3 * id2 + 2];
-    vertex0.set(v0X, v0Y, v0Z);
-    vertex1.set(v1X, v1Y, v1Z);
-    vertex2.set(v2X, v2Y, v2Z);
-    vertex1.subtractToRef(vertex0, vec0);
-    vertex2.subtractToRef(vertex1, vec1);
+  const auto seed = std::random_device{}();
+
+  ThreadPool::Default().parallelFor(0, nbFacets, 64, [&](size_t begin, size_t end) {
+    Vector3 vertex0, vertex1, vertex2, vec0, vec1, facetPoint, direction;
+    Vector2 uv0, uv1, uv2, uvec0, uvec1;
+    Vector4 col0, col1, col2, colvec0, colvec1;
+    Color3 colPoint3;
+    Color4 pointColor;
+    std::minstd_rand generator;
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+    for (size_t index = begin; index < end; ++index) {
+      const auto id0 = meshInd[3 * index];
+      const auto id1 = meshInd[3 * index + 1];
+      const auto id2 = meshInd[3 * index + 2];
+      vertex0.set(meshPos[3 * id0], meshPos[3 * id0 + 1], meshPos[3 * id0 + 2]);
+      vertex1.set(meshPos[3 * id1], meshPos[3 * id1 + 1], meshPos[3 * id1 + 2]);
+      vertex2.set(meshPos[3 * id2], meshPos[3 * id2 + 1], meshPos[3 * id2 + 2]);
+      vertex1.subtractToRef(vertex0, vec0);
+      vertex2.subtractToRef(vertex1, vec1);
+
+      if (!meshUV.empty()) {
+        uv0.set(meshUV[2 * id0], meshUV[2 * id0 + 1]);
+        uv1.set(meshUV[2 * id1], meshUV[2 * id1 + 1]);
+        uv2.set(meshUV[2 * id2], meshUV[2 * id2 + 1]);
+        uv1.subtractToRef(uv0, uvec0);
+        uv2.subtractToRef(uv1, uvec1);
+      }
 
-    if (!meshUV.empty()) {
-      uv0X = meshUV[2 * id0];
-      uv0Y = meshUV[2 * id0 + 1];
-      uv1X = meshUV[2 * id1];
-      uv1Y = meshUV[2 * id1 + 1];
-      uv2X = meshUV[2 * id2];
-      uv2Y = meshUV[2 * id2 + 1];
-      uv0.set(uv0X, uv0Y);
-      uv1.set(uv1X, uv1Y);
-      uv2.set(uv2X, uv2Y);
-      uv1.subtractToRef(uv0, uvec0);
-      uv2.subtractToRef(uv1, uvec1);
-    }
-
-    if (!meshCol.empty() && colorFromTexture) {
-      col0X = meshCol[4 * id0];
-      col0Y = meshCol[4 * id0 + 1];
-      col0Z = meshCol[4 * id0 + 2];
-      col0A = meshCol[4 * id0 + 3];
-      col1X = meshCol[4 * id1];
-      col1Y = meshCol[4 * id1 + 1];
-      col1Z = meshCol[4 * id1 + 2];
-      col1A = meshCol[4 * id1 + 3];
-      col2X = meshCol[4 * id2];
-      col2Y = meshCol[4 * id2 + 1];
-      col2Z = meshCol[4 * id2 + 2];
-      col2A = meshCol[4 * id2 + 3];
-      col0.set(col0X, col0Y, col0Z, col0A);
-      col1.set(col1X, col1Y, col1Z, col1A);
-      col2.set(col2X, col2Y, col2Z, col2A);
-      col1.subtractToRef(col0, colvec0);
-      col2.subtractToRef(col1, colvec1);
-    }
-
-    auto width  = 0.f;
-    auto height = 0.f;
-    auto deltaS = 0.f;
-    auto deltaV = 0.f;
-    auto h      = 0.f;
-    auto s      = 0.f;
-    auto v      = 0.f;
-    Color3 hsvCol;
-    auto statedColor = Color3(0.f, 0.f, 0.f);
-    auto colPoint3   = Color3(0.f, 0.f, 0.f);
-    Color4 pointColors;
-    CloudPointPtr particle = nullptr;
-
-    for (auto i = 0u; i < pointsGroup->_groupDensity[index]; ++i) {
-      idxPoints = particles.size();
-      _addParticle(idxPoints, pointsGroup, _groupCounter, index + i);
-      particle = particles[idxPoints];
-      // form a point inside the facet v0, v1, v2;
-      lamda      = Scalar::RandomRange(0.f, 1.f);
-      mu         = Scalar::RandomRange(0.f, 1.f);
-      facetPoint = vertex0.add(vec0.scale(lamda)).add(vec1.scale(lamda * mu));
-      if (isVolume) {
-        norm          = mesh->getFacetNormal(index).normalize().scale(-1.f);
-        tang          = vec0.clone()->normalize();
-        biNorm        = Vector3::Cross(norm, tang);
-        angle         = Scalar::RandomRange(0.f, Math::PI_2);
-        facetPlaneVec = tang.scale(std::cos(angle)).add(biNorm.scale(std::sin(angle)));
-        angle         = Scalar::RandomRange(0.1f, Math::PI_2);
-        direction     = facetPlaneVec.scale(std::cos(angle)).add(norm.scale(std::sin(angle)));
-
-        ray.origin    = facetPoint.add(direction.scale(0.00001f));
-        ray.direction = direction;
-        ray.length    = diameter;
-        pickInfo      = ray.intersectsMesh(mesh.get());
-        if (pickInfo.hit) {
-          distance = pickInfo.pickedPoint->subtract(facetPoint).length();
-          gap      = Scalar::RandomRange(0.f, 1.f) * distance;
-          facetPoint.addInPlace(direction.scale(gap));
-        }
+      if (vertexColors) {
+        col0.set(meshCol[4 * id0], meshCol[4 * id0 + 1], meshCol[4 * id0 + 2],
+                 meshCol[4 * id0 + 3]);
+        col1.set(meshCol[4 * id1], meshCol[4 * id1 + 1], meshCol[4 * id1 + 2],
+                 meshCol[4 * id1 + 3]);
+        col2.set(meshCol[4 * id2], meshCol[4 * id2 + 1], meshCol[4 * id2 + 2],
+                 meshCol[4 * id2 + 3]);
+        col1.subtractToRef(col0, colvec0);
+        col2.subtractToRef(col1, colvec1);
       }
-      particle->position = facetPoint.copy();
-      stl_util::concat(_positions,
-                       {particle->position.x, particle->position.y, particle->position.z});
-      if (colorFromTexture.has_value()) {
-        if (!meshUV.empty()) {
-          uvPoint = uv0.add(uvec0.scale(lamda)).add(uvec1.scale(lamda * mu));
-          if (colorFromTexture) { // Set particle color to texture color
-            if (hasTexture && pointsGroup->_groupImageData) {
-              width       = pointsGroup->_groupImgWidth;
-              height      = pointsGroup->_groupImgHeight;
-              pointColors = _getColorIndicesForCoord(
-                *pointsGroup, static_cast<uint32_t>(std::round(uvPoint.x * width)),
-                static_cast<uint32_t>(std::round(uvPoint.y * height)),
-                static_cast<uint32_t>(width));
-              particle->color = std::make_unique<Color4>(pointColors);
-              stl_util::concat(_colors,
-                               {pointColors.r, pointColors.g, pointColors.b, pointColors.a});
-            }
-            else {
-              if (!meshCol.empty()) { // failure in texture and colors available
-                colPoint = col0.add(colvec0.scale(lamda)).add(colvec1.scale(lamda * mu));
-                particle->color
-                  = std::make_unique<Color4>(colPoint.x, colPoint.y, colPoint.z, colPoint.w);
-                stl_util::concat(_colors, {colPoint.x, colPoint.y, colPoint.z, colPoint.w});
-              }
-              else {
-                colPoint = col0.set(Math::random(), Math::random(), Math::random(), 1.f);
-                particle->color
-                  = std::make_unique<Color4>(colPoint.x, colPoint.y, colPoint.z, colPoint.w);
-                stl_util::concat(_colors, {colPoint.x, colPoint.y, colPoint.z, colPoint.w});
-              }
-            }
-          }
-          else { // Set particle uv based on a mesh uv
-            particle->uv = std::make_unique<Vector2>(uvPoint);
-            stl_util::concat(_uvs, {particle->uv->x, particle->uv->y});
+
+      // Seeded per facet, the points do not depend on the split of the facets between threads
+      generator.seed(static_cast<std::uint_fast32_t>(seed + index * 2654435761u));
+
+      for (auto p = offsets[index]; p < offsets[index + 1]; ++p) {
+        // form a point inside the facet v0, v1, v2;
+        const auto lamda = unit(generator);
+        const auto mu    = unit(generator);
+        facetPoint       = vertex0.add(vec0.scale(lamda)).add(vec1.scale(lamda * mu));
+        if (isVolume) {
+          const auto& norm    = facetNormals[index];
+          const auto tang     = vec0.normalizeToNew();
+          const auto biNorm   = Vector3::Cross(norm, tang);
+          auto angle          = unit(generator) * Math::PI_2;
+          const auto planeVec = tang.scale(std::cos(angle)).add(biNorm.scale(std::sin(angle)));
+          angle               = 0.1f + unit(generator) * (Math::PI_2 - 0.1f);
+          direction           = planeVec.scale(std::cos(angle)).add(norm.scale(std::sin(angle)));
+
+          const auto distance
+            = bvh->intersect(facetPoint.add(direction.scale(0.00001f)), direction, diameter);
+          if (distance >= 0.f) {
+            facetPoint.addInPlace(direction.scale(unit(generator) * distance));
           }
         }
-      }
-      else {
-        if (color) {
-          statedColor.set(color->r, color->g, color->b);
-          deltaS = Scalar::RandomRange(-range, range);
-          deltaV = Scalar::RandomRange(-range, range);
-          hsvCol = statedColor.toHSV();
-          h      = hsvCol.r;
-          s      = hsvCol.g + deltaS;
-          v      = hsvCol.b + deltaV;
-          if (s < 0.f) {
-            s = 0.f;
+        positions[3 * p]     = facetPoint.x;
+        positions[3 * p + 1] = facetPoint.y;
+        positions[3 * p + 2] = facetPoint.z;
+
+        if (setUVs) {
+          if (!meshUV.empty()) { // Set particle uv based on a mesh uv
+            uvs[2 * p]     = uv0.x + uvec0.x * lamda + uvec1.x * lamda * mu;
+            uvs[2 * p + 1] = uv0.y + uvec0.y * lamda + uvec1.y * lamda * mu;
           }
-          if (s > 1.f) {
-            s = 1.f;
-          }
-          if (v < 0.f) {
-            v = 0.f;
-          }
-          if (v > 1.f) {
-            v = 1.f;
-          }
-          Color3::HSVtoRGBToRef(h, s, v, colPoint3);
-          colPoint.set(colPoint3.r, colPoint3.g, colPoint3.b, 1);
+          continue;
+        }
+
+        if (textureColors) { // Set particle color to texture color
+          const auto u = Scalar::Clamp(uv0.x + uvec0.x * lamda + uvec1.x * lamda * mu, 0.f, 1.f);
+          const auto v = Scalar::Clamp(uv0.y + uvec0.y * lamda + uvec1.y * lamda * mu, 0.f, 1.f);
+          pointColor   = _getColorIndicesForCoord(
+            *pointsGroup, static_cast<uint32_t>(std::min(std::round(u * width), width - 1.f)),
+            static_cast<uint32_t>(std::min(std::round(v * height), height - 1.f)),
+            static_cast<uint32_t>(width));
+        }
+        else if (vertexColors) { // failure in texture and colors available
+          pointColor.set(col0.x + colvec0.x * lamda + colvec1.x * lamda * mu,
+                         col0.y + colvec0.y * lamda + colvec1.y * lamda * mu,
+                         col0.z + colvec0.z * lamda + colvec1.z * lamda * mu,
+                         col0.w + colvec0.w * lamda + colvec1.w * lamda * mu);
+        }
+        else if (color && !colorFromTexture.has_value()) {
+          const auto hsvCol = Color3(color->r, color->g, color->b).toHSV();
+          const auto deltaS = (unit(generator) * 2.f - 1.f) * range;
+          const auto deltaV = (unit(generator) * 2.f - 1.f) * range;
+          const auto s      = Scalar::Clamp(hsvCol.g + deltaS, 0.f, 1.f);
+          const auto v      = Scalar::Clamp(hsvCol.b + deltaV, 0.f, 1.f);
+          Color3::HSVtoRGBToRef(hsvCol.r, s, v, colPoint3);
+          pointColor.set(colPoint3.r, colPoint3.g, colPoint3.b, 1.f);
         }
         else {
-          colPoint = col0.set(Math::random(), Math::random(), Math::random(), 1.f);
+          pointColor.set(unit(generator), unit(generator), unit(generator), 1.f);
         }
-        particle->color = std::make_unique<Color4>(colPoint.x, colPoint.y, colPoint.z, colPoint.w);
-        stl_util::concat(_colors, {colPoint.x, colPoint.y, colPoint.z, colPoint.w});
+        colors[4 * p]     = pointColor.r;
+        colors[4 * p + 1] = pointColor.g;
+        colors[4 * p + 2] = pointColor.b;
+        colors[4 * p + 3] = pointColor.a;
+      }
+    }
+  });
+
+  // The cloud points are created on the calling thread
+  particles.reserve(particles.size() + nbPoints);
+  for (size_t index = 0; index < nbFacets; ++index) {
+    for (auto p = offsets[index]; p < offsets[index + 1]; ++p) {
+      auto particle = _addParticle(particles.size(), pointsGroup, _groupCounter,
+                                   index + p - offsets[index]);
+      particle->position.set(positions[3 * p], positions[3 * p + 1], positions[3 * p + 2]);
+      if (!uvs.empty()) {
+        particle->uv = std::make_unique<Vector2>(uvs[2 * p], uvs[2 * p + 1]);
+      }
+      if (!colors.empty()) {
+        particle->color = std::make_unique<Color4>(colors[4 * p], colors[4 * p + 1],
+                                                   colors[4 * p + 2], colors[4 * p + 3]);
       }
     }
   }
+  stl_util::concat(_positions, positions);
+  stl_util::concat(_uvs, uvs);
+  stl_util::concat(_colors, colors);
 }
 
 void PointsCloudSystem::_colorFromTexture(const MeshPtr& mesh, const PointsGroupPtr& pointsGroup,
@@ -441,7 +559,8 @@ void PointsCloudSystem::_colorFromTexture(const MeshPtr& mesh, const PointsGroup
 Float32Array PointsCloudSystem::_calculateDensity(size_t nbPoints, const Float32Array& positions,
                                                   const IndicesArray& indices)
 {
-  Float32Array density;
+  auto nbFacets = indices.size() / 3;
+  Float32Array density(nbFacets, 0.f);
   auto id0     = 0u;
   auto id1     = 0u;
   auto id2     = 0u;
@@ -466,11 +585,9 @@ Float32Array PointsCloudSystem::_calculateDensity(size_t nbPoints, const Float32
   auto c    = 0.f; // length of side of triangle
   auto p    = 0.f; // perimeter of triangle
   auto area = 0.f;
-  Float32Array areas;
+  Float32Array areas(nbFacets, 0.f);
   auto surfaceArea = 0.f;
 
-  auto nbFacets = indices.size() / 3;
-
   // surface area
   for (size_t index = 0; index < nbFacets; ++index) {
     id0 = indices[3 * index];
@@ -499,6 +616,9 @@ Float32Array PointsCloudSystem::_calculateDensity(size_t nbPoints, const Float32
     surfaceArea += area;
     areas[index] = area;
   }
+  if (nbFacets == 0) {
+    return density;
+  }
   auto pointCount = 0ull;
   for (size_t index = 0; index < nbFacets; ++index) {
     density[index] = std::floor(nbPoints * areas[index] / surfaceArea);
@@ -510,7 +630,7 @@ Float32Array PointsCloudSystem::_calculateDensity(size_t nbPoints, const Float32
   auto extraPoints    = diff % nbFacets;
 
   if (pointsPerFacet > 0.f) {
-    for (size_t i; i < density.size(); ++i) {
+    for (size_t i = 0; i < density.size(); ++i) {
       density[i] += pointsPerFacet;
     }
   }
@@ -704,6 +824,10 @@ PointsCloudSystem& PointsCloudSystem::setParticles(size_t start, size_t end, boo
     // call to custom user function to update the particle properties
     updateParticle(particle);
 
+    if (collider) {
+      collider->collide(particle->position, particle->velocity);
+    }
+
     auto& particleRotationMatrix = particle->_rotationMatrix;
     const auto& particlePosition = particle->position;
     auto& particleGlobalPosition = particle->_globalPosition;
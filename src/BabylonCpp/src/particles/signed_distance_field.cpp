@@ -0,0 +1,552 @@
+#include <babylon/particles/signed_distance_field.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/asio/asio.h>
+#include <babylon/asio/internal/sync_callback_runner.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+struct Triangle {
+  Vector3 a;
+  Vector3 b;
+  Vector3 c;
+  Vector3 normal;
+  Vector3 minimum;
+  Vector3 maximum;
+};
+
+struct WorldTriangles {
+  Float32Array positions;
+  Uint32Array indices;
+};
+
+/**
+ * Closest point of a triangle (Real-Time Collision Detection, 5.1.5).
+ */
+Vector3 ClosestPointOnTriangle(const Vector3& p, const Triangle& t)
+{
+  const auto ab = t.b - t.a;
+  const auto ac = t.c - t.a;
+  const auto ap = p - t.a;
+  const auto d1 = Vector3::Dot(ab, ap);
+  const auto d2 = Vector3::Dot(ac, ap);
+  if (d1 <= 0.f && d2 <= 0.f) {
+    return t.a;
+  }
+
+  const auto bp = p - t.b;
+  const auto d3 = Vector3::Dot(ab, bp);
+  const auto d4 = Vector3::Dot(ac, bp);
+  if (d3 >= 0.f && d4 <= d3) {
+    return t.b;
+  }
+
+  const auto vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+    return t.a + ab * (d1 / (d1 - d3));
+  }
+
+  const auto cp = p - t.c;
+  const auto d5 = Vector3::Dot(ab, cp);
+  const auto d6 = Vector3::Dot(ac, cp);
+  if (d6 >= 0.f && d5 <= d6) {
+    return t.c;
+  }
+
+  const auto vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+    return t.a + ac * (d2 / (d2 - d6));
+  }
+
+  const auto va = d3 * d6 - d5 * d4;
+  if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+    return t.b + (t.c - t.b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+  }
+
+  const auto denom = 1.f / (va + vb + vc);
+  return t.a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+WorldTriangles GetWorldTriangles(const std::vector<AbstractMesh*>& meshes)
+{
+  WorldTriangles triangles;
+  Vector3 position;
+  for (auto mesh : meshes) {
+    if (!mesh) {
+      continue;
+    }
+
+    const auto positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+    auto indices         = mesh->getIndices();
+    const auto& world    = mesh->computeWorldMatrix(true);
+    const auto base      = static_cast<uint32_t>(triangles.positions.size() / 3);
+
+    for (size_t i = 0; i + 2 < positions.size(); i += 3) {
+      Vector3::TransformCoordinatesFromFloatsToRef(positions[i], positions[i + 1],
+                                                   positions[i + 2], world, position);
+      triangles.positions.insert(triangles.positions.end(), {position.x, position.y, position.z});
+    }
+
+    // Unindexed meshes
+    if (indices.empty()) {
+      indices.resize(positions.size() / 3);
+      for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = static_cast<uint32_t>(i);
+      }
+    }
+    for (const auto index : indices) {
+      triangles.indices.emplace_back(base + index);
+    }
+  }
+
+  return triangles;
+}
+
+/**
+ * Trilinear interpolation of the 8 corners of a cell (c[z][y][x]) and its gradient in cell units.
+ */
+float Trilinear(const float c[2][2][2], float tx, float ty, float tz, float& gx, float& gy,
+                float& gz)
+{
+  const auto c00 = c[0][0][0] + (c[0][0][1] - c[0][0][0]) * tx;
+  const auto c10 = c[0][1][0] + (c[0][1][1] - c[0][1][0]) * tx;
+  const auto c01 = c[1][0][0] + (c[1][0][1] - c[1][0][0]) * tx;
+  const auto c11 = c[1][1][0] + (c[1][1][1] - c[1][1][0]) * tx;
+  const auto c0  = c00 + (c10 - c00) * ty;
+  const auto c1  = c01 + (c11 - c01) * ty;
+
+  const auto dx00 = c[0][0][1] - c[0][0][0];
+  const auto dx10 = c[0][1][1] - c[0][1][0];
+  const auto dx01 = c[1][0][1] - c[1][0][0];
+  const auto dx11 = c[1][1][1] - c[1][1][0];
+  const auto dx0  = dx00 + (dx10 - dx00) * ty;
+  const auto dx1  = dx01 + (dx11 - dx01) * ty;
+  gx              = dx0 * (1.f - tz) + dx1 * tz;
+  gy              = (c10 - c00) * (1.f - tz) + (c11 - c01) * tz;
+  gz              = c1 - c0;
+
+  return c0 + (c1 - c0) * tz;
+}
+
+} // end of anonymous namespace
+
+SignedDistanceFieldPtr SignedDistanceField::FromTriangles(const Float32Array& positions,
+                                                          const Uint32Array& indices,
+                                                          float cellSize, float bandWidth)
+{
+  const auto vertexCount = positions.size() / 3;
+  if (cellSize <= 0.f || vertexCount == 0) {
+    return nullptr;
+  }
+  if (bandWidth <= 0.f) {
+    bandWidth = 3.f * cellSize;
+  }
+
+  std::vector<Triangle> triangles;
+  triangles.reserve(indices.size() / 3);
+  const auto max = std::numeric_limits<float>::max();
+  Vector3 minimum(max, max, max);
+  Vector3 maximum(-max, -max, -max);
+  const auto band = Vector3(bandWidth, bandWidth, bandWidth);
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount
+        || indices[i + 2] >= vertexCount) {
+      continue;
+    }
+    Triangle t;
+    t.a      = Vector3::FromArray(positions, indices[i] * 3u);
+    t.b      = Vector3::FromArray(positions, indices[i + 1] * 3u);
+    t.c      = Vector3::FromArray(positions, indices[i + 2] * 3u);
+    // Front face of the meshes (clockwise winding, left-handed)
+    t.normal = Vector3::Cross(t.c - t.a, t.b - t.a);
+    if (t.normal.lengthSquared() == 0.f) {
+      continue;
+    }
+    t.normal.normalize();
+    t.minimum = Vector3::Minimize(Vector3::Minimize(t.a, t.b), t.c);
+    t.maximum = Vector3::Maximize(Vector3::Maximize(t.a, t.b), t.c);
+    minimum.minimizeInPlace(t.minimum);
+    maximum.maximizeInPlace(t.maximum);
+    t.minimum.subtractInPlace(band);
+    t.maximum.addInPlace(band);
+    triangles.emplace_back(t);
+  }
+  if (triangles.empty()) {
+    return nullptr;
+  }
+
+  const auto origin    = minimum.subtract(band);
+  const auto extent    = maximum.add(band).subtract(origin);
+  const auto cellCount = [cellSize](float size) {
+    return static_cast<size_t>(std::ceil(size / cellSize)) + 1;
+  };
+  auto field = std::make_shared<SignedDistanceField>(origin, cellCount(extent.x),
+                                                     cellCount(extent.y), cellCount(extent.z),
+                                                     cellSize, bandWidth);
+
+  const auto width  = field->_width;
+  const auto height = field->_height;
+  auto values       = field->_values.data();
+
+  // Range of the grid values between two coordinates
+  const auto firstCell = [cellSize](float from, float start) {
+    return static_cast<size_t>(std::max(std::ceil((from - start) / cellSize), 0.f));
+  };
+  const auto lastCell = [cellSize](float to, float start, size_t count) {
+    const auto cell = std::max(std::floor((to - start) / cellSize), 0.f);
+    return std::min(static_cast<size_t>(cell), count - 1);
+  };
+
+  // A slice of the grid per job, each slice only writing its own values
+  ThreadPool::Default().parallelFor(0, field->_depth, 1, [&](size_t begin, size_t end) {
+    const auto tieTolerance = 1e-5f * cellSize;
+    // Alignment of the closest triangles with their direction, resolving the ties on the edges
+    std::vector<float> alignments(width * height);
+    for (auto z = begin; z < end; ++z) {
+      const auto pz = origin.z + static_cast<float>(z) * cellSize;
+      std::fill(alignments.begin(), alignments.end(), -1.f);
+      auto slice = values + z * width * height;
+
+      for (const auto& t : triangles) {
+        if (pz < t.minimum.z || pz > t.maximum.z) {
+          continue;
+        }
+        const auto x0 = firstCell(t.minimum.x, origin.x);
+        const auto x1 = lastCell(t.maximum.x, origin.x, width);
+        const auto y0 = firstCell(t.minimum.y, origin.y);
+        const auto y1 = lastCell(t.maximum.y, origin.y, height);
+
+        for (auto y = y0; y <= y1; ++y) {
+          for (auto x = x0; x <= x1; ++x) {
+            const Vector3 p(origin.x + static_cast<float>(x) * cellSize,
+                            origin.y + static_cast<float>(y) * cellSize, pz);
+            const auto toPoint  = p - ClosestPointOnTriangle(p, t);
+            const auto distance = toPoint.length();
+            const auto cell     = y * width + x;
+            const auto current  = std::abs(slice[cell]);
+            if (distance > current + tieTolerance) {
+              continue;
+            }
+
+            const auto side      = Vector3::Dot(toPoint, t.normal);
+            const auto alignment = distance > 0.f ? std::abs(side) / distance : 1.f;
+            if (distance < current - tieTolerance || alignment > alignments[cell]) {
+              slice[cell]      = side < 0.f ? -distance : distance;
+              alignments[cell] = alignment;
+            }
+          }
+        }
+      }
+    }
+  });
+
+  return field;
+}
+
+SignedDistanceFieldPtr SignedDistanceField::FromMeshes(const std::vector<AbstractMesh*>& meshes,
+                                                       float cellSize, float bandWidth)
+{
+  const auto triangles = GetWorldTriangles(meshes);
+  return FromTriangles(triangles.positions, triangles.indices, cellSize, bandWidth);
+}
+
+void SignedDistanceField::FromMeshesAsync(const std::vector<AbstractMesh*>& meshes,
+                                          float cellSize, float bandWidth,
+                                          const OnBakedFunction& onBaked)
+{
+  auto& threadPool = ThreadPool::Default();
+  if (threadPool.size() == 0 || asio::IsAsyncDisabled()) {
+    auto field = FromMeshes(meshes, cellSize, bandWidth);
+    if (onBaked) {
+      onBaked(field);
+    }
+    return;
+  }
+
+  // The meshes are only read on the calling thread
+  auto triangles = std::make_shared<WorldTriangles>(GetWorldTriangles(meshes));
+  threadPool.enqueue([triangles, cellSize, bandWidth, onBaked]() {
+    auto field = FromTriangles(triangles->positions, triangles->indices, cellSize, bandWidth);
+    if (onBaked) {
+      asio::sync_callback_runner::PushCallback([field, onBaked]() { onBaked(field); });
+    }
+  });
+}
+
+SignedDistanceField::SignedDistanceField(const Vector3& origin, size_t width, size_t height,
+                                         size_t depth, float cellSize, float distance)
+    : _origin{origin}
+    , _width{std::max(width, static_cast<size_t>(2))}
+    , _height{std::max(height, static_cast<size_t>(2))}
+    , _depth{std::max(depth, static_cast<size_t>(2))}
+    , _cellSize{cellSize}
+    , _values(_width * _height * _depth, distance)
+{
+}
+
+SignedDistanceField::~SignedDistanceField() = default;
+
+size_t SignedDistanceField::getWidth() const
+{
+  return _width;
+}
+
+size_t SignedDistanceField::getHeight() const
+{
+  return _height;
+}
+
+size_t SignedDistanceField::getDepth() const
+{
+  return _depth;
+}
+
+float SignedDistanceField::getCellSize() const
+{
+  return _cellSize;
+}
+
+const Vector3& SignedDistanceField::getOrigin() const
+{
+  return _origin;
+}
+
+Float32Array& SignedDistanceField::getValues()
+{
+  return _values;
+}
+
+float SignedDistanceField::getValue(size_t x, size_t y, size_t z) const
+{
+  return _values[(z * _height + y) * _width + x];
+}
+
+void SignedDistanceField::setValue(size_t x, size_t y, size_t z, float distance)
+{
+  _values[(z * _height + y) * _width + x] = distance;
+}
+
+float SignedDistanceField::sample(const Vector3& position) const
+{
+  Vector3 gradient;
+  return sample(position, gradient);
+}
+
+float SignedDistanceField::sample(const Vector3& position, Vector3& gradient) const
+{
+  float distance = 0.f;
+  sample(1, &position.x, &position.y, &position.z, &distance, &gradient.x, &gradient.y,
+         &gradient.z);
+  return distance;
+}
+
+void SignedDistanceField::sample(size_t count, const float* x, const float* y, const float* z,
+                                 float* distances, float* gradientX, float* gradientY,
+                                 float* gradientZ) const
+{
+#if defined(OPTION_ENABLE_SIMD) && defined(__SSE2__)
+  sampleSSE2(count, x, y, z, distances, gradientX, gradientY, gradientZ);
+#else
+  sampleScalar(count, x, y, z, distances, gradientX, gradientY, gradientZ);
+#endif
+}
+
+void SignedDistanceField::sampleScalar(size_t count, const float* x, const float* y, const float* z,
+                                       float* distances, float* gradientX, float* gradientY,
+                                       float* gradientZ) const
+{
+  _sampleScalar(0, count, x, y, z, distances, gradientX, gradientY, gradientZ);
+}
+
+bool SignedDistanceField::sampleSSE2(size_t count, const float* x, const float* y, const float* z,
+                                     float* distances, float* gradientX, float* gradientY,
+                                     float* gradientZ) const
+{
+#if defined(__SSE2__)
+  const auto invCellSize = 1.f / _cellSize;
+  const float maxCoordinates[3]
+    = {static_cast<float>(_width - 1), static_cast<float>(_height - 1),
+       static_cast<float>(_depth - 1)};
+  const float maxCells[3] = {maxCoordinates[0] - 1.f, maxCoordinates[1] - 1.f,
+                             maxCoordinates[2] - 1.f};
+  const auto strideY      = _width;
+  const auto strideZ      = _width * _height;
+  const auto values       = _values.data();
+
+  size_t i = 0;
+  const __m128 zero         = _mm_setzero_ps();
+  const __m128 one          = _mm_set1_ps(1.f);
+  const __m128 invCellSizeV = _mm_set1_ps(invCellSize);
+  const __m128 cellSizeV    = _mm_set1_ps(_cellSize);
+  const __m128 originV[3]
+    = {_mm_set1_ps(_origin.x), _mm_set1_ps(_origin.y), _mm_set1_ps(_origin.z)};
+  const __m128 maxCoordinatesV[3] = {_mm_set1_ps(maxCoordinates[0]),
+                                     _mm_set1_ps(maxCoordinates[1]),
+                                     _mm_set1_ps(maxCoordinates[2])};
+  const __m128 maxCellsV[3]
+    = {_mm_set1_ps(maxCells[0]), _mm_set1_ps(maxCells[1]), _mm_set1_ps(maxCells[2])};
+  for (; i + 4 <= count; i += 4) {
+    const __m128 p[3] = {_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i)};
+    __m128 t[3];
+    __m128 outside[3];
+    alignas(16) int32_t cells[3][4];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      // Grid coordinates clamped to the grid, and the offset of the position outside of the grid
+      const auto coordinate = _mm_mul_ps(_mm_sub_ps(p[axis], originV[axis]), invCellSizeV);
+      const auto clamped    = _mm_min_ps(_mm_max_ps(coordinate, zero), maxCoordinatesV[axis]);
+      outside[axis]         = _mm_mul_ps(_mm_sub_ps(coordinate, clamped), cellSizeV);
+      const auto cell = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(clamped)), maxCellsV[axis]);
+      t[axis]         = _mm_sub_ps(clamped, cell);
+      _mm_store_si128(reinterpret_cast<__m128i*>(cells[axis]), _mm_cvttps_epi32(cell));
+    }
+
+    // Gather the corners of the 4 cells
+    alignas(16) float corners[2][2][2][4];
+    for (size_t lane = 0; lane < 4; ++lane) {
+      const auto base = static_cast<size_t>(cells[2][lane]) * strideZ
+                        + static_cast<size_t>(cells[1][lane]) * strideY
+                        + static_cast<size_t>(cells[0][lane]);
+      for (size_t dz = 0; dz < 2; ++dz) {
+        for (size_t dy = 0; dy < 2; ++dy) {
+          const auto row           = values + base + dz * strideZ + dy * strideY;
+          corners[dz][dy][0][lane] = row[0];
+          corners[dz][dy][1][lane] = row[1];
+        }
+      }
+    }
+    __m128 c[2][2][2];
+    for (size_t dz = 0; dz < 2; ++dz) {
+      for (size_t dy = 0; dy < 2; ++dy) {
+        for (size_t dx = 0; dx < 2; ++dx) {
+          c[dz][dy][dx] = _mm_load_ps(corners[dz][dy][dx]);
+        }
+      }
+    }
+
+    // Same operations as the scalar path
+    const auto lerp = [](__m128 a, __m128 b, __m128 s) {
+      return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), s));
+    };
+    const auto c00  = lerp(c[0][0][0], c[0][0][1], t[0]);
+    const auto c10  = lerp(c[0][1][0], c[0][1][1], t[0]);
+    const auto c01  = lerp(c[1][0][0], c[1][0][1], t[0]);
+    const auto c11  = lerp(c[1][1][0], c[1][1][1], t[0]);
+    const auto c0   = lerp(c00, c10, t[1]);
+    const auto c1   = lerp(c01, c11, t[1]);
+    const auto dx00 = _mm_sub_ps(c[0][0][1], c[0][0][0]);
+    const auto dx10 = _mm_sub_ps(c[0][1][1], c[0][1][0]);
+    const auto dx01 = _mm_sub_ps(c[1][0][1], c[1][0][0]);
+    const auto dx11 = _mm_sub_ps(c[1][1][1], c[1][1][0]);
+    const auto dx0  = lerp(dx00, dx10, t[1]);
+    const auto dx1  = lerp(dx01, dx11, t[1]);
+    const auto tz1  = _mm_sub_ps(one, t[2]);
+    auto gx         = _mm_add_ps(_mm_mul_ps(dx0, tz1), _mm_mul_ps(dx1, t[2]));
+    auto gy         = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(c10, c00), tz1),
+                         _mm_mul_ps(_mm_sub_ps(c11, c01), t[2]));
+    auto gz         = _mm_sub_ps(c1, c0);
+    auto distance   = lerp(c0, c1, t[2]);
+
+    // Outside of the grid
+    const auto outsideLength = _mm_sqrt_ps(
+      _mm_add_ps(_mm_add_ps(_mm_mul_ps(outside[0], outside[0]), _mm_mul_ps(outside[1], outside[1])),
+                 _mm_mul_ps(outside[2], outside[2])));
+    const auto isOutside  = _mm_cmpgt_ps(outsideLength, zero);
+    const auto invOutside = _mm_and_ps(isOutside, _mm_div_ps(one, outsideLength));
+    distance              = _mm_add_ps(distance, outsideLength);
+    gx        = _mm_add_ps(_mm_mul_ps(gx, invCellSizeV), _mm_mul_ps(outside[0], invOutside));
+    gy        = _mm_add_ps(_mm_mul_ps(gy, invCellSizeV), _mm_mul_ps(outside[1], invOutside));
+    gz        = _mm_add_ps(_mm_mul_ps(gz, invCellSizeV), _mm_mul_ps(outside[2], invOutside));
+
+    _mm_storeu_ps(distances + i, distance);
+    _mm_storeu_ps(gradientX + i, gx);
+    _mm_storeu_ps(gradientY + i, gy);
+    _mm_storeu_ps(gradientZ + i, gz);
+  }
+
+  // Same operations as the SSE path above
+  _sampleScalar(i, count, x, y, z, distances, gradientX, gradientY, gradientZ);
+  return true;
+#else
+  (void)count;
+  (void)x;
+  (void)y;
+  (void)z;
+  (void)distances;
+  (void)gradientX;
+  (void)gradientY;
+  (void)gradientZ;
+  return false;
+#endif
+}
+
+void SignedDistanceField::_sampleScalar(size_t begin, size_t count, const float* x, const float* y,
+                                        const float* z, float* distances, float* gradientX,
+                                        float* gradientY, float* gradientZ) const
+{
+  const auto invCellSize = 1.f / _cellSize;
+  const float maxCoordinates[3]
+    = {static_cast<float>(_width - 1), static_cast<float>(_height - 1),
+       static_cast<float>(_depth - 1)};
+  const float maxCells[3] = {maxCoordinates[0] - 1.f, maxCoordinates[1] - 1.f,
+                             maxCoordinates[2] - 1.f};
+  const auto strideY      = _width;
+  const auto strideZ      = _width * _height;
+  const auto values       = _values.data();
+  const float origin[3]   = {_origin.x, _origin.y, _origin.z};
+
+  for (auto i = begin; i < count; ++i) {
+    const float p[3] = {x[i], y[i], z[i]};
+    float t[3];
+    float outside[3];
+    size_t cells[3];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const auto coordinate = (p[axis] - origin[axis]) * invCellSize;
+      const auto clamped    = std::min(std::max(coordinate, 0.f), maxCoordinates[axis]);
+      outside[axis]         = (coordinate - clamped) * _cellSize;
+      const auto cell
+        = std::min(static_cast<float>(static_cast<int32_t>(clamped)), maxCells[axis]);
+      t[axis]     = clamped - cell;
+      cells[axis] = static_cast<size_t>(cell);
+    }
+
+    const auto base = cells[2] * strideZ + cells[1] * strideY + cells[0];
+    float c[2][2][2];
+    for (size_t dz = 0; dz < 2; ++dz) {
+      for (size_t dy = 0; dy < 2; ++dy) {
+        const auto row = values + base + dz * strideZ + dy * strideY;
+        c[dz][dy][0]   = row[0];
+        c[dz][dy][1]   = row[1];
+      }
+    }
+
+    float gx      = 0.f;
+    float gy      = 0.f;
+    float gz      = 0.f;
+    auto distance = Trilinear(c, t[0], t[1], t[2], gx, gy, gz);
+
+    // Outside of the grid
+    const auto outsideLength = std::sqrt(outside[0] * outside[0] + outside[1] * outside[1]
+                                         + outside[2] * outside[2]);
+    const auto invOutside    = outsideLength > 0.f ? 1.f / outsideLength : 0.f;
+    distance += outsideLength;
+
+    distances[i] = distance;
+    gradientX[i] = gx * invCellSize + outside[0] * invOutside;
+    gradientY[i] = gy * invCellSize + outside[1] * invOutside;
+    gradientZ[i] = gz * invCellSize + outside[2] * invOutside;
+  }
+}
+
+} // end of namespace BABYLON
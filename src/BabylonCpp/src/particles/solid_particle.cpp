@@ -1,6 +1,5 @@
 #include <babylon/particles/solid_particle.h>
 
-#include <babylon/maths/tmp_vectors.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/particles/solid_particle_system.h>
 
@@ -114,7 +113,6 @@ void SolidParticle::getRotationMatrix(Matrix& m) const
     quaternion = *rotationQuaternion;
   }
   else {
-    quaternion            = TmpVectors::QuaternionArray[0];
     const auto& _rotation = rotation;
     Quaternion::RotationYawPitchRollToRef(_rotation.y, _rotation.x, _rotation.z, quaternion);
   }
@@ -1,9 +1,13 @@
 #include <babylon/particles/solid_particle_system.h>
 
+#include <algorithm>
+#include <mutex>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/target_camera.h>
 #include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -29,6 +33,8 @@ SolidParticleSystem::SolidParticleSystem(const std::string& iName, Scene* scene,
     : nbParticles{0}
     , billboard{false}
     , recomputeNormals{false}
+    , parallelUpdate{false}
+    , parallelUpdateChunkSize{1024}
     , counter{0}
     , mesh{nullptr}
     , computeParticleRotation{this, &SolidParticleSystem::get_computeParticleRotation,
@@ -112,10 +118,6 @@ SolidParticleSystem::SolidParticleSystem(const std::string& iName, Scene* scene,
     _materialIndexesById = {};
   }
 
-  _depthSortFunction = [](const DepthSortedParticle& p1, const DepthSortedParticle& p2) -> bool {
-    return p1.sqDistance < p2.sqDistance;
-  };
-
   _materialSortFunction = [](const DepthSortedParticle& p1, const DepthSortedParticle& p2) -> bool {
     return p2.materialIndex < p1.materialIndex;
   };
@@ -774,8 +776,8 @@ SolidParticlePtr SolidParticleSystem::_insertNewParticle(
                         _shapeCounter, i, bbInfo ? *bbInfo : defaultBbInfo, *storage);
     }
     else {
-      _addParticle(nbParticles, _lastParticleId, currentPos, currentInd, modelShape, _shapeCounter,
-                   i, bbInfo ? *bbInfo : defaultBbInfo);
+      sp = _addParticle(nbParticles, _lastParticleId, currentPos, currentInd, modelShape,
+                        _shapeCounter, i, bbInfo ? *bbInfo : defaultBbInfo);
     }
     sp->position.copyFrom(currentCopy->position);
     sp->rotation.copyFrom(currentCopy->rotation);
@@ -821,7 +823,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
   // custom beforeUpdate
   beforeUpdateParticles(start, end, update);
 
-  auto& rotMatrix      = TmpVectors::MatrixArray[0];
   auto& invertedMatrix = TmpVectors::MatrixArray[1];
   auto& colors32       = _colors32;
   auto& positions32    = _positions32;
@@ -831,13 +832,14 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
   auto& indices        = _indices;
   auto& fixedNormal32  = _fixedNormal32;
 
-  auto& tempVectors         = TmpVectors::Vector3Array;
-  auto& camAxisX            = tempVectors[5].copyFromFloats(1.f, 0.f, 0.f);
-  auto& camAxisY            = tempVectors[6].copyFromFloats(0.f, 1.f, 0.f);
-  auto& camAxisZ            = tempVectors[7].copyFromFloats(0.f, 0.f, 1.f);
-  auto& minimum             = tempVectors[8].setAll(std::numeric_limits<float>::max());
-  auto& maximum             = tempVectors[9].setAll(std::numeric_limits<float>::lowest());
-  auto& camInvertedPosition = tempVectors[10].setAll(0.f);
+  Vector3 camAxisX(1.f, 0.f, 0.f);
+  Vector3 camAxisY(0.f, 1.f, 0.f);
+  Vector3 camAxisZ(0.f, 0.f, 1.f);
+  Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max());
+  Vector3 maximum(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest());
+  Vector3 camInvertedPosition(0.f, 0.f, 0.f);
 
   // cases when the World Matrix is to be computed first
   if (billboard || _depthSort) {
@@ -847,7 +849,7 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
   // if the particles will always face the camera
   if (billboard) {
     // compute the camera position and un-rotate it by the current mesh rotation
-    auto& tmpVertex = tempVectors[0];
+    auto& tmpVertex = TmpVectors::Vector3Array[0];
     _camera->getDirectionToRef(Axis::Z(), tmpVertex);
     Vector3::TransformNormalToRef(tmpVertex, invertedMatrix, camAxisZ);
     camAxisZ.normalize();
@@ -866,17 +868,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
                                        camInvertedPosition); // then un-rotate the camera
   }
 
-  Matrix::IdentityToRef(rotMatrix);
-  auto idx   = 0ull;      // current position index in the global array positions32
-  auto index = 0ull;      // position start index in the global array positions32 of
-                          // the current particle
-  auto colidx     = 0ull; // current color index in the global array colors32
-  auto colorIndex = 0ull; // color start index in the global array colors32 of
-                          // the current particle
-  auto uvidx   = 0ull;    // current uv index in the global array uvs32
-  auto uvIndex = 0ull;    // uv start index in the global array uvs32 of the current particle
-  auto pt      = 0ull;    // current index in the particle model shape
-
   if (mesh->isFacetDataEnabled()) {
     _computeBoundingBox = true;
   }
@@ -894,11 +885,123 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
     }
   }
 
-  // particle loop
-  index      = particles[start]->_pos;
-  auto vpos  = (index / 3);
-  colorIndex = vpos * 4;
-  uvIndex    = vpos * 2;
+  // particle loop, split in chunks of particles updated on the default thread pool when allowed
+  const auto hasParent = [](const SolidParticlePtr& particle) {
+    return particle->parentId.has_value();
+  };
+  const auto parallel = parallelUpdate && end - start + 1 > parallelUpdateChunkSize
+                        && std::none_of(particles.begin() + static_cast<std::ptrdiff_t>(start),
+                                        particles.begin() + static_cast<std::ptrdiff_t>(end) + 1,
+                                        hasParent);
+  if (parallel) {
+    std::mutex boundingBoxMutex;
+    ThreadPool::Default().parallelFor(
+      start, end + 1, parallelUpdateChunkSize, [&](size_t chunkStart, size_t chunkEnd) {
+        Vector3 chunkMinimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::max());
+        Vector3 chunkMaximum(std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest());
+        _setParticlesRange(chunkStart, chunkEnd - 1, camAxisX, camAxisY, camAxisZ,
+                           camInvertedPosition, chunkMinimum, chunkMaximum);
+        if (_computeBoundingBox) {
+          std::lock_guard<std::mutex> lock(boundingBoxMutex);
+          minimum.minimizeInPlace(chunkMinimum);
+          maximum.maximizeInPlace(chunkMaximum);
+        }
+      });
+  }
+  else {
+    _setParticlesRange(start, end, camAxisX, camAxisY, camAxisZ, camInvertedPosition, minimum,
+                       maximum);
+  }
+
+  // if the VBO must be updated
+  if (update) {
+    if (_computeParticleColor) {
+      mesh->updateVerticesData(VertexBuffer::ColorKind, colors32, false, false);
+    }
+    if (_computeParticleTexture) {
+      mesh->updateVerticesData(VertexBuffer::UVKind, uvs32, false, false);
+    }
+    mesh->updateVerticesData(VertexBuffer::PositionKind, positions32, false, false);
+    if (!mesh->areNormalsFrozen || mesh->isFacetDataEnabled) {
+      if (_computeParticleVertex || mesh->isFacetDataEnabled) {
+        // recompute the normals only if the particles can be morphed, update then also the normal
+        // reference array _fixedNormal32[]
+        if (mesh->isFacetDataEnabled) {
+          VertexData::ComputeNormals(positions32, indices32, normals32,
+                                     mesh->getFacetDataParameters());
+        }
+        else {
+          VertexData::ComputeNormals(positions32, indices32, normals32, std::nullopt);
+        }
+        for (size_t i = 0; i < normals32.size(); ++i) {
+          fixedNormal32[i] = normals32[i];
+        }
+      }
+      if (!mesh->areNormalsFrozen) {
+        mesh->updateVerticesData(VertexBuffer::NormalKind, normals32, false, false);
+      }
+    }
+    if (_depthSort && _depthSortParticles) {
+      // the particles keep their slots, which lets the sorter start from the previous order, the
+      // farthest particles being drawn first
+      const auto& sortedOrder = _depthSorter.sort(
+        depthSortedParticles.size(),
+        [this](size_t p) { return depthSortedParticles[p].sqDistance; }, true);
+      auto sid = 0ull;
+      for (const auto sorted : sortedOrder) {
+        const auto lind = depthSortedParticles[sorted].indicesLength;
+        const auto sind = depthSortedParticles[sorted].ind;
+        for (size_t i = 0; i < lind; i++) {
+          indices32[sid] = indices[sind + i];
+          ++sid;
+        }
+      }
+      mesh->updateIndices(indices32);
+    }
+  }
+  if (_computeBoundingBox) {
+    if (mesh->_boundingInfo) {
+      mesh->_boundingInfo->reConstruct(minimum, maximum, mesh->_worldMatrix);
+    }
+    else {
+      mesh->_boundingInfo = std::make_unique<BoundingInfo>(minimum, maximum, mesh->_worldMatrix);
+    }
+  }
+  if (_autoUpdateSubMeshes) {
+    computeSubMeshes();
+  }
+  afterUpdateParticles(start, end, update);
+  return *this;
+}
+
+void SolidParticleSystem::_setParticlesRange(size_t start, size_t end, const Vector3& camAxisX,
+                                             const Vector3& camAxisY, const Vector3& camAxisZ,
+                                             const Vector3& camInvertedPosition, Vector3& minimum,
+                                             Vector3& maximum)
+{
+  auto& colors32      = _colors32;
+  auto& positions32   = _positions32;
+  auto& normals32     = _normals32;
+  auto& uvs32         = _uvs32;
+  auto& fixedNormal32 = _fixedNormal32;
+
+  auto rotMatrix = Matrix::Identity();
+  Vector3 tmpVertex, scaledPivot, pivotBackTranslation;
+  Vector3 tempMin, tempMax;
+
+  // current indices in the global arrays positions32, colors32 and uvs32
+  auto idx    = 0ull;
+  auto colidx = 0ull;
+  auto uvidx  = 0ull;
+  // start indices of the current particle in the global arrays
+  auto index      = particles[start]->_pos;
+  auto colorIndex = (index / 3) * 4;
+  auto uvIndex    = (index / 3) * 2;
+  // current index in the particle model shape
+  auto pt = 0ull;
 
   for (size_t p = start; p <= end; p++) {
     auto particle = particles[p].get();
@@ -935,7 +1038,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
     if (particle->isVisible) {
       particle->_stillInvisible = false; // un-mark permanent invisibility
 
-      auto& scaledPivot = tempVectors[12];
       particle->pivot.multiplyToRef(particleScaling, scaledPivot);
 
       // particle rotation matrix
@@ -1022,7 +1124,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
         }
       }
 
-      auto& pivotBackTranslation = tempVectors[11];
       if (particle->translateFromPivot) {
         pivotBackTranslation.setAll(0.f);
       }
@@ -1036,7 +1137,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
         colidx = colorIndex + pt * 4;
         uvidx  = uvIndex + pt * 2;
 
-        auto& tmpVertex = tempVectors[0];
         tmpVertex.copyFrom(shape[pt]);
         if (_computeParticleVertex) {
           updateParticleVertex(particle, tmpVertex, pt);
@@ -1096,10 +1196,10 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
 
         if (_computeParticleColor && particle->color.has_value()) {
           const auto& color     = particle->color.value();
-          _colors32[colidx]     = color.r;
-          _colors32[colidx + 1] = color.g;
-          _colors32[colidx + 2] = color.b;
-          _colors32[colidx + 3] = color.a;
+          colors32[colidx]     = color.r;
+          colors32[colidx + 1] = color.g;
+          colors32[colidx + 2] = color.b;
+          colors32[colidx + 3] = color.a;
         }
 
         if (_computeParticleTexture) {
@@ -1144,10 +1244,8 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
         // place, scale and rotate the particle bbox within the SPS local system, then update it
         auto& modelBoundingInfoVectors = modelBoundingInfo->boundingBox.vectors;
 
-        auto& tempMin = tempVectors[1];
-        auto& tempMax = tempVectors[2];
         tempMin.setAll(std::numeric_limits<float>::max());
-        tempMax.setAll(std::numeric_limits<float>::min());
+        tempMax.setAll(std::numeric_limits<float>::lowest());
         for (uint32_t b = 0; b < 8; ++b) {
           const auto scaledX  = modelBoundingInfoVectors[b].x * particleScaling.x;
           const auto scaledY  = modelBoundingInfoVectors[b].y * particleScaling.y;
@@ -1175,16 +1273,14 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
       }
 
       // place and scale the particle bouding sphere in the SPS local system, then update it
-      auto minBbox = modelBoundingInfo->minimum().multiplyToRef(particleScaling, tempVectors[1]);
-      auto maxBbox = modelBoundingInfo->maximum().multiplyToRef(particleScaling, tempVectors[2]);
-
-      const auto bSphereCenter = maxBbox.addToRef(minBbox, tempVectors[3])
-                                   .scaleInPlace(0.5f)
-                                   .addInPlace(particleGlobalPosition);
-      const auto halfDiag
-        = maxBbox.subtractToRef(minBbox, tempVectors[4]).scaleInPlace(0.5f * _bSphereRadiusFactor);
-      const auto bSphereMinBbox = bSphereCenter.subtractToRef(halfDiag, tempVectors[1]);
-      const auto bSphereMaxBbox = bSphereCenter.addToRef(halfDiag, tempVectors[2]);
+      const auto minBbox = modelBoundingInfo->minimum().multiply(particleScaling);
+      const auto maxBbox = modelBoundingInfo->maximum().multiply(particleScaling);
+
+      const auto bSphereCenter
+        = maxBbox.add(minBbox).scaleInPlace(0.5f).addInPlace(particleGlobalPosition);
+      const auto halfDiag = maxBbox.subtract(minBbox).scaleInPlace(0.5f * _bSphereRadiusFactor);
+      const auto bSphereMinBbox = bSphereCenter.subtract(halfDiag);
+      const auto bSphereMaxBbox = bSphereCenter.add(halfDiag);
       bSphere.reConstruct(bSphereMinBbox, bSphereMaxBbox, mesh->_worldMatrix);
     }
 
@@ -1194,62 +1290,6 @@ SolidParticleSystem& SolidParticleSystem::setParticles(size_t start, size_t end,
     uvIndex    = uvidx + 2;
   }
 
-  // if the VBO must be updated
-  if (update) {
-    if (_computeParticleColor) {
-      mesh->updateVerticesData(VertexBuffer::ColorKind, colors32, false, false);
-    }
-    if (_computeParticleTexture) {
-      mesh->updateVerticesData(VertexBuffer::UVKind, uvs32, false, false);
-    }
-    mesh->updateVerticesData(VertexBuffer::PositionKind, positions32, false, false);
-    if (!mesh->areNormalsFrozen || mesh->isFacetDataEnabled) {
-      if (_computeParticleVertex || mesh->isFacetDataEnabled) {
-        // recompute the normals only if the particles can be morphed, update then also the normal
-        // reference array _fixedNormal32[]
-        if (mesh->isFacetDataEnabled) {
-          VertexData::ComputeNormals(positions32, indices32, normals32,
-                                     mesh->getFacetDataParameters());
-        }
-        else {
-          VertexData::ComputeNormals(positions32, indices32, normals32, std::nullopt);
-        }
-        for (size_t i = 0; i < normals32.size(); ++i) {
-          fixedNormal32[i] = normals32[i];
-        }
-      }
-      if (!mesh->areNormalsFrozen) {
-        mesh->updateVerticesData(VertexBuffer::NormalKind, normals32, false, false);
-      }
-    }
-    if (_depthSort && _depthSortParticles) {
-      std::sort(depthSortedParticles.begin(), depthSortedParticles.end(), _depthSortFunction);
-      const auto dspl = depthSortedParticles.size();
-      auto sid        = 0ull;
-      for (size_t sorted = 0; sorted < dspl; ++sorted) {
-        const auto lind = depthSortedParticles[sorted].indicesLength;
-        const auto sind = depthSortedParticles[sorted].ind;
-        for (size_t i = 0; i < lind; i++) {
-          indices32[sid] = indices[sind + i];
-          ++sid;
-        }
-      }
-      mesh->updateIndices(indices32);
-    }
-  }
-  if (_computeBoundingBox) {
-    if (mesh->_boundingInfo) {
-      mesh->_boundingInfo->reConstruct(minimum, maximum, mesh->_worldMatrix);
-    }
-    else {
-      mesh->_boundingInfo = std::make_unique<BoundingInfo>(minimum, maximum, mesh->_worldMatrix);
-    }
-  }
-  if (_autoUpdateSubMeshes) {
-    computeSubMeshes();
-  }
-  afterUpdateParticles(start, end, update);
-  return *this;
 }
 
 void SolidParticleSystem::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
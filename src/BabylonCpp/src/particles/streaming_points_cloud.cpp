@@ -0,0 +1,344 @@
+#include <babylon/particles/streaming_points_cloud.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+#include <babylon/asio/asio.h>
+#include <babylon/asio/internal/sync_callback_runner.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+#include <babylon/particles/point_cloud_octree.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Header of the points files
+struct PointsFileHeader {
+  char magic[4];
+  uint32_t flags;
+  uint64_t pointCount;
+  float minimum[3];
+  float maximum[3];
+};
+
+constexpr uint32_t PointsFileHasColors = 1;
+
+bool ReadHeader(std::ifstream& stream, PointsFileHeader& header)
+{
+  stream.read(header.magic, sizeof(header.magic));
+  stream.read(reinterpret_cast<char*>(&header.flags), sizeof(header.flags));
+  stream.read(reinterpret_cast<char*>(&header.pointCount), sizeof(header.pointCount));
+  stream.read(reinterpret_cast<char*>(header.minimum), sizeof(header.minimum));
+  stream.read(reinterpret_cast<char*>(header.maximum), sizeof(header.maximum));
+  return stream.good() && std::memcmp(header.magic, "BPC1", 4) == 0;
+}
+
+} // end of anonymous namespace
+
+/**
+ * Hidden, state shared with the loading jobs, which can outlive the cloud.
+ */
+struct StreamingPointsCloud::StreamingState {
+  std::mutex mutex;
+  std::unique_ptr<PointCloudOctree> octree;
+  std::atomic<bool> cancelled{false};
+  std::atomic<bool> loading{false};
+  std::atomic<size_t> pointCount{0};
+};
+
+StreamingPointsCloud::StreamingPointsCloud(const std::string& iName, Scene* scene,
+                                           float pointSize)
+    : name{iName}
+    , pointBudget{1000000}
+    , minNodeSize{100.f}
+    , chunkSize{65536}
+    , maxCachedNodes{64}
+    , gridSize{128}
+    , maxDepth{10}
+    , _scene{scene}
+    , _pointSize{pointSize}
+    , _state{std::make_shared<StreamingState>()}
+    , _renderedPointCount{0}
+    , _frameId{0}
+    , _onBeforeRenderObserver{nullptr}
+{
+  _root = TransformNode::New(name, _scene);
+
+  _material                  = StandardMaterial::New(name + " material", _scene);
+  _material->emissiveColor   = Color3(1.f, 1.f, 1.f);
+  _material->disableLighting = true;
+  _material->pointsCloud     = true;
+  _material->pointSize       = _pointSize;
+
+  _onBeforeRenderObserver = _scene->onBeforeRenderObservable.add(
+    [this](Scene* /*scene*/, EventState& /*es*/) { update(); });
+}
+
+StreamingPointsCloud::~StreamingPointsCloud()
+{
+  // The loading job and the render observer reference the cloud
+  dispose();
+}
+
+void StreamingPointsCloud::load(const std::string& filename, const OnLoadedFunction& onLoaded)
+{
+  auto stream = std::make_shared<std::ifstream>(filename, std::ios::binary);
+  PointsFileHeader header{};
+  if (!stream->good() || !ReadHeader(*stream, header)) {
+    BABYLON_LOGF_ERROR("StreamingPointsCloud", "Cannot read the points file %s", filename.c_str())
+    if (onLoaded) {
+      onLoaded(this, false);
+    }
+    return;
+  }
+
+  const auto hasColors = (header.flags & PointsFileHasColors) != 0;
+  initialize(Vector3(header.minimum[0], header.minimum[1], header.minimum[2]),
+             Vector3(header.maximum[0], header.maximum[1], header.maximum[2]), hasColors);
+
+  // The points are inserted in the octree chunk by chunk, under the lock of the state
+  auto state          = _state;
+  const auto nbPoints = static_cast<size_t>(header.pointCount);
+  const auto nbChunk  = std::max(chunkSize, static_cast<size_t>(1));
+  state->loading      = true;
+  auto readPoints     = [state, stream, nbPoints, nbChunk, hasColors]() {
+    const size_t recordSize = 3 * sizeof(float) + (hasColors ? 4 : 0);
+    std::vector<char> records(nbChunk * recordSize);
+    Float32Array positions(3 * nbChunk);
+    Float32Array colors(hasColors ? 4 * nbChunk : 0);
+    size_t nbRead = 0;
+    while (nbRead < nbPoints && !state->cancelled) {
+      const auto count = std::min(nbChunk, nbPoints - nbRead);
+      stream->read(records.data(), static_cast<std::streamsize>(count * recordSize));
+      if (!stream->good()) {
+        return false;
+      }
+      for (size_t i = 0; i < count; ++i) {
+        const auto* record = records.data() + i * recordSize;
+        std::memcpy(&positions[3 * i], record, 3 * sizeof(float));
+        if (hasColors) {
+          const auto* color = reinterpret_cast<const uint8_t*>(record + 3 * sizeof(float));
+          for (size_t c = 0; c < 4; ++c) {
+            colors[4 * i + c] = color[c] / 255.f;
+          }
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->octree->addPoints(positions.data(), hasColors ? colors.data() : nullptr, count);
+      }
+      state->pointCount += count;
+      nbRead += count;
+    }
+    return true;
+  };
+
+  auto& threadPool = ThreadPool::Default();
+  if (threadPool.size() == 0 || asio::IsAsyncDisabled()) {
+    const auto success = readPoints();
+    state->loading     = false;
+    if (onLoaded) {
+      onLoaded(this, success);
+    }
+    return;
+  }
+
+  threadPool.enqueue([this, state, readPoints, onLoaded, filename]() {
+    const auto success = readPoints();
+    state->loading     = false;
+    if (!success && !state->cancelled) {
+      BABYLON_LOGF_ERROR("StreamingPointsCloud", "Truncated points file %s", filename.c_str())
+    }
+    if (onLoaded) {
+      // The cloud is only accessed if it was not disposed in the meantime
+      asio::sync_callback_runner::PushCallback([this, state, onLoaded, success]() {
+        if (!state->cancelled) {
+          onLoaded(this, success);
+        }
+      });
+    }
+  });
+}
+
+void StreamingPointsCloud::initialize(const Vector3& minimum, const Vector3& maximum,
+                                      bool hasColors)
+{
+  // Stops the previous loading, its points being discarded with the previous octree
+  _state->cancelled = true;
+  _state            = std::make_shared<StreamingState>();
+  _state->octree
+    = std::make_unique<PointCloudOctree>(minimum, maximum, hasColors, gridSize, maxDepth);
+  _disposeNodeMeshes();
+  _selectedNodes.clear();
+  _renderedPointCount = 0;
+}
+
+void StreamingPointsCloud::addPoints(const float* positions, const float* colors, size_t count)
+{
+  if (!_state->octree) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(_state->mutex);
+  _state->octree->addPoints(positions, colors, count);
+  _state->pointCount += count;
+}
+
+void StreamingPointsCloud::update()
+{
+  auto camera = _scene->activeCamera();
+  if (!camera || !_state->octree) {
+    return;
+  }
+
+  // A chunk is being inserted, the meshes of the previous frame are kept
+  std::unique_lock<std::mutex> lock(_state->mutex, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return;
+  }
+
+  // Selection in the space of the points
+  auto world               = _root->computeWorldMatrix();
+  const auto frustumPlanes = Frustum::GetPlanes(world.multiply(_scene->getTransformMatrix()));
+  const auto cameraPosition
+    = Vector3::TransformCoordinates(camera->globalPosition(), Matrix::Invert(world));
+  const auto tanHalfFov = std::max(std::tan(camera->fov * 0.5f), 1e-3f);
+  const auto projectionFactor
+    = static_cast<float>(_scene->getEngine()->getRenderHeight()) / (2.f * tanHalfFov);
+  _renderedPointCount = _state->octree->selectNodes(frustumPlanes, cameraPosition,
+                                                    projectionFactor, minNodeSize, pointBudget,
+                                                    _selectedNodes);
+
+  ++_frameId;
+  for (const auto node : _selectedNodes) {
+    auto& nodeMesh = _nodeMeshes[node];
+    _updateNodeMesh(*node, nodeMesh);
+    nodeMesh.renderFrame = _frameId;
+  }
+  for (auto& item : _nodeMeshes) {
+    if (item.second.renderFrame != _frameId && item.second.mesh) {
+      item.second.mesh->setEnabled(false);
+    }
+  }
+  _evictNodeMeshes();
+}
+
+void StreamingPointsCloud::_updateNodeMesh(const PointCloudOctreeNode& node, NodeMesh& nodeMesh)
+{
+  if (!nodeMesh.mesh) {
+    nodeMesh.mesh             = Mesh::New(name + " node " + std::to_string(node.depth), _scene);
+    nodeMesh.mesh->parent     = _root.get();
+    nodeMesh.mesh->material   = _material;
+    nodeMesh.mesh->isPickable = false;
+  }
+
+  // Rebuilt when points were added to the node
+  if (nodeMesh.version != node.version) {
+    VertexData vertexData;
+    vertexData.set(node.positions, VertexBuffer::PositionKind);
+    if (!node.colors.empty()) {
+      vertexData.set(node.colors, VertexBuffer::ColorKind);
+    }
+    vertexData.applyToMesh(*nodeMesh.mesh, false);
+    nodeMesh.version = node.version;
+  }
+
+  nodeMesh.mesh->setEnabled(true);
+}
+
+void StreamingPointsCloud::_evictNodeMeshes()
+{
+  // Least recently rendered meshes first
+  std::vector<std::pair<size_t, const PointCloudOctreeNode*>> cachedNodes;
+  for (const auto& item : _nodeMeshes) {
+    if (item.second.renderFrame != _frameId) {
+      cachedNodes.emplace_back(item.second.renderFrame, item.first);
+    }
+  }
+  if (cachedNodes.size() <= maxCachedNodes) {
+    return;
+  }
+
+  std::sort(cachedNodes.begin(), cachedNodes.end());
+  for (size_t i = 0; i < cachedNodes.size() - maxCachedNodes; ++i) {
+    auto it = _nodeMeshes.find(cachedNodes[i].second);
+    if (it->second.mesh) {
+      it->second.mesh->dispose();
+    }
+    _nodeMeshes.erase(it);
+  }
+}
+
+void StreamingPointsCloud::_disposeNodeMeshes()
+{
+  for (auto& item : _nodeMeshes) {
+    if (item.second.mesh) {
+      item.second.mesh->dispose();
+    }
+  }
+  _nodeMeshes.clear();
+}
+
+TransformNodePtr StreamingPointsCloud::getRoot() const
+{
+  return _root;
+}
+
+bool StreamingPointsCloud::isLoading() const
+{
+  return _state->loading;
+}
+
+size_t StreamingPointsCloud::getLoadedPointCount() const
+{
+  return _state->pointCount;
+}
+
+size_t StreamingPointsCloud::getRenderedPointCount() const
+{
+  return _renderedPointCount;
+}
+
+const std::vector<PointCloudOctreeNode*>& StreamingPointsCloud::getSelectedNodes() const
+{
+  return _selectedNodes;
+}
+
+void StreamingPointsCloud::dispose()
+{
+  _state->cancelled = true;
+
+  if (_onBeforeRenderObserver) {
+    _scene->onBeforeRenderObservable.remove(_onBeforeRenderObserver);
+    _onBeforeRenderObserver = nullptr;
+  }
+
+  _disposeNodeMeshes();
+  _selectedNodes.clear();
+  _renderedPointCount = 0;
+
+  if (_material) {
+    _material->dispose();
+    _material = nullptr;
+  }
+  if (_root) {
+    _root->dispose();
+    _root = nullptr;
+  }
+}
+
+} // end of namespace BABYLON
@@ -1,5 +1,7 @@
 #include <babylon/rendering/rendering_group.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/culling/bounding_info.h>
@@ -36,6 +38,7 @@ RenderingGroup::RenderingGroup(
     , _opaqueSortCompareFn{nullptr}
     , _alphaTestSortCompareFn{nullptr}
     , _transparentSortCompareFn{nullptr}
+    , _defaultTransparentSort{false}
     , _renderOpaque{nullptr}
     , _renderAlphaTest{nullptr}
     , _renderTransparent{nullptr}
@@ -99,6 +102,7 @@ void RenderingGroup::set_transparentSortCompareFn(
       return RenderingGroup::defaultTransparentSortCompare(a, b);
     };
   }
+  _defaultTransparentSort = !value;
   _renderTransparent = [this](const std::vector<SubMesh*>& subMeshes) {
     renderTransparentSorted(subMeshes);
   };
@@ -194,6 +198,21 @@ void RenderingGroup::renderAlphaTestSorted(
 void RenderingGroup::renderTransparentSorted(
   const std::vector<SubMesh*>& subMeshes)
 {
+  // The default order only depends on the distances when all the submeshes
+  // share the same alpha index
+  if (_defaultTransparentSort && !subMeshes.empty()) {
+    const auto alphaIndex = subMeshes.front()->getMesh()->alphaIndex;
+    const auto sameAlphaIndex
+      = std::all_of(subMeshes.begin(), subMeshes.end(),
+                    [alphaIndex](SubMesh* subMesh) {
+                      return subMesh->getMesh()->alphaIndex == alphaIndex;
+                    });
+    if (sameAlphaIndex) {
+      _renderTransparentBackToFront(subMeshes);
+      return;
+    }
+  }
+
   return RenderingGroup::renderSorted(subMeshes, _transparentSortCompareFn,
                                       _scene->activeCamera(), true);
 }
@@ -203,13 +222,7 @@ void RenderingGroup::renderSorted(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
   const CameraPtr& camera, bool transparent)
 {
-  auto cameraPosition
-    = camera ? camera->globalPosition() : RenderingGroup::_zeroVector;
-  for (auto& subMesh : subMeshes) {
-    subMesh->_alphaIndex       = subMesh->getMesh()->alphaIndex;
-    subMesh->_distanceToCamera = Vector3::Distance(
-      subMesh->getBoundingInfo()->boundingSphere.centerWorld, cameraPosition);
-  }
+  _prepareSubMeshesForSort(subMeshes, camera);
 
   auto sortedArray = subMeshes;
 
@@ -219,22 +232,54 @@ void RenderingGroup::renderSorted(
   }
 
   for (auto& subMesh : sortedArray) {
-    if (transparent) {
-      auto material = subMesh->getMaterial();
-
-      if (material && material->needDepthPrePass()) {
-        auto engine = material->getScene()->getEngine();
-        engine->setColorWrite(false);
-        engine->setAlphaMode(Constants::ALPHA_DISABLE);
-        subMesh->render(false);
-        engine->setColorWrite(true);
-      }
-    }
+    _renderSubMesh(subMesh, transparent);
+  }
+}
+
+void RenderingGroup::_renderTransparentBackToFront(
+  const std::vector<SubMesh*>& subMeshes)
+{
+  _prepareSubMeshesForSort(subMeshes, _scene->activeCamera());
+
+  const auto& sortedOrder = _transparentDepthSorter.sort(
+    subMeshes.size(),
+    [&subMeshes](size_t i) { return subMeshes[i]->_distanceToCamera; },
+    true);
 
-    subMesh->render(transparent);
+  for (const auto index : sortedOrder) {
+    _renderSubMesh(subMeshes[index], true);
   }
 }
 
+void RenderingGroup::_prepareSubMeshesForSort(
+  const std::vector<SubMesh*>& subMeshes, const CameraPtr& camera)
+{
+  auto cameraPosition
+    = camera ? camera->globalPosition() : RenderingGroup::_zeroVector;
+  for (auto& subMesh : subMeshes) {
+    subMesh->_alphaIndex       = subMesh->getMesh()->alphaIndex;
+    subMesh->_distanceToCamera = Vector3::Distance(
+      subMesh->getBoundingInfo()->boundingSphere.centerWorld, cameraPosition);
+  }
+}
+
+void RenderingGroup::_renderSubMesh(SubMesh* subMesh, bool transparent)
+{
+  if (transparent) {
+    auto material = subMesh->getMaterial();
+
+    if (material && material->needDepthPrePass()) {
+      auto engine = material->getScene()->getEngine();
+      engine->setColorWrite(false);
+      engine->setAlphaMode(Constants::ALPHA_DISABLE);
+      subMesh->render(false);
+      engine->setColorWrite(true);
+    }
+  }
+
+  subMesh->render(transparent);
+}
+
 void RenderingGroup::renderUnsorted(const std::vector<SubMesh*>& subMeshes)
 {
   for (auto& subMesh : subMeshes) {
@@ -246,10 +291,10 @@ bool RenderingGroup::defaultTransparentSortCompare(const SubMesh* a,
                                                    const SubMesh* b)
 {
   // Alpha index first
-  if (a->_alphaIndex > b->_alphaIndex) {
+  if (a->_alphaIndex < b->_alphaIndex) {
     return true;
   }
-  if (a->_alphaIndex < b->_alphaIndex) {
+  if (a->_alphaIndex > b->_alphaIndex) {
     return false;
   }
 
@@ -260,23 +305,13 @@ bool RenderingGroup::defaultTransparentSortCompare(const SubMesh* a,
 bool RenderingGroup::backToFrontSortCompare(const SubMesh* a, const SubMesh* b)
 {
   // Then distance to camera
-  if (a->_distanceToCamera < b->_distanceToCamera) {
-    return true;
-  }
-  if (a->_distanceToCamera > b->_distanceToCamera) {
-    return false;
-  }
-
-  return false;
+  return a->_distanceToCamera > b->_distanceToCamera;
 }
 
 bool RenderingGroup::frontToBackSortCompare(SubMesh* a, SubMesh* b)
 {
   // Then distance to camera
-  if (a->_distanceToCamera < b->_distanceToCamera) {
-    return false;
-  }
-  return a->_distanceToCamera > b->_distanceToCamera;
+  return a->_distanceToCamera < b->_distanceToCamera;
 }
 
 void RenderingGroup::prepare()
@@ -0,0 +1,394 @@
+#include <babylon/sprites/chunked_sprite_manager.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/engines/scene_component_constants.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
+#include <babylon/materials/material.h>
+#include <babylon/materials/textures/texture.h>
+#include <babylon/maths/frustum.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/tmp_vectors.h>
+#include <babylon/meshes/buffer.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/sprites/sprite_scene_component.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Smallest number of records of the instance buffer of a chunk
+constexpr size_t MinChunkCapacity = 64;
+
+} // end of anonymous namespace
+
+ChunkedSpriteManager::ChunkedSpriteManager(const std::string& iName, const std::string& imgUrl,
+                                           const ISize& cellSize, Scene* scene, float chunkSize,
+                                           float epsilon, unsigned int samplingMode)
+    : name{iName}
+    , fogEnabled{true}
+    , cellWidth{cellSize.width != -1 ? cellSize.width : cellSize.height}
+    , cellHeight{cellSize.height != -1 ? cellSize.height : cellSize.width}
+    , blendMode{Constants::ALPHA_COMBINE}
+    , disableDepthWrite{false}
+    , _scene{scene}
+    , _epsilon{epsilon}
+    , _useInstancing{scene->getEngine()->getCaps().instancedArrays}
+    , _grid{chunkSize}
+{
+  auto component = std::static_pointer_cast<SpriteSceneComponent>(
+    scene->_getComponent(SceneComponentConstants::NAME_SPRITE));
+  if (!component) {
+    component = SpriteSceneComponent::New(scene);
+    scene->_addComponent(component);
+  }
+
+  // ISpriteManager interface properties
+  {
+    layerMask        = 0x0FFFFFFF;
+    isPickable       = false;
+    renderingGroupId = 0;
+  }
+
+  _spriteTexture        = Texture::New(imgUrl, scene, true, false, samplingMode);
+  _spriteTexture->wrapU = TextureConstants::CLAMP_ADDRESSMODE;
+  _spriteTexture->wrapV = TextureConstants::CLAMP_ADDRESSMODE;
+
+  // Corners of the quad shared by all the instances
+  const Float32Array spriteData{_epsilon,       _epsilon,       1.f - _epsilon, _epsilon,
+                                1.f - _epsilon, 1.f - _epsilon, _epsilon,       1.f - _epsilon};
+  _spriteBuffer = std::make_unique<Buffer>(scene->getEngine(), spriteData, false, 2);
+  _offsets      = _spriteBuffer->createVertexBuffer("offsets", 0, 2);
+
+  _effectBase = _createEffect(false);
+  _effectFog  = _createEffect(true);
+}
+
+ChunkedSpriteManager::~ChunkedSpriteManager() = default;
+
+void ChunkedSpriteManager::addToScene(const ChunkedSpriteManagerPtr& newSpriteManager)
+{
+  _scene->spriteManagers.emplace_back(newSpriteManager);
+}
+
+EffectPtr ChunkedSpriteManager::_createEffect(bool fog) const
+{
+  IEffectCreationOptions spriteOptions;
+  spriteOptions.attributes    = {VertexBuffer::PositionKind, "options",  "offsets",
+                                 "inverts",                  "cellInfo", VertexBuffer::ColorKind};
+  spriteOptions.uniformsNames = {"view", "projection", "textureInfos", "alphaTest"};
+  spriteOptions.samplers      = {"diffuseSampler"};
+  if (fog) {
+    spriteOptions.uniformsNames.emplace_back("vFogInfos");
+    spriteOptions.uniformsNames.emplace_back("vFogColor");
+    spriteOptions.defines = "#define FOG";
+  }
+
+  return _scene->getEngine()->createEffect("sprites", spriteOptions, _scene->getEngine());
+}
+
+const SpriteChunkGrid& ChunkedSpriteManager::getGrid() const
+{
+  return _grid;
+}
+
+size_t ChunkedSpriteManager::getRenderedChunkCount() const
+{
+  return _visibleChunks.size();
+}
+
+void ChunkedSpriteManager::_updateChunkBuffer(SpriteChunk& chunk)
+{
+  const auto count            = chunk.count();
+  constexpr auto instanceSize = SpriteChunkGrid::InstanceSize;
+
+  // The buffer of the chunk is recreated twice as large when full
+  if (!chunk._buffer || chunk._bufferCapacity < count) {
+    if (chunk._buffer) {
+      chunk._buffer->dispose();
+    }
+    chunk._bufferCapacity = std::max(MinChunkCapacity, count * 2);
+    Float32Array data(chunk._bufferCapacity * instanceSize, 0.f);
+    std::copy(chunk.instanceData.begin(), chunk.instanceData.end(), data.begin());
+
+    auto engine   = _scene->getEngine();
+    chunk._buffer = std::make_unique<Buffer>(engine, data, true, instanceSize, false, true);
+
+    auto& vertexBuffers = chunk._vertexBuffers;
+    vertexBuffers[VertexBuffer::PositionKind]
+      = chunk._buffer->createVertexBuffer(VertexBuffer::PositionKind, 0, 4, instanceSize, true);
+    vertexBuffers[VertexBuffer::OptionsKind]
+      = chunk._buffer->createVertexBuffer(VertexBuffer::OptionsKind, 4, 2, instanceSize, true);
+    vertexBuffers[VertexBuffer::InvertsKind]
+      = chunk._buffer->createVertexBuffer(VertexBuffer::InvertsKind, 6, 2, instanceSize, true);
+    vertexBuffers[VertexBuffer::CellInfoKind]
+      = chunk._buffer->createVertexBuffer(VertexBuffer::CellInfoKind, 8, 4, instanceSize, true);
+    vertexBuffers[VertexBuffer::ColorKind]
+      = chunk._buffer->createVertexBuffer(VertexBuffer::ColorKind, 12, 4, instanceSize, true);
+    vertexBuffers["offsets"] = _offsets;
+
+    chunk.clearDirty();
+    return;
+  }
+
+  // Only the changed records are uploaded
+  const auto end = std::min(chunk.dirtyEnd, count);
+  if (chunk.dirtyStart < end) {
+    const Float32Array data(chunk.instanceData.begin() + chunk.dirtyStart * instanceSize,
+                            chunk.instanceData.begin() + end * instanceSize);
+    chunk._buffer->updateDirectly(data, chunk.dirtyStart * instanceSize);
+  }
+  chunk.clearDirty();
+}
+
+void ChunkedSpriteManager::_intersects(
+  const Ray& ray, const Matrix& cameraView, const std::function<bool(Sprite* sprite)>& predicate,
+  const std::function<bool(const SpritePtr& sprite, float distance)>& onHit)
+{
+  auto min                  = Vector3::Zero();
+  auto max                  = Vector3::Zero();
+  auto& corner              = TmpVectors::Vector3Array[0];
+  auto& cameraSpacePosition = TmpVectors::Vector3Array[1];
+  const auto infinity       = std::numeric_limits<float>::max();
+
+  for (const auto& chunk : _grid.getChunks()) {
+    if (chunk->count() == 0 || chunk->minimum.x > chunk->maximum.x) {
+      continue;
+    }
+
+    // Bounds of the chunk in camera space
+    min.copyFromFloats(infinity, infinity, infinity);
+    max.copyFromFloats(-infinity, -infinity, -infinity);
+    for (unsigned int i = 0; i < 8; ++i) {
+      corner.copyFromFloats((i & 1) ? chunk->maximum.x : chunk->minimum.x,
+                            (i & 2) ? chunk->maximum.y : chunk->minimum.y,
+                            (i & 4) ? chunk->maximum.z : chunk->minimum.z);
+      Vector3::TransformCoordinatesToRef(corner, cameraView, cameraSpacePosition);
+      min.minimizeInPlace(cameraSpacePosition);
+      max.maximizeInPlace(cameraSpacePosition);
+    }
+    if (!ray.intersectsBoxMinMax(min, max)) {
+      continue;
+    }
+
+    for (auto spriteIndex : chunk->spriteIndices) {
+      if (spriteIndex >= sprites.size()) {
+        continue;
+      }
+
+      const auto& sprite = sprites[spriteIndex];
+      if (!sprite || !sprite->isVisible) {
+        continue;
+      }
+
+      if (predicate) {
+        if (!predicate(sprite.get())) {
+          continue;
+        }
+      }
+      else if (!sprite->isPickable) {
+        continue;
+      }
+
+      Vector3::TransformCoordinatesToRef(sprite->position, cameraView, cameraSpacePosition);
+
+      min.copyFromFloats(cameraSpacePosition.x - sprite->width / 2.f,
+                         cameraSpacePosition.y - sprite->height / 2.f, cameraSpacePosition.z);
+      max.copyFromFloats(cameraSpacePosition.x + sprite->width / 2.f,
+                         cameraSpacePosition.y + sprite->height / 2.f, cameraSpacePosition.z);
+
+      if (ray.intersectsBoxMinMax(min, max)
+          && onHit(sprite, Vector3::Distance(cameraSpacePosition, ray.origin))) {
+        return;
+      }
+    }
+  }
+}
+
+std::optional<PickingInfo>
+ChunkedSpriteManager::intersects(const Ray& ray, const CameraPtr& camera,
+                                 const std::function<bool(Sprite* sprite)>& predicate,
+                                 bool fastCheck)
+{
+  auto distance           = std::numeric_limits<float>::max();
+  SpritePtr currentSprite = nullptr;
+  auto cameraView         = camera->getViewMatrix();
+
+  const auto onHit = [&distance, &currentSprite, fastCheck](const SpritePtr& sprite,
+                                                            float spriteDistance) {
+    if (distance > spriteDistance) {
+      distance      = spriteDistance;
+      currentSprite = sprite;
+      return fastCheck;
+    }
+    return false;
+  };
+  _intersects(ray, cameraView, predicate, onHit);
+
+  if (!currentSprite) {
+    return std::nullopt;
+  }
+
+  PickingInfo result;
+
+  cameraView.invertToRef(TmpVectors::MatrixArray[0]);
+  result.hit          = true;
+  result.pickedSprite = currentSprite;
+  result.distance     = distance;
+
+  // Get picked point
+  auto direction = ray.direction;
+  direction.normalize();
+  direction.scaleInPlace(distance);
+
+  result.pickedPoint
+    = Vector3::TransformCoordinates(ray.origin.add(direction), TmpVectors::MatrixArray[0]);
+
+  return result;
+}
+
+std::vector<PickingInfo>
+ChunkedSpriteManager::multiIntersects(const Ray& ray, const CameraPtr& camera,
+                                      const std::function<bool(Sprite* sprite)>& predicate)
+{
+  std::vector<PickingInfo> results;
+  auto cameraView = camera->getViewMatrix();
+  cameraView.invertToRef(TmpVectors::MatrixArray[0]);
+
+  _intersects(ray, cameraView, predicate,
+              [&ray, &results](const SpritePtr& sprite, float distance) {
+                PickingInfo result;
+                result.hit          = true;
+                result.pickedSprite = sprite;
+                result.distance     = distance;
+
+                // Get picked point
+                auto direction = ray.direction;
+                direction.normalize();
+                direction.scaleInPlace(distance);
+
+                result.pickedPoint = Vector3::TransformCoordinates(ray.origin.add(direction),
+                                                                   TmpVectors::MatrixArray[0]);
+                results.emplace_back(result);
+                return false;
+              });
+
+  return results;
+}
+
+void ChunkedSpriteManager::render()
+{
+  // Check
+  if (!_useInstancing || !_effectBase->isReady() || !_effectFog->isReady() || !_spriteTexture
+      || !_spriteTexture->isReady() || sprites.empty()) {
+    return;
+  }
+
+  auto engine   = _scene->getEngine();
+  auto baseSize = _spriteTexture->getBaseSize();
+
+  // Animations, a sprite disposed at the end of its animation is removed from the list
+  const auto deltaTime = engine->getDeltaTime();
+  for (auto index = sprites.size(); index-- > 0;) {
+    if (index < sprites.size() && sprites[index]) {
+      sprites[index]->_animate(deltaTime);
+    }
+  }
+
+  // Chunks
+  _grid.update(sprites, static_cast<float>(baseSize.width), static_cast<float>(baseSize.height),
+               cellWidth, cellHeight);
+  _grid.getVisibleChunks(Frustum::GetPlanes(_scene->getTransformMatrix()), _visibleChunks);
+  if (_visibleChunks.empty()) {
+    return;
+  }
+
+  for (auto chunk : _visibleChunks) {
+    _updateChunkBuffer(*chunk);
+  }
+
+  // Render
+  auto effect = _effectBase;
+
+  if (_scene->fogEnabled() && _scene->fogMode() != Scene::FOGMODE_NONE && fogEnabled) {
+    effect = _effectFog;
+  }
+
+  engine->enableEffect(effect);
+
+  auto viewMatrix = _scene->getViewMatrix();
+  effect->setTexture("diffuseSampler", _spriteTexture);
+  effect->setMatrix("view", viewMatrix);
+  effect->setMatrix("projection", _scene->getProjectionMatrix());
+
+  // Fog
+  if (_scene->fogEnabled() && _scene->fogMode() != Scene::FOGMODE_NONE && fogEnabled) {
+    effect->setFloat4("vFogInfos", static_cast<float>(_scene->fogMode()), _scene->fogStart,
+                      _scene->fogEnd, _scene->fogDensity);
+    effect->setColor3("vFogColor", _scene->fogColor);
+  }
+
+  const auto drawChunks = [this, engine, &effect]() {
+    for (auto chunk : _visibleChunks) {
+      engine->bindBuffers(chunk->_vertexBuffers, nullptr, effect);
+      engine->drawArraysType(Material::TriangleFanDrawMode, 0, 4,
+                             static_cast<int>(chunk->count()));
+    }
+  };
+
+  // Draw order
+  engine->setDepthFunctionToLessOrEqual();
+  if (!disableDepthWrite) {
+    effect->setBool("alphaTest", true);
+    engine->setColorWrite(false);
+    drawChunks();
+    engine->setColorWrite(true);
+    effect->setBool("alphaTest", false);
+  }
+
+  engine->setAlphaMode(blendMode);
+  drawChunks();
+  engine->setAlphaMode(Constants::ALPHA_DISABLE);
+}
+
+void ChunkedSpriteManager::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
+{
+  for (const auto& chunk : _grid.getChunks()) {
+    if (chunk->_buffer) {
+      chunk->_buffer->dispose();
+      chunk->_buffer = nullptr;
+    }
+    chunk->_vertexBuffers.clear();
+    chunk->_bufferCapacity = 0;
+  }
+  _grid.clear();
+  _visibleChunks.clear();
+
+  if (_spriteBuffer) {
+    _spriteBuffer->dispose();
+    _spriteBuffer = nullptr;
+  }
+  _offsets = nullptr;
+
+  if (_spriteTexture) {
+    _spriteTexture->dispose();
+    _spriteTexture = nullptr;
+  }
+
+  // Remove from scene
+  stl_util::remove_vector_elements_equal_sharedptr(_scene->spriteManagers, this);
+
+  // Callback
+  onDisposeObservable.notifyObservers(this);
+  onDisposeObservable.clear();
+}
+
+} // end of namespace BABYLON
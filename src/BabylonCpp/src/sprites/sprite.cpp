@@ -23,6 +23,7 @@ Sprite::Sprite(const std::string& iName, const ISpriteManagerPtr& manager)
     , actionManager{nullptr}
     , isVisible{true}
     , size{this, &Sprite::get_size, &Sprite::set_size}
+    , _isDirty{true}
     , _animationStarted{false}
     , _loopAnimation{false}
     , _fromIndex{0}
@@ -49,8 +50,9 @@ float Sprite::get_size() const
 
 void Sprite::set_size(float value)
 {
-  width  = value;
-  height = value;
+  width    = value;
+  height   = value;
+  _isDirty = true;
 }
 
 void Sprite::playAnimation(int from, int to, bool loop, float delay,
@@ -73,6 +75,7 @@ void Sprite::playAnimation(int from, int to, bool loop, float delay,
 
   cellIndex = from;
   _time     = 0.f;
+  _isDirty  = true;
 
   _onAnimationEnd = onAnimationEnd;
 }
@@ -92,6 +95,7 @@ void Sprite::_animate(float deltaTime)
   if (_time > _delay) {
     _time = std::fmod(_time, _delay);
     cellIndex += _direction;
+    _isDirty = true;
     if ((_direction > 0 && cellIndex > _toIndex) || (_direction < 0 && cellIndex < _fromIndex)) {
       if (_loopAnimation) {
         cellIndex = _direction > 0 ? _fromIndex : _toIndex;
@@ -110,6 +114,11 @@ void Sprite::_animate(float deltaTime)
   }
 }
 
+void Sprite::markAsDirty()
+{
+  _isDirty = true;
+}
+
 void Sprite::dispose()
 {
   // Remove from scene
@@ -0,0 +1,403 @@
+#include <babylon/sprites/sprite_chunk_grid.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/plane.h>
+#include <babylon/meshes/buffer.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/sprites/sprite.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Marks the records of the sprites removed from a chunk
+constexpr size_t NoSprite = std::numeric_limits<size_t>::max();
+
+uint64_t CellKey(const std::array<int, 3>& cell)
+{
+  // 21 bits per coordinate
+  constexpr uint64_t mask = (1ull << 21) - 1;
+  return ((static_cast<uint64_t>(cell[0]) & mask) << 42)
+         | ((static_cast<uint64_t>(cell[1]) & mask) << 21)
+         | (static_cast<uint64_t>(cell[2]) & mask);
+}
+
+void ResetBounds(SpriteChunk& chunk)
+{
+  const auto max = std::numeric_limits<float>::max();
+  chunk.minimum.copyFromFloats(max, max, max);
+  chunk.maximum.copyFromFloats(-max, -max, -max);
+}
+
+} // end of anonymous namespace
+
+SpriteChunk::SpriteChunk() : dirtyStart{0}, dirtyEnd{0}
+{
+  ResetBounds(*this);
+}
+
+SpriteChunk::~SpriteChunk() = default;
+
+size_t SpriteChunk::count() const
+{
+  return spriteIndices.size();
+}
+
+bool SpriteChunk::isDirty() const
+{
+  return dirtyStart < dirtyEnd;
+}
+
+void SpriteChunk::markDirty(size_t start, size_t end)
+{
+  if (!isDirty()) {
+    dirtyStart = start;
+    dirtyEnd   = end;
+  }
+  else {
+    dirtyStart = std::min(dirtyStart, start);
+    dirtyEnd   = std::max(dirtyEnd, end);
+  }
+}
+
+void SpriteChunk::clearDirty()
+{
+  dirtyStart = 0;
+  dirtyEnd   = 0;
+}
+
+SpriteChunkGrid::SpriteChunkGrid(float cellSize)
+    : _cellSize{cellSize > 0.f ? cellSize : 64.f}
+    , _textureWidth{0.f}
+    , _textureHeight{0.f}
+    , _cellWidth{0}
+    , _cellHeight{0}
+{
+}
+
+SpriteChunkGrid::~SpriteChunkGrid() = default;
+
+void SpriteChunkGrid::update(const std::vector<SpritePtr>& sprites, float textureWidth,
+                             float textureHeight, int cellWidth, int cellHeight)
+{
+  // A new sprite sheet changes the cells of all the records
+  const auto refreshAll = textureWidth != _textureWidth || textureHeight != _textureHeight
+                          || cellWidth != _cellWidth || cellHeight != _cellHeight;
+  _textureWidth         = textureWidth;
+  _textureHeight        = textureHeight;
+  _cellWidth            = cellWidth;
+  _cellHeight           = cellHeight;
+
+  // Sprites kept at the same index
+  const auto spriteCount = sprites.size();
+  size_t first           = 0;
+  while (first < _states.size() && first < spriteCount
+         && _states[first].sprite == sprites[first].get()) {
+    ++first;
+  }
+
+  // Sprites removed or moved in the list: the remaining ones keep their records
+  std::vector<size_t> addedSprites;
+  if (first < _states.size()) {
+    std::unordered_map<const Sprite*, SpriteState> previousStates;
+    for (auto i = first; i < _states.size(); ++i) {
+      previousStates.emplace(_states[i].sprite, _states[i]);
+    }
+    _states.resize(first);
+    for (auto i = first; i < spriteCount; ++i) {
+      auto it = previousStates.find(sprites[i].get());
+      if (it != previousStates.end()) {
+        _chunks[it->second.chunk]->spriteIndices[it->second.record] = i;
+        _states.emplace_back(it->second);
+        previousStates.erase(it);
+      }
+      else {
+        _states.emplace_back();
+        addedSprites.emplace_back(i);
+      }
+    }
+
+    std::vector<size_t> chunksWithHoles;
+    for (const auto& item : previousStates) {
+      const auto& state                                 = item.second;
+      _chunks[state.chunk]->spriteIndices[state.record] = NoSprite;
+      chunksWithHoles.emplace_back(state.chunk);
+    }
+    std::sort(chunksWithHoles.begin(), chunksWithHoles.end());
+    chunksWithHoles.erase(std::unique(chunksWithHoles.begin(), chunksWithHoles.end()),
+                          chunksWithHoles.end());
+    for (auto chunkIndex : chunksWithHoles) {
+      _removeHoles(*_chunks[chunkIndex]);
+      _updateBounds(*_chunks[chunkIndex]);
+    }
+  }
+  else {
+    for (auto i = _states.size(); i < spriteCount; ++i) {
+      addedSprites.emplace_back(i);
+    }
+    _states.resize(spriteCount);
+  }
+
+  // Records of the dirty sprites and bounds of their chunks, the sprites leaving their cell are
+  // removed from their chunk and only collected
+  ThreadPool::Default().parallelFor(
+    0, _chunks.size(), 1, [this, &sprites, refreshAll](size_t begin, size_t end) {
+      for (auto c = begin; c < end; ++c) {
+        auto& chunk = *_chunks[c];
+        chunk._movedSprites.clear();
+        auto changed = false;
+        for (size_t r = 0; r < chunk.count(); ++r) {
+          const auto spriteIndex = chunk.spriteIndices[r];
+          const auto& sprite     = sprites[spriteIndex];
+          if (!sprite || !(refreshAll || sprite->_isDirty)) {
+            continue;
+          }
+          sprite->_isDirty = false;
+          _writeRecord(sprite.get(), &chunk.instanceData[r * InstanceSize]);
+          chunk.markDirty(r, r + 1);
+          changed = true;
+          const auto cell = _getCell(sprite->position);
+          if (cell[0] != chunk.x || cell[1] != chunk.y || cell[2] != chunk.z) {
+            chunk.spriteIndices[r] = NoSprite;
+            chunk._movedSprites.emplace_back(spriteIndex);
+          }
+        }
+        if (changed) {
+          _updateBounds(chunk);
+        }
+      }
+    });
+
+  // Sprites which changed of cell
+  std::vector<size_t> movedSprites;
+  for (const auto& chunk : _chunks) {
+    if (chunk->_movedSprites.empty()) {
+      continue;
+    }
+    movedSprites.insert(movedSprites.end(), chunk->_movedSprites.begin(),
+                        chunk->_movedSprites.end());
+    _removeHoles(*chunk);
+    chunk->_movedSprites.clear();
+  }
+  for (auto spriteIndex : movedSprites) {
+    _insert(sprites[spriteIndex], spriteIndex);
+  }
+
+  // Sprites added to the list
+  for (auto spriteIndex : addedSprites) {
+    _insert(sprites[spriteIndex], spriteIndex);
+  }
+}
+
+float SpriteChunkGrid::getCellSize() const
+{
+  return _cellSize;
+}
+
+const std::vector<std::unique_ptr<SpriteChunk>>& SpriteChunkGrid::getChunks() const
+{
+  return _chunks;
+}
+
+void SpriteChunkGrid::getVisibleChunks(const std::array<Plane, 6>& frustumPlanes,
+                                       std::vector<SpriteChunk*>& chunks) const
+{
+  chunks.clear();
+  for (const auto& chunk : _chunks) {
+    if (chunk->count() == 0 || chunk->minimum.x > chunk->maximum.x) {
+      continue;
+    }
+
+    // The corner of the bounds the farthest along the normal of each plane
+    auto inside = true;
+    for (const auto& plane : frustumPlanes) {
+      const Vector3 corner(plane.normal.x >= 0.f ? chunk->maximum.x : chunk->minimum.x,
+                           plane.normal.y >= 0.f ? chunk->maximum.y : chunk->minimum.y,
+                           plane.normal.z >= 0.f ? chunk->maximum.z : chunk->minimum.z);
+      if (plane.dotCoordinate(corner) < 0.f) {
+        inside = false;
+        break;
+      }
+    }
+    if (inside) {
+      chunks.emplace_back(chunk.get());
+    }
+  }
+}
+
+SpriteChunk* SpriteChunkGrid::getChunk(size_t spriteIndex, size_t& record) const
+{
+  if (spriteIndex >= _states.size() || _chunks.empty()) {
+    return nullptr;
+  }
+
+  const auto& state = _states[spriteIndex];
+  auto chunk        = _chunks[state.chunk].get();
+  if (state.record >= chunk->count() || chunk->spriteIndices[state.record] != spriteIndex) {
+    return nullptr;
+  }
+
+  record = state.record;
+  return chunk;
+}
+
+void SpriteChunkGrid::clear()
+{
+  for (const auto& chunk : _chunks) {
+    chunk->spriteIndices.clear();
+    chunk->instanceData.clear();
+    chunk->_movedSprites.clear();
+    chunk->clearDirty();
+    ResetBounds(*chunk);
+  }
+  _states.clear();
+}
+
+std::array<int, 3> SpriteChunkGrid::_getCell(const Vector3& position) const
+{
+  return {{static_cast<int>(std::floor(position.x / _cellSize)),
+           static_cast<int>(std::floor(position.y / _cellSize)),
+           static_cast<int>(std::floor(position.z / _cellSize))}};
+}
+
+size_t SpriteChunkGrid::_getChunk(const std::array<int, 3>& cell)
+{
+  const auto key = CellKey(cell);
+  auto it        = _chunkIndices.find(key);
+  if (it != _chunkIndices.end()) {
+    return it->second;
+  }
+
+  auto chunk = std::make_unique<SpriteChunk>();
+  chunk->x   = cell[0];
+  chunk->y   = cell[1];
+  chunk->z   = cell[2];
+  _chunks.emplace_back(std::move(chunk));
+  _chunkIndices[key] = _chunks.size() - 1;
+
+  return _chunks.size() - 1;
+}
+
+void SpriteChunkGrid::_insert(const SpritePtr& sprite, size_t spriteIndex)
+{
+  const auto chunkIndex
+    = _getChunk(sprite ? _getCell(sprite->position) : std::array<int, 3>{{0, 0, 0}});
+  auto& chunk       = *_chunks[chunkIndex];
+  const auto record = chunk.count();
+
+  chunk.spriteIndices.emplace_back(spriteIndex);
+  chunk.instanceData.resize((record + 1) * InstanceSize);
+  _writeRecord(sprite.get(), &chunk.instanceData[record * InstanceSize]);
+  chunk.markDirty(record, record + 1);
+  if (sprite) {
+    sprite->_isDirty = false;
+    _extendBounds(chunk, &chunk.instanceData[record * InstanceSize]);
+  }
+
+  _states[spriteIndex] = {sprite.get(), chunkIndex, record};
+}
+
+void SpriteChunkGrid::_removeHoles(SpriteChunk& chunk)
+{
+  // Each hole is filled with the last record of the chunk
+  auto count    = chunk.count();
+  size_t record = 0;
+  while (record < count) {
+    if (chunk.spriteIndices[record] != NoSprite) {
+      ++record;
+      continue;
+    }
+    while (count > record && chunk.spriteIndices[count - 1] == NoSprite) {
+      --count;
+    }
+    if (count <= record) {
+      break;
+    }
+
+    const auto last             = count - 1;
+    const auto spriteIndex      = chunk.spriteIndices[last];
+    chunk.spriteIndices[record] = spriteIndex;
+    std::copy_n(&chunk.instanceData[last * InstanceSize], InstanceSize,
+                &chunk.instanceData[record * InstanceSize]);
+    _states[spriteIndex].record = record;
+    chunk.markDirty(record, record + 1);
+    --count;
+    ++record;
+  }
+
+  chunk.spriteIndices.resize(count);
+  chunk.instanceData.resize(count * InstanceSize);
+}
+
+void SpriteChunkGrid::_updateBounds(SpriteChunk& chunk)
+{
+  ResetBounds(chunk);
+  for (size_t r = 0; r < chunk.count(); ++r) {
+    if (chunk.spriteIndices[r] != NoSprite) {
+      _extendBounds(chunk, &chunk.instanceData[r * InstanceSize]);
+    }
+  }
+}
+
+void SpriteChunkGrid::_writeRecord(const Sprite* sprite, float* record) const
+{
+  if (!sprite) {
+    std::fill_n(record, InstanceSize, 0.f);
+    return;
+  }
+
+  // Position and angle
+  record[0] = sprite->position.x;
+  record[1] = sprite->position.y;
+  record[2] = sprite->position.z;
+  record[3] = sprite->angle;
+  // Size
+  record[4] = sprite->isVisible ? sprite->width : 0.f;
+  record[5] = sprite->isVisible ? sprite->height : 0.f;
+  // Inverts
+  record[6] = sprite->invertU ? 1.f : 0.f;
+  record[7] = sprite->invertV ? 1.f : 0.f;
+  // Cell
+  if (_cellWidth > 0 && _cellHeight > 0 && _textureWidth > 0.f && _textureHeight > 0.f) {
+    const auto rowSize = std::max(static_cast<int>(_textureWidth) / _cellWidth, 1);
+    const auto row     = sprite->cellIndex / rowSize;
+    const auto column  = sprite->cellIndex - row * rowSize;
+    record[8]          = static_cast<float>(column * _cellWidth) / _textureWidth;
+    record[9]          = static_cast<float>(row * _cellHeight) / _textureHeight;
+    record[10]         = static_cast<float>(_cellWidth) / _textureWidth;
+    record[11]         = static_cast<float>(_cellHeight) / _textureHeight;
+  }
+  else {
+    std::fill_n(record + 8, 4, 0.f);
+  }
+  // Color
+  const auto color = sprite->color.value_or(Color4(1.f, 1.f, 1.f, 1.f));
+  record[12]       = color.r;
+  record[13]       = color.g;
+  record[14]       = color.b;
+  record[15]       = color.a;
+}
+
+void SpriteChunkGrid::_extendBounds(SpriteChunk& chunk, const float* record)
+{
+  // Hidden sprites are neither drawn nor picked
+  if (record[4] == 0.f && record[5] == 0.f) {
+    return;
+  }
+
+  // The sprites face the camera, their bounds are the spheres around their rotated quads
+  const auto radius = 0.5f * std::sqrt(record[4] * record[4] + record[5] * record[5]);
+  chunk.minimum.x   = std::min(chunk.minimum.x, record[0] - radius);
+  chunk.minimum.y   = std::min(chunk.minimum.y, record[1] - radius);
+  chunk.minimum.z   = std::min(chunk.minimum.z, record[2] - radius);
+  chunk.maximum.x   = std::max(chunk.maximum.x, record[0] + radius);
+  chunk.maximum.y   = std::max(chunk.maximum.y, record[1] + radius);
+  chunk.maximum.z   = std::max(chunk.maximum.z, record[2] + radius);
+}
+
+} // end of namespace BABYLON
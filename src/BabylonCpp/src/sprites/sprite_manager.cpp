@@ -97,13 +97,15 @@ SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl
   _buffer = std::make_unique<Buffer>(scene->getEngine(), _vertexData, true, 18);
 
   auto positions = _buffer->createVertexBuffer(VertexBuffer::PositionKind, 0, 4);
-  auto options   = _buffer->createVertexBuffer(VertexBuffer::OptionsKind, 4, 4);
+  auto options   = _buffer->createVertexBuffer(VertexBuffer::OptionsKind, 4, 2);
+  auto offsets   = _buffer->createVertexBuffer("offsets", 6, 2);
   auto inverts   = _buffer->createVertexBuffer(VertexBuffer::InvertsKind, 8, 2);
   auto cellInfo  = _buffer->createVertexBuffer(VertexBuffer::CellInfoKind, 10, 4);
   auto colors    = _buffer->createVertexBuffer(VertexBuffer::ColorKind, 14, 4);
 
   _vertexBuffers[VertexBuffer::PositionKind] = std::move(positions);
   _vertexBuffers[VertexBuffer::OptionsKind]  = std::move(options);
+  _vertexBuffers["offsets"]                  = std::move(offsets);
   _vertexBuffers[VertexBuffer::InvertsKind]  = std::move(inverts);
   _vertexBuffers[VertexBuffer::CellInfoKind] = std::move(cellInfo);
   _vertexBuffers[VertexBuffer::ColorKind]    = std::move(colors);
@@ -112,8 +114,8 @@ SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl
 
   {
     IEffectCreationOptions spriteOptions;
-    spriteOptions.attributes
-      = {VertexBuffer::PositionKind, "options", "inverts", "cellInfo", VertexBuffer::ColorKind};
+    spriteOptions.attributes    = {VertexBuffer::PositionKind, "options",  "offsets",
+                                   "inverts",                  "cellInfo", VertexBuffer::ColorKind};
     spriteOptions.uniformsNames = {"view", "projection", "textureInfos", "alphaTest"};
     spriteOptions.samplers      = {"diffuseSampler"};
 
@@ -122,8 +124,8 @@ SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl
 
   {
     IEffectCreationOptions spriteOptions;
-    spriteOptions.attributes
-      = {VertexBuffer::PositionKind, "options", "inverts", "cellInfo", VertexBuffer::ColorKind};
+    spriteOptions.attributes = {VertexBuffer::PositionKind, "options",  "offsets",
+                                "inverts",                  "cellInfo", VertexBuffer::ColorKind};
     spriteOptions.uniformsNames
       = {"view", "projection", "textureInfos", "alphaTest", "vFogInfos", "vFogColor"};
     spriteOptions.samplers = {"diffuseSampler"};
@@ -220,10 +222,14 @@ void SpriteManager::_appendSpriteVertex(size_t index, Sprite& sprite, int offset
     auto rowSize = baseSize.width / cellWidth;
     auto offset  = (rowSize == 0) ? 0 : sprite.cellIndex / rowSize;
     _vertexData[arrayOffset + 10]
-      = static_cast<float>((sprite.cellIndex - offset * rowSize) * cellWidth / baseSize.width);
-    _vertexData[arrayOffset + 11] = static_cast<float>(offset * cellHeight / baseSize.height);
-    _vertexData[arrayOffset + 12] = static_cast<float>(cellWidth / baseSize.width);
-    _vertexData[arrayOffset + 13] = static_cast<float>(cellHeight / baseSize.height);
+      = static_cast<float>((sprite.cellIndex - offset * rowSize) * cellWidth)
+        / static_cast<float>(baseSize.width);
+    _vertexData[arrayOffset + 11]
+      = static_cast<float>(offset * cellHeight) / static_cast<float>(baseSize.height);
+    _vertexData[arrayOffset + 12]
+      = static_cast<float>(cellWidth) / static_cast<float>(baseSize.width);
+    _vertexData[arrayOffset + 13]
+      = static_cast<float>(cellHeight) / static_cast<float>(baseSize.height);
   }
   // Color
   _vertexData[arrayOffset + 14] = sprite.color->r;
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_key_compression.h>
+#include <babylon/animations/compiled_animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+TEST(TestAnimationKeyCompression, CompressVector3Animation)
+{
+  using namespace BABYLON;
+
+  // 60 keys per second: a linear part followed by a curved part
+  std::vector<IAnimationKey> keys;
+  for (size_t i = 0; i <= 120; ++i) {
+    const auto frame = static_cast<float>(i);
+    const auto y     = i < 60 ? 0.f : std::sin((frame - 60.f) * 0.1f);
+    keys.emplace_back(IAnimationKey(frame, AnimationValue(Vector3(frame * 0.5f, y, 1.f))));
+  }
+  auto animation = Animation::New("position", "position", 60, Animation::ANIMATIONTYPE_VECTOR3);
+  animation->setKeys(keys);
+
+  AnimationKeyCompressionOptions options;
+  options.tolerance = 1e-3f;
+  const auto report = AnimationKeyCompression::CompressAnimation(*animation, options);
+
+  EXPECT_EQ(report.animationCount, 1ull);
+  EXPECT_EQ(report.originalKeyCount, keys.size());
+  EXPECT_EQ(report.originalMemorySize, keys.size() * sizeof(IAnimationKey));
+  EXPECT_LT(report.keyCount, keys.size() / 2);
+  EXPECT_LT(report.memorySize * 4, report.originalMemorySize);
+  // Key reduction tolerance and quantization error (60 / 65535 on x)
+  EXPECT_LT(report.maxError, 2e-3f);
+
+  // The quantized key frames are the only copy of the key frames
+  EXPECT_TRUE(animation->quantizeKeys());
+  EXPECT_TRUE(animation->_hasQuantizedKeys());
+  const auto track = animation->_getCompiledTrack();
+  ASSERT_NE(track, nullptr);
+  EXPECT_TRUE(track->isQuantized());
+  EXPECT_EQ(report.memorySize, track->memorySize());
+  EXPECT_EQ(animation->getKeyCount(), report.keyCount);
+  EXPECT_EQ(animation->getKeyFrame(0), 0.f);
+  EXPECT_EQ(animation->getKeyFrame(report.keyCount - 1), 120.f);
+  EXPECT_FLOAT_EQ(animation->getHighestFrame(), 120.f);
+  const auto lastValue = animation->getKeyValue(report.keyCount - 1).get<Vector3>();
+  EXPECT_NEAR(lastValue.x, 60.f, 1e-3f);
+
+  // The keys are decoded when accessed, and quantized again when evaluated
+  std::vector<CompiledAnimationTrack::Value> values;
+  for (size_t i = 0; i < report.keyCount; ++i) {
+    values.emplace_back(track->keyValue(i));
+  }
+  const auto decodedKeys = animation->getKeys();
+  EXPECT_FALSE(animation->_hasQuantizedKeys());
+  ASSERT_EQ(decodedKeys.size(), report.keyCount);
+  for (size_t i = 0; i < decodedKeys.size(); ++i) {
+    const auto value = decodedKeys[i].value.get<Vector3>();
+    EXPECT_EQ(value.x, values[i][0]);
+    EXPECT_EQ(value.y, values[i][1]);
+    EXPECT_EQ(value.z, values[i][2]);
+  }
+  ASSERT_NE(animation->_getCompiledTrack(), nullptr);
+  EXPECT_TRUE(animation->_hasQuantizedKeys());
+  EXPECT_EQ(animation->getKeyCount(), report.keyCount);
+}
+
+TEST(TestAnimationKeyCompression, QuantizeQuaternionTrack)
+{
+  using namespace BABYLON;
+
+  std::vector<IAnimationKey> keys;
+  for (size_t i = 0; i <= 30; ++i) {
+    const auto angle = static_cast<float>(i) * 0.2f;
+    const auto rotation = Quaternion::RotationYawPitchRoll(angle, -angle, 0.3f);
+    keys.emplace_back(IAnimationKey(static_cast<float>(i), AnimationValue(rotation)));
+  }
+
+  auto track = CompiledAnimationTrack::Compile(Animation::ANIMATIONTYPE_QUATERNION, keys);
+  ASSERT_NE(track, nullptr);
+  const auto size = track->memorySize();
+  EXPECT_TRUE(track->quantize());
+  EXPECT_LT(track->memorySize(), size);
+
+  // Smallest three encoding: q or -q, within the quantization step
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const auto& expected = keys[i].value.get<Quaternion>();
+    const auto value     = track->keyValue(i);
+    const auto dot = value[0] * expected.x + value[1] * expected.y + value[2] * expected.z
+                     + value[3] * expected.w;
+    const auto sign = dot < 0.f ? -1.f : 1.f;
+    EXPECT_NEAR(sign * value[0], expected.x, 1e-4f);
+    EXPECT_NEAR(sign * value[1], expected.y, 1e-4f);
+    EXPECT_NEAR(sign * value[2], expected.z, 1e-4f);
+    EXPECT_NEAR(sign * value[3], expected.w, 1e-4f);
+  }
+}
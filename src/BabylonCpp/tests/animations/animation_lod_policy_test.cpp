@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_event.h>
+#include <babylon/animations/animation_lod_policy.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/viewport.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+namespace {
+
+/**
+ * Box of size 1 whose rotation around the y axis is animated from 0 to lastFrame, at 60 frames per
+ * second.
+ */
+BABYLON::MeshPtr CreateAnimatedBox(BABYLON::Scene* scene, const BABYLON::Vector3& position,
+                                   float lastFrame)
+{
+  using namespace BABYLON;
+
+  BoxOptions options;
+  options.size = 1.f;
+  auto box     = MeshBuilder::CreateBox("box", options, scene);
+  box->position().copyFrom(position);
+  box->computeWorldMatrix(true);
+
+  auto animation = Animation::New("rotation", "rotation", 60, Animation::ANIMATIONTYPE_VECTOR3);
+  animation->setKeys({IAnimationKey(0.f, AnimationValue(Vector3::Zero())),
+                      IAnimationKey(lastFrame, AnimationValue(Vector3(0.f, lastFrame, 0.f)))});
+  box->animations.emplace_back(animation);
+  return box;
+}
+
+/**
+ * Animates the scene with a step of 16ms then activates the given meshes, as done by Scene::render.
+ */
+void RenderFrame(BABYLON::Scene* scene, const std::vector<BABYLON::AbstractMesh*>& activeMeshes)
+{
+  scene->animate();
+  scene->incrementRenderId();
+  for (const auto& mesh : activeMeshes) {
+    mesh->_renderId = scene->getRenderId();
+  }
+}
+
+/**
+ * Returns the number of frames, out of frameCount, during which the rotation of the box changed.
+ */
+size_t CountUpdates(BABYLON::Scene* scene, const BABYLON::MeshPtr& box, size_t frameCount,
+                    bool active)
+{
+  size_t updateCount = 0;
+  for (size_t i = 0; i < frameCount; ++i) {
+    const auto rotation = box->rotation().y;
+    RenderFrame(scene, active ? std::vector<BABYLON::AbstractMesh*>{box.get()} :
+                                std::vector<BABYLON::AbstractMesh*>{});
+    updateCount += box->rotation().y != rotation ? 1 : 0;
+  }
+  return updateCount;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAnimationLODPolicy, OffscreenAnimatables)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->useConstantAnimationDeltaTime = true;
+  scene->animationLODPolicy->enabled   = true;
+  scene->activeCamera = FreeCamera::New("camera", Vector3::Zero(), scene.get());
+
+  auto box = CreateAnimatedBox(scene.get(), Vector3(0.f, 0.f, 5.f), 600.f);
+  scene->beginAnimation(box, 0.f, 600.f, true);
+  RenderFrame(scene.get(), {});
+
+  // The animatables of the meshes which were not active are updated every offscreenUpdateInterval
+  // frames
+  scene->animationLODPolicy->offscreenUpdateInterval = 5;
+  EXPECT_EQ(CountUpdates(scene.get(), box, 20, false), 4ull);
+
+  // Or paused
+  scene->animationLODPolicy->offscreenUpdateInterval = 0;
+  EXPECT_EQ(CountUpdates(scene.get(), box, 20, false), 0ull);
+
+  // Until one of their meshes becomes active, the animation catching up with the elapsed time
+  RenderFrame(scene.get(), {box.get()});
+  EXPECT_EQ(CountUpdates(scene.get(), box, 1, true), 1ull);
+  EXPECT_NEAR(box->rotation().y, 42.f * 16.f * 60.f / 1000.f, 1e-3f);
+}
+
+TEST(TestAnimationLODPolicy, DistantAnimatables)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->useConstantAnimationDeltaTime = true;
+  scene->animationLODPolicy->enabled   = true;
+  scene->animationLODPolicy->distantUpdateInterval = 4;
+
+  // The viewport of the camera is twice wider than high
+  auto camera         = FreeCamera::New("camera", Vector3::Zero(), scene.get());
+  camera->fov         = 0.8f;
+  camera->viewport    = Viewport(0.f, 0.f, 1.f, 0.5f);
+  scene->activeCamera = camera;
+
+  // The diameter of the box covers 8% of the height of the screen with a vertical field of view
+  auto box = CreateAnimatedBox(scene.get(), Vector3(0.f, 0.f, 25.f), 600.f);
+  scene->beginAnimation(box, 0.f, 600.f, true);
+  RenderFrame(scene.get(), {box.get()});
+  EXPECT_EQ(CountUpdates(scene.get(), box, 16, true), 4ull);
+
+  // And 16% with the same horizontal field of view
+  camera->fovMode = Camera::FOVMODE_HORIZONTAL_FIXED;
+  EXPECT_EQ(CountUpdates(scene.get(), box, 16, true), 16ull);
+
+  // The policy can be disabled
+  camera->fovMode                    = Camera::FOVMODE_VERTICAL_FIXED;
+  scene->animationLODPolicy->enabled = false;
+  EXPECT_EQ(CountUpdates(scene.get(), box, 16, true), 16ull);
+}
+
+TEST(TestAnimationLODPolicy, EventsAcrossLoops)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->useConstantAnimationDeltaTime = true;
+  scene->animationLODPolicy->enabled   = true;
+  scene->animationLODPolicy->offscreenUpdateInterval = 8;
+
+  // A loop of 10 frames, the updates being 7.68 frames apart
+  auto box           = CreateAnimatedBox(scene.get(), Vector3::Zero(), 10.f);
+  size_t earlyEvents = 0;
+  size_t lateEvents  = 0;
+  auto& animation    = box->animations.front();
+  animation->addEvent(AnimationEvent(3.f, [&earlyEvents](float /*frame*/) { ++earlyEvents; }));
+  animation->addEvent(AnimationEvent(9.f, [&lateEvents](float /*frame*/) { ++lateEvents; }));
+  scene->beginAnimation(box, 0.f, 10.f, true);
+  RenderFrame(scene.get(), {});
+
+  // Frame 7.68
+  EXPECT_EQ(CountUpdates(scene.get(), box, 8, false), 1ull);
+  EXPECT_EQ(earlyEvents, 1ull);
+  EXPECT_EQ(lateEvents, 0ull);
+
+  // Frame 5.36 of the next loop, the event of the frame 9 skipped in the first loop is raised
+  EXPECT_EQ(CountUpdates(scene.get(), box, 8, false), 1ull);
+  EXPECT_EQ(earlyEvents, 2ull);
+  EXPECT_EQ(lateEvents, 1ull);
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/compiled_animation_track.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/scalar.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+BABYLON::_IAnimationState CreateState(unsigned int loopMode)
+{
+  BABYLON::_IAnimationState state;
+  state.key         = 0;
+  state.repeatCount = 0;
+  state.loopMode    = loopMode;
+  return state;
+}
+
+} // end of anonymous namespace
+
+TEST(TestCompiledAnimationTrack, FindSegment)
+{
+  using namespace BABYLON;
+
+  const std::vector<IAnimationKey> keys{
+    IAnimationKey(0.f, AnimationValue(0.f)), IAnimationKey(10.f, AnimationValue(1.f)),
+    IAnimationKey(20.f, AnimationValue(2.f)), IAnimationKey(30.f, AnimationValue(3.f))};
+  const auto track = CompiledAnimationTrack::Compile(Animation::ANIMATIONTYPE_FLOAT, keys);
+  ASSERT_NE(track, nullptr);
+  EXPECT_EQ(track->keyCount(), 4ull);
+
+  int cursor = 0;
+  EXPECT_EQ(track->findSegment(-5.f, cursor), 0);
+  EXPECT_EQ(track->findSegment(10.f, cursor), 0);
+  EXPECT_EQ(track->findSegment(10.5f, cursor), 1);
+  EXPECT_EQ(track->findSegment(25.f, cursor), 2);
+  EXPECT_EQ(cursor, 2);
+  EXPECT_EQ(track->findSegment(5.f, cursor), 0);
+  EXPECT_EQ(track->findSegment(31.f, cursor), -1);
+
+  // Unsorted keys and keys of another type are not compiled
+  const std::vector<IAnimationKey> unsorted{IAnimationKey(10.f, AnimationValue(0.f)),
+                                            IAnimationKey(0.f, AnimationValue(1.f))};
+  EXPECT_EQ(CompiledAnimationTrack::Compile(Animation::ANIMATIONTYPE_FLOAT, unsorted), nullptr);
+  EXPECT_EQ(CompiledAnimationTrack::Compile(Animation::ANIMATIONTYPE_VECTOR3, keys), nullptr);
+}
+
+TEST(TestCompiledAnimationTrack, InterpolateVector3AndQuaternion)
+{
+  using namespace BABYLON;
+
+  const Vector3 v0(0.f, 1.f, 2.f), v1(4.f, -2.f, 8.f), v2(1.f, 1.f, 1.f);
+  auto positions = Animation::New("positions", "position", 30, Animation::ANIMATIONTYPE_VECTOR3);
+  positions->setKeys({IAnimationKey(0.f, AnimationValue(v0)),
+                      IAnimationKey(8.f, AnimationValue(v1)),
+                      IAnimationKey(20.f, AnimationValue(v2))});
+  ASSERT_NE(positions->_getCompiledTrack(), nullptr);
+
+  auto state = CreateState(Animation::ANIMATIONLOOPMODE_CYCLE);
+  for (const auto frame : {0.f, 3.f, 8.f, 12.5f, 19.f, 2.f, 20.f}) {
+    const auto expected = frame <= 8.f ? Vector3::Lerp(v0, v1, frame / 8.f) :
+                                         Vector3::Lerp(v1, v2, (frame - 8.f) / 12.f);
+    const auto value    = positions->_interpolate(frame, state).get<Vector3>();
+    EXPECT_EQ(value.x, expected.x) << "frame " << frame;
+    EXPECT_EQ(value.y, expected.y) << "frame " << frame;
+    EXPECT_EQ(value.z, expected.z) << "frame " << frame;
+  }
+
+  const auto q0 = Quaternion::RotationYawPitchRoll(0.2f, 0.4f, 0.f);
+  const auto q1 = Quaternion::RotationYawPitchRoll(1.5f, -0.3f, 0.7f);
+  auto rotations
+    = Animation::New("rotations", "rotationQuaternion", 30, Animation::ANIMATIONTYPE_QUATERNION);
+  rotations->setKeys(
+    {IAnimationKey(0.f, AnimationValue(q0)), IAnimationKey(4.f, AnimationValue(q1))});
+  const auto expected = Quaternion::Slerp(q0, q1, 0.25f);
+  const auto value    = rotations->_interpolate(1.f, state).get<Quaternion>();
+  EXPECT_EQ(value.x, expected.x);
+  EXPECT_EQ(value.y, expected.y);
+  EXPECT_EQ(value.z, expected.z);
+  EXPECT_EQ(value.w, expected.w);
+}
+
+TEST(TestCompiledAnimationTrack, TangentsStepAndRelative)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("anim", "position.x", 30, Animation::ANIMATIONTYPE_FLOAT);
+  animation->setKeys({
+    IAnimationKey(0.f, AnimationValue(1.f), std::nullopt, AnimationValue(0.5f), std::nullopt),
+    IAnimationKey(10.f, AnimationValue(3.f), AnimationValue(-0.25f), std::nullopt,
+                  AnimationValue(static_cast<int>(AnimationKeyInterpolation::STEP))),
+    IAnimationKey(20.f, AnimationValue(5.f)),
+  });
+
+  auto state = CreateState(Animation::ANIMATIONLOOPMODE_CYCLE);
+  EXPECT_EQ(animation->_interpolate(4.f, state).get<float>(),
+            Scalar::Hermite(1.f, 0.5f * 10.f, 3.f, -0.25f * 10.f, 0.4f));
+  EXPECT_EQ(animation->_interpolate(15.f, state).get<float>(), 3.f);
+
+  // Keys added or modified in place through getKeys() are taken into account
+  animation->getKeys().emplace_back(IAnimationKey(30.f, AnimationValue(9.f)));
+  EXPECT_EQ(animation->_interpolate(25.f, state).get<float>(), 7.f);
+  animation->getKeys().back().value = AnimationValue(13.f);
+  EXPECT_EQ(animation->_interpolate(25.f, state).get<float>(), 9.f);
+
+  state             = CreateState(Animation::ANIMATIONLOOPMODE_RELATIVE);
+  state.repeatCount = 2;
+  state.offsetValue = AnimationValue(8.f);
+  // 9 + 2 * 8
+  EXPECT_EQ(animation->_interpolate(25.f, state).get<float>(), 25.f);
+}
+
+TEST(TestCompiledAnimationTrack, CompileKeysCanBeDisabled)
+{
+  using namespace BABYLON;
+
+  const std::vector<IAnimationKey> keys{
+    IAnimationKey(0.f, AnimationValue(1.f), std::nullopt, AnimationValue(0.5f), std::nullopt),
+    IAnimationKey(10.f, AnimationValue(3.f), AnimationValue(-0.25f), std::nullopt,
+                  AnimationValue(static_cast<int>(AnimationKeyInterpolation::STEP))),
+    IAnimationKey(20.f, AnimationValue(5.f)), IAnimationKey(30.f, AnimationValue(-2.f))};
+  auto compiled = Animation::New("compiled", "position.x", 30, Animation::ANIMATIONTYPE_FLOAT);
+  compiled->setKeys(keys);
+  EXPECT_TRUE(compiled->compileKeys());
+  ASSERT_NE(compiled->_getCompiledTrack(), nullptr);
+
+  auto uncompiled = Animation::New("uncompiled", "position.x", 30, Animation::ANIMATIONTYPE_FLOAT);
+  uncompiled->compileKeys = false;
+  uncompiled->setKeys(keys);
+  EXPECT_EQ(uncompiled->_getCompiledTrack(), nullptr);
+
+  // Both paths give the same values, forward, backward and over repeats
+  for (const auto loopMode :
+       {Animation::ANIMATIONLOOPMODE_CYCLE, Animation::ANIMATIONLOOPMODE_RELATIVE}) {
+    auto compiledState   = CreateState(loopMode);
+    auto uncompiledState = CreateState(loopMode);
+    for (const auto frame : {0.f, 4.f, 10.f, 15.f, 22.5f, 30.f, 7.f, 26.f}) {
+      compiledState.repeatCount = uncompiledState.repeatCount = frame > 20.f ? 1 : 0;
+      compiledState.offsetValue = uncompiledState.offsetValue = AnimationValue(-3.f);
+      EXPECT_FLOAT_EQ(uncompiled->_interpolate(frame, uncompiledState).get<float>(),
+                      compiled->_interpolate(frame, compiledState).get<float>())
+        << "frame " << frame;
+    }
+  }
+
+  // Disabling the compilation decodes the quantized key frames
+  compiled->quantizeKeys = true;
+  ASSERT_NE(compiled->_getCompiledTrack(), nullptr);
+  EXPECT_TRUE(compiled->_hasQuantizedKeys());
+  compiled->compileKeys = false;
+  EXPECT_FALSE(compiled->_hasQuantizedKeys());
+  EXPECT_EQ(compiled->_getCompiledTrack(), nullptr);
+  ASSERT_EQ(compiled->getKeyCount(), 4ull);
+  EXPECT_NEAR(compiled->getKeyValue(3).get<float>(), -2.f, 1e-3f);
+  auto state = CreateState(Animation::ANIMATIONLOOPMODE_CYCLE);
+  EXPECT_NEAR(compiled->_interpolate(15.f, state).get<float>(), 3.f, 1e-3f);
+
+  // And enabling it again compiles them on the next evaluation
+  compiled->compileKeys = true;
+  EXPECT_NE(compiled->_getCompiledTrack(), nullptr);
+  EXPECT_TRUE(compiled->_hasQuantizedKeys());
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_event.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+namespace {
+
+/**
+ * Position animation of 10 frames at 60 frames per second, from start to end.
+ */
+BABYLON::AnimationPtr CreatePositionAnimation(const BABYLON::Vector3& start,
+                                              const BABYLON::Vector3& end)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("position", "position", 60, Animation::ANIMATIONTYPE_VECTOR3);
+  animation->setKeys(
+    {IAnimationKey(0.f, AnimationValue(start)), IAnimationKey(10.f, AnimationValue(end))});
+  return animation;
+}
+
+/**
+ * Animates boxes whose animations raise events, and returns the positions of the boxes and the
+ * events raised after each frame.
+ */
+std::pair<std::vector<BABYLON::Vector3>, std::vector<std::string>>
+AnimateBoxes(bool useParallelAnimationEvaluation)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->useConstantAnimationDeltaTime  = true;
+  scene->useParallelAnimationEvaluation = useParallelAnimationEvaluation;
+
+  std::vector<MeshPtr> boxes;
+  std::vector<std::string> events;
+  for (size_t i = 0; i < 8; ++i) {
+    BoxOptions options;
+    auto box       = MeshBuilder::CreateBox("box" + std::to_string(i), options, scene.get());
+    auto animation = CreatePositionAnimation(Vector3::Zero(), Vector3(static_cast<float>(i), 0, 1));
+    const auto name = box->name;
+    animation->addEvent(AnimationEvent(static_cast<float>(i), [&events, name](float frame) {
+      events.emplace_back(name + "@" + std::to_string(frame));
+    }));
+    box->animations.emplace_back(animation);
+    // The looping and the ending animations are interleaved
+    scene->beginAnimation(box, 0.f, 10.f, i % 2 == 0);
+    boxes.emplace_back(box);
+  }
+
+  std::vector<Vector3> positions;
+  for (size_t frame = 0; frame < 20; ++frame) {
+    scene->animate();
+    for (const auto& box : boxes) {
+      positions.emplace_back(box->position());
+    }
+    events.emplace_back("frame");
+  }
+  return {positions, events};
+}
+
+/**
+ * Animates the position of a box, originally at (4, 0, 0), with two weighted animations moving it
+ * to (8, 0, 0) and (0, 8, 0), and returns its position after frameCount frames.
+ */
+BABYLON::Vector3 AnimateWeightedBox(float firstWeight, float secondWeight, size_t frameCount,
+                                    bool loop = true)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->useConstantAnimationDeltaTime = true;
+
+  BoxOptions options;
+  auto box = MeshBuilder::CreateBox("box", options, scene.get());
+  box->position().copyFromFloats(4.f, 0.f, 0.f);
+  box->animations = {CreatePositionAnimation(Vector3(8.f, 0.f, 0.f), Vector3(8.f, 0.f, 0.f))};
+  scene->beginWeightedAnimation(box, 0.f, 10.f, firstWeight, loop);
+  box->animations = {CreatePositionAnimation(Vector3(0.f, 8.f, 0.f), Vector3(0.f, 8.f, 0.f))};
+  scene->beginWeightedAnimation(box, 0.f, 10.f, secondWeight, loop);
+
+  for (size_t frame = 0; frame < frameCount; ++frame) {
+    scene->animate();
+  }
+  return box->position();
+}
+
+} // end of anonymous namespace
+
+TEST(TestParallelAnimationEvaluation, SameValuesAndEvents)
+{
+  const auto [sequentialPositions, sequentialEvents] = AnimateBoxes(false);
+  const auto [parallelPositions, parallelEvents]     = AnimateBoxes(true);
+
+  // The values are the same and the events are raised in the order of the animatables
+  ASSERT_EQ(parallelPositions.size(), sequentialPositions.size());
+  for (size_t i = 0; i < parallelPositions.size(); ++i) {
+    EXPECT_TRUE(parallelPositions[i].equals(sequentialPositions[i])) << "value " << i;
+  }
+  EXPECT_EQ(parallelEvents, sequentialEvents);
+  EXPECT_GT(parallelEvents.size(), 20ull);
+}
+
+TEST(TestParallelAnimationEvaluation, WeightedAnimations)
+{
+  using namespace BABYLON;
+
+  // The original value is mixed in when the total weight is lower than 1
+  auto position = AnimateWeightedBox(0.25f, 0.5f, 3);
+  EXPECT_NEAR(position.x, 4.f * 0.25f + 8.f * 0.25f, 1e-4f);
+  EXPECT_NEAR(position.y, 8.f * 0.5f, 1e-4f);
+  EXPECT_NEAR(position.z, 0.f, 1e-4f);
+
+  // And the weights are normalized otherwise
+  position = AnimateWeightedBox(0.6f, 0.9f, 3);
+  EXPECT_NEAR(position.x, 8.f * 0.4f, 1e-4f);
+  EXPECT_NEAR(position.y, 8.f * 0.6f, 1e-4f);
+
+  // The values of the animations disposed at their end are still blended
+  position = AnimateWeightedBox(0.5f, 0.5f, 60, false);
+  EXPECT_NEAR(position.x, 8.f * 0.5f, 1e-4f);
+  EXPECT_NEAR(position.y, 8.f * 0.5f, 1e-4f);
+}
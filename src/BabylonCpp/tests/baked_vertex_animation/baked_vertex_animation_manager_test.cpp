@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector4.h>
+
+TEST(TestBakedVertexAnimationManager, ComputeFrame)
+{
+  using namespace BABYLON;
+
+  // Frames 10 to 19 played at 30 frames per second
+  const Vector4 settings(10.f, 19.f, 0.f, 30.f);
+  EXPECT_FLOAT_EQ(BakedVertexAnimationManager::ComputeFrame(settings, 0.f), 10.f);
+  EXPECT_FLOAT_EQ(BakedVertexAnimationManager::ComputeFrame(settings, 0.1f), 13.f);
+
+  // After the first loop, the first frame is skipped
+  EXPECT_FLOAT_EQ(BakedVertexAnimationManager::ComputeFrame(settings, 0.5f), 15.f);
+
+  // The offset wraps around the range
+  const Vector4 offsetSettings(10.f, 19.f, 7.f, 30.f);
+  EXPECT_FLOAT_EQ(BakedVertexAnimationManager::ComputeFrame(offsetSettings, 0.1f), 10.f);
+}
+
+TEST(TestBakedVertexAnimationManager, ReadBoneMatrix)
+{
+  using namespace BABYLON;
+
+  // 2 bones (3 matrices per frame) and 3 frames
+  const size_t boneCount = 2;
+  Float32Array vertexData((boneCount + 1) * 16 * 3);
+  for (size_t i = 0; i < vertexData.size(); ++i) {
+    vertexData[i] = static_cast<float>(i);
+  }
+
+  const auto matrix = BakedVertexAnimationManager::ReadBoneMatrix(vertexData, boneCount, 2, 1);
+  const auto offset = (2 * (boneCount + 1) + 1) * 16;
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_EQ(matrix.m()[i], static_cast<float>(offset + i));
+  }
+
+  // Out of range
+  auto identity = BakedVertexAnimationManager::ReadBoneMatrix(vertexData, boneCount, 3, 0);
+  EXPECT_TRUE(identity.isIdentity());
+}
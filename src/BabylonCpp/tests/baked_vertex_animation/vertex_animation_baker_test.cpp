@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
+#include <babylon/baked_vertex_animation/vertex_animation_baker.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+
+namespace {
+
+void ExpectTranslation(const BABYLON::Matrix& matrix, float x)
+{
+  const auto expected = BABYLON::Matrix::Translation(x, 0.f, 0.f);
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_NEAR(matrix.m()[i], expected.m()[i], 1e-5f) << "frame " << x << ", element " << i;
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestVertexAnimationBaker, BakeVertexData)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // The root bone is translated along the x axis by one unit per frame, from frame 0 to frame 10.
+  // The matrices are not interpolated by default, a key holds its value until the next key frame:
+  // the keys are set half a frame before the baked frames.
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto root     = Bone::New("root", skeleton.get(), nullptr, Matrix::Identity());
+  Bone::New("child", skeleton.get(), root.get(), Matrix::Translation(0.f, 1.f, 0.f));
+  auto animation = Animation::New("root", "_matrix", 30, Animation::ANIMATIONTYPE_MATRIX);
+  std::vector<IAnimationKey> keys;
+  for (size_t frame = 0; frame <= 10; ++frame) {
+    const auto x = static_cast<float>(frame);
+    keys.emplace_back(IAnimationKey(x - 0.5f, AnimationValue(Matrix::Translation(x, 0.f, 0.f))));
+  }
+  animation->setKeys(keys);
+  root->animations.emplace_back(animation);
+
+  BoxOptions options;
+  auto box             = MeshBuilder::CreateBox("box", options, scene.get());
+  box->skeleton        = skeleton;
+  const auto boneCount = skeleton->bones.size();
+  const auto rowSize   = (boneCount + 1) * 16;
+  VertexAnimationBaker baker(scene.get(), box);
+  EXPECT_TRUE(baker.bakeVertexData({}).empty());
+
+  // One row of matrices per frame of the ranges, in order
+  const auto vertexData = baker.bakeVertexData(
+    {AnimationRange("first", 0.f, 2.f), AnimationRange("second", 6.f, 7.f)});
+  ASSERT_EQ(vertexData.size(), 5 * rowSize);
+  const std::vector<float> frames{0.f, 1.f, 2.f, 6.f, 7.f};
+  for (size_t frameIndex = 0; frameIndex < frames.size(); ++frameIndex) {
+    // The child follows its parent, the skinning matrices being relative to the rest pose
+    const auto frame = frames[frameIndex];
+    ExpectTranslation(
+      BakedVertexAnimationManager::ReadBoneMatrix(vertexData, boneCount, frameIndex, 0), frame);
+    ExpectTranslation(
+      BakedVertexAnimationManager::ReadBoneMatrix(vertexData, boneCount, frameIndex, 1), frame);
+  }
+
+  // The skeleton is left in its rest pose
+  EXPECT_TRUE(root->getLocalMatrix().isIdentity());
+
+  // The texture has one row of RGBA texels per frame
+  const auto texture = baker.textureFromBakedVertexData(vertexData);
+  ASSERT_NE(texture, nullptr);
+  EXPECT_EQ(texture->getSize().width, static_cast<int>(rowSize / 4));
+  EXPECT_EQ(texture->getSize().height, 5);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/bone_matrix_texture_atlas.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/raw_texture.h>
+
+TEST(TestBoneMatrixTextureAtlas, AllocateAndRelease)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto& atlas = BoneMatrixTextureAtlas::ForScene(scene.get());
+  EXPECT_EQ(atlas.getTexture(), nullptr);
+
+  // The first rows fit in the initial texture
+  for (size_t i = 0; i < BoneMatrixTextureAtlas::InitialRowCount; ++i) {
+    EXPECT_EQ(atlas.allocate(10), i);
+  }
+  EXPECT_NE(atlas.getTexture(), nullptr);
+  EXPECT_EQ(atlas.getWidth(), BoneMatrixTextureAtlas::MinWidth);
+  EXPECT_EQ(atlas.getHeight(), BoneMatrixTextureAtlas::InitialRowCount);
+
+  // The height doubles when all the rows are used, the released rows are reused first
+  EXPECT_EQ(atlas.allocate(10), BoneMatrixTextureAtlas::InitialRowCount);
+  EXPECT_EQ(atlas.getHeight(), 2 * BoneMatrixTextureAtlas::InitialRowCount);
+  atlas.release(1);
+  EXPECT_EQ(atlas.allocate(10), 1ull);
+
+  // The width grows by powers of two for the larger skeletons
+  const auto row = atlas.allocate(100);
+  ASSERT_TRUE(row.has_value());
+  EXPECT_EQ(atlas.getWidth(), 512ull);
+
+  // Up to the maximum texture size of the engine
+  const auto maxTextureSize = static_cast<size_t>(engine->getCaps().maxTextureSize);
+  EXPECT_FALSE(atlas.allocate(maxTextureSize).has_value());
+  EXPECT_EQ(atlas.getWidth(), 512ull);
+
+  atlas.dispose();
+  EXPECT_EQ(atlas.getTexture(), nullptr);
+  EXPECT_EQ(atlas.getWidth(), 0ull);
+  EXPECT_EQ(atlas.allocate(1), 0ull);
+}
+
+TEST(TestBoneMatrixTextureAtlas, Update)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto& atlas = BoneMatrixTextureAtlas::ForScene(scene.get());
+
+  const auto row = atlas.allocate(2);
+  ASSERT_TRUE(row.has_value());
+  const auto uploadedTexelCount = atlas.getUploadedTexelCount();
+
+  // Only the texels which changed are uploaded
+  Float32Array matrices(32, 1.f);
+  atlas.update(*row, matrices);
+  EXPECT_EQ(atlas.getUploadedTexelCount(), uploadedTexelCount + 8);
+  atlas.update(*row, matrices);
+  EXPECT_EQ(atlas.getUploadedTexelCount(), uploadedTexelCount + 8);
+  matrices[5]  = 2.f;
+  matrices[14] = 2.f;
+  atlas.update(*row, matrices);
+  EXPECT_EQ(atlas.getUploadedTexelCount(), uploadedTexelCount + 8 + 3);
+}
+
+TEST(TestBoneMatrixTextureAtlas, SceneDispose)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoneMatrixTextureAtlas::ForScene(scene.get()).allocate(1);
+  ASSERT_NE(scene->_boneMatrixTextureAtlas, nullptr);
+
+  scene->dispose();
+  EXPECT_EQ(scene->_boneMatrixTextureAtlas->getTexture(), nullptr);
+  EXPECT_EQ(scene->_boneMatrixTextureAtlas->getHeight(), 0ull);
+}
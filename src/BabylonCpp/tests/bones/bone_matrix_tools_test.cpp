@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <babylon/bones/bone_matrix_tools.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+BABYLON::Matrix CreateMatrix(float seed)
+{
+  using namespace BABYLON;
+  return Matrix::Compose(Vector3(1.f + seed, 2.f - seed, 0.5f),
+                         Quaternion::RotationYawPitchRoll(seed, 2.f * seed, -seed),
+                         Vector3(seed, -3.f * seed, 10.f));
+}
+
+} // end of anonymous namespace
+
+TEST(TestBoneMatrixTools, Multiply)
+{
+  using namespace BABYLON;
+
+  auto a       = CreateMatrix(0.3f);
+  const auto b = CreateMatrix(-1.2f);
+  Matrix expected;
+  a.multiplyToRef(b, expected);
+
+  std::array<float, 16> result{};
+  BoneMatrixTools::Multiply(a.m().data(), b.m().data(), result.data());
+  EXPECT_EQ(result, expected.m());
+
+  // In place
+  auto inPlace = a.m();
+  BoneMatrixTools::Multiply(inPlace.data(), b.m().data(), inPlace.data());
+  EXPECT_EQ(inPlace, expected.m());
+
+  // Both the scalar and the SSE products are checked, whatever the product used by the library
+  BoneMatrixTools::MultiplyScalar(a.m().data(), b.m().data(), result.data());
+  EXPECT_EQ(result, expected.m());
+  result.fill(0.f);
+  if (BoneMatrixTools::MultiplySSE2(a.m().data(), b.m().data(), result.data())) {
+    EXPECT_EQ(result, expected.m());
+    inPlace = a.m();
+    BoneMatrixTools::MultiplySSE2(inPlace.data(), b.m().data(), inPlace.data());
+    EXPECT_EQ(inPlace, expected.m());
+  }
+}
+
+TEST(TestBoneMatrixTools, ComputeSkinningMatrices)
+{
+  using namespace BABYLON;
+
+  // Root <- child <- grandchild, the matrix of the child is skipped
+  const std::vector<int> parents{-1, 0, 1};
+  const std::vector<int> matrixIndices{0, -1, 1};
+  std::vector<Matrix> locals{CreateMatrix(0.1f), CreateMatrix(0.2f), CreateMatrix(0.3f)};
+  std::vector<Matrix> inverseBinds{CreateMatrix(-0.1f), CreateMatrix(-0.2f),
+                                   CreateMatrix(-0.3f)};
+  const auto root = CreateMatrix(1.f);
+
+  std::vector<float> localArray, inverseBindArray;
+  for (size_t i = 0; i < 3; ++i) {
+    localArray.insert(localArray.end(), locals[i].m().begin(), locals[i].m().end());
+    inverseBindArray.insert(inverseBindArray.end(), inverseBinds[i].m().begin(),
+                            inverseBinds[i].m().end());
+  }
+
+  std::vector<float> worlds(3 * 16), target(2 * 16, 0.f);
+  BoneMatrixTools::ComputeWorldMatrices(parents.data(), localArray.data(), root.m().data(),
+                                        worlds.data(), 3);
+  BoneMatrixTools::ComputeSkinningMatrices(matrixIndices.data(), inverseBindArray.data(),
+                                           worlds.data(), target.data(), 3);
+
+  // Same computation with Matrix
+  Matrix world0, world1, world2, skin0, skin2;
+  locals[0].multiplyToRef(root, world0);
+  locals[1].multiplyToRef(world0, world1);
+  locals[2].multiplyToRef(world1, world2);
+  inverseBinds[0].multiplyToRef(world0, skin0);
+  inverseBinds[2].multiplyToRef(world2, skin2);
+
+  EXPECT_TRUE(std::equal(world2.m().begin(), world2.m().end(), worlds.begin() + 32));
+  EXPECT_TRUE(std::equal(skin0.m().begin(), skin0.m().end(), target.begin()));
+  EXPECT_TRUE(std::equal(skin2.m().begin(), skin2.m().end(), target.begin() + 16));
+}
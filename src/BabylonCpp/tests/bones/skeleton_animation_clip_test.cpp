@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/bones/skeleton_animation_clip.h>
+#include <babylon/bones/skeleton_pose_cache.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace {
+
+/**
+ * Skeleton made of a root bone, whose matrix animation translates it along the x axis by one unit
+ * per frame from frame 0 to frame 20, and of a child bone.
+ */
+BABYLON::SkeletonPtr CreateSkeleton(BABYLON::Scene* scene, const std::string& name)
+{
+  using namespace BABYLON;
+
+  auto skeleton = Skeleton::New(name, name, scene);
+  auto root     = Bone::New("root", skeleton.get(), nullptr, Matrix::Identity());
+  Bone::New("child", skeleton.get(), root.get(), Matrix::Translation(0.f, 1.f, 0.f));
+
+  auto animation = Animation::New("root", "_matrix", 30, Animation::ANIMATIONTYPE_MATRIX);
+  animation->setKeys({IAnimationKey(0.f, AnimationValue(Matrix::Identity())),
+                      IAnimationKey(10.f, AnimationValue(Matrix::Translation(10.f, 0.f, 0.f))),
+                      IAnimationKey(20.f, AnimationValue(Matrix::Translation(20.f, 0.f, 0.f)))});
+  root->animations.emplace_back(animation);
+  skeleton->createAnimationRange("walk", 10.f, 20.f);
+  return skeleton;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSkeletonAnimationClip, FromAnimationRange)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto skeleton = CreateSkeleton(scene.get(), "skeleton");
+  EXPECT_EQ(SkeletonAnimationClip::FromAnimationRange(skeleton.get(), "run"), nullptr);
+
+  // Only the animated bones have a track, whose frames start at the beginning of the range
+  const auto clip = SkeletonAnimationClip::FromAnimationRange(skeleton.get(), "walk");
+  ASSERT_NE(clip, nullptr);
+  EXPECT_EQ(clip->name, "walk");
+  EXPECT_FLOAT_EQ(clip->framePerSecond, 30.f);
+  EXPECT_FLOAT_EQ(clip->duration, 10.f);
+  ASSERT_EQ(clip->boneCount(), 1ull);
+  EXPECT_EQ(clip->boneName(0), "root");
+  EXPECT_EQ(clip->findBone("root"), 0);
+  EXPECT_EQ(clip->findBone("child"), -1);
+
+  std::vector<Matrix> localMatrices;
+  clip->evaluate(2.5f, localMatrices);
+  ASSERT_EQ(localMatrices.size(), 1ull);
+  EXPECT_NEAR(localMatrices[0].getTranslation().x, 12.5f, 1e-4f);
+  clip->evaluate(100.f, localMatrices);
+  EXPECT_NEAR(localMatrices[0].getTranslation().x, 20.f, 1e-4f);
+  EXPECT_GT(clip->memorySize(), sizeof(SkeletonAnimationClip));
+}
+
+TEST(TestSkeletonAnimationClip, FromAnimationGroup)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto bone     = Bone::New("bone", skeleton.get(), nullptr, Matrix::Identity());
+
+  // The bones loaded from glTF files are driven by transform nodes animated by their position,
+  // rotationQuaternion and scaling
+  auto node = TransformNode::New("node", scene.get());
+  node->scaling().copyFromFloats(2.f, 2.f, 2.f);
+  bone->linkTransformNode(node);
+
+  auto position = Animation::New("position", "position", 1, Animation::ANIMATIONTYPE_VECTOR3);
+  position->setKeys({IAnimationKey(0.f, AnimationValue(Vector3::Zero())),
+                     IAnimationKey(2.f, AnimationValue(Vector3(4.f, 0.f, 0.f)))});
+  auto axis                   = Vector3::Up();
+  const auto expectedRotation = Quaternion::RotationAxis(axis, Math::PI_2);
+  auto rotation
+    = Animation::New("rotation", "rotationQuaternion", 1, Animation::ANIMATIONTYPE_QUATERNION);
+  rotation->setKeys({IAnimationKey(0.f, AnimationValue(Quaternion::Identity())),
+                     IAnimationKey(1.f, AnimationValue(expectedRotation))});
+  auto group = AnimationGroup::New("group", scene.get());
+  EXPECT_EQ(SkeletonAnimationClip::FromAnimationGroup(skeleton.get(), *group), nullptr);
+  group->addTargetedAnimation(position, node);
+  group->addTargetedAnimation(rotation, node);
+
+  const auto clip = SkeletonAnimationClip::FromAnimationGroup(skeleton.get(), *group);
+  ASSERT_NE(clip, nullptr);
+  EXPECT_EQ(clip->name, "group");
+  EXPECT_FLOAT_EQ(clip->framePerSecond, 1.f);
+  EXPECT_FLOAT_EQ(clip->duration, 2.f);
+  ASSERT_EQ(clip->boneCount(), 1ull);
+  EXPECT_EQ(clip->boneName(0), "bone");
+
+  // The channels are sampled at all their key frames, the scaling keeping its rest value
+  std::vector<Matrix> localMatrices;
+  clip->evaluate(1.5f, localMatrices);
+  ASSERT_EQ(localMatrices.size(), 1ull);
+  std::optional<Vector3> scaling         = Vector3::Zero();
+  std::optional<Quaternion> rotationPart = Quaternion::Identity();
+  std::optional<Vector3> translation     = Vector3::Zero();
+  localMatrices[0].decompose(scaling, rotationPart, translation);
+  EXPECT_NEAR(translation->x, 3.f, 1e-4f);
+  EXPECT_NEAR(scaling->x, 2.f, 1e-4f);
+  EXPECT_NEAR(std::abs(Quaternion::Dot(*rotationPart, expectedRotation)), 1.f, 1e-4f);
+}
+
+TEST(TestSkeletonAnimationClip, PlayClip)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto first  = CreateSkeleton(scene.get(), "first");
+  auto second = CreateSkeleton(scene.get(), "second");
+  const auto clip = SkeletonAnimationClip::FromAnimationRange(first.get(), "walk");
+  ASSERT_NE(clip, nullptr);
+
+  // Both skeletons play the clip from the same time of the clock, the second one sharing the pose
+  // evaluated for the first one
+  auto& poseCache = *scene->skeletonPoseCache;
+  first->playClip(clip);
+  second->playClip(clip);
+  poseCache._advance(100.f);
+  first->prepare();
+  second->prepare();
+  EXPECT_EQ(poseCache.getEvaluationCount(), 1ull);
+  EXPECT_EQ(poseCache.getHitCount(), 1ull);
+  EXPECT_NEAR(first->bones[0]->getLocalMatrix().getTranslation().x, 13.f, 1e-4f);
+  EXPECT_NEAR(second->bones[0]->getLocalMatrix().getTranslation().x, 13.f, 1e-4f);
+
+  // The bones which are not animated by the clip are not modified
+  EXPECT_NEAR(first->bones[1]->getLocalMatrix().getTranslation().y, 1.f, 1e-4f);
+
+  // The clip loops
+  poseCache._advance(300.f);
+  first->prepare();
+  EXPECT_NEAR(first->bones[0]->getLocalMatrix().getTranslation().x, 12.f, 1e-4f);
+
+  // A stopped clip leaves the bones in their current pose
+  first->stopClip();
+  EXPECT_FALSE(first->getClipPlayback().has_value());
+  poseCache._advance(100.f);
+  first->prepare();
+  EXPECT_NEAR(first->bones[0]->getLocalMatrix().getTranslation().x, 12.f, 1e-4f);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/bones/skeleton_animation_clip.h>
+#include <babylon/bones/skeleton_pose_cache.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+
+namespace {
+
+/**
+ * Clip of 10 frames translating a bone along the x axis by one unit per frame.
+ */
+BABYLON::SkeletonAnimationClipPtr CreateClip(BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+
+  auto skeleton  = Skeleton::New("skeleton", "skeleton", scene);
+  auto bone      = Bone::New("bone", skeleton.get(), nullptr, Matrix::Identity());
+  auto animation = Animation::New("bone", "_matrix", 60, Animation::ANIMATIONTYPE_MATRIX);
+  animation->setKeys({IAnimationKey(0.f, AnimationValue(Matrix::Identity())),
+                      IAnimationKey(10.f, AnimationValue(Matrix::Translation(10.f, 0.f, 0.f)))});
+  bone->animations.emplace_back(animation);
+  skeleton->createAnimationRange("clip", 0.f, 10.f);
+  return SkeletonAnimationClip::FromAnimationRange(skeleton.get(), "clip");
+}
+
+} // end of anonymous namespace
+
+TEST(TestSkeletonPoseCache, GetPose)
+{
+  using namespace BABYLON;
+
+  auto engine     = createSubject();
+  auto scene      = Scene::New(engine.get());
+  const auto clip = CreateClip(scene.get());
+  ASSERT_NE(clip, nullptr);
+
+  SkeletonPoseCache poseCache;
+  EXPECT_FLOAT_EQ(poseCache.getTime(), 0.f);
+
+  // The poses of the same clip at the same frame are evaluated once
+  const auto& pose = poseCache.getPose(*clip, 2.f);
+  ASSERT_EQ(pose.size(), 1ull);
+  EXPECT_NEAR(pose[0].getTranslation().x, 2.f, 1e-4f);
+  EXPECT_EQ(&poseCache.getPose(*clip, 2.f), &pose);
+  EXPECT_NEAR(poseCache.getPose(*clip, 3.f)[0].getTranslation().x, 3.f, 1e-4f);
+  EXPECT_EQ(poseCache.getEvaluationCount(), 2ull);
+  EXPECT_EQ(poseCache.getHitCount(), 1ull);
+
+  // The cache is cleared when the clock advances
+  poseCache._advance(0.f);
+  poseCache.getPose(*clip, 2.f);
+  EXPECT_EQ(poseCache.getEvaluationCount(), 2ull);
+  poseCache._advance(16.f);
+  EXPECT_FLOAT_EQ(poseCache.getTime(), 16.f);
+  poseCache.getPose(*clip, 2.f);
+  EXPECT_EQ(poseCache.getEvaluationCount(), 3ull);
+  EXPECT_EQ(poseCache.getHitCount(), 2ull);
+}
+
+TEST(TestSkeletonPoseCache, FramePrecision)
+{
+  using namespace BABYLON;
+
+  auto engine     = createSubject();
+  auto scene      = Scene::New(engine.get());
+  const auto clip = CreateClip(scene.get());
+  ASSERT_NE(clip, nullptr);
+
+  // The close frames share the pose of the rounded frame
+  SkeletonPoseCache poseCache;
+  poseCache.framePrecision = 0.5f;
+  EXPECT_NEAR(poseCache.getPose(*clip, 2.1f)[0].getTranslation().x, 2.f, 1e-4f);
+  EXPECT_NEAR(poseCache.getPose(*clip, 1.9f)[0].getTranslation().x, 2.f, 1e-4f);
+  EXPECT_EQ(poseCache.getEvaluationCount(), 1ull);
+  EXPECT_EQ(poseCache.getHitCount(), 1ull);
+
+  // The poses are evaluated each time when the cache is disabled
+  poseCache.enabled        = false;
+  poseCache.framePrecision = 0.f;
+  EXPECT_NEAR(poseCache.getPose(*clip, 2.1f)[0].getTranslation().x, 2.1f, 1e-4f);
+  poseCache.getPose(*clip, 2.1f);
+  EXPECT_EQ(poseCache.getEvaluationCount(), 3ull);
+  EXPECT_EQ(poseCache.getHitCount(), 1ull);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+
+namespace {
+
+/**
+ * Checks the world matrices of the bones, and their transform matrices (inverted absolute
+ * transform * world matrix).
+ */
+void ExpectTransformMatrices(BABYLON::Skeleton& skeleton)
+{
+  using namespace BABYLON;
+
+  skeleton._markAsDirty();
+  skeleton.prepare();
+  const auto& transformMatrices = skeleton.getTransformMatrices(nullptr);
+  ASSERT_EQ(transformMatrices.size(), 16 * (skeleton.bones.size() + 1));
+  for (size_t i = 0; i < skeleton.bones.size(); ++i) {
+    const auto& bone = skeleton.bones[i];
+    Matrix world;
+    if (const auto parent = bone->getParent()) {
+      bone->getLocalMatrix().multiplyToRef(parent->getWorldMatrix(), world);
+    }
+    else {
+      world.copyFrom(bone->getLocalMatrix());
+    }
+    EXPECT_EQ(bone->getWorldMatrix().m(), world.m()) << bone->name;
+
+    Matrix transform;
+    bone->getInvertedAbsoluteTransform().multiplyToRef(world, transform);
+    EXPECT_TRUE(std::equal(transform.m().begin(), transform.m().end(),
+                           transformMatrices.begin() + static_cast<std::ptrdiff_t>(i * 16)))
+      << bone->name;
+  }
+}
+
+void SetLocalMatrix(BABYLON::Bone& bone, const BABYLON::Matrix& matrix)
+{
+  bone.getLocalMatrix().copyFrom(matrix);
+  bone.markAsDirty();
+}
+
+} // end of anonymous namespace
+
+TEST(TestSkeleton, TransformMatrices)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto root  = Bone::New("root", skeleton.get(), nullptr, Matrix::Translation(1.f, 0.f, 0.f));
+  auto child = Bone::New("child", skeleton.get(), root.get(), Matrix::Translation(0.f, 2.f, 0.f));
+  ExpectTransformMatrices(*skeleton);
+
+  // The matrices follow the local matrices of the bones
+  SetLocalMatrix(*root, Matrix::RotationY(0.5f));
+  SetLocalMatrix(*child, Matrix::Scaling(2.f, 2.f, 2.f));
+  ExpectTransformMatrices(*skeleton);
+
+  // And the changes of the hierarchy
+  auto leaf = Bone::New("leaf", skeleton.get(), child.get(), Matrix::Translation(0.f, 0.f, 3.f));
+  ExpectTransformMatrices(*skeleton);
+  leaf->setParent(root.get());
+  SetLocalMatrix(*leaf, Matrix::RotationX(0.25f));
+  ExpectTransformMatrices(*skeleton);
+}
+
+TEST(TestSkeleton, ParentOutsideSkeleton)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto first  = Skeleton::New("first", "first", scene.get());
+  auto parent = Bone::New("parent", first.get(), nullptr, Matrix::Translation(1.f, 0.f, 0.f));
+
+  // The bone parented to a bone of another skeleton is computed from the world matrix of its
+  // parent, on each update
+  auto second = Skeleton::New("second", "second", scene.get());
+  auto bone   = Bone::New("bone", second.get(), parent.get(), Matrix::Translation(0.f, 2.f, 0.f));
+  auto child  = Bone::New("child", second.get(), bone.get(), Matrix::RotationZ(0.5f));
+  first->prepare();
+  ExpectTransformMatrices(*second);
+
+  SetLocalMatrix(*parent, Matrix::Translation(-1.f, 0.f, 4.f));
+  first->prepare();
+  SetLocalMatrix(*child, Matrix::RotationZ(1.f));
+  ExpectTransformMatrices(*second);
+
+  // Until the bone is parented in its skeleton
+  bone->setParent(nullptr);
+  SetLocalMatrix(*bone, Matrix::Translation(0.f, 2.f, 1.f));
+  ExpectTransformMatrices(*second);
+}
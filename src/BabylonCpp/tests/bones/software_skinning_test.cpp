@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/bones/software_skinning.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(TestSoftwareSkinning, MatchesMatrixComputation)
+{
+  using namespace BABYLON;
+
+  // 3 skinning matrices
+  Float32Array matrices;
+  for (const auto seed : {0.2f, -0.7f, 1.3f}) {
+    const auto matrix = Matrix::Compose(Vector3(1.f + seed, 1.f, 1.f - seed),
+                                        Quaternion::RotationYawPitchRoll(seed, -seed, 0.5f * seed),
+                                        Vector3(seed, 2.f * seed, -seed));
+    matrices.insert(matrices.end(), matrix.m().begin(), matrix.m().end());
+  }
+
+  // Vertices using 8 influences, spread over blocks of 3 vertices
+  const size_t vertexCount = 10;
+  Float32Array positions, normals, tangents, indices, weights, indicesExtra, weightsExtra;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto f = static_cast<float>(i);
+    positions.insert(positions.end(), {f, 1.f - f, 0.5f * f});
+    normals.insert(normals.end(), {0.f, 1.f, f});
+    tangents.insert(tangents.end(), {1.f, 0.f, -f, i % 2 ? 1.f : -1.f});
+    indices.insert(indices.end(), {0.f, 1.f, 2.f, 1.f});
+    weights.insert(weights.end(), {0.4f, 0.2f, 0.f, 0.1f});
+    indicesExtra.insert(indicesExtra.end(), {2.f, 0.f, 1.f, 2.f});
+    weightsExtra.insert(weightsExtra.end(), {0.1f, 0.1f, 0.05f, 0.05f});
+  }
+
+  Float32Array skinnedPositions(positions.size()), skinnedNormals(normals.size()),
+    skinnedTangents(tangents.size());
+
+  SoftwareSkinningData data;
+  data.matrices             = matrices.data();
+  data.matrixCount          = 3;
+  data.matricesIndices      = indices.data();
+  data.matricesWeights      = weights.data();
+  data.matricesIndicesExtra = indicesExtra.data();
+  data.matricesWeightsExtra = weightsExtra.data();
+  data.sourcePositions      = positions.data();
+  data.positions            = skinnedPositions.data();
+  data.sourceNormals        = normals.data();
+  data.normals              = skinnedNormals.data();
+  data.sourceTangents       = tangents.data();
+  data.tangents             = skinnedTangents.data();
+  data.vertexCount          = vertexCount;
+  SoftwareSkinning::Apply(data, 3);
+
+  // Same computation as the previous implementation of Mesh::applySkeleton
+  Matrix finalMatrix, tempMatrix;
+  Vector3 expected;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    finalMatrix.reset();
+    for (size_t inf = 0; inf < 8; ++inf) {
+      const auto weight = inf < 4 ? weights[i * 4 + inf] : weightsExtra[i * 4 + inf - 4];
+      const auto index  = inf < 4 ? indices[i * 4 + inf] : indicesExtra[i * 4 + inf - 4];
+      if (weight > 0.f) {
+        Matrix::FromFloat32ArrayToRefScaled(matrices, static_cast<unsigned int>(index * 16),
+                                            weight, tempMatrix);
+        finalMatrix.addToSelf(tempMatrix);
+      }
+    }
+
+    Vector3::TransformCoordinatesFromFloatsToRef(positions[i * 3], positions[i * 3 + 1],
+                                                 positions[i * 3 + 2], finalMatrix, expected);
+    EXPECT_EQ(skinnedPositions[i * 3], expected.x);
+    EXPECT_EQ(skinnedPositions[i * 3 + 1], expected.y);
+    EXPECT_EQ(skinnedPositions[i * 3 + 2], expected.z);
+
+    Vector3::TransformNormalFromFloatsToRef(normals[i * 3], normals[i * 3 + 1],
+                                            normals[i * 3 + 2], finalMatrix, expected);
+    EXPECT_EQ(skinnedNormals[i * 3], expected.x);
+    EXPECT_EQ(skinnedNormals[i * 3 + 1], expected.y);
+    EXPECT_EQ(skinnedNormals[i * 3 + 2], expected.z);
+
+    Vector3::TransformNormalFromFloatsToRef(tangents[i * 4], tangents[i * 4 + 1],
+                                            tangents[i * 4 + 2], finalMatrix, expected);
+    EXPECT_EQ(skinnedTangents[i * 4], expected.x);
+    EXPECT_EQ(skinnedTangents[i * 4 + 1], expected.y);
+    EXPECT_EQ(skinnedTangents[i * 4 + 2], expected.z);
+    EXPECT_EQ(skinnedTangents[i * 4 + 3], tangents[i * 4 + 3]);
+  }
+
+  // Both the scalar and the SSE skinning are checked, whatever the skinning used by the library
+  const auto skinned = std::make_tuple(skinnedPositions, skinnedNormals, skinnedTangents);
+  const auto clear   = [&]() {
+    for (auto stream : {&skinnedPositions, &skinnedNormals, &skinnedTangents}) {
+      std::fill(stream->begin(), stream->end(), 0.f);
+    }
+  };
+  clear();
+  SoftwareSkinning::SkinVerticesScalar(data, 0, vertexCount);
+  EXPECT_EQ(std::tie(skinnedPositions, skinnedNormals, skinnedTangents), skinned);
+  clear();
+  if (SoftwareSkinning::SkinVerticesSSE2(data, 0, vertexCount)) {
+    EXPECT_EQ(std::tie(skinnedPositions, skinnedNormals, skinnedTangents), skinned);
+  }
+}
+
+TEST(TestSoftwareSkinning, ApplySkeleton)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // The top vertices of the box follow the first bone, the bottom ones the second bone
+  BoxOptions options;
+  auto box               = MeshBuilder::CreateBox("box", options, scene.get());
+  const auto positions   = box->getVerticesData(VertexBuffer::PositionKind);
+  const auto normals     = box->getVerticesData(VertexBuffer::NormalKind);
+  const auto vertexCount = positions.size() / 3;
+  Float32Array tangents, indices, weights;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    tangents.insert(tangents.end(), {1.f, 0.f, 0.f, i % 2 ? 1.f : -1.f});
+    indices.insert(indices.end(), {positions[i * 3 + 1] > 0.f ? 0.f : 1.f, 0.f, 0.f, 0.f});
+    weights.insert(weights.end(), {1.f, 0.f, 0.f, 0.f});
+  }
+  box->setVerticesData(VertexBuffer::TangentKind, tangents, false, 4);
+  box->setVerticesData(VertexBuffer::MatricesIndicesKind, indices, false, 4);
+  box->setVerticesData(VertexBuffer::MatricesWeightsKind, weights, false, 4);
+
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto top      = Bone::New("top", skeleton.get(), nullptr, Matrix::Identity());
+  auto bottom   = Bone::New("bottom", skeleton.get(), nullptr, Matrix::Identity());
+  top->getLocalMatrix().copyFrom(Matrix::RotationZ(Math::PI_2));
+  bottom->getLocalMatrix().copyFrom(Matrix::Translation(0.f, 0.f, 5.f));
+  skeleton->_markAsDirty();
+  skeleton->prepare();
+
+  box->applySkeleton(skeleton);
+  const auto& skinnedPositions = box->getSoftwareSkinnedVerticesData(VertexBuffer::PositionKind);
+  const auto& skinnedNormals   = box->getSoftwareSkinnedVerticesData(VertexBuffer::NormalKind);
+  const auto& skinnedTangents  = box->getSoftwareSkinnedVerticesData(VertexBuffer::TangentKind);
+  ASSERT_EQ(skinnedPositions.size(), positions.size());
+  ASSERT_EQ(skinnedNormals.size(), normals.size());
+  ASSERT_EQ(skinnedTangents.size(), tangents.size());
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto x = positions[i * 3];
+    const auto y = positions[i * 3 + 1];
+    const auto z = positions[i * 3 + 2];
+    if (y > 0.f) {
+      // Rotated around the z axis
+      EXPECT_NEAR(skinnedPositions[i * 3], -y, 1e-5f);
+      EXPECT_NEAR(skinnedPositions[i * 3 + 1], x, 1e-5f);
+      EXPECT_NEAR(skinnedNormals[i * 3], -normals[i * 3 + 1], 1e-5f);
+      EXPECT_NEAR(skinnedTangents[i * 4], 0.f, 1e-5f);
+      EXPECT_NEAR(skinnedTangents[i * 4 + 1], 1.f, 1e-5f);
+    }
+    else {
+      // Translated along the z axis, the directions being unchanged
+      EXPECT_NEAR(skinnedPositions[i * 3], x, 1e-5f);
+      EXPECT_NEAR(skinnedPositions[i * 3 + 2], z + 5.f, 1e-5f);
+      EXPECT_NEAR(skinnedNormals[i * 3 + 2], normals[i * 3 + 2], 1e-5f);
+      EXPECT_NEAR(skinnedTangents[i * 4], 1.f, 1e-5f);
+      EXPECT_NEAR(skinnedTangents[i * 4 + 1], 0.f, 1e-5f);
+    }
+    EXPECT_EQ(skinnedTangents[i * 4 + 3], tangents[i * 4 + 3]);
+  }
+
+  // The skinned data is uploaded to the vertex buffers
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), skinnedPositions);
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::TangentKind), skinnedTangents);
+
+  // The mesh is skinned once per frame, from its source data
+  bottom->getLocalMatrix().copyFrom(Matrix::Translation(0.f, 0.f, -5.f));
+  skeleton->_markAsDirty();
+  skeleton->prepare();
+  box->applySkeleton(skeleton);
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), skinnedPositions);
+  scene->incrementRenderId();
+  box->applySkeleton(skeleton);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    if (positions[i * 3 + 1] <= 0.f) {
+      EXPECT_NEAR(skinnedPositions[i * 3 + 2], positions[i * 3 + 2] - 5.f, 1e-5f);
+    }
+  }
+}
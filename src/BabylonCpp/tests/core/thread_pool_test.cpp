@@ -0,0 +1,59 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, enqueue)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  auto result = pool.enqueue([]() { return 40 + 2; });
+  EXPECT_EQ(result.get(), 42);
+}
+
+TEST(TestThreadPool, parallelForCoversRange)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(3);
+  std::vector<int> values(1000, 0);
+  pool.parallelFor(0, values.size(), 7, [&values](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      values[i] += static_cast<int>(i);
+    }
+  });
+  std::vector<int> expected(values.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_THAT(values, ::testing::ContainerEq(expected));
+}
+
+TEST(TestThreadPool, nestedParallelFor)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::atomic<size_t> count{0};
+  pool.parallelFor(0, 8, 1, [&](size_t, size_t) {
+    pool.parallelFor(0, 100, 10, [&](size_t begin, size_t end) { count += end - begin; });
+  });
+  EXPECT_EQ(count.load(), 800ull);
+}
+
+TEST(TestThreadPool, withoutWorkers)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(0);
+  EXPECT_EQ(pool.concurrency(), 1ull);
+  size_t sum = 0;
+  pool.parallelFor(0, 10, 3, [&sum](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      sum += i;
+    }
+  });
+  EXPECT_EQ(sum, 45ull);
+}
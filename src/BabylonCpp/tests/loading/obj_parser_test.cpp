@@ -0,0 +1,155 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/loading/plugins/obj/obj_parser.h>
+
+namespace {
+
+const char* quadObj = R"(# quad
+mtllib quad.mtl
+v 0.0 0.0 0.0
+v 1.0 0.0 0.0
+v 1.0 1.0 0.0
+v 0.0 1.0 0.0
+vt 0.0 0.0
+vt 1.0 0.0
+vt 1.0 1.0
+vt 0.0 1.0
+vn 0.0 0.0 1.0
+g quad
+usemtl red
+f 1/1/1 2/2/1 3/3/1 4/4/1
+)";
+
+} // end of anonymous namespace
+
+TEST(TestOBJParser, parseQuad)
+{
+  using namespace BABYLON;
+
+  const auto result = OBJParser::Parse(quadObj);
+  EXPECT_EQ(result.mtlFileName, "quad.mtl");
+  ASSERT_EQ(result.meshes.size(), 1ull);
+
+  const auto& mesh = result.meshes[0];
+  EXPECT_EQ(mesh.name, "quad");
+  EXPECT_EQ(mesh.materialName, "red");
+  // The quad is split in two triangles sharing 2 vertices, indices are reversed
+  const IndicesArray expectedIndices{3, 2, 0, 2, 1, 0};
+  EXPECT_THAT(mesh.indices, ::testing::ContainerEq(expectedIndices));
+  EXPECT_EQ(mesh.positions.size(), 12ull);
+  EXPECT_EQ(mesh.uvs.size(), 8ull);
+  EXPECT_FLOAT_EQ(mesh.positions[6], 1.f);
+  EXPECT_FLOAT_EQ(mesh.positions[7], 1.f);
+  EXPECT_FLOAT_EQ(mesh.normals[2], 1.f);
+}
+
+TEST(TestOBJParser, faceFormats)
+{
+  using namespace BABYLON;
+
+  const std::string data = "v 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\nvt 0.5 0.5\n"
+                           "f 1 2 3\n"
+                           "f 1//1 2//1 3//1\n"
+                           "f 1/1 2/1 3/1\n"
+                           "f -3/-1/-1 -2/-1/-1 -1/-1/-1\n";
+  const auto result = OBJParser::Parse(data);
+  ASSERT_EQ(result.meshes.size(), 1ull);
+  const auto& mesh = result.meshes[0];
+  EXPECT_TRUE(mesh.name.empty());
+  EXPECT_EQ(mesh.indices.size(), 12ull);
+  // Each face references a different (position, uv, normal) tuple combination
+  EXPECT_EQ(mesh.positions.size(), 12ull * 3);
+  // Indices are reversed, the first triangle is the last face (relative indices)
+  EXPECT_FLOAT_EQ(mesh.positions[mesh.indices[0] * 3 + 1], 1.f);
+  EXPECT_FLOAT_EQ(mesh.uvs[mesh.indices[0] * 2], 0.5f);
+  EXPECT_FLOAT_EQ(mesh.normals[mesh.indices[0] * 3 + 2], 1.f);
+  // Default normal is Up for faces without normals
+  EXPECT_FLOAT_EQ(mesh.normals[mesh.indices[11] * 3 + 1], 1.f);
+}
+
+TEST(TestOBJParser, usemtlSplitsMeshes)
+{
+  using namespace BABYLON;
+
+  const std::string data = "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+                           "o box\nusemtl a\nf 1 2 3\nusemtl b\nf 3 2 1\n";
+  const auto result = OBJParser::Parse(data);
+  ASSERT_EQ(result.meshes.size(), 2ull);
+  EXPECT_EQ(result.meshes[0].name, "box");
+  EXPECT_EQ(result.meshes[0].materialName, "a");
+  EXPECT_EQ(result.meshes[1].name, "box_mm1");
+  EXPECT_EQ(result.meshes[1].materialName, "b");
+  EXPECT_EQ(result.meshes[0].indices.size(), 3ull);
+  EXPECT_EQ(result.meshes[1].indices.size(), 3ull);
+}
+
+TEST(TestOBJParser, vertexColors)
+{
+  using namespace BABYLON;
+
+  OBJParserOptions options;
+  options.importVertexColors = true;
+  const auto result
+    = OBJParser::Parse("v 0 0 0 1 0 0\nv 1 0 0 0 1 0 0.5\nv 0 1 0\nf 1 2 3\n", options);
+  ASSERT_EQ(result.meshes.size(), 1ull);
+  const Float32Array expectedColors{1.f, 0.f, 0.f, 1.f, 0.f, 1.f, 0.f, 0.5f, 0.5f, 0.5f, 0.5f, 1.f};
+  EXPECT_THAT(result.meshes[0].colors, ::testing::ContainerEq(expectedColors));
+}
+
+TEST(TestOBJParser, parallelChunksMatchSerialGeometry)
+{
+  using namespace BABYLON;
+
+  // Grid of quads, each row of quads following its vertices, every other row referencing them
+  // with negative (relative) indices
+  std::string data = "o grid\n";
+  const int64_t size = 40;
+  for (int64_t y = 0; y <= size; ++y) {
+    for (int64_t x = 0; x <= size; ++x) {
+      data += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\n";
+    }
+    if (y == 0) {
+      continue;
+    }
+    const auto offset = (y % 2 == 0) ? 0 : -(y + 1) * (size + 1) - 1;
+    for (int64_t x = 0; x < size; ++x) {
+      const auto i = (y - 1) * (size + 1) + x + 1 + offset;
+      data += "f " + std::to_string(i) + " " + std::to_string(i + 1) + " "
+              + std::to_string(i + size + 2) + " " + std::to_string(i + size + 1) + "\n";
+    }
+  }
+
+  ThreadPool pool(3);
+  OBJParserOptions serialOptions;
+  const auto serial = OBJParser::Parse(data, serialOptions, &pool);
+  OBJParserOptions parallelOptions;
+  parallelOptions.minChunkSize = 256;
+  const auto parallel = OBJParser::Parse(data, parallelOptions, &pool);
+
+  ASSERT_EQ(serial.meshes.size(), 1ull);
+  ASSERT_EQ(parallel.meshes.size(), 1ull);
+  const auto& a = serial.meshes[0];
+  const auto& b = parallel.meshes[0];
+  EXPECT_EQ(a.positions.size(), static_cast<size_t>((size + 1) * (size + 1) * 3));
+  ASSERT_EQ(a.indices.size(), static_cast<size_t>(size * size * 6));
+  ASSERT_EQ(a.indices.size(), b.indices.size());
+  // The relative indices resolve to the corners of a unit quad
+  for (size_t i = 0; i < a.indices.size(); i += 3) {
+    for (size_t c = 0; c < 2; ++c) {
+      const auto u = a.positions[a.indices[i] * 3 + c];
+      const auto v = a.positions[a.indices[i + 1] * 3 + c];
+      const auto w = a.positions[a.indices[i + 2] * 3 + c];
+      EXPECT_LE(std::max({u, v, w}) - std::min({u, v, w}), 1.f);
+    }
+  }
+  // Compare the triangles positions, the index spaces may differ
+  for (size_t i = 0; i < a.indices.size(); ++i) {
+    for (size_t c = 0; c < 3; ++c) {
+      EXPECT_FLOAT_EQ(a.positions[a.indices[i] * 3 + c], b.positions[b.indices[i] * 3 + c]);
+    }
+  }
+}
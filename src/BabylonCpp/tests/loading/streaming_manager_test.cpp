@@ -0,0 +1,123 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include <babylon/loading/streaming/streaming_manager.h>
+
+namespace {
+
+struct FakeFetcher {
+  std::vector<std::string> requests;
+  std::map<std::string, BABYLON::asio::OnSuccessFunction<BABYLON::ArrayBuffer>> pending;
+
+  BABYLON::StreamingManagerOptions::FetchFunction function()
+  {
+    return [this](const std::string& url,
+                  const BABYLON::asio::OnSuccessFunction<BABYLON::ArrayBuffer>& onSuccess,
+                  const BABYLON::asio::OnErrorFunction&) {
+      requests.emplace_back(url);
+      pending[url] = onSuccess;
+    };
+  }
+
+  void complete(const std::string& url, size_t size)
+  {
+    auto callback = pending[url];
+    pending.erase(url);
+    callback(BABYLON::ArrayBuffer(size));
+  }
+};
+
+BABYLON::StreamingAssetOptions makeAsset(const std::string& name, const BABYLON::Vector3& center,
+                                         std::vector<std::string>* evicted = nullptr)
+{
+  using namespace BABYLON;
+  StreamingAssetOptions asset;
+  asset.name   = name;
+  asset.center = center;
+  asset.radius = 1.f;
+  for (const auto& coverage : {0.f, 0.1f, 0.5f}) {
+    StreamingLODLevel level;
+    level.url               = name + std::to_string(asset.levels.size());
+    level.minScreenCoverage = coverage;
+    if (evicted) {
+      level.onEvicted = [evicted, url = level.url]() { evicted->emplace_back(url); };
+    }
+    asset.levels.emplace_back(level);
+  }
+  return asset;
+}
+
+} // end of anonymous namespace
+
+TEST(TestStreamingManager, coarsestLevelsFirstThenByPriority)
+{
+  using namespace BABYLON;
+
+  FakeFetcher fetcher;
+  StreamingManagerOptions options;
+  options.fetch                 = fetcher.function();
+  options.maxConcurrentRequests = 2;
+  StreamingManager manager(nullptr, options);
+
+  const auto far  = manager.addAsset(makeAsset("far", Vector3(0.f, 0.f, 100.f)));
+  const auto near = manager.addAsset(makeAsset("near", Vector3(0.f, 0.f, 2.f)));
+
+  // The nearest asset covers more of the screen, its coarsest level is requested first
+  manager.update(Vector3::Zero(), 1.f);
+  EXPECT_THAT(fetcher.requests, ::testing::ElementsAre("near0", "far0"));
+  EXPECT_EQ(manager.pendingRequests(), 2ull);
+
+  fetcher.complete("far0", 10);
+  fetcher.complete("near0", 10);
+  EXPECT_EQ(manager.residentLevel(far), 0);
+  EXPECT_EQ(manager.residentLevel(near), 0);
+
+  // Only the near asset covers enough of the screen to get finer levels
+  manager.update(Vector3::Zero(), 1.f);
+  EXPECT_THAT(fetcher.requests, ::testing::ElementsAre("near0", "far0", "near1"));
+  fetcher.complete("near1", 10);
+  manager.update(Vector3::Zero(), 1.f);
+  fetcher.complete("near2", 10);
+  EXPECT_EQ(manager.residentLevel(near), 2);
+  EXPECT_EQ(manager.residentBytes(), 40ull);
+}
+
+TEST(TestStreamingManager, coldLevelsAreEvictedOverBudget)
+{
+  using namespace BABYLON;
+
+  FakeFetcher fetcher;
+  std::vector<std::string> evicted;
+  StreamingManagerOptions options;
+  options.fetch        = fetcher.function();
+  options.memoryBudget = 25;
+  options.coldFrames   = 2;
+  StreamingManager manager(nullptr, options);
+
+  const auto asset = manager.addAsset(makeAsset("a", Vector3(0.f, 0.f, 2.f), &evicted));
+  for (size_t i = 0; i < 3; ++i) {
+    manager.update(Vector3::Zero(), 1.f);
+    fetcher.complete("a" + std::to_string(i), 10);
+  }
+  EXPECT_EQ(manager.residentLevel(asset), 2);
+  EXPECT_EQ(manager.residentBytes(), 30ull);
+
+  // Still wanted: over budget but nothing is cold
+  manager.update(Vector3::Zero(), 1.f);
+  EXPECT_TRUE(evicted.empty());
+
+  // The camera moves away, the finest level goes cold
+  const Vector3 farAway(0.f, 0.f, -1000.f);
+  manager.update(farAway, 1.f);
+  EXPECT_TRUE(evicted.empty());
+  manager.update(farAway, 1.f);
+  EXPECT_THAT(evicted, ::testing::ElementsAre("a2"));
+  EXPECT_EQ(manager.residentLevel(asset), 1);
+  EXPECT_EQ(manager.residentBytes(), 20ull);
+
+  // Back within the budget, the remaining cold level is kept
+  manager.update(farAway, 1.f);
+  EXPECT_EQ(manager.residentLevel(asset), 1);
+}
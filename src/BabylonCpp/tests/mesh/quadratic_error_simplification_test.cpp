@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <set>
+
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+namespace {
+
+/**
+ * Flat grid of size x size quads in the unit square, the columns from seamColumn being duplicated
+ * with other indices as if they had other UVs.
+ */
+void CreateGrid(size_t size, size_t seamColumn, BABYLON::Float32Array& positions,
+                BABYLON::IndicesArray& indices, std::vector<size_t>& indexCounts)
+{
+  const auto rowSize = static_cast<uint32_t>(size + 1);
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t y = 0; y <= size; ++y) {
+      for (size_t x = 0; x <= size; ++x) {
+        positions.insert(positions.end(), {static_cast<float>(x) / static_cast<float>(size),
+                                           static_cast<float>(y) / static_cast<float>(size), 0.f});
+      }
+    }
+  }
+
+  for (size_t side = 0; side < 2; ++side) {
+    const auto offset = static_cast<uint32_t>(side * rowSize * rowSize);
+    const auto begin  = indices.size();
+    for (uint32_t y = 0; y < size; ++y) {
+      for (uint32_t x = side == 0 ? 0 : static_cast<uint32_t>(seamColumn);
+           x < (side == 0 ? seamColumn : size); ++x) {
+        const auto i = offset + y * rowSize + x;
+        indices.insert(indices.end(), {i, i + 1, i + rowSize + 1, i, i + rowSize + 1, i + rowSize});
+      }
+    }
+    indexCounts.emplace_back(indices.size() - begin);
+  }
+}
+
+float Area(const BABYLON::Float32Array& positions, const BABYLON::IndicesArray& indices)
+{
+  float area = 0.f;
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    const auto* a = &positions[3 * indices[i + 0]];
+    const auto* b = &positions[3 * indices[i + 1]];
+    const auto* c = &positions[3 * indices[i + 2]];
+    area += 0.5f * ((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]));
+  }
+  return area;
+}
+
+} // end of anonymous namespace
+
+TEST(TestQuadraticErrorSimplification, FlatGrid)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  std::vector<size_t> indexCounts;
+  CreateGrid(16, 16, positions, indices, indexCounts);
+  ASSERT_EQ(indices.size(), 16ull * 16ull * 6ull);
+
+  const auto result = QuadraticErrorSimplification::SimplifyIndices(positions, indices, 0.25f);
+  EXPECT_EQ(result.sourceTriangleCount, 512ull);
+  EXPECT_LE(result.triangleCount, 128ull);
+  EXPECT_GT(result.triangleCount, 0ull);
+  ASSERT_EQ(result.indexCounts.size(), 1ull);
+  EXPECT_EQ(result.indexCounts[0], result.indices.size());
+  EXPECT_NEAR(result.error, 0.f, 1e-3f);
+
+  // The borders are kept and no triangle is flipped, so the covered area is the same
+  EXPECT_NEAR(Area(positions, result.indices), 1.f, 1e-4f);
+  for (size_t i = 0; i < result.indices.size(); i += 3) {
+    const IndicesArray triangle(result.indices.begin() + i, result.indices.begin() + i + 3);
+    EXPECT_GT(Area(positions, triangle), 0.f);
+  }
+}
+
+TEST(TestQuadraticErrorSimplification, Seam)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  std::vector<size_t> indexCounts;
+  CreateGrid(16, 8, positions, indices, indexCounts);
+  const auto sideVertexCount = 17u * 17u;
+
+  const auto result
+    = QuadraticErrorSimplification::SimplifyIndices(positions, indices, 0.25f, indexCounts);
+  EXPECT_LE(result.triangleCount, 128ull);
+  ASSERT_EQ(result.indexCounts.size(), 2ull);
+  EXPECT_EQ(result.indexCounts[0] + result.indexCounts[1], result.indices.size());
+  EXPECT_NEAR(Area(positions, result.indices), 1.f, 1e-4f);
+
+  // Each side keeps its vertices, and both sides keep the same vertices on the seam
+  std::set<float> leftSeam;
+  std::set<float> rightSeam;
+  for (size_t i = 0; i < result.indices.size(); ++i) {
+    const auto index = result.indices[i];
+    const auto left  = i < result.indexCounts[0];
+    EXPECT_EQ(index < sideVertexCount, left);
+    if (positions[3 * index] == 0.5f) {
+      (left ? leftSeam : rightSeam).insert(positions[3 * index + 1]);
+    }
+  }
+  EXPECT_EQ(leftSeam, rightSeam);
+  EXPECT_LT(leftSeam.size(), 17ull);
+}
+
+TEST(TestQuadraticErrorSimplification, Quality)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  std::vector<size_t> indexCounts;
+  CreateGrid(4, 4, positions, indices, indexCounts);
+
+  // Nothing is collapsed at full quality
+  const auto result = QuadraticErrorSimplification::SimplifyIndices(positions, indices, 1.f);
+  EXPECT_EQ(result.indices, indices);
+  EXPECT_FLOAT_EQ(result.error, 0.f);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/ground_mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+/**
+ * Simplifies a ground of 16x16 quads at the qualities 0.5 and 0.25, the levels being simplified
+ * with the asynchronous tasks disabled, and returns the ground.
+ */
+BABYLON::MeshPtr SimplifyGround(BABYLON::Scene* scene, bool parallelProcessing,
+                                size_t& successCount)
+{
+  using namespace BABYLON;
+
+  GroundOptions options;
+  options.subdivisions = 16;
+  auto ground          = MeshBuilder::CreateGround("ground", options, scene);
+  ground->simplify({SimplificationSettings(0.25f, 20.f, false),
+                    SimplificationSettings(0.5f, 10.f, false)},
+                   parallelProcessing, SimplificationType::QUADRATIC,
+                   [&successCount, &ground](Mesh* mesh) {
+                     EXPECT_EQ(mesh, ground.get());
+                     ++successCount;
+                   });
+
+  asio::push_HACK_DISABLE_ASYNC();
+  scene->simplificationQueue()->executeNext();
+  asio::pop_HACK_DISABLE_ASYNC();
+  return ground;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSimplificationQueue, AddLODLevels)
+{
+  using namespace BABYLON;
+
+  for (const auto parallelProcessing : {true, false}) {
+    auto engine         = createSubject();
+    auto scene          = Scene::New(engine.get());
+    size_t successCount = 0;
+    auto ground         = SimplifyGround(scene.get(), parallelProcessing, successCount);
+    EXPECT_EQ(successCount, 1ull);
+    EXPECT_FALSE(scene->simplificationQueue()->running);
+
+    // The levels are sorted from the farthest whatever the order in which they are simplified
+    const auto& lodLevels = ground->getLODLevels();
+    ASSERT_EQ(lodLevels.size(), 2ull);
+    EXPECT_FLOAT_EQ(lodLevels[0]->distance, 20.f);
+    EXPECT_FLOAT_EQ(lodLevels[1]->distance, 10.f);
+    const auto indexCount = ground->getTotalIndices();
+    EXPECT_LT(lodLevels[1]->mesh->getTotalIndices(), indexCount);
+    EXPECT_LT(lodLevels[0]->mesh->getTotalIndices(), lodLevels[1]->mesh->getTotalIndices());
+
+    // All the vertex data are carried over
+    for (const auto& lodLevel : lodLevels) {
+      const auto& mesh = lodLevel->mesh;
+      EXPECT_TRUE(mesh->isVisible);
+      for (const auto& kind :
+           {VertexBuffer::PositionKind, VertexBuffer::NormalKind, VertexBuffer::UVKind}) {
+        EXPECT_TRUE(mesh->isVerticesDataPresent(kind)) << kind;
+      }
+      EXPECT_EQ(mesh->getVerticesData(VertexBuffer::UVKind).size() / 2,
+                mesh->getTotalVertices());
+    }
+  }
+}
+
+TEST(TestSimplificationQueue, ReleasedMesh)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // The task of a mesh released before it runs is skipped
+  GroundOptions options;
+  options.subdivisions = 4;
+  auto ground          = MeshBuilder::CreateGround("ground", options, scene.get());
+  auto successCount    = 0ull;
+  ground->simplify({SimplificationSettings(0.5f, 10.f, false)}, true,
+                   SimplificationType::QUADRATIC, [&successCount](Mesh*) { ++successCount; });
+  ground->dispose();
+  ground = nullptr;
+
+  asio::push_HACK_DISABLE_ASYNC();
+  scene->simplificationQueue()->executeNext();
+  asio::pop_HACK_DISABLE_ASYNC();
+  EXPECT_EQ(successCount, 0ull);
+  EXPECT_FALSE(scene->simplificationQueue()->running);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <babylon/misc/depth_sorter.h>
+
+namespace {
+
+std::vector<uint32_t> StableSortedOrder(const std::vector<float>& depths, bool descending)
+{
+  std::vector<uint32_t> order(depths.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+    return descending ? depths[a] > depths[b] : depths[a] < depths[b];
+  });
+  return order;
+}
+
+} // end of anonymous namespace
+
+TEST(TestDepthSorter, FloatToKey)
+{
+  using namespace BABYLON;
+
+  const std::vector<float> values{-1e30f, -2.5f, -1.f, -1e-30f, 0.f, 1e-30f, 1.f, 2.5f, 1e30f};
+  for (size_t i = 1; i < values.size(); ++i) {
+    EXPECT_LT(DepthSorter::FloatToKey(values[i - 1]), DepthSorter::FloatToKey(values[i]));
+  }
+}
+
+TEST(TestDepthSorter, RadixSort)
+{
+  using namespace BABYLON;
+
+  // Negative and positive depths with duplicates to check the stability
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(-5000, 5000);
+  std::vector<float> depths(10000);
+  for (auto& depth : depths) {
+    depth = static_cast<float>(distribution(generator)) * 0.25f;
+  }
+
+  DepthSorter sorter;
+  EXPECT_EQ(sorter.sort(depths.data(), depths.size()), StableSortedOrder(depths, false));
+  EXPECT_FALSE(sorter.lastSortWasIncremental());
+
+  sorter.reset();
+  EXPECT_EQ(sorter.sort(depths.data(), depths.size(), true), StableSortedOrder(depths, true));
+}
+
+TEST(TestDepthSorter, IncrementalSort)
+{
+  using namespace BABYLON;
+
+  std::vector<float> depths(1000);
+  for (size_t i = 0; i < depths.size(); ++i) {
+    depths[i] = static_cast<float>(depths.size() - i);
+  }
+
+  DepthSorter sorter;
+  sorter.sort(depths.data(), depths.size());
+
+  // A few items moving between two frames only need the insertion sort
+  std::swap(depths[10], depths[20]);
+  depths[995] = 0.5f;
+  const auto order = sorter.sort(depths.data(), depths.size());
+  EXPECT_TRUE(sorter.lastSortWasIncremental());
+  for (size_t i = 1; i < order.size(); ++i) {
+    EXPECT_LE(depths[order[i - 1]], depths[order[i]]);
+  }
+
+  // Reversing the order exceeds the budget of moves
+  sorter.sort(depths.size(), [&depths](size_t i) { return -depths[i]; });
+  EXPECT_FALSE(sorter.lastSortWasIncremental());
+  const auto& reversed = sorter.order();
+  for (size_t i = 1; i < reversed.size(); ++i) {
+    EXPECT_GE(depths[reversed[i - 1]], depths[reversed[i]]);
+  }
+}
@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/constants.h>
+#include <babylon/misc/khronos_texture_container2.h>
+
+namespace {
+
+void WriteUint32(BABYLON::ArrayBuffer& buffer, size_t offset, uint32_t value)
+{
+  for (size_t i = 0; i < 4; ++i) {
+    buffer[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+void WriteUint64(BABYLON::ArrayBuffer& buffer, size_t offset, uint64_t value)
+{
+  WriteUint32(buffer, offset, static_cast<uint32_t>(value));
+  WriteUint32(buffer, offset + 4, static_cast<uint32_t>(value >> 32));
+}
+
+/**
+ * Builds a 2D KTX2 file with the given levels and, if colorModel is not 0, a data format
+ * descriptor with a single sample.
+ */
+BABYLON::ArrayBuffer CreateKTX2File(uint32_t vkFormat, uint32_t width, uint32_t height,
+                                    const std::vector<BABYLON::ArrayBuffer>& levels,
+                                    uint8_t colorModel = 0, uint8_t channelId = 0)
+{
+  const size_t levelIndexOffset = 80;
+  const size_t dfdOffset        = levelIndexOffset + levels.size() * 24;
+  const size_t dfdLength        = colorModel != 0 ? 4 + 24 + 16 : 0;
+  size_t dataOffset             = dfdOffset + dfdLength;
+  size_t size                   = dataOffset;
+  for (const auto& level : levels) {
+    size += level.size();
+  }
+
+  BABYLON::ArrayBuffer file(size, 0);
+  const uint8_t identifier[12]
+    = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+  std::copy(std::begin(identifier), std::end(identifier), file.begin());
+  WriteUint32(file, 12, vkFormat);
+  WriteUint32(file, 16, 1);
+  WriteUint32(file, 20, width);
+  WriteUint32(file, 24, height);
+  WriteUint32(file, 36, 1);
+  WriteUint32(file, 40, static_cast<uint32_t>(levels.size()));
+  WriteUint32(file, 48, static_cast<uint32_t>(dfdOffset));
+  WriteUint32(file, 52, static_cast<uint32_t>(dfdLength));
+  if (colorModel != 0) {
+    WriteUint32(file, dfdOffset, static_cast<uint32_t>(dfdLength));
+    WriteUint32(file, dfdOffset + 8, (24 + 16) << 16);
+    file[dfdOffset + 12]         = colorModel;
+    file[dfdOffset + 4 + 24 + 3] = channelId;
+  }
+  for (size_t i = 0; i < levels.size(); ++i) {
+    WriteUint64(file, levelIndexOffset + i * 24, dataOffset);
+    WriteUint64(file, levelIndexOffset + i * 24 + 8, levels[i].size());
+    WriteUint64(file, levelIndexOffset + i * 24 + 16, levels[i].size());
+    std::copy(levels[i].begin(), levels[i].end(), file.begin() + static_cast<long>(dataOffset));
+    dataOffset += levels[i].size();
+  }
+  return file;
+}
+
+/**
+ * Transcodes UASTC to BC7 or RGBA by filling the levels with the index of the level.
+ */
+class FakeTranscoder : public BABYLON::KTX2Transcoder {
+public:
+  std::string name() const override
+  {
+    return "FakeTranscoder";
+  }
+
+  bool canTranscode(BABYLON::KTX2SourceTextureFormat sourceFormat,
+                    BABYLON::KTX2TranscodeTarget targetFormat, bool) const override
+  {
+    return sourceFormat == BABYLON::KTX2SourceTextureFormat::UASTC4x4
+           && (targetFormat == BABYLON::KTX2TranscodeTarget::BC7_RGBA
+               || targetFormat == BABYLON::KTX2TranscodeTarget::RGBA32);
+  }
+
+  bool transcode(const BABYLON::KTX2TranscodeRequest& request,
+                 BABYLON::Uint8Array& output) override
+  {
+    const auto blockCount = ((request.width + 3) / 4) * ((request.height + 3) / 4);
+    output.assign(blockCount * 16, static_cast<uint8_t>(request.level));
+    return request.encodedByteLength == blockCount * 16;
+  }
+}; // end of class FakeTranscoder
+
+} // end of anonymous namespace
+
+TEST(TestKhronosTextureContainer2, DecodeUncompressed)
+{
+  using namespace BABYLON;
+
+  // 2x2 RGBA8 with its 1x1 mip level
+  const auto file = CreateKTX2File(37, 2, 2, {ArrayBuffer(16, 7), ArrayBuffer(4, 9)});
+  ASSERT_TRUE(KhronosTextureContainer2::IsValid(ArrayBufferView(file)));
+
+  const auto decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.errorMessage.empty());
+  EXPECT_FALSE(decoded.isCompressed);
+  EXPECT_EQ(decoded.internalFormat, Constants::TEXTUREFORMAT_RGBA);
+  ASSERT_EQ(decoded.levels.size(), 2ull);
+  EXPECT_EQ(decoded.levels[1].width, 1);
+  EXPECT_EQ(decoded.levels[1].data, ArrayBuffer(4, 9));
+}
+
+TEST(TestKhronosTextureContainer2, DecodeToRGBA)
+{
+  using namespace BABYLON;
+
+  // 2x1 BGR8, expanded to RGBA
+  auto file    = CreateKTX2File(30, 2, 1, {ArrayBuffer{1, 2, 3, 4, 5, 6}});
+  auto decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.errorMessage.empty());
+  EXPECT_FALSE(decoded.isCompressed);
+  EXPECT_FALSE(decoded.hasAlpha);
+  EXPECT_EQ(decoded.internalFormat, Constants::TEXTUREFORMAT_RGBA);
+  ASSERT_EQ(decoded.levels.size(), 1ull);
+  EXPECT_EQ(decoded.levels[0].data, (Uint8Array{3, 2, 1, 255, 6, 5, 4, 255}));
+
+  // 2x2 level of a BC1 block interpolating red and blue, uploaded as is if S3TC is available
+  const ArrayBuffer bc1Block{0x00, 0xF8, 0x1F, 0x00, 0xE4, 0x00, 0x00, 0x00};
+  file = CreateKTX2File(131, 2, 2, {bc1Block});
+  KTX2DecoderOptions options;
+  options.s3tc = true;
+  decoded      = KhronosTextureContainer2::Decode(ArrayBufferView(file), options);
+  EXPECT_TRUE(decoded.isCompressed);
+  EXPECT_EQ(decoded.internalFormat, Constants::TEXTUREFORMAT_COMPRESSED_RGB_S3TC_DXT1);
+
+  // Decoded otherwise, the pixels of the block outside of the level being skipped
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.errorMessage.empty());
+  EXPECT_FALSE(decoded.isCompressed);
+  EXPECT_EQ(decoded.internalFormat, Constants::TEXTUREFORMAT_RGBA);
+  ASSERT_EQ(decoded.levels.size(), 1ull);
+  EXPECT_EQ(decoded.levels[0].data,
+            (Uint8Array{255, 0, 0, 255, 0, 0, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255}));
+
+  // BC3 block, the alphas of the second pixel interpolating 255 and 0
+  ArrayBuffer bc3Block{255, 0, 0x10, 0, 0, 0, 0, 0};
+  bc3Block.insert(bc3Block.end(), bc1Block.begin(), bc1Block.end());
+  file    = CreateKTX2File(137, 4, 4, {bc3Block});
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.hasAlpha);
+  ASSERT_EQ(decoded.levels.size(), 1ull);
+  ASSERT_EQ(decoded.levels[0].data.size(), 64ull);
+  EXPECT_EQ(decoded.levels[0].data[3], 255);
+  EXPECT_EQ(decoded.levels[0].data[7], 218);
+  EXPECT_EQ(decoded.levels[0].data[11], 255);
+  // The third color of the BC3 blocks interpolates the first two
+  EXPECT_EQ(decoded.levels[0].data[8], 170);
+  EXPECT_EQ(decoded.levels[0].data[10], 85);
+
+  // Truncated level, formats without fallback
+  file    = CreateKTX2File(131, 8, 8, {bc1Block});
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.levels.empty());
+  EXPECT_FALSE(decoded.errorMessage.empty());
+  file    = CreateKTX2File(145, 4, 4, {ArrayBuffer(16, 0)});
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.levels.empty());
+  EXPECT_FALSE(decoded.errorMessage.empty());
+}
+
+TEST(TestKhronosTextureContainer2, TranscodeUASTC)
+{
+  using namespace BABYLON;
+
+  // 8x8 UASTC RGBA (4 blocks) with its 4x4 mip level (1 block)
+  const auto file = CreateKTX2File(0, 8, 8, {ArrayBuffer(64, 1), ArrayBuffer(16, 1)}, 166, 3);
+
+  KhronosTextureContainer2::ClearTranscoders();
+  auto failed = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(failed.levels.empty());
+  EXPECT_FALSE(failed.errorMessage.empty());
+
+  KhronosTextureContainer2::RegisterTranscoder(std::make_shared<FakeTranscoder>());
+
+  // BC7 is preferred to RGBA, ETC2 has no transcoder
+  KTX2DecoderOptions options;
+  options.bptc = true;
+  options.etc2 = true;
+  auto decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), options);
+  EXPECT_TRUE(decoded.errorMessage.empty());
+  EXPECT_TRUE(decoded.hasAlpha);
+  EXPECT_TRUE(decoded.isCompressed);
+  EXPECT_EQ(decoded.internalFormat, Constants::TEXTUREFORMAT_COMPRESSED_RGBA_BPTC_UNORM);
+  EXPECT_EQ(decoded.transcoderName, "FakeTranscoder");
+  ASSERT_EQ(decoded.levels.size(), 2ull);
+  EXPECT_EQ(decoded.levels[1].data, Uint8Array(16, 1));
+
+  // No GPU format available: RGBA fallback
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_FALSE(decoded.isCompressed);
+  EXPECT_EQ(decoded.internalFormat, Constants::TEXTUREFORMAT_RGBA);
+
+  KhronosTextureContainer2::ClearTranscoders();
+}
+
+TEST(TestKhronosTextureContainer2, MalformedFile)
+{
+  using namespace BABYLON;
+
+  KhronosTextureContainer2::ClearTranscoders();
+  KhronosTextureContainer2::RegisterTranscoder(std::make_shared<FakeTranscoder>());
+
+  // Descriptor announcing more samples than it holds: the samples are ignored
+  const size_t dfdOffset = 80 + 24;
+  auto file              = CreateKTX2File(0, 4, 4, {ArrayBuffer(16, 1)}, 166, 3);
+  auto decoded           = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.errorMessage.empty());
+  EXPECT_TRUE(decoded.hasAlpha);
+  WriteUint32(file, dfdOffset + 8, 0xFFFFu << 16);
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.errorMessage.empty());
+  EXPECT_FALSE(decoded.hasAlpha);
+  ASSERT_EQ(decoded.levels.size(), 1ull);
+
+  // Level range wrapping around the 64 bits offsets
+  file = CreateKTX2File(37, 2, 2, {ArrayBuffer(16, 7)});
+  WriteUint64(file, 80, ~uint64_t(0) - 15);
+  WriteUint64(file, 80 + 8, 32);
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.levels.empty());
+  EXPECT_FALSE(decoded.errorMessage.empty());
+
+  // Same for the supercompression global data
+  file = CreateKTX2File(37, 2, 2, {ArrayBuffer(16, 7)});
+  WriteUint64(file, 64, ~uint64_t(0));
+  WriteUint64(file, 72, 1);
+  decoded = KhronosTextureContainer2::Decode(ArrayBufferView(file), {});
+  EXPECT_TRUE(decoded.levels.empty());
+  EXPECT_FALSE(decoded.errorMessage.empty());
+
+  KhronosTextureContainer2::ClearTranscoders();
+}
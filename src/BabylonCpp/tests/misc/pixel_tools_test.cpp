@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/structs.h>
+#include <babylon/misc/pixel_tools.h>
+
+TEST(TestPixelTools, FlipVertically)
+{
+  using namespace BABYLON;
+
+  std::vector<uint8_t> pixels{1, 2, 3, 4, 5, 6};
+  PixelTools::FlipVertically(pixels.data(), 2, 3);
+  const std::vector<uint8_t> expected{5, 6, 3, 4, 1, 2};
+  EXPECT_EQ(pixels, expected);
+}
+
+TEST(TestPixelTools, ExpandToRGBA)
+{
+  using namespace BABYLON;
+
+  // With OPTION_ENABLE_SIMD, enough pixels for a full SSE iteration and a scalar tail
+  const size_t pixelCount = 11;
+  std::vector<uint8_t> rgb(pixelCount * 3);
+  for (size_t i = 0; i < rgb.size(); ++i) {
+    rgb[i] = static_cast<uint8_t>(i);
+  }
+  std::vector<uint8_t> rgba(pixelCount * 4);
+  PixelTools::ExpandToRGBA(rgb.data(), 3, rgba.data(), pixelCount);
+  for (size_t i = 0; i < pixelCount; ++i) {
+    EXPECT_EQ(rgba[i * 4 + 0], rgb[i * 3 + 0]);
+    EXPECT_EQ(rgba[i * 4 + 1], rgb[i * 3 + 1]);
+    EXPECT_EQ(rgba[i * 4 + 2], rgb[i * 3 + 2]);
+    EXPECT_EQ(rgba[i * 4 + 3], 255);
+  }
+
+  const std::vector<uint8_t> greyAlpha{10, 20};
+  PixelTools::ExpandToRGBA(greyAlpha.data(), 2, rgba.data(), 1);
+  EXPECT_EQ(rgba[0], 10);
+  EXPECT_EQ(rgba[1], 10);
+  EXPECT_EQ(rgba[2], 10);
+  EXPECT_EQ(rgba[3], 20);
+}
+
+TEST(TestPixelTools, PremultiplyAlpha)
+{
+  using namespace BABYLON;
+
+  std::vector<uint8_t> rgba;
+  for (unsigned int i = 0; i < 9; ++i) {
+    rgba.insert(rgba.end(), {255, 128, 1, static_cast<uint8_t>(i * 32)});
+  }
+  const auto source = rgba;
+  PixelTools::PremultiplyAlpha(rgba.data(), 9);
+  for (size_t i = 0; i < rgba.size(); i += 4) {
+    const auto a = source[i + 3];
+    for (size_t c = 0; c < 3; ++c) {
+      const auto expected = static_cast<int>(source[i + c] * a / 255.f + 0.5f);
+      EXPECT_EQ(rgba[i + c], expected);
+    }
+    EXPECT_EQ(rgba[i + 3], a);
+  }
+}
+
+TEST(TestPixelTools, DownsampleRGBA)
+{
+  using namespace BABYLON;
+
+  // 5x3 image, the value of a channel is the column index times 10 plus the row index
+  Image image;
+  image.width  = 5;
+  image.height = 3;
+  image.depth  = 4;
+  for (int y = 0; y < image.height; ++y) {
+    for (int x = 0; x < image.width; ++x) {
+      const auto value = static_cast<uint8_t>(x * 10 + y);
+      image.data.insert(image.data.end(), {value, value, value, 255});
+    }
+  }
+
+  const auto mip = PixelTools::DownsampleRGBA(image);
+  ASSERT_EQ(mip.width, 2);
+  ASSERT_EQ(mip.height, 1);
+  ASSERT_EQ(mip.data.size(), 8ull);
+  // Average of (0, 1, 10, 11) and (20, 21, 30, 31), rounded
+  EXPECT_EQ(mip.data[0], 6);
+  EXPECT_EQ(mip.data[4], 26);
+  EXPECT_EQ(mip.data[7], 255);
+
+  Image pixel;
+  pixel.width  = 1;
+  pixel.height = 1;
+  pixel.depth  = 4;
+  pixel.data   = {1, 2, 3, 4};
+  const auto same = PixelTools::DownsampleRGBA(pixel);
+  EXPECT_EQ(same.width, 1);
+  EXPECT_EQ(same.data, pixel.data);
+}
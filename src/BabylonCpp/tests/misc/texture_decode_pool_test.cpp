@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <babylon/misc/texture_decode_pool.h>
+
+namespace {
+
+/**
+ * Builds an uncompressed 24 bits TGA file (top-left origin) of the given size. The red channel of
+ * a pixel is its column index times 10 plus its row index, the green channel is 100 plus the red
+ * one and the blue channel is 200.
+ */
+BABYLON::ArrayBuffer CreateTGAFile(uint8_t width, uint8_t height)
+{
+  BABYLON::ArrayBuffer file(18, 0);
+  file[2]  = 2; // Uncompressed true-color image
+  file[12] = width;
+  file[14] = height;
+  file[16] = 24;   // Bits per pixel
+  file[17] = 0x20; // Top-left origin
+  for (uint8_t y = 0; y < height; ++y) {
+    for (uint8_t x = 0; x < width; ++x) {
+      const auto red = static_cast<uint8_t>(x * 10 + y);
+      // Stored as BGR
+      file.insert(file.end(), {200, static_cast<uint8_t>(100 + red), red});
+    }
+  }
+  return file;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTextureDecodePool, Decode)
+{
+  using namespace BABYLON;
+
+  const auto decoded = TextureDecodePool::Decode(CreateTGAFile(5, 3));
+  ASSERT_TRUE(decoded.errorMessage.empty());
+  ASSERT_EQ(decoded.image.width, 5);
+  ASSERT_EQ(decoded.image.height, 3);
+  ASSERT_EQ(decoded.image.data.size(), 5ull * 3 * 4);
+  EXPECT_TRUE(decoded.mipMaps.empty());
+  // Last pixel, expanded to RGBA
+  EXPECT_EQ(decoded.image.data[56], 42);
+  EXPECT_EQ(decoded.image.data[57], 142);
+  EXPECT_EQ(decoded.image.data[58], 200);
+  EXPECT_EQ(decoded.image.data[59], 255);
+
+  // The first row is at the bottom once flipped
+  TextureDecodeOptions options;
+  options.flipVertically = true;
+  const auto flipped     = TextureDecodePool::Decode(CreateTGAFile(5, 3), options);
+  EXPECT_EQ(flipped.image.data[0], 2);
+  EXPECT_EQ(flipped.image.data[40], 0);
+
+  EXPECT_FALSE(TextureDecodePool::Decode(ArrayBuffer{1, 2, 3}).errorMessage.empty());
+}
+
+TEST(TestTextureDecodePool, GenerateMipMaps)
+{
+  using namespace BABYLON;
+
+  TextureDecodeOptions options;
+  options.generateMipMaps = true;
+  TextureDecodePool pool;
+  const auto decodedImages = pool.decodeAll({CreateTGAFile(5, 3), CreateTGAFile(4, 4)}, options);
+  ASSERT_EQ(decodedImages.size(), 2ull);
+
+  // 5x3, then 2x1 and 1x1
+  const auto& mipMaps = decodedImages[0].mipMaps;
+  ASSERT_EQ(mipMaps.size(), 2ull);
+  EXPECT_EQ(mipMaps[0].width, 2);
+  EXPECT_EQ(mipMaps[0].height, 1);
+  ASSERT_EQ(mipMaps[0].data.size(), 8ull);
+  EXPECT_EQ(mipMaps[1].width, 1);
+  EXPECT_EQ(mipMaps[1].height, 1);
+  ASSERT_EQ(mipMaps[1].data.size(), 4ull);
+  // Average of (0, 1, 10, 11) and (20, 21, 30, 31), rounded, then of both pixels
+  EXPECT_EQ(mipMaps[0].data[0], 6);
+  EXPECT_EQ(mipMaps[0].data[1], 106);
+  EXPECT_EQ(mipMaps[0].data[2], 200);
+  EXPECT_EQ(mipMaps[0].data[3], 255);
+  EXPECT_EQ(mipMaps[0].data[4], 26);
+  EXPECT_EQ(mipMaps[0].data[5], 126);
+  EXPECT_EQ(mipMaps[1].data[0], 16);
+  EXPECT_EQ(mipMaps[1].data[1], 116);
+  EXPECT_EQ(mipMaps[1].data[3], 255);
+
+  // 4x4, then 2x2 and 1x1
+  const auto& squareMipMaps = decodedImages[1].mipMaps;
+  ASSERT_EQ(squareMipMaps.size(), 2ull);
+  EXPECT_EQ(squareMipMaps[0].width, 2);
+  EXPECT_EQ(squareMipMaps[0].height, 2);
+  ASSERT_EQ(squareMipMaps[0].data.size(), 16ull);
+  // Average of (22, 23, 32, 33) at (1, 1)
+  EXPECT_EQ(squareMipMaps[0].data[12], 28);
+  EXPECT_EQ(squareMipMaps[1].width, 1);
+  EXPECT_EQ(squareMipMaps[1].height, 1);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+
+TEST(TestMorphTargetManager, CPUBlending)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  BoxOptions options;
+  auto box             = MeshBuilder::CreateBox("box", options, scene.get());
+  const auto positions = box->getVerticesData(VertexBuffer::PositionKind);
+  const auto normals   = box->getVerticesData(VertexBuffer::NormalKind);
+  ASSERT_FALSE(positions.empty());
+
+  // The target moves the first face only
+  auto moved = positions;
+  for (size_t i = 0; i < 4; ++i) {
+    moved[i * 3] += 1.f;
+  }
+  auto target = MorphTarget::New("target", 0.5f, scene.get());
+  target->setPositions(moved);
+  target->setNormals(normals);
+  auto manager = MorphTargetManager::New(scene.get());
+  manager->addTarget(target);
+  manager->useCPUBlending = true;
+  box->morphTargetManager = manager;
+  const auto denseSize    = (positions.size() + normals.size()) * sizeof(float);
+  EXPECT_EQ(manager->getTargetsMemorySize(), denseSize);
+
+  // The target is blended in the vertex data and only its deltas are kept
+  box->_syncCPUMorphTargets();
+  auto blended = box->getVerticesData(VertexBuffer::PositionKind);
+  ASSERT_EQ(blended.size(), positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    EXPECT_FLOAT_EQ(blended[i], positions[i] + 0.5f * (moved[i] - positions[i]));
+  }
+  EXPECT_TRUE(target->getPositions().empty());
+  EXPECT_TRUE(target->hasPositions());
+  EXPECT_TRUE(target->hasNormals());
+  EXPECT_LT(manager->getTargetsMemorySize() * 10, denseSize);
+
+  // Without influence the data without morphing is restored
+  target->influence = 0.f;
+  box->_syncCPUMorphTargets();
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), positions);
+
+  // Back to the GPU morphing, the targets are dense again
+  target->influence = 1.f;
+  box->_syncCPUMorphTargets();
+  manager->useCPUBlending = false;
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), positions);
+  EXPECT_EQ(target->getPositions(), moved);
+  EXPECT_EQ(target->getNormals(), normals);
+}
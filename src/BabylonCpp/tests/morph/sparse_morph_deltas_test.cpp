@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/morph/sparse_morph_deltas.h>
+
+TEST(TestSparseMorphDeltas, CompressAndAccumulate)
+{
+  using namespace BABYLON;
+
+  // 100 vertices, the target moves one vertex out of ten
+  const size_t vertexCount = 100;
+  Float32Array base, target;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto f = static_cast<float>(i);
+    base.insert(base.end(), {f, -f, 0.5f * f});
+    const auto delta = (i % 10 == 0) ? 0.01f * f : 0.f;
+    target.insert(target.end(), {f + delta, -f - 2.f * delta, 0.5f * f});
+  }
+
+  const auto deltas = SparseMorphDeltas::Compress(base, target, 3);
+  EXPECT_EQ(deltas.vertexCount, vertexCount);
+  EXPECT_EQ(deltas.indices.size(), 9ull);
+  EXPECT_LT(deltas.memorySize() * 10, base.size() * sizeof(float));
+
+  // Half influence on a 3 floats stream
+  auto positions = base;
+  deltas.accumulate(0.5f, positions.data());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    EXPECT_NEAR(positions[i], base[i] + 0.5f * (target[i] - base[i]), 1e-4f);
+  }
+
+  // Full influence on a 4 floats stream (tangents), w is untouched
+  Float32Array tangents;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    tangents.insert(tangents.end(), {base[i * 3], base[i * 3 + 1], base[i * 3 + 2], -1.f});
+  }
+  deltas.accumulate(1.f, tangents.data(), 4);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    for (size_t c = 0; c < 3; ++c) {
+      EXPECT_NEAR(tangents[i * 4 + c], target[i * 3 + c], 1e-4f);
+    }
+    EXPECT_EQ(tangents[i * 4 + 3], -1.f);
+  }
+
+  // Identical streams do not produce deltas
+  EXPECT_TRUE(SparseMorphDeltas::Compress(base, base, 3).empty());
+}
+
+TEST(TestSparseMorphDeltas, ScalarAndSSE2)
+{
+  using namespace BABYLON;
+
+  // Every other vertex is moved, the last one included. The signed zeros of the base data show
+  // the lanes written back by the SSE accumulation.
+  const size_t vertexCount = 9;
+  Float32Array base, target;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto f     = static_cast<float>(i);
+    const auto delta = i % 2 == 0 ? 0.25f * f + 0.5f : 0.f;
+    base.insert(base.end(), {-0.f, f, 2.f * f});
+    target.insert(target.end(), {delta, f - delta, 2.f * f});
+  }
+
+  for (const auto components : {size_t(3), size_t(4)}) {
+    for (const auto stride : {size_t(3), size_t(4)}) {
+      if (stride < components) {
+        continue;
+      }
+      // The deltas of the components, accumulated in a stream of the given stride
+      Float32Array baseData, targetData, stream;
+      for (size_t i = 0; i < vertexCount; ++i) {
+        const auto w = i % 2 == 0 ? 1.f : -0.f;
+        for (size_t c = 0; c < stride; ++c) {
+          if (c < components) {
+            baseData.emplace_back(c < 3 ? base[i * 3 + c] : -0.f);
+            targetData.emplace_back(c < 3 ? target[i * 3 + c] : w);
+          }
+          stream.emplace_back(c < 3 ? base[i * 3 + c] : -0.f);
+        }
+      }
+      const auto deltas = SparseMorphDeltas::Compress(baseData, targetData, components);
+      ASSERT_EQ(deltas.indices.size(), 5ull);
+      ASSERT_EQ(deltas.indices.back(), vertexCount - 1);
+
+      auto scalar = stream;
+      deltas.accumulateScalar(0.75f, scalar.data(), stride);
+      auto simd = stream;
+      if (!deltas.accumulateSSE2(0.75f, simd.data(), stride)) {
+        continue;
+      }
+      // Bit for bit, up to the last component of the last vertex
+      ASSERT_EQ(simd.size(), scalar.size());
+      for (size_t i = 0; i < scalar.size(); ++i) {
+        EXPECT_EQ(std::signbit(simd[i]), std::signbit(scalar[i]))
+          << components << " components, stride " << stride << ", float " << i;
+        EXPECT_EQ(simd[i], scalar[i])
+          << components << " components, stride " << stride << ", float " << i;
+      }
+    }
+  }
+}
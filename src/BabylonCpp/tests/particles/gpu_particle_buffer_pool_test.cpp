@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/buffer.h>
+#include <babylon/particles/gpu_particle_buffer_pool.h>
+
+namespace {
+
+/**
+ * Engine recording the vertex buffers created and updated by the pool.
+ */
+class RecordingEngine : public BABYLON::NullEngine {
+
+public:
+  struct Update {
+    BABYLON::WebGLDataBufferPtr buffer;
+    size_t size;
+    int byteOffset;
+  };
+
+  static std::unique_ptr<RecordingEngine> New()
+  {
+    return std::unique_ptr<RecordingEngine>(new RecordingEngine());
+  }
+
+  BABYLON::WebGLDataBufferPtr createDynamicVertexBuffer(const BABYLON::Float32Array& data) override
+  {
+    createdSizes.emplace_back(data.size());
+    return NullEngine::createDynamicVertexBuffer(data);
+  }
+
+  void updateDynamicVertexBuffer(const BABYLON::WebGLDataBufferPtr& vertexBuffer,
+                                 const BABYLON::Float32Array& data, int byteOffset,
+                                 int /*byteLength*/) override
+  {
+    updates.emplace_back(Update{vertexBuffer, data.size(), byteOffset});
+  }
+
+  std::vector<size_t> createdSizes;
+  std::vector<Update> updates;
+};
+
+} // end of anonymous namespace
+
+TEST(TestGPUParticleBufferPool, RangeAllocation)
+{
+  using namespace BABYLON;
+
+  GPUParticleRangeAllocator allocator(100);
+  const auto a = allocator.allocate(40);
+  const auto b = allocator.allocate(30);
+  const auto c = allocator.allocate(30);
+  EXPECT_EQ(allocator.getPageCount(), 1ull);
+  EXPECT_EQ(a.offset, 0ull);
+  EXPECT_EQ(b.offset, 40ull);
+  EXPECT_EQ(c.offset, 70ull);
+  EXPECT_EQ(allocator.getUsedCount(0), 100ull);
+
+  // The page is full
+  const auto d = allocator.allocate(10);
+  EXPECT_EQ(d.page, 1ull);
+  EXPECT_EQ(d.offset, 0ull);
+
+  // A freed range is reused (first fit)
+  allocator.release(b);
+  const auto e = allocator.allocate(20);
+  EXPECT_EQ(e.page, 0ull);
+  EXPECT_EQ(e.offset, 40ull);
+
+  // Released neighbours are merged
+  allocator.release(a);
+  allocator.release(e);
+  EXPECT_EQ(allocator.getUsedCount(0), 30ull);
+  const auto f = allocator.allocate(70);
+  EXPECT_EQ(f.page, 0ull);
+  EXPECT_EQ(f.offset, 0ull);
+
+  // A range larger than the pages gets its own page
+  const auto g = allocator.allocate(250);
+  EXPECT_EQ(g.page, 2ull);
+  EXPECT_EQ(allocator.getPageCapacity(2), 250ull);
+  EXPECT_EQ(allocator.getPageCount(), 3ull);
+}
+
+TEST(TestGPUParticleBufferPool, SharedBuffers)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  GPUParticleBufferPool pool(scene.get(), 64);
+
+  // The first system creates the two buffers of a page and uploads its particles in both
+  const Float32Array particles(10 * 4, 1.f);
+  const auto a = pool.allocate(4, particles);
+  ASSERT_NE(a.buffers[0], nullptr);
+  ASSERT_NE(a.buffers[1], nullptr);
+  EXPECT_EQ(engine->createdSizes, (std::vector<size_t>{64 * 4, 64 * 4}));
+  ASSERT_EQ(engine->updates.size(), 2ull);
+  EXPECT_EQ(engine->updates[0].buffer, a.buffers[0]->getBuffer());
+  EXPECT_EQ(engine->updates[1].buffer, a.buffers[1]->getBuffer());
+  EXPECT_EQ(engine->updates[0].size, particles.size());
+  EXPECT_EQ(engine->updates[0].byteOffset, 0);
+
+  // The next system with the same layout only uploads its range, after the first one
+  engine->updates.clear();
+  const auto b = pool.allocate(4, Float32Array(20 * 4, 2.f));
+  EXPECT_EQ(engine->createdSizes.size(), 2ull);
+  EXPECT_EQ(b.buffers, a.buffers);
+  EXPECT_EQ(b.range.offset, 10ull);
+  ASSERT_EQ(engine->updates.size(), 2ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, static_cast<int>(10 * 4 * sizeof(float)));
+  EXPECT_EQ(pool.getPageCount(), 1ull);
+
+  // A released range is reused without creating buffers
+  pool.release(a);
+  const auto c = pool.allocate(4, Float32Array(8 * 4, 3.f));
+  EXPECT_EQ(c.range.page, a.range.page);
+  EXPECT_EQ(c.range.offset, 0ull);
+  EXPECT_EQ(engine->createdSizes.size(), 2ull);
+
+  // Another layout, or a full page, gets its own buffers
+  const auto d = pool.allocate(6, Float32Array(10 * 6, 4.f));
+  EXPECT_NE(d.buffers, a.buffers);
+  const auto e = pool.allocate(4, Float32Array(60 * 4, 5.f));
+  EXPECT_EQ(e.range.page, 1ull);
+  EXPECT_EQ(pool.getPageCount(), 3ull);
+  EXPECT_EQ(engine->createdSizes,
+            (std::vector<size_t>{64 * 4, 64 * 4, 64 * 6, 64 * 6, 64 * 4, 64 * 4}));
+
+  pool.dispose();
+  EXPECT_EQ(pool.getPageCount(), 0ull);
+}
+
+TEST(TestGPUParticleBufferPool, SceneDispose)
+{
+  using namespace BABYLON;
+
+  auto engine = RecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  auto& pool  = GPUParticleBufferPool::ForScene(scene.get());
+  EXPECT_EQ(&GPUParticleBufferPool::ForScene(scene.get()), &pool);
+  pool.allocate(4, Float32Array(10 * 4, 1.f));
+  EXPECT_EQ(pool.getPageCount(), 1ull);
+
+  // The pool is released with the scene
+  scene->dispose();
+  EXPECT_EQ(scene->_gpuParticleBufferPool, nullptr);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/particles/particle_arena.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+/**
+ * System emitting from a position, the scene owning it.
+ */
+BABYLON::ParticleSystem* CreateSystem(BABYLON::Scene* scene, size_t capacity, float lifeTime)
+{
+  using namespace BABYLON;
+
+  auto system             = new ParticleSystem("particles", capacity, scene);
+  system->emitter         = Vector3::Zero();
+  system->particleTexture = RawTexture::CreateRGBATexture(
+    ArrayBufferView(Uint8Array{255, 255, 255, 255}), 1, 1, scene);
+  system->emitRate    = 1000.f;
+  system->minLifeTime = lifeTime;
+  system->maxLifeTime = lifeTime;
+  return system;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleArena, RecycleParticles)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto& arena = ParticleArena::ForScene(scene.get());
+
+  // The released particles are acquired again
+  auto system = CreateSystem(scene.get(), 100, 1.f);
+  std::vector<Particle*> particles;
+  for (size_t i = 0; i < 2 * arena.blockSize; ++i) {
+    particles.emplace_back(arena.acquireParticle(system));
+  }
+  const auto particleCount = arena.getParticleCount();
+  EXPECT_GE(particleCount, particles.size());
+  arena.releaseParticles(particles);
+  EXPECT_TRUE(particles.empty());
+  EXPECT_EQ(arena.getFreeParticleCount(), particleCount);
+  // The free list has grown to hold all the particles
+  const auto allocationCount = arena.getAllocationCount();
+  for (size_t i = 0; i < 2 * arena.blockSize; ++i) {
+    particles.emplace_back(arena.acquireParticle(system));
+  }
+  arena.releaseParticles(particles);
+  EXPECT_EQ(arena.getParticleCount(), particleCount);
+  EXPECT_EQ(arena.getAllocationCount(), allocationCount);
+}
+
+TEST(TestParticleArena, RecycleSubSystemsWithoutArenaAllocations)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->createDefaultCamera();
+  scene->useConstantAnimationDeltaTime = true;
+  SceneInstrumentation instrumentation(scene.get());
+  auto& arena = ParticleArena::ForScene(scene.get());
+
+  // Each dying particle starts a short burst of the template, stopped after about ten frames
+  auto templateSystem                = CreateSystem(scene.get(), 10, 0.5f);
+  templateSystem->updateSpeed        = 0.1f;
+  templateSystem->targetStopDuration = 1;
+  auto system                        = CreateSystem(scene.get(), 20, 0.1f);
+  system->emitRate                   = 100.f;
+  system->subEmitters                = {templateSystem};
+  system->start();
+
+  for (size_t frame = 0; frame < 200; ++frame) {
+    scene->render();
+  }
+  EXPECT_GT(arena.getSubSystemCount(), 0ull);
+  EXPECT_GT(arena.getFreeSubSystemCount(), 0ull);
+
+  // Steady state: the ended sub-systems and their particles are reused, so the arena does not
+  // allocate (the counter only sees the allocations of the arena, not all the heap allocations)
+  const auto subSystemCount = arena.getSubSystemCount();
+  for (size_t frame = 0; frame < 100; ++frame) {
+    scene->render();
+    EXPECT_EQ(instrumentation.particleAllocationsCounter().current(), 0ull);
+  }
+  EXPECT_EQ(arena.getSubSystemCount(), subSystemCount);
+}
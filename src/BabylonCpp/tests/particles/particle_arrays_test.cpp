@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/misc/color_gradient.h>
+#include <babylon/misc/factor_gradient.h>
+#include <babylon/particles/particle_arrays.h>
+
+namespace {
+
+/**
+ * Fills the arrays with 11 particles whose properties all differ, a third of them dying during an
+ * update of 0.5.
+ */
+void AddParticles(BABYLON::ParticleArrays& particles)
+{
+  particles.reserve(16);
+  for (size_t i = 0; i < 11; ++i) {
+    const auto p              = particles.add();
+    const auto f              = static_cast<float>(i);
+    particles.lifeTime[p]     = (i % 3 == 1) ? 1.25f : 2.f + 0.1f * f;
+    particles.age[p]          = 0.9f + 0.01f * f;
+    particles.positionX[p]    = f;
+    particles.positionY[p]    = -f;
+    particles.positionZ[p]    = 0.5f * f;
+    particles.directionX[p]   = 1.f + 0.3f * f;
+    particles.directionY[p]   = 2.f - 0.7f * f;
+    particles.directionZ[p]   = 0.2f * f;
+    particles.colorR[p]       = 0.9f;
+    particles.colorStepR[p]   = -0.1f * f;
+    particles.colorA[p]       = 0.5f;
+    particles.colorStepA[p]   = -0.05f * f;
+    particles.angularSpeed[p] = 1.f - 0.2f * f;
+    particles.gradientSeed[p] = 0.09f * f;
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleArrays, UpdateAndRemoveDeadParticles)
+{
+  using namespace BABYLON;
+
+  // 10 particles in blocks of 4, the last 2 particles always taking the scalar path (the full
+  // blocks use SSE with OPTION_ENABLE_SIMD), the odd particles die during the update
+  ParticleArrays particles;
+  particles.reserve(16);
+  for (size_t i = 0; i < 10; ++i) {
+    const auto p              = particles.add();
+    const auto f              = static_cast<float>(i);
+    particles.lifeTime[p]     = (i % 2) ? 1.f + 0.05f * f : 10.f;
+    particles.age[p]          = 1.f;
+    particles.positionX[p]    = f;
+    particles.directionX[p]   = 1.f;
+    particles.directionY[p]   = f;
+    particles.colorA[p]       = 0.1f;
+    particles.colorStepA[p]   = -1.f;
+    particles.angularSpeed[p] = 2.f;
+    particles.gradientSeed[p] = 0.5f;
+  }
+  EXPECT_EQ(particles.count(), 10ull);
+
+  std::vector<FactorGradient> sizeGradients{FactorGradient(0.f, 1.f, 3.f),
+                                            FactorGradient(1.f, 5.f)};
+
+  ParticleArraysUpdate update;
+  update.step          = 0.5f;
+  update.gravity       = Vector3(0.f, -2.f, 0.f);
+  update.sizeGradients = &sizeGradients;
+  update.blockSize     = 4;
+  particles.update(update);
+
+  for (size_t i = 0; i < 10; ++i) {
+    const auto f    = static_cast<float>(i);
+    const auto step = (i % 2) ? particles.lifeTime[i] - 1.f : 0.5f;
+    const auto age  = 1.f + step;
+    EXPECT_FLOAT_EQ(particles.age[i], age);
+    EXPECT_FLOAT_EQ(particles.positionX[i], f + step);
+    EXPECT_FLOAT_EQ(particles.positionY[i], f * step);
+    EXPECT_FLOAT_EQ(particles.directionY[i], f - 2.f * step);
+    EXPECT_FLOAT_EQ(particles.angle[i], 2.f * step);
+    EXPECT_FLOAT_EQ(particles.colorA[i], std::max(0.1f - step, 0.f));
+    // Seed 0.5: 2 at the start, 5 at the end
+    const auto ratio = age / particles.lifeTime[i];
+    EXPECT_NEAR(particles.size[i], 2.f + 3.f * ratio, 1e-5f);
+  }
+
+  // The living particles are kept
+  EXPECT_EQ(particles.removeDeadParticles(), 5ull);
+  ASSERT_EQ(particles.count(), 5ull);
+  std::vector<float> positions(particles.positionX.begin(), particles.positionX.begin() + 5);
+  std::sort(positions.begin(), positions.end());
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_FLOAT_EQ(positions[i], static_cast<float>(2 * i) + 0.5f);
+  }
+}
+
+TEST(TestParticleArrays, ColorGradients)
+{
+  using namespace BABYLON;
+
+  ParticleArrays particles;
+  particles.reserve(5);
+  for (size_t i = 0; i < 5; ++i) {
+    const auto p              = particles.add();
+    particles.lifeTime[p]     = 1.f;
+    particles.age[p]          = 0.25f * static_cast<float>(i) - 0.25f;
+    particles.gradientSeed[p] = 0.f;
+  }
+
+  std::vector<ColorGradient> colorGradients{
+    ColorGradient(0.25f, Color4(1.f, 0.f, 0.f, 1.f), Color4(0.f, 0.f, 0.f, 0.f)),
+    ColorGradient(0.75f, Color4(0.f, 1.f, 0.f, 0.f))};
+
+  ParticleArraysUpdate update;
+  update.step           = 0.25f;
+  update.colorGradients = &colorGradients;
+  particles.update(update);
+
+  // Ratios 0, 0.25, 0.5, 0.75, 1
+  const std::vector<float> expectedRed{1.f, 1.f, 0.5f, 0.f, 0.f};
+  for (size_t i = 0; i < 5; ++i) {
+    EXPECT_FLOAT_EQ(particles.colorR[i], expectedRed[i]);
+    EXPECT_FLOAT_EQ(particles.colorG[i], 1.f - expectedRed[i]);
+    EXPECT_FLOAT_EQ(particles.colorA[i], expectedRed[i]);
+  }
+}
+
+TEST(TestParticleArrays, ScalarAndSSE2)
+{
+  using namespace BABYLON;
+
+  std::vector<FactorGradient> factorGradients{FactorGradient(0.f, 1.f, 3.f),
+                                              FactorGradient(0.6f, 2.f),
+                                              FactorGradient(1.f, 0.5f, 4.f)};
+  std::vector<FactorGradient> limitVelocityGradients{FactorGradient(0.f, 1.5f, 3.f)};
+
+  // Blocks of 6 particles: a group of 4 particles and a tail of 2, then a group of 4 and a tail
+  // of 1
+  ParticleArraysUpdate update;
+  update.step                   = 0.5f;
+  update.gravity                = Vector3(0.f, -9.81f, 0.5f);
+  update.sizeGradients          = &factorGradients;
+  update.angularSpeedGradients  = &factorGradients;
+  update.velocityGradients      = &factorGradients;
+  update.limitVelocityGradients = &limitVelocityGradients;
+  update.dragGradients          = &factorGradients;
+  update.blockSize              = 6;
+
+  std::vector<ColorGradient> colorGradients{
+    ColorGradient(0.f, Color4(1.f, 0.f, 0.f, 1.f), Color4(0.f, 0.f, 1.f, 0.5f)),
+    ColorGradient(0.7f, Color4(0.f, 1.f, 0.f, 0.f))};
+
+  for (const auto withColorGradients : {false, true}) {
+    update.colorGradients = withColorGradients ? &colorGradients : nullptr;
+
+    ParticleArrays scalar;
+    AddParticles(scalar);
+    scalar.updateScalar(update);
+
+    ParticleArrays sse2;
+    AddParticles(sse2);
+    if (!sse2.updateSSE2(update)) {
+      GTEST_SKIP() << "SSE2 is not supported by the target";
+    }
+
+    // Same operations in the same order, so the same bits
+    for (auto stream :
+         {&ParticleArrays::positionX, &ParticleArrays::positionY, &ParticleArrays::positionZ,
+          &ParticleArrays::directionX, &ParticleArrays::directionY, &ParticleArrays::directionZ,
+          &ParticleArrays::colorR, &ParticleArrays::colorG, &ParticleArrays::colorB,
+          &ParticleArrays::colorA, &ParticleArrays::age, &ParticleArrays::size,
+          &ParticleArrays::angle, &ParticleArrays::angularSpeed}) {
+      for (size_t i = 0; i < scalar.count(); ++i) {
+        const auto expected = (scalar.*stream)[i];
+        const auto actual   = (sse2.*stream)[i];
+        EXPECT_TRUE(expected == actual || (std::isnan(expected) && std::isnan(actual)))
+          << "particle " << i << ": " << expected << " != " << actual;
+      }
+    }
+
+    // The same particles are removed, the last ones being moved in the same slots
+    EXPECT_EQ(scalar.removeDeadParticlesScalar(), 4ull);
+    EXPECT_EQ(sse2.removeDeadParticlesSSE2(), std::optional<size_t>{4});
+    ASSERT_EQ(sse2.count(), scalar.count());
+    for (size_t i = 0; i < scalar.count(); ++i) {
+      EXPECT_EQ(sse2.positionX[i], scalar.positionX[i]);
+      EXPECT_EQ(sse2.lifeTime[i], scalar.lifeTime[i]);
+    }
+  }
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/instrumentation/scene_instrumentation.h>
+#include <babylon/particles/particle_budget_manager.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+BABYLON::ParticleBudgetDecision Decision(size_t capacity, float screenSize, bool visible = true,
+                                         float particleScreenArea = 0.f)
+{
+  BABYLON::ParticleBudgetDecision decision;
+  decision.requestedCapacity  = capacity;
+  decision.screenSize         = screenSize;
+  decision.visible            = visible;
+  decision.particleScreenArea = particleScreenArea;
+  return decision;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleBudgetManager, Allocate)
+{
+  using namespace BABYLON;
+
+  ParticleBudgetManager budgetManager(nullptr);
+  budgetManager.maxParticles       = 1000;
+  budgetManager.fullRateScreenSize = 0.1f;
+  budgetManager.maxUpdateInterval  = 4;
+  budgetManager.minWeight          = 0.05f;
+
+  // Within the budget, only the small systems are updated less often
+  std::vector<ParticleBudgetDecision> decisions{Decision(100, 0.5f), Decision(200, 0.04f)};
+  budgetManager.allocate(decisions);
+  EXPECT_EQ(decisions[0].capacity, 100ull);
+  EXPECT_FLOAT_EQ(decisions[0].emitRateScale, 1.f);
+  EXPECT_EQ(decisions[0].updateInterval, 1u);
+  EXPECT_EQ(decisions[1].capacity, 200ull);
+  EXPECT_EQ(decisions[1].updateInterval, 2u);
+
+  // Over the budget, the shares follow the screen sizes
+  budgetManager.maxParticles = 300;
+  decisions = {Decision(400, 0.2f), Decision(400, 0.025f), Decision(400, 0.5f, false)};
+  budgetManager.allocate(decisions);
+  EXPECT_NEAR(static_cast<float>(decisions[0].capacity), 230.8f, 1.f);
+  EXPECT_NEAR(static_cast<float>(decisions[1].capacity), 57.7f, 1.f);
+  EXPECT_NEAR(static_cast<float>(decisions[2].capacity), 11.5f, 1.f);
+  EXPECT_LE(decisions[0].capacity + decisions[1].capacity + decisions[2].capacity, 300ull);
+  EXPECT_NEAR(decisions[0].emitRateScale, 0.577f, 1e-3f);
+  EXPECT_EQ(decisions[1].updateInterval, 4u);
+  EXPECT_EQ(decisions[2].updateInterval, 4u);
+
+  // The overdraw scales all the shares
+  budgetManager.maxParticles = 10000;
+  budgetManager.maxOverdraw  = 1.f;
+  decisions                  = {Decision(1000, 0.5f, true, 0.01f)};
+  budgetManager.allocate(decisions);
+  EXPECT_EQ(decisions[0].capacity, 100ull);
+  EXPECT_NEAR(decisions[0].emitRateScale, 0.1f, 1e-5f);
+}
+
+TEST(TestParticleBudgetManager, UpdateOncePerFrame)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->activeCamera = camera;
+  SceneInstrumentation instrumentation(scene.get());
+
+  // The scene owns the system
+  auto system     = new ParticleSystem("particles", 500, scene.get());
+  system->emitter = Vector3::Zero();
+  system->start();
+
+  auto& budgetManager        = ParticleBudgetManager::ForScene(scene.get());
+  budgetManager.maxParticles = 100;
+  size_t updateCount         = 0;
+  budgetManager.onDecisionsAppliedObservable.add(
+    [&updateCount](ParticleBudgetManager* /*budgetManager*/, EventState& /*es*/) {
+      ++updateCount;
+    });
+
+  // Notified by each camera and rendering group of a frame
+  for (size_t i = 0; i < 3; ++i) {
+    scene->onBeforeParticlesRenderingObservable.notifyObservers(scene.get());
+  }
+  EXPECT_EQ(updateCount, 1ull);
+
+  scene->render();
+  EXPECT_EQ(updateCount, 2ull);
+  ASSERT_EQ(budgetManager.getDecisions().size(), 1ull);
+  EXPECT_GT(budgetManager.getAllowedParticleCount(), 0ull);
+  EXPECT_LE(budgetManager.getAllowedParticleCount(), 100ull);
+
+  // The decisions of the frame are reported by the instrumentation
+  EXPECT_EQ(instrumentation.budgetedParticlesCounter().current(),
+            budgetManager.getAllowedParticleCount());
+  EXPECT_EQ(instrumentation.throttledParticleSystemsCounter().current(), 1ull);
+
+  budgetManager.dispose();
+  EXPECT_TRUE(budgetManager.getDecisions().empty());
+}
+
+TEST(TestParticleBudgetManager, NoScene)
+{
+  using namespace BABYLON;
+
+  // Without a scene, there is nothing to budget
+  ParticleBudgetManager budgetManager(nullptr);
+  budgetManager.update();
+  EXPECT_TRUE(budgetManager.getDecisions().empty());
+  budgetManager.dispose();
+}
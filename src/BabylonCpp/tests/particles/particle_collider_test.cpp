@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/particles/particle_arrays.h>
+#include <babylon/particles/particle_collider.h>
+#include <babylon/particles/signed_distance_field.h>
+
+namespace {
+
+/**
+ * Square of size 4 at y = 0 facing +y.
+ */
+BABYLON::SignedDistanceFieldPtr GroundField()
+{
+  const BABYLON::Float32Array positions{-2.f, 0.f, -2.f, -2.f, 0.f, 2.f,
+                                        2.f,  0.f, -2.f, 2.f,  0.f, 2.f};
+  const BABYLON::Uint32Array indices{0, 2, 1, 1, 2, 3};
+  return BABYLON::SignedDistanceField::FromTriangles(positions, indices, 0.25f);
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleCollider, SignedDistanceField)
+{
+  using namespace BABYLON;
+
+  const auto field = GroundField();
+  ASSERT_NE(field, nullptr);
+  EXPECT_FLOAT_EQ(field->getOrigin().y, -0.75f);
+
+  Vector3 gradient;
+  EXPECT_NEAR(field->sample(Vector3(0.3f, 0.5f, 0.2f), gradient), 0.5f, 1e-4f);
+  EXPECT_NEAR(gradient.x, 0.f, 1e-4f);
+  EXPECT_NEAR(gradient.y, 1.f, 1e-4f);
+  EXPECT_NEAR(gradient.z, 0.f, 1e-4f);
+  EXPECT_NEAR(field->sample(Vector3(-1.1f, -0.3f, 0.7f)), -0.3f, 1e-4f);
+
+  // Outside of the grid the distance to the grid is added
+  EXPECT_NEAR(field->sample(Vector3(0.f, 2.75f, 0.f)), 2.75f, 1e-4f);
+
+  // The batch sampling (4 positions at a time with OPTION_ENABLE_SIMD, then one by one) matches
+  // the single samples
+  const std::vector<float> x{0.1f, -1.3f, 1.7f, 0.45f, 3.f, -0.2f, 0.9f};
+  const std::vector<float> y{0.2f, -0.6f, 0.05f, 0.7f, 0.3f, -2.f, 0.33f};
+  const std::vector<float> z{-0.4f, 1.2f, 0.3f, -1.8f, 0.f, 0.6f, 1.1f};
+  std::vector<float> distances(x.size()), gx(x.size()), gy(x.size()), gz(x.size());
+  field->sample(x.size(), x.data(), y.data(), z.data(), distances.data(), gx.data(), gy.data(),
+                gz.data());
+  for (size_t i = 0; i < x.size(); ++i) {
+    const auto distance = field->sample(Vector3(x[i], y[i], z[i]), gradient);
+    EXPECT_NEAR(distances[i], distance, 1e-5f);
+    EXPECT_NEAR(gx[i], gradient.x, 1e-4f);
+    EXPECT_NEAR(gy[i], gradient.y, 1e-4f);
+    EXPECT_NEAR(gz[i], gradient.z, 1e-4f);
+  }
+}
+
+TEST(TestParticleCollider, SignedDistanceFieldScalarAndSSE2)
+{
+  using namespace BABYLON;
+
+  const auto field = GroundField();
+  ASSERT_NE(field, nullptr);
+
+  // 2 groups of 4 positions and a tail of 3, inside, on the border and outside of the grid along
+  // every axis (the 4th position of each group being outside)
+  const std::vector<float> x{0.1f, -1.3f, 1.7f, 5.f, 0.45f, -2.25f, 0.9f, -9.f, 2.25f, 0.f, -3.f};
+  const std::vector<float> y{0.2f, -0.6f, 0.05f, 0.3f, 0.7f, -0.75f, 0.33f, 1.f, 0.f, 4.f, -2.f};
+  const std::vector<float> z{-0.4f, 1.2f, 0.3f, 0.f, -1.8f, 2.25f, 1.1f, -0.5f, 0.f, 0.f, 7.f};
+  const auto count = x.size();
+  std::vector<float> distances(count), gx(count), gy(count), gz(count);
+  field->sampleScalar(count, x.data(), y.data(), z.data(), distances.data(), gx.data(), gy.data(),
+                      gz.data());
+
+  std::vector<float> sseDistances(count), sseGx(count), sseGy(count), sseGz(count);
+  if (!field->sampleSSE2(count, x.data(), y.data(), z.data(), sseDistances.data(), sseGx.data(),
+                         sseGy.data(), sseGz.data())) {
+    GTEST_SKIP() << "SSE2 is not supported by the target";
+  }
+
+  // Same operations in the same order, so the same bits
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(sseDistances[i], distances[i]) << "position " << i;
+    EXPECT_EQ(sseGx[i], gx[i]) << "position " << i;
+    EXPECT_EQ(sseGy[i], gy[i]) << "position " << i;
+    EXPECT_EQ(sseGz[i], gz[i]) << "position " << i;
+  }
+}
+
+TEST(TestParticleCollider, SignedDistanceFieldFromMeshes)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // Box of size 2 centered at (0, 3, 0), the meshes being read in world space
+  BoxOptions options;
+  options.size = 2.f;
+  auto box     = MeshBuilder::CreateBox("box", options, scene.get());
+  box->position().copyFromFloats(0.f, 3.f, 0.f);
+  const std::vector<AbstractMesh*> meshes{nullptr, box.get()};
+  const auto field = SignedDistanceField::FromMeshes(meshes, 0.25f);
+  ASSERT_NE(field, nullptr);
+  EXPECT_NEAR(field->getOrigin().y, 1.25f, 1e-4f);
+  Vector3 gradient;
+  EXPECT_NEAR(field->sample(Vector3(0.1f, 4.5f, -0.2f), gradient), 0.5f, 1e-4f);
+  EXPECT_NEAR(gradient.y, 1.f, 1e-4f);
+  EXPECT_NEAR(field->sample(Vector3(0.f, 3.8f, 0.1f)), -0.2f, 1e-4f);
+
+  // The field baked asynchronously is the same
+  SignedDistanceFieldPtr bakedField = nullptr;
+  asio::push_HACK_DISABLE_ASYNC();
+  SignedDistanceField::FromMeshesAsync(meshes, 0.25f, 0.f,
+                                       [&bakedField](const SignedDistanceFieldPtr& baked) {
+                                         bakedField = baked;
+                                       });
+  asio::pop_HACK_DISABLE_ASYNC();
+  ASSERT_NE(bakedField, nullptr);
+  EXPECT_TRUE(bakedField->getOrigin().equals(field->getOrigin()));
+  EXPECT_EQ(bakedField->getValues(), field->getValues());
+}
+
+TEST(TestParticleCollider, Collisions)
+{
+  using namespace BABYLON;
+
+  ParticleCollider collider(GroundField());
+  collider.radius      = 0.1f;
+  collider.restitution = 0.5f;
+  collider.friction    = 0.2f;
+
+  // The even particles fall through the ground, the odd ones are above it
+  ParticleArrays particles;
+  particles.reserve(6);
+  for (size_t i = 0; i < 6; ++i) {
+    const auto p            = particles.add();
+    particles.positionX[p]  = -1.f + 0.3f * static_cast<float>(i);
+    particles.positionY[p]  = (i % 2) ? 0.5f : -0.05f;
+    particles.directionX[p] = 1.f;
+    particles.directionY[p] = -2.f;
+  }
+  EXPECT_EQ(collider.collide(particles), 3ull);
+
+  for (size_t i = 0; i < 6; ++i) {
+    if (i % 2) {
+      EXPECT_FLOAT_EQ(particles.positionY[i], 0.5f);
+      EXPECT_FLOAT_EQ(particles.directionY[i], -2.f);
+    }
+    else {
+      EXPECT_NEAR(particles.positionY[i], 0.1f, 1e-4f);
+      EXPECT_NEAR(particles.directionX[i], 0.8f, 1e-4f);
+      EXPECT_NEAR(particles.directionY[i], 1.f, 1e-4f);
+    }
+  }
+
+  // Moving away from the ground, only pushed back
+  Vector3 position(0.f, 0.05f, 0.f);
+  Vector3 velocity(0.f, 1.f, 0.f);
+  EXPECT_TRUE(collider.collide(position, velocity));
+  EXPECT_NEAR(position.y, 0.1f, 1e-4f);
+  EXPECT_FLOAT_EQ(velocity.y, 1.f);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+
+#include <babylon/particles/emittertypes/box_particle_emitter.h>
+#include <babylon/particles/particle_pre_warm_cache.h>
+
+TEST(TestParticlePreWarmCache, GetSetRemove)
+{
+  using namespace BABYLON;
+
+  ParticlePreWarmCache cache;
+  EXPECT_EQ(cache.get("fire"), nullptr);
+
+  auto state               = std::make_shared<ParticlePreWarmState>();
+  state->preWarmCycles     = 100;
+  state->preWarmStepOffset = 2.f;
+  state->updateSpeed       = 0.01f;
+  state->emission.capacity = 500;
+  cache.set("fire", state);
+  cache.set("smoke", std::make_shared<ParticlePreWarmState>());
+  EXPECT_EQ(cache.size(), 2ull);
+  EXPECT_EQ(cache.get("fire"), state);
+
+  cache.remove("fire");
+  EXPECT_EQ(cache.get("fire"), nullptr);
+  EXPECT_EQ(cache.size(), 1ull);
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0ull);
+}
+
+TEST(TestParticlePreWarmCache, Matches)
+{
+  using namespace BABYLON;
+
+  std::shared_ptr<IParticleEmitterType> emitter = std::make_shared<BoxParticleEmitter>();
+
+  ParticlePreWarmState state;
+  state.preWarmCycles     = 100;
+  state.preWarmStepOffset = 2.f;
+  state.updateSpeed       = 0.01f;
+  state.emitRate          = 10.f;
+  state.minLifeTime       = 1.f;
+  state.maxLifeTime       = 2.f;
+  state.emitter           = emitter;
+  state.emission.capacity = 500;
+
+  auto other = [&](const std::function<void(ParticlePreWarmState&)>& change) {
+    ParticlePreWarmState result;
+    result.preWarmCycles     = state.preWarmCycles;
+    result.preWarmStepOffset = state.preWarmStepOffset;
+    result.updateSpeed       = state.updateSpeed;
+    result.emitRate          = state.emitRate;
+    result.minLifeTime       = state.minLifeTime;
+    result.maxLifeTime       = state.maxLifeTime;
+    result.emitter           = state.emitter;
+    result.emission.capacity = state.emission.capacity;
+    change(result);
+    return result;
+  };
+
+  EXPECT_TRUE(state.matches(other([](ParticlePreWarmState&) {})));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.preWarmCycles = 50; })));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.preWarmStepOffset = 1.f; })));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.updateSpeed = 0.02f; })));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.emission.capacity = 1000; })));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.emitRate = 20.f; })));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.minLifeTime = 0.5f; })));
+  EXPECT_FALSE(state.matches(other([](ParticlePreWarmState& s) { s.maxLifeTime = 3.f; })));
+
+  // Another emitter, even with the same type and settings
+  std::shared_ptr<IParticleEmitterType> otherEmitter = std::make_shared<BoxParticleEmitter>();
+  EXPECT_FALSE(state.matches(other([&](ParticlePreWarmState& s) { s.emitter = otherEmitter; })));
+
+  // The particles of a disposed emitter are never reused
+  auto expired = other([](ParticlePreWarmState&) {});
+  emitter.reset();
+  EXPECT_FALSE(state.matches(expired));
+}
+
+TEST(TestParticlePreWarmCache, MoveToEmitter)
+{
+  using namespace BABYLON;
+
+  ParticlePreWarmState state;
+  state.emission.emitterWorldMatrix = Matrix::Translation(1.f, 0.f, 0.f);
+  state.particles.reserve(1);
+  const auto p                      = state.particles.add();
+  state.particles.positionX[p]      = 2.f;
+  state.particles.positionY[p]      = 3.f;
+  state.particles.directionY[p]     = 1.f;
+
+  // The emitter moved by (0, 0, 5) and rotated by 90 degrees around Y
+  const auto world = Matrix::RotationY(Math::PI_2).multiply(Matrix::Translation(1.f, 0.f, 5.f));
+  state.moveToEmitter(world);
+
+  // (1, 3, 0) relative to the emitter, rotated to (0, 3, -1)
+  EXPECT_NEAR(state.particles.positionX[p], 1.f, 1e-5f);
+  EXPECT_NEAR(state.particles.positionY[p], 3.f, 1e-5f);
+  EXPECT_NEAR(state.particles.positionZ[p], 4.f, 1e-5f);
+  EXPECT_NEAR(state.particles.directionX[p], 0.f, 1e-5f);
+  EXPECT_NEAR(state.particles.directionY[p], 1.f, 1e-5f);
+  EXPECT_NEAR(state.particles.directionZ[p], 0.f, 1e-5f);
+  EXPECT_TRUE(state.emission.emitterWorldMatrix.equals(world));
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "../test_utils.h"
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/particles/particle_pre_warm_cache.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+/**
+ * System emitting one particle per pre-warm cycle, living about 50 cycles, so that the number of
+ * pre-warmed particles does not depend on the random values.
+ */
+BABYLON::ParticleSystem* CreateSystem(BABYLON::Scene* scene, const std::string& key, bool async)
+{
+  using namespace BABYLON;
+
+  // The scene owns the system
+  auto system                = new ParticleSystem("particles", 1000, scene);
+  system->emitter            = Vector3::Zero();
+  system->useParticleArrays  = true;
+  system->emitRate           = 100;
+  system->minLifeTime        = 0.5f;
+  system->maxLifeTime        = 0.5f;
+  system->updateSpeed        = 0.01f;
+  system->preWarmCycles      = 100;
+  system->preWarmStepOffset  = 1;
+  system->preWarmAsync       = async;
+  system->preWarmSnapshotKey = key;
+  return system;
+}
+
+size_t PreWarmedCount(const std::string& key)
+{
+  auto snapshot = BABYLON::ParticlePreWarmCache::Default().get(key);
+  return snapshot ? snapshot->particles.count() : 0;
+}
+
+} // end of anonymous namespace
+
+TEST(TestParticleSystemPreWarm, AsyncSwap)
+{
+  using namespace BABYLON;
+
+  if (ThreadPool::Default().size() == 0) {
+    GTEST_SKIP() << "The pre-warm is simulated on the calling thread without worker threads";
+  }
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  CreateSystem(scene.get(), "sync", false)->start();
+  const auto expectedCount = PreWarmedCount("sync");
+  EXPECT_GT(expectedCount, 0ull);
+
+  auto system = CreateSystem(scene.get(), "async", true);
+  system->start();
+  EXPECT_TRUE(system->isPreWarming());
+
+  // The simulation reads the properties copied when the system was started
+  system->emitRate = 1000;
+  system->addSizeGradient(0.f, 1.f);
+
+  // The particles are swapped in by the first animation after the simulation
+  for (size_t i = 0; i < 1000 && system->isPreWarming(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    system->animate();
+  }
+  EXPECT_FALSE(system->isPreWarming());
+  EXPECT_EQ(PreWarmedCount("async"), expectedCount);
+
+  ParticlePreWarmCache::Default().clear();
+}
+
+TEST(TestParticleSystemPreWarm, Cancel)
+{
+  using namespace BABYLON;
+
+  if (ThreadPool::Default().size() == 0) {
+    GTEST_SKIP() << "The pre-warm is simulated on the calling thread without worker threads";
+  }
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // A reset waits for the simulation, whose particles are discarded
+  auto system           = CreateSystem(scene.get(), "cancel", true);
+  system->preWarmCycles = 100000;
+  system->start();
+  EXPECT_TRUE(system->isPreWarming());
+  system->reset();
+  EXPECT_FALSE(system->isPreWarming());
+  system->animate();
+  EXPECT_EQ(ParticlePreWarmCache::Default().get("cancel"), nullptr);
+
+  // So does a restart, the new simulation replacing the previous one
+  system->start();
+  system->start();
+  EXPECT_TRUE(system->isPreWarming());
+
+  // The scene disposes the system while it is pre-warmed
+  scene->dispose();
+  EXPECT_EQ(ParticlePreWarmCache::Default().get("cancel"), nullptr);
+}
+
+TEST(TestParticleSystemPreWarm, Snapshot)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto& cache = ParticlePreWarmCache::Default();
+
+  auto templateSystem = CreateSystem(scene.get(), "snapshot", false);
+  templateSystem->start();
+  const auto snapshot = cache.get("snapshot");
+  ASSERT_NE(snapshot, nullptr);
+  const auto count = snapshot->particles.count();
+  EXPECT_GT(count, 0ull);
+
+  // A system sharing the emitter of the template starts from its particles
+  auto copy                 = CreateSystem(scene.get(), "snapshot", false);
+  copy->particleEmitterType = templateSystem->particleEmitterType;
+  copy->start();
+  EXPECT_EQ(cache.get("snapshot"), snapshot);
+
+  // The systems emitting otherwise simulate their own particles
+  auto faster                 = CreateSystem(scene.get(), "snapshot", false);
+  faster->particleEmitterType = templateSystem->particleEmitterType;
+  faster->emitRate            = 200;
+  faster->start();
+  EXPECT_NE(cache.get("snapshot"), snapshot);
+  EXPECT_GT(PreWarmedCount("snapshot"), count);
+
+  auto other = CreateSystem(scene.get(), "snapshot", false);
+  other->start();
+  EXPECT_EQ(PreWarmedCount("snapshot"), count);
+  EXPECT_FALSE(cache.get("snapshot")->matches(*snapshot));
+
+  cache.clear();
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <babylon/maths/plane.h>
+#include <babylon/particles/point_cloud_octree.h>
+
+namespace {
+
+size_t CountPoints(const BABYLON::PointCloudOctreeNode& node)
+{
+  auto count = node.count();
+  for (const auto& child : node.children) {
+    if (child) {
+      count += CountPoints(*child);
+    }
+  }
+  return count;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPointCloudOctree, AddPoints)
+{
+  using namespace BABYLON;
+
+  // 4x4x4 points in a cube of size 4, the root keeps one point per cell of its 2x2x2 grid
+  PointCloudOctree octree(Vector3(0.f, 0.f, 0.f), Vector3(4.f, 4.f, 4.f), true, 2, 4);
+  Float32Array positions;
+  Float32Array colors;
+  for (int z = 0; z < 4; ++z) {
+    for (int y = 0; y < 4; ++y) {
+      for (int x = 0; x < 4; ++x) {
+        positions.insert(positions.end(), {x + 0.5f, y + 0.5f, z + 0.5f});
+        colors.insert(colors.end(), {1.f, 0.f, 0.f, 1.f});
+      }
+    }
+  }
+  const auto nodes = octree.addPoints(positions.data(), colors.data(), 64);
+
+  auto root = octree.getRoot();
+  EXPECT_EQ(octree.getPointCount(), 64ull);
+  EXPECT_EQ(CountPoints(*root), 64ull);
+  EXPECT_EQ(root->count(), 8ull);
+  EXPECT_EQ(root->colors.size(), 32ull);
+  EXPECT_EQ(root->version, 1ull);
+  EXPECT_EQ(nodes.size(), octree.getNodeCount());
+  EXPECT_FLOAT_EQ(octree.getSpacing(0), 2.f);
+  EXPECT_FLOAT_EQ(octree.getSpacing(1), 1.f);
+
+  // Each child keeps the 8 remaining points of its octant
+  for (const auto& child : root->children) {
+    ASSERT_NE(child, nullptr);
+    EXPECT_EQ(child->depth, 1ull);
+    EXPECT_EQ(child->count(), 7ull);
+  }
+
+  // Points outside of the bounds are clamped
+  const float outside[3] = {10.f, -1.f, 2.f};
+  octree.addPoints(outside, nullptr, 1);
+  EXPECT_EQ(CountPoints(*root), 65ull);
+  EXPECT_EQ(root->version, 1ull);
+}
+
+TEST(TestPointCloudOctree, SelectNodes)
+{
+  using namespace BABYLON;
+
+  PointCloudOctree octree(Vector3(0.f, 0.f, 0.f), Vector3(4.f, 4.f, 4.f), false, 2, 4);
+  Float32Array positions;
+  for (int z = 0; z < 4; ++z) {
+    for (int y = 0; y < 4; ++y) {
+      for (int x = 0; x < 4; ++x) {
+        positions.insert(positions.end(), {x + 0.5f, y + 0.5f, z + 0.5f});
+      }
+    }
+  }
+  octree.addPoints(positions.data(), nullptr, 64);
+
+  // Planes keeping everything
+  const Plane all(0.f, 1.f, 0.f, 100.f);
+  const std::array<Plane, 6> planes{{all, all, all, all, all, all}};
+  std::vector<PointCloudOctreeNode*> nodes;
+
+  // Close camera, all the nodes
+  EXPECT_EQ(octree.selectNodes(planes, Vector3(2.f, 2.f, -10.f), 100.f, 1.f, 1000, nodes), 64ull);
+  EXPECT_EQ(nodes.size(), 9ull);
+  EXPECT_EQ(nodes[0], octree.getRoot());
+
+  // Far camera, the children are too small
+  EXPECT_EQ(octree.selectNodes(planes, Vector3(2.f, 2.f, -1000.f), 100.f, 0.2f, 1000, nodes),
+            8ull);
+  EXPECT_EQ(nodes.size(), 1ull);
+
+  // Budget, the closest children first
+  EXPECT_EQ(octree.selectNodes(planes, Vector3(0.f, 0.f, -10.f), 100.f, 1.f, 22, nodes), 22ull);
+  ASSERT_EQ(nodes.size(), 3ull);
+  EXPECT_EQ(nodes[1], octree.getRoot()->children[0].get());
+
+  // Half space x >= 2.5, the root and the children of the right
+  const Plane right(1.f, 0.f, 0.f, -2.5f);
+  EXPECT_EQ(octree.selectNodes({{right, right, right, right, right, right}},
+                               Vector3(2.f, 2.f, -10.f), 100.f, 1.f, 1000, nodes),
+            8ull + 4 * 7ull);
+  for (size_t i = 1; i < nodes.size(); ++i) {
+    EXPECT_GE(nodes[i]->minimum.x, 2.f);
+  }
+}
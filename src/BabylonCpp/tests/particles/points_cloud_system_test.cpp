@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/particles/cloud_point.h>
+#include <babylon/particles/points_cloud_system.h>
+
+namespace {
+
+// Box of size 2 centered at the given position
+BABYLON::MeshPtr CreateBox(BABYLON::Scene* scene, const BABYLON::Vector3& position)
+{
+  using namespace BABYLON;
+
+  BoxOptions options;
+  options.size = 2.f;
+  auto box     = MeshBuilder::CreateBox("box", options, scene);
+  box->position().copyFrom(position);
+  box->computeWorldMatrix(true);
+  return box;
+}
+
+bool IsInsideBox(const BABYLON::Vector3& point, const BABYLON::Vector3& center)
+{
+  const auto epsilon = 1e-4f;
+  return std::abs(point.x - center.x) <= 1.f + epsilon
+         && std::abs(point.y - center.y) <= 1.f + epsilon
+         && std::abs(point.z - center.z) <= 1.f + epsilon;
+}
+
+bool IsOnBox(const BABYLON::Vector3& point, const BABYLON::Vector3& center)
+{
+  const auto epsilon = 1e-4f;
+  return IsInsideBox(point, center)
+         && (std::abs(std::abs(point.x - center.x) - 1.f) <= epsilon
+             || std::abs(std::abs(point.y - center.y) - 1.f) <= epsilon
+             || std::abs(std::abs(point.z - center.z) - 1.f) <= epsilon);
+}
+
+} // end of anonymous namespace
+
+TEST(TestPointsCloudSystem, AddSurfacePoints)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // The points are placed in the world space of the mesh
+  const Vector3 center(3.f, -2.f, 1.f);
+  auto box = CreateBox(scene.get(), center);
+  PointsCloudSystem pcs("pcs", 1, scene.get());
+  pcs.addSurfacePoints(box, 1000);
+  ASSERT_EQ(pcs.nbParticles, 1000ull);
+  ASSERT_EQ(pcs.particles.size(), 1000ull);
+
+  size_t onSurface = 0;
+  for (const auto& particle : pcs.particles) {
+    onSurface += IsOnBox(particle->position, center) ? 1 : 0;
+    ASSERT_NE(particle->color, nullptr);
+    EXPECT_GE(particle->color->r, 0.f);
+    EXPECT_LE(particle->color->r, 1.f);
+  }
+  EXPECT_EQ(onSurface, 1000ull);
+
+  // The facets sampled in parallel fill consecutive particles
+  for (size_t i = 0; i < pcs.particles.size(); ++i) {
+    EXPECT_EQ(pcs.particles[i]->idx, i);
+  }
+}
+
+TEST(TestPointsCloudSystem, AddSurfacePointsUV)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  auto box = CreateBox(scene.get(), Vector3::Zero());
+  PointsCloudSystem pcs("pcs", 1, scene.get());
+  pcs.addSurfacePoints(box, 500, PointColor::UV);
+  ASSERT_EQ(pcs.particles.size(), 500ull);
+
+  for (const auto& particle : pcs.particles) {
+    ASSERT_NE(particle->uv, nullptr);
+    EXPECT_GE(particle->uv->x, 0.f);
+    EXPECT_LE(particle->uv->x, 1.f);
+    EXPECT_GE(particle->uv->y, 0.f);
+    EXPECT_LE(particle->uv->y, 1.f);
+  }
+}
+
+TEST(TestPointsCloudSystem, AddVolumePoints)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // The rays cast in the mesh by the hierarchy of triangles move the points inside
+  const Vector3 center(-1.f, 4.f, 2.f);
+  auto box = CreateBox(scene.get(), center);
+  PointsCloudSystem pcs("pcs", 1, scene.get());
+  pcs.addVolumePoints(box, 1000);
+  ASSERT_EQ(pcs.particles.size(), 1000ull);
+
+  size_t inside = 0, onSurface = 0;
+  for (const auto& particle : pcs.particles) {
+    inside += IsInsideBox(particle->position, center) ? 1 : 0;
+    onSurface += IsOnBox(particle->position, center) ? 1 : 0;
+  }
+  EXPECT_EQ(inside, 1000ull);
+  EXPECT_LT(onSurface, 100ull);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../test_utils.h"
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/particles/solid_particle.h>
+#include <babylon/particles/solid_particle_system.h>
+
+namespace {
+
+/**
+ * Solid particle system placing its particles on a spiral, the position, rotation, scaling and
+ * color of each particle only depending on its index.
+ */
+class SpiralParticleSystem : public BABYLON::SolidParticleSystem {
+
+public:
+  SpiralParticleSystem(const std::string& name, BABYLON::Scene* scene)
+      : SolidParticleSystem(name, scene)
+  {
+  }
+
+  BABYLON::SolidParticle* updateParticle(BABYLON::SolidParticle* particle) override
+  {
+    const auto i = static_cast<float>(particle->idx);
+    particle->position.copyFromFloats(std::cos(i * 0.1f) * i, i * 0.01f, std::sin(i * 0.1f) * i);
+    particle->rotation.copyFromFloats(i * 0.3f, i * 0.2f, i * 0.1f);
+    particle->scaling.copyFromFloats(1.f + std::fmod(i, 3.f), 1.f, 1.f);
+    particle->color = BABYLON::Color4(std::fmod(i, 7.f) / 7.f, 0.5f, 1.f, 1.f);
+    return particle;
+  }
+
+}; // end of class SpiralParticleSystem
+
+/**
+ * Builds a system of 5000 boxes, sets its particles and returns the system.
+ */
+std::shared_ptr<SpiralParticleSystem> CreateSpiral(BABYLON::Scene* scene, bool parallelUpdate)
+{
+  using namespace BABYLON;
+
+  BoxOptions options;
+  auto box = MeshBuilder::CreateBox("box", options, scene);
+  auto sps = std::make_shared<SpiralParticleSystem>("sps", scene);
+  SolidParticleSystemMeshBuilderOptions shapeOptions;
+  sps->addShape(box, 5000, shapeOptions);
+  sps->buildMesh();
+  box->dispose();
+
+  sps->computeBoundingBox      = true;
+  sps->parallelUpdate          = parallelUpdate;
+  sps->parallelUpdateChunkSize = 256;
+  sps->setParticles();
+  return sps;
+}
+
+void ExpectNear(const BABYLON::Float32Array& actual, const BABYLON::Float32Array& expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-4f) << "index " << i;
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestSolidParticleSystem, ParallelUpdate)
+{
+  using namespace BABYLON;
+
+  auto engine   = createSubject();
+  auto scene    = Scene::New(engine.get());
+  auto serial   = CreateSpiral(scene.get(), false);
+  auto parallel = CreateSpiral(scene.get(), true);
+
+  // The chunks updated in parallel give the vertices and the bounding box of the serial update
+  for (const auto& kind :
+       {VertexBuffer::PositionKind, VertexBuffer::NormalKind, VertexBuffer::ColorKind}) {
+    ExpectNear(parallel->mesh->getVerticesData(kind), serial->mesh->getVerticesData(kind));
+  }
+  const Vector3 minimum = serial->mesh->getBoundingInfo()->minimum();
+  const Vector3 maximum = serial->mesh->getBoundingInfo()->maximum();
+  EXPECT_TRUE(parallel->mesh->getBoundingInfo()->minimum().equalsWithEpsilon(minimum, 1e-4f));
+  EXPECT_TRUE(parallel->mesh->getBoundingInfo()->maximum().equalsWithEpsilon(maximum, 1e-4f));
+
+  // Including when only a range of particles, spanning several chunks, is updated
+  serial->setParticles(1000, 3000);
+  parallel->setParticles(1000, 3000);
+  ExpectNear(parallel->mesh->getVerticesData(VertexBuffer::PositionKind),
+             serial->mesh->getVerticesData(VertexBuffer::PositionKind));
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "../test_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/particles/point_cloud_octree.h>
+#include <babylon/particles/streaming_points_cloud.h>
+
+namespace {
+
+/**
+ * Writes a points file of 16x16x16 colored points in a cube of size 4, the header announcing
+ * pointCount points.
+ */
+std::string WritePointsFile(const std::string& filename, const char* magic, uint64_t pointCount)
+{
+  const auto path = (std::filesystem::temp_directory_path() / filename).string();
+  std::ofstream stream(path, std::ios::binary);
+  const uint32_t flags   = 1;
+  const float minimum[3] = {0.f, 0.f, 0.f};
+  const float maximum[3] = {4.f, 4.f, 4.f};
+  stream.write(magic, 4);
+  stream.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+  stream.write(reinterpret_cast<const char*>(&pointCount), sizeof(pointCount));
+  stream.write(reinterpret_cast<const char*>(minimum), sizeof(minimum));
+  stream.write(reinterpret_cast<const char*>(maximum), sizeof(maximum));
+  for (int z = 0; z < 16; ++z) {
+    for (int y = 0; y < 16; ++y) {
+      for (int x = 0; x < 16; ++x) {
+        const float position[3] = {(x + 0.5f) / 4.f, (y + 0.5f) / 4.f, (z + 0.5f) / 4.f};
+        const uint8_t color[4]  = {255, 0, 0, 255};
+        stream.write(reinterpret_cast<const char*>(position), sizeof(position));
+        stream.write(reinterpret_cast<const char*>(color), sizeof(color));
+      }
+    }
+  }
+  return path;
+}
+
+} // end of anonymous namespace
+
+TEST(TestStreamingPointsCloud, Load)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(2.f, 2.f, -10.f), scene.get());
+  camera->setTarget(Vector3(2.f, 2.f, 2.f));
+  scene->activeCamera = camera;
+
+  // The points are read in chunks on the calling thread
+  const auto path = WritePointsFile("streaming_points_cloud_test.bpc", "BPC1", 4096);
+  StreamingPointsCloud cloud("cloud", scene.get());
+  cloud.chunkSize = 100;
+  cloud.gridSize  = 2;
+  cloud.maxDepth  = 4;
+  auto loaded     = false;
+  asio::push_HACK_DISABLE_ASYNC();
+  cloud.load(path, [&loaded](StreamingPointsCloud* /*cloud*/, bool success) { loaded = success; });
+  asio::pop_HACK_DISABLE_ASYNC();
+  std::filesystem::remove(path);
+  EXPECT_TRUE(loaded);
+  EXPECT_FALSE(cloud.isLoading());
+  EXPECT_EQ(cloud.getLoadedPointCount(), 4096ull);
+
+  // All the points are rendered within the budget
+  scene->setTransformMatrix(camera->getViewMatrix(true), camera->getProjectionMatrix(true));
+  cloud.minNodeSize = 0.f;
+  cloud.update();
+  EXPECT_EQ(cloud.getRenderedPointCount(), 4096ull);
+
+  // The nodes with the largest projected sizes fill a smaller budget
+  cloud.pointBudget = 100;
+  cloud.update();
+  const auto& nodes = cloud.getSelectedNodes();
+  ASSERT_FALSE(nodes.empty());
+  EXPECT_EQ(nodes.front()->depth, 0ull);
+  size_t pointCount = 0;
+  for (const auto node : nodes) {
+    pointCount += node->count();
+  }
+  EXPECT_EQ(cloud.getRenderedPointCount(), pointCount);
+  EXPECT_LE(pointCount, 100ull);
+
+  cloud.dispose();
+}
+
+TEST(TestStreamingPointsCloud, LoadInvalidFile)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  StreamingPointsCloud cloud("cloud", scene.get());
+  cloud.chunkSize = 1000;
+  auto result     = true;
+  const auto onLoaded
+    = [&result](StreamingPointsCloud* /*cloud*/, bool success) { result = success; };
+  asio::push_HACK_DISABLE_ASYNC();
+
+  // Missing file
+  cloud.load((std::filesystem::temp_directory_path() / "missing.bpc").string(), onLoaded);
+  EXPECT_FALSE(result);
+
+  // Wrong magic
+  result    = true;
+  auto path = WritePointsFile("streaming_points_cloud_magic.bpc", "BPC2", 4096);
+  cloud.load(path, onLoaded);
+  std::filesystem::remove(path);
+  EXPECT_FALSE(result);
+  EXPECT_EQ(cloud.getLoadedPointCount(), 0ull);
+
+  // Fewer points than announced, the complete chunks being kept
+  result = true;
+  path   = WritePointsFile("streaming_points_cloud_truncated.bpc", "BPC1", 5000);
+  cloud.load(path, onLoaded);
+  std::filesystem::remove(path);
+  EXPECT_FALSE(result);
+  EXPECT_FALSE(cloud.isLoading());
+  EXPECT_EQ(cloud.getLoadedPointCount(), 4000ull);
+
+  asio::pop_HACK_DISABLE_ASYNC();
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/isize.h>
+#include <babylon/sprites/chunked_sprite_manager.h>
+#include <babylon/sprites/sprite.h>
+
+TEST(TestChunkedSpriteManager, RenderAndPick)
+{
+  using namespace BABYLON;
+
+  auto engine                       = createSubject();
+  engine->getCaps().instancedArrays = true;
+  auto scene                        = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->activeCamera = camera;
+  auto manager
+    = ChunkedSpriteManager::New("manager", "sprites.png", ISize(64, 64), scene.get(), 10.f);
+  ASSERT_EQ(scene->spriteManagers.size(), 1ull);
+
+  // One sprite in front of the camera and one outside of its frustum, in another chunk
+  auto a        = Sprite::New("a", manager);
+  a->isPickable = true;
+  auto b        = Sprite::New("b", manager);
+  b->position   = Vector3(100.f, 0.f, 0.f);
+  scene->render();
+  ASSERT_EQ(manager->getGrid().getChunks().size(), 2ull);
+  EXPECT_EQ(manager->getRenderedChunkCount(), 1ull);
+  size_t record = 0;
+  auto chunk    = manager->getGrid().getChunk(0, record);
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_NE(chunk->_buffer, nullptr);
+  EXPECT_FALSE(chunk->isDirty());
+
+  // Picking along the view direction, in camera space
+  const Ray ray(Vector3::Zero(), Vector3(0.f, 0.f, 1.f));
+  auto pickingInfo = manager->intersects(ray, camera, nullptr, false);
+  ASSERT_TRUE(pickingInfo.has_value());
+  EXPECT_EQ(pickingInfo->pickedSprite, a);
+  EXPECT_NEAR(pickingInfo->distance, 10.f, 1e-4f);
+  EXPECT_TRUE(pickingInfo->pickedPoint->equalsWithEpsilon(Vector3::Zero(), 1e-4f));
+  EXPECT_EQ(manager->multiIntersects(ray, camera, [](Sprite*) { return true; }).size(), 1ull);
+
+  // A sprite moved out of the frustum is neither drawn nor picked once marked as dirty
+  a->position.x = 100.f;
+  a->markAsDirty();
+  scene->render();
+  EXPECT_EQ(manager->getRenderedChunkCount(), 0ull);
+  EXPECT_EQ(manager->getGrid().getChunk(0, record), manager->getGrid().getChunk(1, record));
+  EXPECT_FALSE(manager->intersects(ray, camera, nullptr, false).has_value());
+
+  manager->dispose();
+  EXPECT_TRUE(scene->spriteManagers.empty());
+  EXPECT_EQ(manager->getGrid().getChunk(0, record), nullptr);
+}
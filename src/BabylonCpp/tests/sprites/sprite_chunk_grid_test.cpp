@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <babylon/collisions/picking_info.h>
+#include <babylon/maths/plane.h>
+#include <babylon/sprites/isprite_manager.h>
+#include <babylon/sprites/sprite.h>
+#include <babylon/sprites/sprite_chunk_grid.h>
+
+namespace {
+
+struct TestSpriteManager : public BABYLON::ISpriteManager {
+  std::optional<BABYLON::PickingInfo>
+  intersects(const BABYLON::Ray& /*ray*/, const BABYLON::CameraPtr& /*camera*/,
+             const std::function<bool(BABYLON::Sprite* sprite)>& /*predicate*/,
+             bool /*fastCheck*/) override
+  {
+    return std::nullopt;
+  }
+  std::vector<BABYLON::PickingInfo>
+  multiIntersects(const BABYLON::Ray& /*ray*/, const BABYLON::CameraPtr& /*camera*/,
+                  const std::function<bool(BABYLON::Sprite* sprite)>& /*predicate*/) override
+  {
+    return {};
+  }
+  void render() override
+  {
+  }
+  void dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/) override
+  {
+  }
+};
+
+BABYLON::SpritePtr AddSprite(const std::shared_ptr<TestSpriteManager>& manager,
+                             const BABYLON::Vector3& position)
+{
+  auto sprite      = BABYLON::Sprite::New("sprite", manager);
+  sprite->position = position;
+  return sprite;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSpriteChunkGrid, Update)
+{
+  using namespace BABYLON;
+
+  auto manager = std::make_shared<TestSpriteManager>();
+  auto a       = AddSprite(manager, Vector3(1.f, 1.f, 1.f));
+  auto b       = AddSprite(manager, Vector3(15.f, 1.f, 1.f));
+  auto c       = AddSprite(manager, Vector3(2.f, 3.f, 4.f));
+  c->cellIndex = 5;
+
+  SpriteChunkGrid grid(10.f);
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  ASSERT_EQ(grid.getChunks().size(), 2ull);
+
+  size_t record = 0;
+  auto chunk    = grid.getChunk(2, record);
+  ASSERT_NE(chunk, nullptr);
+  EXPECT_EQ(chunk, grid.getChunk(0, record));
+  EXPECT_EQ(chunk->count(), 2ull);
+  EXPECT_TRUE(chunk->isDirty());
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize + 8], 0.25f);
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize + 9], 0.25f);
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize + 10], 0.25f);
+
+  // Only the records of the sprites marked as dirty are rebuilt
+  for (const auto& gridChunk : grid.getChunks()) {
+    gridChunk->clearDirty();
+  }
+  c->color = Color4(1.f, 0.f, 0.f, 1.f);
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  for (const auto& gridChunk : grid.getChunks()) {
+    EXPECT_FALSE(gridChunk->isDirty());
+  }
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize + 13], 1.f);
+  c->markAsDirty();
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  EXPECT_EQ(chunk->dirtyStart, 1ull);
+  EXPECT_EQ(chunk->dirtyEnd, 2ull);
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize + 13], 0.f);
+  EXPECT_FALSE(c->_isDirty);
+
+  // And all of them with a new sprite sheet
+  for (const auto& gridChunk : grid.getChunks()) {
+    gridChunk->clearDirty();
+  }
+  grid.update(manager->sprites, 512.f, 512.f, 64, 64);
+  EXPECT_EQ(chunk->dirtyStart, 0ull);
+  EXPECT_EQ(chunk->dirtyEnd, 2ull);
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize + 8], 0.625f);
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+
+  // Sprite moving to another cell
+  b->position.x = 3.f;
+  b->markAsDirty();
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  EXPECT_EQ(chunk->count(), 3ull);
+  EXPECT_EQ(grid.getChunk(1, record), chunk);
+  EXPECT_EQ(record, 2ull);
+  EXPECT_FLOAT_EQ(chunk->instanceData[record * SpriteChunkGrid::InstanceSize], 3.f);
+
+  // Sprite removed from the list, the last record fills its hole
+  a->dispose();
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  EXPECT_EQ(chunk->count(), 2ull);
+  EXPECT_EQ(grid.getChunk(0, record), chunk);
+  EXPECT_EQ(record, 0ull);
+  EXPECT_FLOAT_EQ(chunk->instanceData[0], 3.f);
+  EXPECT_EQ(grid.getChunk(1, record), chunk);
+  EXPECT_EQ(record, 1ull);
+  EXPECT_FLOAT_EQ(chunk->instanceData[SpriteChunkGrid::InstanceSize], 2.f);
+
+  // Culling with the half space x >= 10
+  auto d = AddSprite(manager, Vector3(25.f, 0.f, 0.f));
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  const Plane plane(1.f, 0.f, 0.f, -10.f);
+  std::vector<SpriteChunk*> visibleChunks;
+  grid.getVisibleChunks({{plane, plane, plane, plane, plane, plane}}, visibleChunks);
+  ASSERT_EQ(visibleChunks.size(), 1ull);
+  EXPECT_EQ(visibleChunks[0], grid.getChunk(2, record));
+
+  // Hidden sprites are not in the bounds
+  d->isVisible = false;
+  d->markAsDirty();
+  grid.update(manager->sprites, 256.f, 256.f, 64, 64);
+  grid.getVisibleChunks({{plane, plane, plane, plane, plane, plane}}, visibleChunks);
+  EXPECT_TRUE(visibleChunks.empty());
+}
@@ -24,6 +24,8 @@ public:
   void bindBuffer(GLenum target, IGLBuffer* buffer) override;
   void bindFramebuffer(GLenum target, IGLFramebuffer* framebuffer) override;
   void bindBufferBase(GLenum target, GLuint index, IGLBuffer* buffer) override;
+  void bindBufferRange(GLenum target, GLuint index, IGLBuffer* buffer, GLintptr offset,
+                       GLsizeiptr size) override;
   void bindRenderbuffer(GLenum target, IGLRenderbuffer* renderbuffer) override;
   void bindTexture(GLenum target, IGLTexture* texture) override;
   void bindTransformFeedback(GLenum target, IGLTransformFeedback* transformFeedback) override;
@@ -66,15 +66,16 @@ struct BABYLON_SHARED_EXPORT AnimationGridComponent {
       auto& _animationControl = animationReservedDataStore._animationControl;
       if (!_animations.empty()) {
         for (const auto& animation : _animations) {
-          const auto& keys = animation->getKeys();
+          // Read without getKeys(), which would compile the keys again
+          const auto keyCount = animation->getKeyCount();
 
-          if (!keys.empty()) {
-            if (keys[0].frame < _animationControl.from) {
-              _animationControl.from = keys[0].frame;
+          if (keyCount > 0) {
+            if (animation->getKeyFrame(0) < _animationControl.from) {
+              _animationControl.from = animation->getKeyFrame(0);
             }
-            auto lastKeyIndex = keys.size() - 1;
-            if (keys[lastKeyIndex].frame > _animationControl.to) {
-              _animationControl.to = keys[lastKeyIndex].frame;
+            auto lastKeyIndex = keyCount - 1;
+            if (animation->getKeyFrame(lastKeyIndex) > _animationControl.to) {
+              _animationControl.to = animation->getKeyFrame(lastKeyIndex);
             }
           }
         }
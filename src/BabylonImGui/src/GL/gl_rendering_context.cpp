@@ -233,6 +233,12 @@ void GLRenderingContext::bindBufferBase(GLenum target, GLuint index, IGLBuffer*
   glBindBufferBase(target, index, buffer ? buffer->value : 0);
 }
 
+void GLRenderingContext::bindBufferRange(GLenum target, GLuint index, IGLBuffer* buffer,
+                                         GLintptr offset, GLsizeiptr size)
+{
+  glBindBufferRange(target, index, buffer ? buffer->value : 0, offset, size);
+}
+
 void GLRenderingContext::bindRenderbuffer(GLenum target, IGLRenderbuffer* renderbuffer)
 {
   glBindRenderbuffer(target, renderbuffer ? renderbuffer->value : 0);